@@ -0,0 +1,191 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares batch interleaved small matrix operations with the per matrix
+// approach of exercises/permuted-layout-batch-matrix-multiply.cpp, each
+// matrix stored contiguously and processed with scalar code.
+//
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+namespace batched = RAJA::expt::batched;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using batch_exec = RAJA::omp_parallel_for_exec;
+#else
+using batch_exec = RAJA::loop_exec;
+#endif
+
+static std::vector<double> make_values(size_t N)
+{
+  std::mt19937 rng(N);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> values(N);
+  for (double& v : values) {
+    v = dist(rng);
+  }
+  return values;
+}
+
+//! diagonally dominant so LU without pivoting is stable
+static std::vector<double> make_matrices(camp::idx_t num_batch, camp::idx_t n)
+{
+  std::vector<double> values = make_values(num_batch * n * n);
+  for (camp::idx_t b = 0; b < num_batch; ++b) {
+    for (camp::idx_t i = 0; i < n; ++i) {
+      values[(b * n + i) * n + i] += n;
+    }
+  }
+  return values;
+}
+
+template < camp::idx_t N >
+static void benchmark_gemm_per_matrix(benchmark::State& state)
+{
+  const camp::idx_t nb = state.range(0);
+  const std::vector<double> a = make_matrices(nb, N);
+  const std::vector<double> b = make_matrices(nb, N);
+  std::vector<double> c(nb * N * N);
+  const double* A = a.data();
+  const double* B = b.data();
+  double* C = c.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<batch_exec>(RAJA::TypedRangeSegment<camp::idx_t>(0, nb),
+      [=](camp::idx_t e) {
+        for (camp::idx_t i = 0; i < N; ++i) {
+          for (camp::idx_t j = 0; j < N; ++j) {
+            double dot = 0.0;
+            for (camp::idx_t k = 0; k < N; ++k) {
+              dot += A[(e * N + i) * N + k] * B[(e * N + k) * N + j];
+            }
+            C[(e * N + i) * N + j] = dot;
+          }
+        }
+    });
+    benchmark::DoNotOptimize(C);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * nb);
+}
+
+template < camp::idx_t N >
+static void benchmark_gemm_batched(benchmark::State& state)
+{
+  const camp::idx_t nb = state.range(0);
+  const std::vector<double> a = make_matrices(nb, N);
+  const std::vector<double> b = make_matrices(nb, N);
+
+  const camp::idx_t stride = batched::padded_batch_size<double>(nb);
+  std::vector<double> ap(N * N * stride), bp(N * N * stride),
+      cp(N * N * stride);
+  auto A = batched::make_batch_matrix_view<N, N>(ap.data(), nb);
+  auto B = batched::make_batch_matrix_view<N, N>(bp.data(), nb);
+  auto C = batched::make_batch_matrix_view<N, N>(cp.data(), nb);
+  batched::pack<batch_exec>(a.data(), A);
+  batched::pack<batch_exec>(b.data(), B);
+
+  while (state.KeepRunning()) {
+    batched::gemm<batch_exec>(A, B, C);
+    benchmark::DoNotOptimize(C.data);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * nb);
+}
+
+template < camp::idx_t N >
+static void benchmark_lu_solve_per_matrix(benchmark::State& state)
+{
+  const camp::idx_t nb = state.range(0);
+  const std::vector<double> a0 = make_matrices(nb, N);
+  const std::vector<double> x0 = make_values(nb * N);
+  std::vector<double> a(a0.size()), x(x0.size());
+  double* A = a.data();
+  double* X = x.data();
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    a = a0;
+    x = x0;
+    state.ResumeTiming();
+
+    RAJA::forall<batch_exec>(RAJA::TypedRangeSegment<camp::idx_t>(0, nb),
+      [=](camp::idx_t e) {
+        double* m = A + e * N * N;
+        double* v = X + e * N;
+        for (camp::idx_t k = 0; k < N; ++k) {
+          const double inv_pivot = 1.0 / m[k * N + k];
+          for (camp::idx_t i = k + 1; i < N; ++i) {
+            const double l = m[i * N + k] * inv_pivot;
+            for (camp::idx_t j = k + 1; j < N; ++j) {
+              m[i * N + j] -= l * m[k * N + j];
+            }
+            v[i] -= l * v[k];
+          }
+        }
+        for (camp::idx_t i = N - 1; i >= 0; --i) {
+          double s = v[i];
+          for (camp::idx_t k = i + 1; k < N; ++k) {
+            s -= m[i * N + k] * v[k];
+          }
+          v[i] = s / m[i * N + i];
+        }
+    });
+    benchmark::DoNotOptimize(X);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * nb);
+}
+
+template < camp::idx_t N >
+static void benchmark_lu_solve_batched(benchmark::State& state)
+{
+  const camp::idx_t nb = state.range(0);
+  const std::vector<double> a = make_matrices(nb, N);
+  const std::vector<double> x = make_values(nb * N);
+
+  const camp::idx_t stride = batched::padded_batch_size<double>(nb);
+  std::vector<double> ap0(N * N * stride), xp0(N * stride);
+  auto A0 = batched::make_batch_matrix_view<N, N>(ap0.data(), nb);
+  auto X0 = batched::make_batch_matrix_view<N, 1>(xp0.data(), nb);
+  batched::pack<batch_exec>(a.data(), A0);
+  batched::pack<batch_exec>(x.data(), X0);
+
+  std::vector<double> ap(ap0.size()), xp(xp0.size());
+  auto A = batched::make_batch_matrix_view<N, N>(ap.data(), nb);
+  auto X = batched::make_batch_matrix_view<N, 1>(xp.data(), nb);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    ap = ap0;
+    xp = xp0;
+    state.ResumeTiming();
+
+    batched::lu_factor<batch_exec>(A);
+    batched::lu_solve<batch_exec>(A, X);
+    benchmark::DoNotOptimize(X.data);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * nb);
+}
+
+BENCHMARK_TEMPLATE(benchmark_gemm_per_matrix, 3)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_gemm_batched, 3)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_gemm_per_matrix, 8)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_gemm_batched, 8)->Arg(1 << 20);
+
+BENCHMARK_TEMPLATE(benchmark_lu_solve_per_matrix, 3)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_lu_solve_batched, 3)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_lu_solve_per_matrix, 8)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_lu_solve_batched, 8)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares one cycle of an adaptive code that loops over its active zones:
+// rebuilding a ListSegment from the zone flags and looping over it, against
+// building a BitsetSegment from the packed flags and looping over it. The
+// active zones come in clusters, as refined regions of a mesh do, and
+// cover 5 to 30 percent of the zones.
+//
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+using idx_t = RAJA::Index_type;
+
+static camp::resources::Resource host_res{camp::resources::Host()};
+
+static std::vector<std::uint64_t> make_mask(idx_t n, int percent)
+{
+  std::mt19937 rng(static_cast<unsigned>(n + percent));
+  std::vector<std::uint64_t> mask((n + 63) / 64, 0);
+  idx_t i = 0;
+  while (i < n) {
+    // clusters of about 200 zones
+    const idx_t len = 1 + rng() % 400;
+    const bool active = static_cast<int>(rng() % 100) < percent;
+    for (idx_t k = i; k < i + len && k < n; ++k) {
+      if (active) {
+        mask[k / 64] |= std::uint64_t(1) << (k % 64);
+      }
+    }
+    i += len;
+  }
+  return mask;
+}
+
+template < typename ExecPol >
+static void benchmark_list_rebuild(benchmark::State& state)
+{
+  const idx_t n = state.range(0);
+  const std::vector<std::uint64_t> mask = make_mask(n, state.range(1));
+
+  std::vector<char> flags(n);
+  for (idx_t k = 0; k < n; ++k) {
+    flags[k] = (mask[k / 64] >> (k % 64)) & 1;
+  }
+  std::vector<double> x(n, 1.0);
+  std::vector<double> y(n, 2.0);
+  const double* xp = x.data();
+  double* yp = y.data();
+
+  std::vector<idx_t> active;
+  while (state.KeepRunning()) {
+    active.clear();
+    for (idx_t k = 0; k < n; ++k) {
+      if (flags[k]) {
+        active.push_back(k);
+      }
+    }
+    RAJA::ListSegment segment(active, host_res);
+    RAJA::forall<ExecPol>(segment, [=](idx_t i) {
+      yp[i] += 0.5 * xp[i];
+    });
+    benchmark::DoNotOptimize(yp);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template < typename ExecPol >
+static void benchmark_bitset(benchmark::State& state)
+{
+  const idx_t n = state.range(0);
+  const std::vector<std::uint64_t> mask = make_mask(n, state.range(1));
+
+  std::vector<double> x(n, 1.0);
+  std::vector<double> y(n, 2.0);
+  const double* xp = x.data();
+  double* yp = y.data();
+
+  while (state.KeepRunning()) {
+    RAJA::BitsetSegment segment(mask, 0, n, host_res);
+    RAJA::forall<ExecPol>(segment, [=](idx_t i) {
+      yp[i] += 0.5 * xp[i];
+    });
+    benchmark::DoNotOptimize(yp);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void bitset_args(benchmark::internal::Benchmark* b)
+{
+  for (int n : {1 << 20, 1 << 24}) {
+    for (int percent : {5, 15, 30}) {
+      b->Args({n, percent});
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(benchmark_list_rebuild, RAJA::seq_exec)
+    ->Apply(bitset_args);
+BENCHMARK_TEMPLATE(benchmark_bitset, RAJA::seq_exec)->Apply(bitset_args);
+BENCHMARK_TEMPLATE(benchmark_list_rebuild, RAJA::simd_exec)
+    ->Apply(bitset_args);
+BENCHMARK_TEMPLATE(benchmark_bitset, RAJA::simd_exec)->Apply(bitset_args);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_list_rebuild, RAJA::omp_parallel_for_exec)
+    ->Apply(bitset_args);
+BENCHMARK_TEMPLATE(benchmark_bitset, RAJA::omp_parallel_for_exec)
+    ->Apply(bitset_args);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares loops over a ListSegment and a CompressedListSegment holding
+// the same indices. The indices are those of the interior zones of a 3D
+// block with a few zones removed, as a material or boundary subset of a
+// mesh would be: runs of consecutive indices with small gaps. A second
+// list shuffles the indices within short windows, so blocks are not runs.
+//
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+using idx_t = RAJA::Index_type;
+
+static camp::resources::Resource host_res{camp::resources::Host()};
+
+enum ListShape { Subset, Shuffled };
+
+static std::vector<idx_t> make_indices(ListShape shape, idx_t n)
+{
+  std::mt19937 rng(static_cast<unsigned>(n));
+  std::vector<idx_t> idx;
+  for (idx_t i = 1; i < n - 1; ++i) {
+    for (idx_t j = 1; j < n - 1; ++j) {
+      for (idx_t k = 1; k < n - 1; ++k) {
+        if (rng() % 16 != 0) {
+          idx.push_back((i * n + j) * n + k);
+        }
+      }
+    }
+  }
+  if (shape == Shuffled) {
+    for (size_t b = 0; b < idx.size(); b += 32) {
+      std::shuffle(idx.begin() + b,
+                   idx.begin() + std::min(b + 32, idx.size()),
+                   rng);
+    }
+  }
+  return idx;
+}
+
+template < typename Segment, typename ExecPol >
+static void benchmark_list_axpy(benchmark::State& state)
+{
+  const ListShape shape = static_cast<ListShape>(state.range(0));
+  const idx_t n = state.range(1);
+  const std::vector<idx_t> idx = make_indices(shape, n);
+  const Segment segment(idx, host_res);
+
+  std::vector<double> x(n * n * n, 1.0);
+  std::vector<double> y(n * n * n, 2.0);
+  const double* xp = x.data();
+  double* yp = y.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPol>(segment, [=](idx_t i) {
+      yp[i] += 0.5 * xp[i];
+    });
+    benchmark::DoNotOptimize(yp);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * idx.size());
+}
+
+static void list_args(benchmark::internal::Benchmark* b)
+{
+  for (int shape : {Subset, Shuffled}) {
+    for (int n : {32, 64, 128}) {
+      b->Args({shape, n});
+    }
+  }
+}
+
+static void benchmark_compressed_bytes(benchmark::State& state)
+{
+  const ListShape shape = static_cast<ListShape>(state.range(0));
+  const idx_t n = state.range(1);
+  const std::vector<idx_t> idx = make_indices(shape, n);
+
+  size_t bytes = 0;
+  while (state.KeepRunning()) {
+    RAJA::CompressedListSegment segment(idx, host_res);
+    bytes = segment.getCompressedBytes();
+    benchmark::DoNotOptimize(bytes);
+  }
+  state.counters["bytes_per_index"] =
+      static_cast<double>(bytes) / static_cast<double>(idx.size());
+  state.SetItemsProcessed(state.iterations() * idx.size());
+}
+
+BENCHMARK_TEMPLATE(benchmark_list_axpy, RAJA::ListSegment, RAJA::seq_exec)
+    ->Apply(list_args);
+BENCHMARK_TEMPLATE(benchmark_list_axpy,
+                   RAJA::CompressedListSegment,
+                   RAJA::seq_exec)
+    ->Apply(list_args);
+BENCHMARK_TEMPLATE(benchmark_list_axpy, RAJA::ListSegment, RAJA::simd_exec)
+    ->Apply(list_args);
+BENCHMARK_TEMPLATE(benchmark_list_axpy,
+                   RAJA::CompressedListSegment,
+                   RAJA::simd_exec)
+    ->Apply(list_args);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_list_axpy,
+                   RAJA::ListSegment,
+                   RAJA::omp_parallel_for_exec)
+    ->Apply(list_args);
+BENCHMARK_TEMPLATE(benchmark_list_axpy,
+                   RAJA::CompressedListSegment,
+                   RAJA::omp_parallel_for_exec)
+    ->Apply(list_args);
+#endif
+
+// time to build the compressed list, and its size in bytes per index
+BENCHMARK(benchmark_compressed_bytes)->Apply(list_args);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,110 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares a TypedIndexSet against a TypedFlatIndexSet holding the same
+// many small segments: looping over all of them, and taking half of the
+// segments as a slice and looping over the slice. The segments alternate
+// between ranges and lists of 4 to 16 indices.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+using idx_t = RAJA::Index_type;
+using RangeSeg = RAJA::TypedRangeSegment<idx_t>;
+using ListSeg = RAJA::TypedListSegment<idx_t>;
+
+static camp::resources::Resource host_res{camp::resources::Host()};
+
+template < typename ISET >
+static idx_t fill(ISET& iset, idx_t num_seg)
+{
+  idx_t n = 0;
+  for (idx_t s = 0; s < num_seg; ++s) {
+    const idx_t len = 4 + s % 13;
+    if (s % 2) {
+      std::vector<idx_t> idx(len);
+      for (idx_t k = 0; k < len; ++k) {
+        idx[k] = n + len - 1 - k;
+      }
+      iset.push_back(ListSeg(idx, host_res));
+    } else {
+      iset.push_back(RangeSeg(n, n + len));
+    }
+    n += len;
+  }
+  return n;
+}
+
+template < typename ISET, typename ExecPol >
+static void benchmark_forall(benchmark::State& state)
+{
+  ISET iset;
+  const idx_t n = fill(iset, state.range(0));
+
+  std::vector<double> x(n, 1.0);
+  std::vector<double> y(n, 2.0);
+  const double* xp = x.data();
+  double* yp = y.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPol>(iset, [=](idx_t i) {
+      yp[i] += 0.5 * xp[i];
+    });
+    benchmark::DoNotOptimize(yp);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template < typename ISET, typename ExecPol >
+static void benchmark_slice(benchmark::State& state)
+{
+  ISET iset;
+  const idx_t n = fill(iset, state.range(0));
+  const int num_seg = static_cast<int>(iset.getNumSegments());
+
+  std::vector<double> y(n, 2.0);
+  double* yp = y.data();
+
+  while (state.KeepRunning()) {
+    auto slice = iset.createSlice(num_seg / 4, num_seg / 4 + num_seg / 2);
+    RAJA::forall<ExecPol>(slice, [=](idx_t i) {
+      yp[i] *= 0.5;
+    });
+    benchmark::DoNotOptimize(yp);
+    benchmark::ClobberMemory();
+  }
+}
+
+using TypedSet = RAJA::TypedIndexSet<RangeSeg, ListSeg>;
+using FlatSet = RAJA::TypedFlatIndexSet<RangeSeg, ListSeg>;
+
+using seq_pol = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::simd_exec>;
+
+BENCHMARK_TEMPLATE(benchmark_forall, TypedSet, seq_pol)
+    ->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(benchmark_forall, FlatSet, seq_pol)
+    ->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(benchmark_slice, TypedSet, seq_pol)
+    ->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(benchmark_slice, FlatSet, seq_pol)
+    ->Arg(1000)->Arg(100000);
+
+#if defined(RAJA_ENABLE_OPENMP)
+using omp_pol = RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::simd_exec>;
+
+BENCHMARK_TEMPLATE(benchmark_forall, TypedSet, omp_pol)
+    ->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(benchmark_forall, FlatSet, omp_pol)
+    ->Arg(1000)->Arg(100000);
+#endif
+
+BENCHMARK_MAIN();
@@ -552,7 +552,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
 
 #ifdef RAJA_ENABLE_VECTOR_STATS
-  RAJA::tensor_stats::resetVectorStats();
+  RAJA::expt::tensor_stats::resetVectorStats();
+  RAJA::expt::tensor_stats::KernelScope stats_scope("LTimes vectorized");
 #endif
 
 
@@ -580,7 +581,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
             << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
 
 #ifdef RAJA_ENABLE_VECTOR_STATS
-  RAJA::tensor_stats::printVectorStats();
+  RAJA::expt::tensor_stats::printVectorStats();
 #endif
 
 #if defined(DEBUG_LTIMES)
@@ -639,7 +640,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
 
 #ifdef RAJA_ENABLE_VECTOR_STATS
-  RAJA::tensor_stats::resetVectorStats();
+  RAJA::expt::tensor_stats::resetVectorStats();
 #endif
 
   RAJA::Timer timer;
@@ -675,7 +676,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
             << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
 
 #ifdef RAJA_ENABLE_VECTOR_STATS
-  RAJA::tensor_stats::printVectorStats();
+  RAJA::expt::tensor_stats::printVectorStats();
 #endif
 
 #if defined(DEBUG_LTIMES)
@@ -730,7 +731,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
 
   #ifdef RAJA_ENABLE_VECTOR_STATS
-    RAJA::tensor_stats::resetVectorStats();
+    RAJA::expt::tensor_stats::resetVectorStats();
   #endif
 
     RAJA::Timer timer;
@@ -763,7 +764,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
             << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
 
 #ifdef RAJA_ENABLE_VECTOR_STATS
-  RAJA::tensor_stats::printVectorStats();
+  RAJA::expt::tensor_stats::printVectorStats();
 #endif
 
 #if defined(DEBUG_LTIMES)
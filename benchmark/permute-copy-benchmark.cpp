@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares the bandwidth of RAJA::permute_copy with memcpy of the same
+// number of bytes. Both report the bytes read plus the bytes written, so
+// the bytes_per_second columns compare directly.
+//
+
+#include <cstring>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+using copy_exec = RAJA::omp_parallel_for_exec;
+#else
+using copy_exec = RAJA::loop_exec;
+#endif
+
+template < typename T >
+static void benchmark_memcpy(benchmark::State& state)
+{
+  const size_t n = state.range(0);
+  const std::vector<T> src(n * n, T(1));
+  std::vector<T> dst(n * n);
+
+  while (state.KeepRunning()) {
+    std::memcpy(dst.data(), src.data(), n * n * sizeof(T));
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(T));
+}
+
+//! n x n transpose
+template < typename T >
+static void benchmark_permute_copy_transpose(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const std::vector<T> src_data(n * n, T(1));
+  std::vector<T> dst_data(n * n);
+
+  RAJA::View<const T, RAJA::Layout<2>> src(src_data.data(), n, n);
+  RAJA::View<T, RAJA::Layout<2>> dst(
+      dst_data.data(),
+      RAJA::make_permuted_layout({{n, n}},
+                                 RAJA::as_array<RAJA::PERM_JI>::get()));
+
+  while (state.KeepRunning()) {
+    RAJA::permute_copy<copy_exec>(src, dst);
+    benchmark::DoNotOptimize(dst_data.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(T));
+}
+
+//! n * n / 8 zones with 8 members, array of structs to struct of arrays
+template < typename T >
+static void benchmark_permute_copy_aos_to_soa(benchmark::State& state)
+{
+  const RAJA::Index_type num_members = 8;
+  const RAJA::Index_type num_zones = state.range(0) * state.range(0) /
+                                     num_members;
+  const std::vector<T> src_data(num_zones * num_members, T(1));
+  std::vector<T> dst_data(num_zones * num_members);
+
+  RAJA::View<const T, RAJA::Layout<2>> src(src_data.data(),
+                                           num_zones,
+                                           num_members);
+  RAJA::View<T, RAJA::Layout<2>> dst(
+      dst_data.data(),
+      RAJA::make_permuted_layout({{num_zones, num_members}},
+                                 RAJA::as_array<RAJA::PERM_JI>::get()));
+
+  while (state.KeepRunning()) {
+    RAJA::permute_copy<copy_exec>(src, dst);
+    benchmark::DoNotOptimize(dst_data.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * num_zones * num_members *
+                          sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(benchmark_memcpy, double)->RangeMultiplier(2)->Range(256, 4096);
+BENCHMARK_TEMPLATE(benchmark_permute_copy_transpose, double)->RangeMultiplier(2)->Range(256, 4096);
+BENCHMARK_TEMPLATE(benchmark_permute_copy_aos_to_soa, double)->RangeMultiplier(2)->Range(256, 4096);
+
+BENCHMARK_TEMPLATE(benchmark_memcpy, float)->RangeMultiplier(2)->Range(256, 4096);
+BENCHMARK_TEMPLATE(benchmark_permute_copy_transpose, float)->RangeMultiplier(2)->Range(256, 4096);
+BENCHMARK_TEMPLATE(benchmark_permute_copy_aos_to_soa, float)->RangeMultiplier(2)->Range(256, 4096);
+
+BENCHMARK_MAIN();
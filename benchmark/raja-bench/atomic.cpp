@@ -0,0 +1,74 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Atomic add contention. 2^20 adds into 1 to 2^16 bins, adjacent iterations
+// use different bins, so contention falls as the number of bins grows.
+//
+
+#include "raja-bench.hpp"
+
+static void atomic_args(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(16)->Range(1, 1 << 16);
+}
+
+template < typename ExecPol, typename AtomicPol, typename T >
+static void atomic_add_bins(benchmark::State& state)
+{
+  const int N = 1 << 20;
+  const int num_bins = static_cast<int>(state.range(0));
+  std::vector<T> bins(num_bins);
+  T* b = bins.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<int>(0, N), [=](int i) {
+      RAJA::atomicAdd<AtomicPol>(&b[i % num_bins], T(1));
+    });
+    benchmark::DoNotOptimize(b);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+BENCHMARK_TEMPLATE(atomic_add_bins, RAJA::seq_exec, RAJA::seq_atomic, double)
+    ->Apply(atomic_args);
+BENCHMARK_TEMPLATE(atomic_add_bins,
+                   RAJA::seq_exec,
+                   RAJA::builtin_atomic,
+                   double)
+    ->Apply(atomic_args);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(atomic_add_bins,
+                   RAJA::omp_parallel_for_exec,
+                   RAJA::omp_atomic,
+                   int)
+    ->Apply(atomic_args);
+BENCHMARK_TEMPLATE(atomic_add_bins,
+                   RAJA::omp_parallel_for_exec,
+                   RAJA::omp_atomic,
+                   double)
+    ->Apply(atomic_args);
+BENCHMARK_TEMPLATE(atomic_add_bins,
+                   RAJA::omp_parallel_for_exec,
+                   RAJA::builtin_atomic,
+                   double)
+    ->Apply(atomic_args);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(atomic_add_bins,
+                   RAJA::tbb_for_exec,
+                   RAJA::builtin_atomic,
+                   int)
+    ->Apply(atomic_args);
+BENCHMARK_TEMPLATE(atomic_add_bins,
+                   RAJA::tbb_for_exec,
+                   RAJA::builtin_atomic,
+                   double)
+    ->Apply(atomic_args);
+#endif
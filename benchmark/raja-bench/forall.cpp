@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// forall dispatch overhead against loop length. A daxpy over 1 to 2^20
+// elements, with a plain loop as the baseline. For short loops the time is
+// dominated by the cost of entering forall and, for parallel policies, of
+// starting the parallel region.
+//
+
+#include "raja-bench.hpp"
+
+static void forall_args(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(8)->Range(1, 1 << 20);
+}
+
+static void forall_daxpy_raw_loop(benchmark::State& state)
+{
+  const int N = static_cast<int>(state.range(0));
+  const std::vector<double> x = raja_bench::make_values(N);
+  std::vector<double> y = raja_bench::make_values(N);
+  const double* xp = x.data();
+  double* yp = y.data();
+
+  while (state.KeepRunning()) {
+    for (int i = 0; i < N; ++i) {
+      yp[i] += 2.0 * xp[i];
+    }
+    benchmark::DoNotOptimize(yp);
+    benchmark::ClobberMemory();
+  }
+  raja_bench::set_throughput(state, N, 3 * sizeof(double));
+}
+
+template < typename ExecPol >
+static void forall_daxpy(benchmark::State& state)
+{
+  const int N = static_cast<int>(state.range(0));
+  const std::vector<double> x = raja_bench::make_values(N);
+  std::vector<double> y = raja_bench::make_values(N);
+  const double* xp = x.data();
+  double* yp = y.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<int>(0, N), [=](int i) {
+      yp[i] += 2.0 * xp[i];
+    });
+    benchmark::DoNotOptimize(yp);
+    benchmark::ClobberMemory();
+  }
+  raja_bench::set_throughput(state, N, 3 * sizeof(double));
+}
+
+//! indirect iteration through a list segment
+template < typename ExecPol >
+static void forall_daxpy_list(benchmark::State& state)
+{
+  const int N = static_cast<int>(state.range(0));
+  const std::vector<double> x = raja_bench::make_values(N);
+  std::vector<double> y = raja_bench::make_values(N);
+  std::vector<int> idx(N);
+  for (int i = 0; i < N; ++i) {
+    idx[i] = i;
+  }
+  camp::resources::Resource host{camp::resources::Host()};
+  RAJA::TypedListSegment<int> list(idx.data(), N, host);
+  const double* xp = x.data();
+  double* yp = y.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPol>(list, [=](int i) {
+      yp[i] += 2.0 * xp[i];
+    });
+    benchmark::DoNotOptimize(yp);
+    benchmark::ClobberMemory();
+  }
+  raja_bench::set_throughput(state, N, 3 * sizeof(double) + sizeof(int));
+}
+
+BENCHMARK(forall_daxpy_raw_loop)->Apply(forall_args);
+
+BENCHMARK_TEMPLATE(forall_daxpy, RAJA::seq_exec)->Apply(forall_args);
+BENCHMARK_TEMPLATE(forall_daxpy, RAJA::loop_exec)->Apply(forall_args);
+BENCHMARK_TEMPLATE(forall_daxpy, RAJA::simd_exec)->Apply(forall_args);
+BENCHMARK_TEMPLATE(forall_daxpy_list, RAJA::seq_exec)->Apply(forall_args);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(forall_daxpy, RAJA::omp_parallel_for_exec)
+    ->Apply(forall_args);
+BENCHMARK_TEMPLATE(forall_daxpy, RAJA::omp_parallel_for_static_exec<>)
+    ->Apply(forall_args);
+BENCHMARK_TEMPLATE(forall_daxpy_list, RAJA::omp_parallel_for_exec)
+    ->Apply(forall_args);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(forall_daxpy, RAJA::tbb_for_exec)->Apply(forall_args);
+BENCHMARK_TEMPLATE(forall_daxpy, RAJA::tbb_for_dynamic)->Apply(forall_args);
+BENCHMARK_TEMPLATE(forall_daxpy_list, RAJA::tbb_for_exec)
+    ->Apply(forall_args);
+#endif
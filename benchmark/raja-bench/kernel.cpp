@@ -0,0 +1,170 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Nested loops with RAJA::kernel: a 2D transpose with nested For, Collapse
+// and Tile statements, and a 3D wavefront sweep with Hyperplane, each with a
+// plain loop nest as the baseline.
+//
+
+#include "raja-bench.hpp"
+
+using namespace RAJA::statement;
+
+static void transpose_args(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(4)->Range(64, 4096);
+}
+
+static void wavefront_args(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(2)->Range(32, 256);
+}
+
+static void kernel_transpose_raw_loop(benchmark::State& state)
+{
+  const int N = static_cast<int>(state.range(0));
+  const std::vector<double> a = raja_bench::make_values(N * N);
+  std::vector<double> at(N * N);
+  const double* ap = a.data();
+  double* atp = at.data();
+
+  while (state.KeepRunning()) {
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        atp[j * N + i] = ap[i * N + j];
+      }
+    }
+    benchmark::DoNotOptimize(atp);
+    benchmark::ClobberMemory();
+  }
+  raja_bench::set_throughput(state, N * N, 2 * sizeof(double));
+}
+
+template < typename KernelPol >
+static void kernel_transpose(benchmark::State& state)
+{
+  const int N = static_cast<int>(state.range(0));
+  const std::vector<double> a = raja_bench::make_values(N * N);
+  std::vector<double> at(N * N);
+  const double* ap = a.data();
+  double* atp = at.data();
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<KernelPol>(
+        RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, N),
+                         RAJA::TypedRangeSegment<int>(0, N)),
+        [=](int j, int i) {
+          atp[j * N + i] = ap[i * N + j];
+        });
+    benchmark::DoNotOptimize(atp);
+    benchmark::ClobberMemory();
+  }
+  raja_bench::set_throughput(state, N * N, 2 * sizeof(double));
+}
+
+static void kernel_wavefront_raw_loop(benchmark::State& state)
+{
+  const int N = static_cast<int>(state.range(0));
+  std::vector<double> a = raja_bench::make_values(N * N * N);
+  double* ap = a.data();
+
+  while (state.KeepRunning()) {
+    for (int i = 1; i < N; ++i) {
+      for (int j = 1; j < N; ++j) {
+        for (int k = 1; k < N; ++k) {
+          ap[(i * N + j) * N + k] = (ap[((i - 1) * N + j) * N + k] +
+                                     ap[(i * N + j - 1) * N + k] +
+                                     ap[(i * N + j) * N + k - 1]) / 3.0;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(ap);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * (N - 1) * (N - 1) * (N - 1));
+}
+
+//! each point depends on its lower neighbors, hyperplanes i+j+k are parallel
+template < typename KernelPol >
+static void kernel_wavefront(benchmark::State& state)
+{
+  const int N = static_cast<int>(state.range(0));
+  std::vector<double> a = raja_bench::make_values(N * N * N);
+  double* ap = a.data();
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<KernelPol>(
+        RAJA::make_tuple(RAJA::TypedRangeSegment<int>(1, N),
+                         RAJA::TypedRangeSegment<int>(1, N),
+                         RAJA::TypedRangeSegment<int>(1, N)),
+        [=](int i, int j, int k) {
+          ap[(i * N + j) * N + k] = (ap[((i - 1) * N + j) * N + k] +
+                                     ap[(i * N + j - 1) * N + k] +
+                                     ap[(i * N + j) * N + k - 1]) / 3.0;
+        });
+    benchmark::DoNotOptimize(ap);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * (N - 1) * (N - 1) * (N - 1));
+}
+
+template < typename OuterPol >
+using nested_pol =
+    RAJA::KernelPolicy<For<1, OuterPol, For<0, RAJA::seq_exec, Lambda<0>>>>;
+
+template < typename OuterPol >
+using tiled_pol = RAJA::KernelPolicy<
+    Tile<1, RAJA::tile_fixed<32>, OuterPol,
+      Tile<0, RAJA::tile_fixed<32>, RAJA::seq_exec,
+        For<1, RAJA::seq_exec,
+          For<0, RAJA::seq_exec, Lambda<0>>>>>>;
+
+template < typename CollapsePol >
+using collapse_pol =
+    RAJA::KernelPolicy<Collapse<CollapsePol, RAJA::ArgList<1, 0>, Lambda<0>>>;
+
+template < typename CollapsePol >
+using hyperplane_pol = RAJA::KernelPolicy<
+    Hyperplane<0, RAJA::seq_exec, RAJA::ArgList<1, 2>, CollapsePol,
+      Lambda<0>>>;
+
+BENCHMARK(kernel_transpose_raw_loop)->Apply(transpose_args);
+BENCHMARK_TEMPLATE(kernel_transpose, nested_pol<RAJA::seq_exec>)
+    ->Apply(transpose_args);
+BENCHMARK_TEMPLATE(kernel_transpose, tiled_pol<RAJA::seq_exec>)
+    ->Apply(transpose_args);
+BENCHMARK_TEMPLATE(kernel_transpose, collapse_pol<RAJA::seq_exec>)
+    ->Apply(transpose_args);
+
+BENCHMARK(kernel_wavefront_raw_loop)->Apply(wavefront_args);
+BENCHMARK_TEMPLATE(kernel_wavefront, hyperplane_pol<RAJA::seq_exec>)
+    ->Apply(wavefront_args);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(kernel_transpose, nested_pol<RAJA::omp_parallel_for_exec>)
+    ->Apply(transpose_args);
+BENCHMARK_TEMPLATE(kernel_transpose, tiled_pol<RAJA::omp_parallel_for_exec>)
+    ->Apply(transpose_args);
+BENCHMARK_TEMPLATE(kernel_transpose,
+                   collapse_pol<RAJA::omp_parallel_collapse_exec>)
+    ->Apply(transpose_args);
+BENCHMARK_TEMPLATE(kernel_wavefront,
+                   hyperplane_pol<RAJA::omp_parallel_collapse_exec>)
+    ->Apply(wavefront_args);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(kernel_transpose, nested_pol<RAJA::tbb_for_exec>)
+    ->Apply(transpose_args);
+BENCHMARK_TEMPLATE(kernel_transpose, tiled_pol<RAJA::tbb_for_exec>)
+    ->Apply(transpose_args);
+BENCHMARK_TEMPLATE(kernel_transpose, collapse_pol<RAJA::tbb_collapse_exec<>>)
+    ->Apply(transpose_args);
+BENCHMARK_TEMPLATE(kernel_wavefront,
+                   hyperplane_pol<RAJA::tbb_collapse_exec<>>)
+    ->Apply(wavefront_args);
+#endif
@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// RAJA::launch on the host. A daxpy in one loop against loop length, which
+// measures launch overhead like forall_daxpy, and a tiled 2D transpose.
+//
+
+#include "raja-bench.hpp"
+
+static void launch_args(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(8)->Range(1, 1 << 20);
+}
+
+static void transpose_args(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(4)->Range(64, 4096);
+}
+
+template < typename LaunchPol, typename LoopPol >
+static void launch_daxpy(benchmark::State& state)
+{
+  const int N = static_cast<int>(state.range(0));
+  const std::vector<double> x = raja_bench::make_values(N);
+  std::vector<double> y = raja_bench::make_values(N);
+  const double* xp = x.data();
+  double* yp = y.data();
+  const RAJA::TypedRangeSegment<int> range(0, N);
+
+  while (state.KeepRunning()) {
+    RAJA::launch<RAJA::LaunchPolicy<LaunchPol>>(RAJA::LaunchParams(),
+      [=](RAJA::LaunchContext ctx) {
+        RAJA::loop<RAJA::LoopPolicy<LoopPol>>(ctx, range, [&](int i) {
+          yp[i] += 2.0 * xp[i];
+        });
+    });
+    benchmark::DoNotOptimize(yp);
+    benchmark::ClobberMemory();
+  }
+  raja_bench::set_throughput(state, N, 3 * sizeof(double));
+}
+
+template < typename LaunchPol, typename OuterPol >
+static void launch_transpose_tiled(benchmark::State& state)
+{
+  using outer_pol = RAJA::LoopPolicy<OuterPol>;
+  using inner_pol = RAJA::LoopPolicy<RAJA::loop_exec>;
+  constexpr int tile = 32;
+
+  const int N = static_cast<int>(state.range(0));
+  const std::vector<double> a = raja_bench::make_values(N * N);
+  std::vector<double> at(N * N);
+  const double* ap = a.data();
+  double* atp = at.data();
+  const RAJA::TypedRangeSegment<int> range(0, N);
+
+  while (state.KeepRunning()) {
+    RAJA::launch<RAJA::LaunchPolicy<LaunchPol>>(RAJA::LaunchParams(),
+      [=](RAJA::LaunchContext ctx) {
+        RAJA::tile<outer_pol>(ctx, tile, range,
+          [&](RAJA::TypedRangeSegment<int> const& rows) {
+            RAJA::tile<inner_pol>(ctx, tile, range,
+              [&](RAJA::TypedRangeSegment<int> const& cols) {
+                RAJA::loop<inner_pol>(ctx, rows, [&](int i) {
+                  RAJA::loop<inner_pol>(ctx, cols, [&](int j) {
+                    atp[j * N + i] = ap[i * N + j];
+                  });
+                });
+            });
+        });
+    });
+    benchmark::DoNotOptimize(atp);
+    benchmark::ClobberMemory();
+  }
+  raja_bench::set_throughput(state, N * N, 2 * sizeof(double));
+}
+
+BENCHMARK_TEMPLATE(launch_daxpy, RAJA::seq_launch_t, RAJA::seq_exec)
+    ->Apply(launch_args);
+BENCHMARK_TEMPLATE(launch_daxpy, RAJA::seq_launch_t, RAJA::simd_exec)
+    ->Apply(launch_args);
+BENCHMARK_TEMPLATE(launch_transpose_tiled, RAJA::seq_launch_t, RAJA::loop_exec)
+    ->Apply(transpose_args);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(launch_daxpy, RAJA::omp_launch_t, RAJA::omp_for_exec)
+    ->Apply(launch_args);
+BENCHMARK_TEMPLATE(launch_transpose_tiled,
+                   RAJA::omp_launch_t,
+                   RAJA::omp_for_exec)
+    ->Apply(transpose_args);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(launch_daxpy, RAJA::tbb_launch_t, RAJA::tbb_for_dynamic)
+    ->Apply(launch_args);
+BENCHMARK_TEMPLATE(launch_transpose_tiled,
+                   RAJA::tbb_launch_t,
+                   RAJA::tbb_for_dynamic)
+    ->Apply(transpose_args);
+#endif
@@ -0,0 +1,336 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Driver of the raja-bench suite.
+//
+// All google benchmark flags are accepted, results are written as JSON with
+//
+//   raja-bench.exe --benchmark_out=results.json --benchmark_out_format=json
+//
+// and compared against a previous JSON result file with
+//
+//   raja-bench.exe --raja_bench_baseline=baseline.json
+//                  [--raja_bench_threshold=0.1]
+//
+// which prints the change in real time of every benchmark found in both and
+// exits with status 1 when any is slower than the baseline by more than the
+// threshold fraction. When a benchmark has several repetitions the fastest
+// is compared.
+//
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+namespace
+{
+
+double to_nanoseconds(double time, std::string const& unit)
+{
+  if (unit == "us") return time * 1e3;
+  if (unit == "ms") return time * 1e6;
+  if (unit == "s") return time * 1e9;
+  return time;
+}
+
+void record_time(std::map<std::string, double>& times,
+                 std::string const& name,
+                 double ns)
+{
+  auto it = times.find(name);
+  if (it == times.end()) {
+    times.emplace(name, ns);
+  } else {
+    it->second = std::min(it->second, ns);
+  }
+}
+
+/*!
+ * Reads the real times of the iteration runs in a google benchmark JSON
+ * result file. Only the parts of JSON that file uses are understood.
+ */
+class BaselineReader
+{
+public:
+  explicit BaselineReader(std::string text) : m_text(std::move(text)) {}
+
+  bool read(std::map<std::string, double>& times)
+  {
+    skip_space();
+    return parse_value("", &times) && (skip_space(), m_pos == m_text.size());
+  }
+
+private:
+  std::string m_text;
+  size_t m_pos = 0;
+
+  struct Entry {
+    std::string name;
+    std::string run_type = "iteration";
+    std::string time_unit = "ns";
+    double real_time = -1.0;
+    bool error = false;
+  };
+
+  void skip_space()
+  {
+    while (m_pos < m_text.size() &&
+           std::isspace(static_cast<unsigned char>(m_text[m_pos]))) {
+      ++m_pos;
+    }
+  }
+
+  bool consume(char c)
+  {
+    skip_space();
+    if (m_pos < m_text.size() && m_text[m_pos] == c) {
+      ++m_pos;
+      return true;
+    }
+    return false;
+  }
+
+  bool parse_string(std::string& out)
+  {
+    if (!consume('"')) return false;
+    out.clear();
+    while (m_pos < m_text.size() && m_text[m_pos] != '"') {
+      char c = m_text[m_pos++];
+      if (c == '\\' && m_pos < m_text.size()) {
+        c = m_text[m_pos++];
+        if (c == 'n') c = '\n';
+        else if (c == 't') c = '\t';
+        else if (c == 'u') {
+          // names are ascii, keep the escape as is
+          out += "\\u";
+          continue;
+        }
+      }
+      out += c;
+    }
+    return consume('"');
+  }
+
+  bool parse_number(double& out)
+  {
+    skip_space();
+    const char* begin = m_text.c_str() + m_pos;
+    char* end = nullptr;
+    out = std::strtod(begin, &end);
+    if (end == begin) return false;
+    m_pos += static_cast<size_t>(end - begin);
+    return true;
+  }
+
+  bool parse_literal()
+  {
+    skip_space();
+    for (const char* word : {"true", "false", "null"}) {
+      const std::string w(word);
+      if (m_text.compare(m_pos, w.size(), w) == 0) {
+        m_pos += w.size();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // entries of the "benchmarks" array are recorded into times,
+  // other values are skipped
+  bool parse_value(std::string const& key,
+                   std::map<std::string, double>* times,
+                   Entry* entry = nullptr)
+  {
+    skip_space();
+    if (m_pos >= m_text.size()) return false;
+    const char c = m_text[m_pos];
+
+    if (c == '{') {
+      ++m_pos;
+      Entry this_entry;
+      const bool is_entry = (key == "[benchmarks]");
+      if (consume('}')) return true;
+      do {
+        std::string member;
+        if (!parse_string(member) || !consume(':')) return false;
+        if (!parse_value(member,
+                         key.empty() ? times : nullptr,
+                         is_entry ? &this_entry : nullptr)) {
+          return false;
+        }
+      } while (consume(','));
+      if (!consume('}')) return false;
+      if (is_entry && times != nullptr && !this_entry.error &&
+          this_entry.run_type == "iteration" && this_entry.real_time >= 0.0) {
+        record_time(*times,
+                    this_entry.name,
+                    to_nanoseconds(this_entry.real_time, this_entry.time_unit));
+      }
+      return true;
+    }
+
+    if (c == '[') {
+      ++m_pos;
+      const std::string element_key =
+          (key == "benchmarks" && times != nullptr) ? "[benchmarks]" : "";
+      if (consume(']')) return true;
+      do {
+        if (!parse_value(element_key, element_key.empty() ? nullptr : times)) {
+          return false;
+        }
+      } while (consume(','));
+      return consume(']');
+    }
+
+    if (c == '"') {
+      std::string value;
+      if (!parse_string(value)) return false;
+      if (entry != nullptr) {
+        if (key == "name") entry->name = value;
+        else if (key == "run_type") entry->run_type = value;
+        else if (key == "time_unit") entry->time_unit = value;
+        else if (key == "error_message") entry->error = true;
+      }
+      return true;
+    }
+
+    if (c == '-' || std::isdigit(static_cast<unsigned char>(c))) {
+      double value = 0.0;
+      if (!parse_number(value)) return false;
+      if (entry != nullptr && key == "real_time") entry->real_time = value;
+      return true;
+    }
+
+    if (m_text.compare(m_pos, 4, "true") == 0 && entry != nullptr &&
+        key == "error_occurred") {
+      entry->error = true;
+    }
+    return parse_literal();
+  }
+};
+
+//! console output that also keeps the real time of every run
+class RecordingReporter : public benchmark::ConsoleReporter
+{
+public:
+  std::map<std::string, double> times;
+
+  void ReportRuns(const std::vector<Run>& reports) override
+  {
+    for (Run const& run : reports) {
+      if (!run.error_occurred && run.run_type == Run::RT_Iteration) {
+        record_time(times,
+                    run.benchmark_name(),
+                    to_nanoseconds(run.GetAdjustedRealTime(),
+                                   benchmark::GetTimeUnitString(run.time_unit)));
+      }
+    }
+    benchmark::ConsoleReporter::ReportRuns(reports);
+  }
+};
+
+//! returns the number of regressions
+int compare(std::map<std::string, double> const& baseline,
+            std::map<std::string, double> const& current,
+            double threshold)
+{
+  int num_regressions = 0;
+  int num_improvements = 0;
+
+  std::printf("\n%-70s %14s %14s %9s\n",
+              "Comparison with baseline",
+              "baseline ns",
+              "current ns",
+              "change");
+  for (auto const& cur : current) {
+    auto base = baseline.find(cur.first);
+    if (base == baseline.end()) {
+      std::printf("%-70s %14s %14.1f %9s\n",
+                  cur.first.c_str(), "-", cur.second, "new");
+      continue;
+    }
+    const double change = (cur.second - base->second) / base->second;
+    const char* flag = "";
+    if (change > threshold) {
+      flag = "  REGRESSION";
+      ++num_regressions;
+    } else if (change < -threshold) {
+      flag = "  improved";
+      ++num_improvements;
+    }
+    std::printf("%-70s %14.1f %14.1f %+8.1f%%%s\n",
+                cur.first.c_str(),
+                base->second,
+                cur.second,
+                100.0 * change,
+                flag);
+  }
+
+  std::printf("\n%d regressions and %d improvements beyond %.1f%%\n",
+              num_regressions,
+              num_improvements,
+              100.0 * threshold);
+  return num_regressions;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  std::string baseline_file;
+  double threshold = 0.1;
+
+  // remove our flags before google benchmark sees the arguments
+  std::vector<char*> args;
+  for (int i = 0; i < argc; ++i) {
+    const std::string arg(argv[i]);
+    const std::string baseline_flag("--raja_bench_baseline=");
+    const std::string threshold_flag("--raja_bench_threshold=");
+    if (arg.compare(0, baseline_flag.size(), baseline_flag) == 0) {
+      baseline_file = arg.substr(baseline_flag.size());
+    } else if (arg.compare(0, threshold_flag.size(), threshold_flag) == 0) {
+      threshold = std::atof(arg.substr(threshold_flag.size()).c_str());
+    } else {
+      args.push_back(argv[i]);
+    }
+  }
+  int num_args = static_cast<int>(args.size());
+
+  std::map<std::string, double> baseline;
+  if (!baseline_file.empty()) {
+    std::ifstream in(baseline_file);
+    std::stringstream text;
+    text << in.rdbuf();
+    if (!in || !BaselineReader(text.str()).read(baseline)) {
+      std::fprintf(stderr,
+                   "raja-bench: could not read baseline %s\n",
+                   baseline_file.c_str());
+      return 2;
+    }
+  }
+
+  benchmark::Initialize(&num_args, args.data());
+  if (benchmark::ReportUnrecognizedArguments(num_args, args.data())) {
+    return 2;
+  }
+
+  RecordingReporter reporter;
+  benchmark::RunSpecifiedBenchmarks(&reporter);
+
+  if (!baseline_file.empty()) {
+    return compare(baseline, reporter.times, threshold) > 0 ? 1 : 0;
+  }
+  return 0;
+}
@@ -0,0 +1,48 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Helpers shared by the raja-bench benchmark sources.
+//
+
+#ifndef RAJA_BENCH_HPP
+#define RAJA_BENCH_HPP
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+namespace raja_bench
+{
+
+//! uniformly distributed values in [-1, 1), the same for a given N
+template < typename T = double >
+std::vector<T> make_values(size_t N)
+{
+  std::mt19937 rng(N);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<T> values(N);
+  for (T& v : values) {
+    v = static_cast<T>(dist(rng));
+  }
+  return values;
+}
+
+//! report items/s and bytes/s for N items of bytes_per_item per iteration
+inline void set_throughput(benchmark::State& state,
+                           int64_t N,
+                           int64_t bytes_per_item)
+{
+  state.SetItemsProcessed(state.iterations() * N);
+  state.SetBytesProcessed(state.iterations() * N * bytes_per_item);
+}
+
+}  // namespace raja_bench
+
+#endif
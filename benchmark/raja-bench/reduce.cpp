@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Reducer cost against loop length. Short loops measure creating and
+// combining the per thread copies of a reducer, long loops the cost of
+// updating it in the loop body. Reducer objects and forall parameter
+// reductions (expt::Reduce) are measured with the same loop.
+//
+
+#include <limits>
+
+#include "raja-bench.hpp"
+
+static void reduce_args(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(32)->Range(1, 1 << 20);
+}
+
+template < typename ExecPol, typename ReducePol >
+static void reduce_sum(benchmark::State& state)
+{
+  const int N = static_cast<int>(state.range(0));
+  const std::vector<double> values = raja_bench::make_values(N);
+  const double* v = values.data();
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<ReducePol, double> sum(0.0);
+    RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<int>(0, N), [=](int i) {
+      sum += v[i];
+    });
+    benchmark::DoNotOptimize(sum.get());
+  }
+  raja_bench::set_throughput(state, N, sizeof(double));
+}
+
+template < typename ExecPol, typename ReducePol >
+static void reduce_sum_min_maxloc(benchmark::State& state)
+{
+  const int N = static_cast<int>(state.range(0));
+  const std::vector<double> values = raja_bench::make_values(N);
+  const double* v = values.data();
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<ReducePol, double> sum(0.0);
+    RAJA::ReduceMin<ReducePol, double> min(std::numeric_limits<double>::max());
+    RAJA::ReduceMaxLoc<ReducePol, double, int> maxloc(
+        std::numeric_limits<double>::lowest(), -1);
+    RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<int>(0, N), [=](int i) {
+      sum += v[i];
+      min.min(v[i]);
+      maxloc.maxloc(v[i], i);
+    });
+    benchmark::DoNotOptimize(sum.get());
+    benchmark::DoNotOptimize(min.get());
+    benchmark::DoNotOptimize(maxloc.getLoc());
+  }
+  raja_bench::set_throughput(state, N, sizeof(double));
+}
+
+template < typename ExecPol >
+static void reduce_expt_sum(benchmark::State& state)
+{
+  const int N = static_cast<int>(state.range(0));
+  const std::vector<double> values = raja_bench::make_values(N);
+  const double* v = values.data();
+
+  while (state.KeepRunning()) {
+    double sum = 0.0;
+    RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<int>(0, N),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      [=](int i, double& s) {
+        s += v[i];
+    });
+    benchmark::DoNotOptimize(sum);
+  }
+  raja_bench::set_throughput(state, N, sizeof(double));
+}
+
+BENCHMARK_TEMPLATE(reduce_sum, RAJA::seq_exec, RAJA::seq_reduce)
+    ->Apply(reduce_args);
+BENCHMARK_TEMPLATE(reduce_sum, RAJA::simd_exec, RAJA::seq_reduce)
+    ->Apply(reduce_args);
+BENCHMARK_TEMPLATE(reduce_sum_min_maxloc, RAJA::seq_exec, RAJA::seq_reduce)
+    ->Apply(reduce_args);
+BENCHMARK_TEMPLATE(reduce_expt_sum, RAJA::seq_exec)->Apply(reduce_args);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(reduce_sum, RAJA::omp_parallel_for_exec, RAJA::omp_reduce)
+    ->Apply(reduce_args);
+BENCHMARK_TEMPLATE(reduce_sum,
+                   RAJA::omp_parallel_for_exec,
+                   RAJA::omp_reduce_ordered)
+    ->Apply(reduce_args);
+BENCHMARK_TEMPLATE(reduce_sum_min_maxloc,
+                   RAJA::omp_parallel_for_exec,
+                   RAJA::omp_reduce)
+    ->Apply(reduce_args);
+BENCHMARK_TEMPLATE(reduce_expt_sum, RAJA::omp_parallel_for_exec)
+    ->Apply(reduce_args);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(reduce_sum, RAJA::tbb_for_exec, RAJA::tbb_reduce)
+    ->Apply(reduce_args);
+BENCHMARK_TEMPLATE(reduce_sum_min_maxloc, RAJA::tbb_for_exec, RAJA::tbb_reduce)
+    ->Apply(reduce_args);
+BENCHMARK_TEMPLATE(reduce_expt_sum, RAJA::tbb_for_dynamic)
+    ->Apply(reduce_args);
+#endif
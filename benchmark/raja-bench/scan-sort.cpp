@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Scan and sort throughput.
+//
+
+#include "raja-bench.hpp"
+
+static void scan_args(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(16)->Range(1 << 8, 1 << 24);
+}
+
+static void sort_args(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+}
+
+template < typename ExecPol >
+static void scan_inclusive(benchmark::State& state)
+{
+  const std::vector<double> in = raja_bench::make_values(state.range(0));
+  std::vector<double> out(in.size());
+
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan<ExecPol>(in, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  raja_bench::set_throughput(state, state.range(0), 2 * sizeof(double));
+}
+
+template < typename ExecPol >
+static void scan_exclusive_inplace(benchmark::State& state)
+{
+  std::vector<int> data(state.range(0), 1);
+
+  while (state.KeepRunning()) {
+    RAJA::exclusive_scan_inplace<ExecPol>(data);
+    benchmark::DoNotOptimize(data.data());
+    benchmark::ClobberMemory();
+  }
+  raja_bench::set_throughput(state, state.range(0), 2 * sizeof(int));
+}
+
+template < typename ExecPol >
+static void sort_keys(benchmark::State& state)
+{
+  const std::vector<double> orig = raja_bench::make_values(state.range(0));
+  std::vector<double> keys(orig.size());
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = orig;
+    state.ResumeTiming();
+    RAJA::sort<ExecPol>(keys);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template < typename ExecPol >
+static void sort_stable_pairs(benchmark::State& state)
+{
+  const std::vector<double> orig = raja_bench::make_values(state.range(0));
+  std::vector<double> keys(orig.size());
+  std::vector<int> vals(orig.size());
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = orig;
+    state.ResumeTiming();
+    RAJA::stable_sort_pairs<ExecPol>(keys, vals);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(scan_inclusive, RAJA::seq_exec)->Apply(scan_args);
+BENCHMARK_TEMPLATE(scan_exclusive_inplace, RAJA::seq_exec)->Apply(scan_args);
+BENCHMARK_TEMPLATE(sort_keys, RAJA::seq_exec)->Apply(sort_args);
+BENCHMARK_TEMPLATE(sort_stable_pairs, RAJA::seq_exec)->Apply(sort_args);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(scan_inclusive, RAJA::omp_parallel_for_exec)
+    ->Apply(scan_args);
+BENCHMARK_TEMPLATE(scan_exclusive_inplace, RAJA::omp_parallel_for_exec)
+    ->Apply(scan_args);
+BENCHMARK_TEMPLATE(sort_keys, RAJA::omp_parallel_for_exec)
+    ->Apply(sort_args);
+BENCHMARK_TEMPLATE(sort_stable_pairs, RAJA::omp_parallel_for_exec)
+    ->Apply(sort_args);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(scan_inclusive, RAJA::tbb_for_exec)->Apply(scan_args);
+BENCHMARK_TEMPLATE(scan_exclusive_inplace, RAJA::tbb_for_exec)
+    ->Apply(scan_args);
+BENCHMARK_TEMPLATE(sort_keys, RAJA::tbb_for_exec)->Apply(sort_args);
+BENCHMARK_TEMPLATE(sort_stable_pairs, RAJA::tbb_for_exec)->Apply(sort_args);
+#endif
@@ -0,0 +1,163 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// WorkGroup cost for many short loops, as in halo packing. Each iteration
+// copies num_loops short arrays, either with one forall per loop or by
+// enqueueing the loops in a WorkPool and running them as one WorkGroup.
+// The first argument is the number of loops, the second the loop length.
+//
+
+#include <memory>
+
+#include "raja-bench.hpp"
+
+static void workgroup_args(benchmark::internal::Benchmark* b)
+{
+  for (int len : {16, 256, 4096}) {
+    b->Args({64, len});
+    b->Args({1024, len});
+  }
+}
+
+template < typename ExecPol >
+static void workgroup_forall_per_loop(benchmark::State& state)
+{
+  const int num_loops = static_cast<int>(state.range(0));
+  const int len = static_cast<int>(state.range(1));
+  const std::vector<double> src = raja_bench::make_values(num_loops * len);
+  std::vector<double> dst(src.size());
+
+  while (state.KeepRunning()) {
+    for (int l = 0; l < num_loops; ++l) {
+      const double* s = src.data() + l * len;
+      double* d = dst.data() + l * len;
+      RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<int>(0, len), [=](int i) {
+        d[i] = s[i];
+      });
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  raja_bench::set_throughput(state, num_loops * len, 2 * sizeof(double));
+}
+
+//! enqueue, instantiate and run every iteration
+template < typename WorkPol, typename Dispatch >
+static void workgroup_enqueue_run(benchmark::State& state)
+{
+  using policy = RAJA::WorkGroupPolicy<WorkPol,
+                                       RAJA::ordered,
+                                       RAJA::ragged_array_of_objects,
+                                       Dispatch>;
+  using pool_t =
+      RAJA::WorkPool<policy, int, RAJA::xargs<>, std::allocator<char>>;
+  using group_t =
+      RAJA::WorkGroup<policy, int, RAJA::xargs<>, std::allocator<char>>;
+  using site_t =
+      RAJA::WorkSite<policy, int, RAJA::xargs<>, std::allocator<char>>;
+
+  const int num_loops = static_cast<int>(state.range(0));
+  const int len = static_cast<int>(state.range(1));
+  const std::vector<double> src = raja_bench::make_values(num_loops * len);
+  std::vector<double> dst(src.size());
+
+  pool_t pool(std::allocator<char>{});
+
+  while (state.KeepRunning()) {
+    for (int l = 0; l < num_loops; ++l) {
+      const double* s = src.data() + l * len;
+      double* d = dst.data() + l * len;
+      pool.enqueue(RAJA::TypedRangeSegment<int>(0, len), [=](int i) {
+        d[i] = s[i];
+      });
+    }
+    group_t group = pool.instantiate();
+    site_t site = group.run();
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  raja_bench::set_throughput(state, num_loops * len, 2 * sizeof(double));
+}
+
+//! instantiate once and run the same group every iteration
+template < typename WorkPol, typename Dispatch >
+static void workgroup_run(benchmark::State& state)
+{
+  using policy = RAJA::WorkGroupPolicy<WorkPol,
+                                       RAJA::ordered,
+                                       RAJA::ragged_array_of_objects,
+                                       Dispatch>;
+  using pool_t =
+      RAJA::WorkPool<policy, int, RAJA::xargs<>, std::allocator<char>>;
+  using group_t =
+      RAJA::WorkGroup<policy, int, RAJA::xargs<>, std::allocator<char>>;
+  using site_t =
+      RAJA::WorkSite<policy, int, RAJA::xargs<>, std::allocator<char>>;
+
+  const int num_loops = static_cast<int>(state.range(0));
+  const int len = static_cast<int>(state.range(1));
+  const std::vector<double> src = raja_bench::make_values(num_loops * len);
+  std::vector<double> dst(src.size());
+
+  pool_t pool(std::allocator<char>{});
+  for (int l = 0; l < num_loops; ++l) {
+    const double* s = src.data() + l * len;
+    double* d = dst.data() + l * len;
+    pool.enqueue(RAJA::TypedRangeSegment<int>(0, len), [=](int i) {
+      d[i] = s[i];
+    });
+  }
+  group_t group = pool.instantiate();
+
+  while (state.KeepRunning()) {
+    site_t site = group.run();
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  raja_bench::set_throughput(state, num_loops * len, 2 * sizeof(double));
+}
+
+BENCHMARK_TEMPLATE(workgroup_forall_per_loop, RAJA::seq_exec)
+    ->Apply(workgroup_args);
+BENCHMARK_TEMPLATE(workgroup_enqueue_run,
+                   RAJA::seq_work,
+                   RAJA::indirect_function_call_dispatch)
+    ->Apply(workgroup_args);
+BENCHMARK_TEMPLATE(workgroup_enqueue_run,
+                   RAJA::seq_work,
+                   RAJA::indirect_virtual_function_dispatch)
+    ->Apply(workgroup_args);
+BENCHMARK_TEMPLATE(workgroup_run,
+                   RAJA::seq_work,
+                   RAJA::indirect_function_call_dispatch)
+    ->Apply(workgroup_args);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(workgroup_forall_per_loop, RAJA::omp_parallel_for_exec)
+    ->Apply(workgroup_args);
+BENCHMARK_TEMPLATE(workgroup_enqueue_run,
+                   RAJA::omp_work,
+                   RAJA::indirect_function_call_dispatch)
+    ->Apply(workgroup_args);
+BENCHMARK_TEMPLATE(workgroup_run,
+                   RAJA::omp_work,
+                   RAJA::indirect_function_call_dispatch)
+    ->Apply(workgroup_args);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(workgroup_forall_per_loop, RAJA::tbb_for_exec)
+    ->Apply(workgroup_args);
+BENCHMARK_TEMPLATE(workgroup_enqueue_run,
+                   RAJA::tbb_work,
+                   RAJA::indirect_function_call_dispatch)
+    ->Apply(workgroup_args);
+BENCHMARK_TEMPLATE(workgroup_run,
+                   RAJA::tbb_work,
+                   RAJA::indirect_function_call_dispatch)
+    ->Apply(workgroup_args);
+#endif
@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares reproducible sum reductions with ordinary sum reductions.
+//
+// benchmark_accumulate adds the values to a single accumulator, without a
+// loop policy, so the ratio of its items_per_second for double and for
+// RAJA::ReproducibleSum<double> is the cost of adding a value to the
+// reproducible sum relative to an ordinary floating point add.
+//
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+static std::vector<double> make_values(size_t N)
+{
+  std::mt19937 rng(N);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> values(N);
+  for (double& v : values) {
+    v = dist(rng);
+  }
+  return values;
+}
+
+template < typename T >
+static void benchmark_accumulate(benchmark::State& state)
+{
+  const std::vector<double> values = make_values(state.range(0));
+  while (state.KeepRunning()) {
+    T sum{};
+    for (double v : values) {
+      sum += v;
+    }
+    benchmark::DoNotOptimize(static_cast<double>(sum));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template < typename ExecPol, typename ReducePol >
+static void benchmark_reduce_sum(benchmark::State& state)
+{
+  const std::vector<double> values = make_values(state.range(0));
+  const double* v = values.data();
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<ReducePol, double> sum(0.0);
+    RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<int>(0, values.size()),
+      [=](int i) {
+        sum += v[i];
+    });
+    benchmark::DoNotOptimize(sum.get());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template < typename ExecPol, typename T >
+static void benchmark_expt_reduce_sum(benchmark::State& state)
+{
+  const std::vector<double> values = make_values(state.range(0));
+  const double* v = values.data();
+  while (state.KeepRunning()) {
+    T sum{};
+    RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<int>(0, values.size()),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      [=](int i, T& s) {
+        s += v[i];
+    });
+    benchmark::DoNotOptimize(static_cast<double>(sum));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(benchmark_accumulate, double)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(benchmark_accumulate, RAJA::ReproducibleSum<double>)
+    ->Range(1 << 10, 1 << 22);
+
+BENCHMARK_TEMPLATE(benchmark_reduce_sum,
+                   RAJA::seq_exec, RAJA::seq_reduce)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(benchmark_reduce_sum,
+                   RAJA::seq_exec, RAJA::seq_reduce_reproducible)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(benchmark_expt_reduce_sum,
+                   RAJA::seq_exec, double)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(benchmark_expt_reduce_sum,
+                   RAJA::seq_exec, RAJA::ReproducibleSum<double>)
+    ->Range(1 << 10, 1 << 22);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_reduce_sum,
+                   RAJA::omp_parallel_for_exec, RAJA::omp_reduce)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(benchmark_reduce_sum,
+                   RAJA::omp_parallel_for_exec, RAJA::omp_reduce_ordered)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(benchmark_reduce_sum,
+                   RAJA::omp_parallel_for_exec, RAJA::omp_reduce_reproducible)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(benchmark_expt_reduce_sum,
+                   RAJA::omp_parallel_for_exec, double)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(benchmark_expt_reduce_sum,
+                   RAJA::omp_parallel_for_exec, RAJA::ReproducibleSum<double>)
+    ->Range(1 << 10, 1 << 22);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,62 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares scatter-adds through atomic views with builtin, OpenMP and
+// write combining atomic policies. Particles are ordered by cell, as after
+// a particle sort, so neighboring particles add to the same cells.
+//
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+static constexpr int num_cells = 1 << 16;
+
+static std::vector<int> make_cells(size_t N)
+{
+  std::mt19937 rng(N);
+  std::uniform_int_distribution<int> jitter(0, 7);
+  std::vector<int> cells(N);
+  const size_t per_cell = (N + num_cells - 1) / num_cells;
+  for (size_t i = 0; i < N; ++i) {
+    cells[i] = static_cast<int>((i / per_cell + jitter(rng)) % num_cells);
+  }
+  return cells;
+}
+
+template < typename AtomicPol >
+static void benchmark_scatter_add(benchmark::State& state)
+{
+  const std::vector<int> cells = make_cells(state.range(0));
+  std::vector<double> grid(num_cells, 0.0);
+  const int* cell = cells.data();
+
+  RAJA::View<double, RAJA::Layout<1>> grid_view(grid.data(), num_cells);
+  auto atomic_grid = RAJA::make_atomic_view<AtomicPol>(grid_view);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+      RAJA::TypedRangeSegment<int>(0, cells.size()),
+      [=](int i) {
+        atomic_grid(cell[i]) += 1.0;
+    });
+    benchmark::DoNotOptimize(grid.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(benchmark_scatter_add, RAJA::omp_atomic)
+    ->Range(1 << 16, 1 << 24);
+BENCHMARK_TEMPLATE(benchmark_scatter_add, RAJA::builtin_atomic)
+    ->Range(1 << 16, 1 << 24);
+BENCHMARK_TEMPLATE(benchmark_scatter_add, RAJA::combining_atomic)
+    ->Range(1 << 16, 1 << 24);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares the OpenMP stable sort, which merges all thread chunks in one
+// multiway pass, with the pairwise merge OpenMP sort and std::stable_sort.
+//
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+static std::vector<double> make_keys(size_t N)
+{
+  std::mt19937 rng(N);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::vector<double> keys(N);
+  for (double& k : keys) {
+    k = dist(rng);
+  }
+  return keys;
+}
+
+static void benchmark_stable_sort_std(benchmark::State& state)
+{
+  const std::vector<double> orig = make_keys(state.range(0));
+  std::vector<double> keys(orig.size());
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = orig;
+    state.ResumeTiming();
+    std::stable_sort(keys.begin(), keys.end());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void benchmark_stable_sort_omp_pairwise(benchmark::State& state)
+{
+  namespace sort_detail = RAJA::impl::sort::detail;
+  const std::vector<double> orig = make_keys(state.range(0));
+  std::vector<double> keys(orig.size());
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = orig;
+    state.ResumeTiming();
+    sort_detail::openmp::sort(sort_detail::StableSorter{},
+                              keys.data(), keys.data() + keys.size(),
+                              RAJA::operators::less<double>{});
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void benchmark_stable_sort_omp(benchmark::State& state)
+{
+  const std::vector<double> orig = make_keys(state.range(0));
+  std::vector<double> keys(orig.size());
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = orig;
+    state.ResumeTiming();
+    RAJA::stable_sort<RAJA::omp_parallel_for_exec>(keys);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void benchmark_stable_sort_pairs_omp_pairwise(benchmark::State& state)
+{
+  namespace sort_detail = RAJA::impl::sort::detail;
+  const std::vector<double> orig = make_keys(state.range(0));
+  std::vector<double> keys(orig.size());
+  std::vector<int> vals(orig.size());
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = orig;
+    for (size_t i = 0; i < vals.size(); ++i) {
+      vals[i] = static_cast<int>(i);
+    }
+    state.ResumeTiming();
+    auto begin = RAJA::zip(keys.data(), vals.data());
+    auto end   = RAJA::zip(keys.data() + keys.size(), vals.data() + vals.size());
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    sort_detail::openmp::sort(sort_detail::StableSorter{}, begin, end,
+        RAJA::compare_first<zip_ref>(RAJA::operators::less<double>{}));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void benchmark_stable_sort_pairs_omp(benchmark::State& state)
+{
+  const std::vector<double> orig = make_keys(state.range(0));
+  std::vector<double> keys(orig.size());
+  std::vector<int> vals(orig.size());
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = orig;
+    for (size_t i = 0; i < vals.size(); ++i) {
+      vals[i] = static_cast<int>(i);
+    }
+    state.ResumeTiming();
+    RAJA::stable_sort_pairs<RAJA::omp_parallel_for_exec>(keys, vals);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(benchmark_stable_sort_std)->RangeMultiplier(8)->Range(1<<12, 1<<24);
+BENCHMARK(benchmark_stable_sort_omp_pairwise)->RangeMultiplier(8)->Range(1<<12, 1<<24);
+BENCHMARK(benchmark_stable_sort_omp)->RangeMultiplier(8)->Range(1<<12, 1<<24);
+BENCHMARK(benchmark_stable_sort_pairs_omp_pairwise)->RangeMultiplier(8)->Range(1<<12, 1<<24);
+BENCHMARK(benchmark_stable_sort_pairs_omp)->RangeMultiplier(8)->Range(1<<12, 1<<24);
+
+BENCHMARK_MAIN();
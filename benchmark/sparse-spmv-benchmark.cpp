@@ -0,0 +1,170 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares CSR and SELL-C-sigma sparse matrix vector multiplies on a 2D
+// 5 point stencil, a 3D 27 point stencil and a matrix with power law row
+// lengths.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+using csr_t = RAJA::sparse::CSRMatrix<double>;
+using idx_t = RAJA::Index_type;
+
+enum MatrixShape { Laplace2D, Stencil27, PowerLaw };
+
+static csr_t make_matrix(MatrixShape shape, idx_t n)
+{
+  std::vector<idx_t> rows, cols;
+  std::vector<double> vals;
+  idx_t num_rows = 0;
+
+  if (shape == Laplace2D) {
+    num_rows = n * n;
+    for (idx_t i = 0; i < n; ++i) {
+      for (idx_t j = 0; j < n; ++j) {
+        const idx_t r = i * n + j;
+        const idx_t nbrs[5][2] = {{i, j}, {i-1, j}, {i+1, j}, {i, j-1}, {i, j+1}};
+        for (auto const& nb : nbrs) {
+          if (nb[0] >= 0 && nb[0] < n && nb[1] >= 0 && nb[1] < n) {
+            rows.push_back(r);
+            cols.push_back(nb[0] * n + nb[1]);
+            vals.push_back(r == nb[0] * n + nb[1] ? 4.0 : -1.0);
+          }
+        }
+      }
+    }
+  } else if (shape == Stencil27) {
+    num_rows = n * n * n;
+    for (idx_t i = 0; i < n; ++i) {
+      for (idx_t j = 0; j < n; ++j) {
+        for (idx_t k = 0; k < n; ++k) {
+          const idx_t r = (i * n + j) * n + k;
+          for (idx_t di = -1; di <= 1; ++di) {
+            for (idx_t dj = -1; dj <= 1; ++dj) {
+              for (idx_t dk = -1; dk <= 1; ++dk) {
+                if (i+di < 0 || i+di >= n || j+dj < 0 || j+dj >= n ||
+                    k+dk < 0 || k+dk >= n) {
+                  continue;
+                }
+                rows.push_back(r);
+                cols.push_back(((i+di) * n + j+dj) * n + k+dk);
+                vals.push_back(di == 0 && dj == 0 && dk == 0 ? 26.0 : -1.0);
+              }
+            }
+          }
+        }
+      }
+    }
+  } else {
+    num_rows = n * n;
+    std::mt19937 rng(n);
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    std::uniform_int_distribution<idx_t> col(0, num_rows - 1);
+    for (idx_t r = 0; r < num_rows; ++r) {
+      // row lengths with a Pareto tail, mostly short with a few long rows
+      const idx_t len = std::min<idx_t>(
+          num_rows, static_cast<idx_t>(2.0 / std::pow(1.0 - u(rng), 0.6)));
+      for (idx_t k = 0; k < len; ++k) {
+        rows.push_back(r);
+        cols.push_back(col(rng));
+        vals.push_back(u(rng));
+      }
+    }
+  }
+
+  return csr_t::from_coo(num_rows, num_rows, rows, cols, vals);
+}
+
+static void set_counters(benchmark::State& state, idx_t nnz)
+{
+  state.counters["nnz"] = static_cast<double>(nnz);
+  state.counters["flops"] = benchmark::Counter(
+      2.0 * static_cast<double>(nnz) * static_cast<double>(state.iterations()),
+      benchmark::Counter::kIsRate);
+}
+
+template < typename ExecPol >
+static void benchmark_csr_spmv(benchmark::State& state)
+{
+  const csr_t A = make_matrix(static_cast<MatrixShape>(state.range(0)),
+                              state.range(1));
+  std::vector<double> x(A.num_cols(), 1.0), y(A.num_rows());
+
+  while (state.KeepRunning()) {
+    RAJA::sparse::spmv<ExecPol>(A, x.data(), y.data());
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+  set_counters(state, A.num_nonzeros());
+}
+
+template < typename ExecPol >
+static void benchmark_sell_spmv(benchmark::State& state)
+{
+  const csr_t A = make_matrix(static_cast<MatrixShape>(state.range(0)),
+                              state.range(1));
+  const RAJA::sparse::SellMatrix<double> S(A, state.range(2));
+  std::vector<double> x(A.num_cols(), 1.0), y(A.num_rows());
+
+  while (state.KeepRunning()) {
+    RAJA::sparse::spmv<ExecPol>(S, x.data(), y.data());
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+  set_counters(state, A.num_nonzeros());
+  state.counters["fill"] =
+      static_cast<double>(S.num_stored()) / static_cast<double>(S.num_nonzeros());
+}
+
+static void csr_args(benchmark::internal::Benchmark* b)
+{
+  b->Args({Laplace2D, 1000});
+  b->Args({Stencil27, 100});
+  b->Args({PowerLaw, 1000});
+}
+
+// the third argument is the SELL sorting window sigma
+static void sell_args(benchmark::internal::Benchmark* b)
+{
+  for (idx_t sigma : {1, 256}) {
+    b->Args({Laplace2D, 1000, sigma});
+    b->Args({Stencil27, 100, sigma});
+    b->Args({PowerLaw, 1000, sigma});
+  }
+}
+
+BENCHMARK_TEMPLATE(benchmark_csr_spmv, RAJA::seq_exec)->Apply(csr_args);
+BENCHMARK_TEMPLATE(benchmark_csr_spmv, RAJA::simd_exec)->Apply(csr_args);
+#if defined(RAJA_ENABLE_VECTORIZATION)
+BENCHMARK_TEMPLATE(benchmark_sell_spmv, RAJA::seq_exec)->Apply(sell_args);
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_csr_spmv, RAJA::omp_parallel_for_exec)
+    ->Apply(csr_args);
+#if defined(RAJA_ENABLE_VECTORIZATION)
+BENCHMARK_TEMPLATE(benchmark_sell_spmv, RAJA::omp_parallel_for_exec)
+    ->Apply(sell_args);
+#endif
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_csr_spmv, RAJA::tbb_for_exec)->Apply(csr_args);
+#if defined(RAJA_ENABLE_VECTORIZATION)
+BENCHMARK_TEMPLATE(benchmark_sell_spmv, RAJA::tbb_for_exec)->Apply(sell_args);
+#endif
+#endif
+
+BENCHMARK_MAIN();
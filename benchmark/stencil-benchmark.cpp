@@ -0,0 +1,200 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares RAJA::expt::stencil with one sweep over the grid per time step,
+// for Jacobi iterations on grids much larger than the last level cache.
+//
+// A sweep moves 24 bytes per point update from memory: it reads in, and
+// reads and writes out. bytes_per_second counts those 24 bytes for every
+// version, so a blocked rate above the copy rate of the machine (the
+// benchmark_copy line) shows the traffic saved. dram_bytes_per_update is
+// the traffic of the tiling: each tile, widened by the region its gaps
+// read, moves 24 bytes per point once per time block.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+using stencil_exec = RAJA::omp_parallel_for_exec;
+#else
+using stencil_exec = RAJA::loop_exec;
+#endif
+
+using idx_t = RAJA::Index_type;
+
+static constexpr idx_t num_steps = 16;
+
+template < camp::idx_t N_DIMS >
+using grid_view = RAJA::View<double, RAJA::OffsetLayout<N_DIMS>>;
+
+static void set_counters(benchmark::State& state,
+                         idx_t num_points,
+                         double dram_bytes_per_update)
+{
+  const idx_t updates = state.iterations() * num_steps * num_points;
+  state.SetItemsProcessed(updates);
+  state.SetBytesProcessed(updates * 3 * sizeof(double));
+  state.counters["dram_bytes_per_update"] = dram_bytes_per_update;
+}
+
+static double blocked_bytes_per_update(RAJA::expt::StencilBlocking const& b,
+                                       camp::idx_t n_dims)
+{
+  double widen = 1.0;
+  for (camp::idx_t d = 0; d < n_dims; ++d) {
+    const double width =
+        d == n_dims - 1 ? b.inner_tile_width : b.tile_width;
+    widen *= 1.0 + 2.0 * b.time_block * b.radius / width;
+  }
+  return 3.0 * sizeof(double) * widen / b.time_block;
+}
+
+//! reference memory rate: out = 0.5 * (in + out) over both grids
+static void benchmark_copy(benchmark::State& state)
+{
+  const idx_t n = state.range(0);
+  std::vector<double> a(n, 1.0), b(n, 1.0);
+  double* in = a.data();
+  double* out = b.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<stencil_exec>(RAJA::TypedRangeSegment<idx_t>(0, n),
+      [=](idx_t i) {
+        out[i] = 0.5 * (in[i] + out[i]);
+    });
+    benchmark::DoNotOptimize(out);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * n * 3 * sizeof(double));
+}
+
+static auto jacobi_2d = [](grid_view<2> const& in,
+                           grid_view<2> const& out,
+                           idx_t i,
+                           idx_t j) {
+  out(i, j) =
+      0.25 * (in(i - 1, j) + in(i + 1, j) + in(i, j - 1) + in(i, j + 1));
+};
+
+static auto jacobi_3d = [](grid_view<3> const& in,
+                           grid_view<3> const& out,
+                           idx_t i,
+                           idx_t j,
+                           idx_t k) {
+  out(i, j, k) = (1.0 / 6.0) * (in(i - 1, j, k) + in(i + 1, j, k) +
+                                in(i, j - 1, k) + in(i, j + 1, k) +
+                                in(i, j, k - 1) + in(i, j, k + 1));
+};
+
+static void benchmark_sweep_2d(benchmark::State& state)
+{
+  const idx_t n = state.range(0);
+  const auto layout =
+      RAJA::make_offset_layout<2>({{-1, -1}}, {{n + 1, n + 1}});
+  std::vector<double> a(layout.size(), 1.0), b(layout.size(), 1.0);
+  const grid_view<2> views[2] = {grid_view<2>(a.data(), layout),
+                                 grid_view<2>(b.data(), layout)};
+
+  while (state.KeepRunning()) {
+    for (idx_t s = 0; s < num_steps; ++s) {
+      const grid_view<2> in = views[s % 2];
+      const grid_view<2> out = views[(s + 1) % 2];
+      RAJA::forall<stencil_exec>(RAJA::TypedRangeSegment<idx_t>(0, n),
+        [=](idx_t i) {
+          RAJA_SIMD
+          for (idx_t j = 0; j < n; ++j) {
+            jacobi_2d(in, out, i, j);
+          }
+      });
+    }
+    benchmark::ClobberMemory();
+  }
+  set_counters(state, n * n, 3.0 * sizeof(double));
+}
+
+static void benchmark_blocked_2d(benchmark::State& state)
+{
+  const idx_t n = state.range(0);
+  const auto layout =
+      RAJA::make_offset_layout<2>({{-1, -1}}, {{n + 1, n + 1}});
+  std::vector<double> a(layout.size(), 1.0), b(layout.size(), 1.0);
+  grid_view<2> va(a.data(), layout);
+  grid_view<2> vb(b.data(), layout);
+
+  RAJA::expt::StencilBlocking blocking;
+  blocking.tile_width = state.range(1);
+  blocking.time_block = state.range(2);
+
+  while (state.KeepRunning()) {
+    RAJA::expt::stencil<stencil_exec>(va, vb, num_steps, blocking, jacobi_2d);
+    benchmark::ClobberMemory();
+  }
+  set_counters(state, n * n, blocked_bytes_per_update(blocking, 2));
+}
+
+static void benchmark_sweep_3d(benchmark::State& state)
+{
+  const idx_t n = state.range(0);
+  const auto layout = RAJA::make_offset_layout<3>(
+      {{-1, -1, -1}}, {{n + 1, n + 1, n + 1}});
+  std::vector<double> a(layout.size(), 1.0), b(layout.size(), 1.0);
+  const grid_view<3> views[2] = {grid_view<3>(a.data(), layout),
+                                 grid_view<3>(b.data(), layout)};
+
+  while (state.KeepRunning()) {
+    for (idx_t s = 0; s < num_steps; ++s) {
+      const grid_view<3> in = views[s % 2];
+      const grid_view<3> out = views[(s + 1) % 2];
+      RAJA::forall<stencil_exec>(RAJA::TypedRangeSegment<idx_t>(0, n),
+        [=](idx_t i) {
+          for (idx_t j = 0; j < n; ++j) {
+            RAJA_SIMD
+            for (idx_t k = 0; k < n; ++k) {
+              jacobi_3d(in, out, i, j, k);
+            }
+          }
+      });
+    }
+    benchmark::ClobberMemory();
+  }
+  set_counters(state, n * n * n, 3.0 * sizeof(double));
+}
+
+static void benchmark_blocked_3d(benchmark::State& state)
+{
+  const idx_t n = state.range(0);
+  const auto layout = RAJA::make_offset_layout<3>(
+      {{-1, -1, -1}}, {{n + 1, n + 1, n + 1}});
+  std::vector<double> a(layout.size(), 1.0), b(layout.size(), 1.0);
+  grid_view<3> va(a.data(), layout);
+  grid_view<3> vb(b.data(), layout);
+
+  RAJA::expt::StencilBlocking blocking;
+  blocking.tile_width = state.range(1);
+  blocking.time_block = state.range(2);
+
+  while (state.KeepRunning()) {
+    RAJA::expt::stencil<stencil_exec>(va, vb, num_steps, blocking, jacobi_3d);
+    benchmark::ClobberMemory();
+  }
+  set_counters(state, n * n * n, blocked_bytes_per_update(blocking, 3));
+}
+
+// about 1 GiB over both grids, well past the last level cache
+BENCHMARK(benchmark_copy)->Arg(1 << 26);
+
+BENCHMARK(benchmark_sweep_2d)->Arg(8192);
+BENCHMARK(benchmark_blocked_2d)->Args({8192, 32, 8})->Args({8192, 64, 16});
+
+BENCHMARK(benchmark_sweep_3d)->Arg(384);
+BENCHMARK(benchmark_blocked_3d)->Args({384, 32, 8})->Args({384, 24, 8});
+
+BENCHMARK_MAIN();
@@ -99,6 +99,9 @@
 #endif
 
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/FlatIndexSet.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
+#include "RAJA/index/BitsetSegment.hpp"
 
 //
 // Strongly typed index class
@@ -156,12 +159,44 @@
 //
 #include "RAJA/util/sort.hpp"
 
+//
+// Run time tuning of tile sizes
+//
+#include "RAJA/util/TileTuner.hpp"
+
 //
 // WorkPool, WorkGroup, WorkSite objects
 //
 #include "RAJA/policy/WorkGroup.hpp"
 #include "RAJA/pattern/WorkGroup.hpp"
 
+//
+// Graph record and replay of forall, kernel and launch sequences
+//
+#include "RAJA/pattern/Graph.hpp"
+
+//
+// Batched small dense matrix operations
+//
+#if defined(RAJA_ENABLE_VECTORIZATION)
+#include "RAJA/pattern/batched.hpp"
+#endif
+
+//
+// Sparse matrix formats and kernels
+//
+#include "RAJA/pattern/sparse.hpp"
+
+//
+// Temporally blocked stencils over offset layout views
+//
+#include "RAJA/pattern/stencil.hpp"
+
+//
+// Copies between views with permuted layouts
+//
+#include "RAJA/pattern/permute_copy.hpp"
+
 //
 // Reduction objects
 //
@@ -188,6 +223,7 @@
 
 #include "RAJA/index/IndexSetUtils.hpp"
 #include "RAJA/index/IndexSetBuilders.hpp"
+#include "RAJA/index/IndexSetCache.hpp"
 
 #include "RAJA/pattern/scan.hpp"
 
@@ -197,6 +233,8 @@
 
 #include "RAJA/pattern/sort.hpp"
 
+#include "RAJA/pattern/worklist.hpp"
+
 namespace RAJA {
 namespace expt{}
 //  // provide a RAJA::expt namespace for experimental work, but bring alias
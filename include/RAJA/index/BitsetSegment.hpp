@@ -0,0 +1,660 @@
+/*!
+ ******************************************************************************
+ *
+ * \file BitsetSegment.hpp
+ *
+ * \brief  Header file containing definition of RAJA bitset segment class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_BitsetSegment_HPP
+#define RAJA_BitsetSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/SegmentBlocks.hpp"
+#include "RAJA/util/BitMask.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Word w with ranks[w] <= rank < ranks[w+1], for 0 <= rank < ranks[nwords]
+RAJA_HOST_DEVICE RAJA_INLINE Index_type
+bitset_word_of_rank(const Index_type* ranks, Index_type nwords, Index_type rank)
+{
+  Index_type lo = 0;
+  Index_type hi = nwords;
+  while (hi - lo > 1) {
+    const Index_type mid = lo + (hi - lo) / 2;
+    if (ranks[mid] <= rank) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+//@{
+//! Call body with base + k for every set bit k of word, in order, with the
+//! vectorization a forall over the segment with the given policy allows.
+template <typename Body>
+RAJA_INLINE void bitset_word_loop(seq_exec const&,
+                                  std::uint64_t word,
+                                  Index_type base,
+                                  Body const& body)
+{
+  RAJA_NO_SIMD
+  while (word != 0) {
+    body(base + count_trailing_zeros(word));
+    word &= word - 1;
+  }
+}
+
+template <typename Body>
+RAJA_INLINE void bitset_word_loop(loop_exec const&,
+                                  std::uint64_t word,
+                                  Index_type base,
+                                  Body const& body)
+{
+  if (word == ~std::uint64_t(0)) {
+    for (Index_type k = 0; k < 64; ++k) {
+      body(base + k);
+    }
+    return;
+  }
+  while (word != 0) {
+    body(base + count_trailing_zeros(word));
+    word &= word - 1;
+  }
+}
+
+// Dense words run a simd loop over every bit with the body masked by the
+// bit, sparse words jump from set bit to set bit.
+template <typename Body>
+RAJA_INLINE void bitset_word_loop(simd_exec const&,
+                                  std::uint64_t word,
+                                  Index_type base,
+                                  Body const& body)
+{
+  if (word == ~std::uint64_t(0)) {
+    RAJA_SIMD
+    for (Index_type k = 0; k < 64; ++k) {
+      body(base + k);
+    }
+  } else if (popcount(word) >= 32) {
+    RAJA_SIMD
+    for (Index_type k = 0; k < 64; ++k) {
+      if ((word >> k) & 1) {
+        body(base + k);
+      }
+    }
+  } else {
+    while (word != 0) {
+      body(base + count_trailing_zeros(word));
+      word &= word - 1;
+    }
+  }
+}
+//@}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedBitsetSegment
+ *
+ * \brief  Segment class representing the indices of a range whose bits are
+ *         set in a packed mask.
+ *
+ * \tparam StorageT integral type of the segment indices
+ *
+ * Bit k of word w of the mask stands for index begin + 64 * w + k of the
+ * range [begin, end). The segment holds a copy of the mask and, per word,
+ * the number of set bits in the words before it, both built in O(n / 64).
+ * This replaces rebuilding a TypedListSegment from flags with a scan and a
+ * compaction when the set of active indices changes.
+ *
+ * The segment models a random access Iterable like TypedListSegment, so it
+ * can be used with any RAJA::forall policy and in a TypedIndexSet; the i-th
+ * set index is found by a binary search over the words. With host policies
+ * RAJA::forall runs the policy over blocks of block_size set bits, so every
+ * block, e.g. every OpenMP chunk, gets the same amount of work, and the bits
+ * of each block are visited word by word. With simd_exec words with many set
+ * bits are visited with a vectorized loop.
+ *
+ * Usage:
+ *
+ * \verbatim
+ * camp::resources::Resource resource{ camp resource type };
+ * TypedBitsetSegment<T> bitseg(mask_words, begin, end, resource);
+ *
+ * forall<exec_pol>(bitseg, [=] (T i) {
+ *   // loop body -- use i as index value
+ * });
+ * \endverbatim
+ *
+ * Copies of the segment, like copies of a TypedListSegment, are shallow and
+ * do not own the data.
+ *
+ ******************************************************************************
+ */
+template <typename StorageT>
+class TypedBitsetSegment
+{
+  static_assert(std::is_integral<StorageT>::value,
+                "TypedBitsetSegment requires an integral index type");
+
+public:
+
+  //! Number of indices per word of the mask
+  static constexpr Index_type word_bits = 64;
+
+  //! Number of set bits in a block, only the last block may have fewer
+  static constexpr Index_type block_size = 4096;
+
+  //@{
+  //!   @name Types used in implementation based on template parameter.
+
+  //! The underlying value type for index storage
+  using value_type = StorageT;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //! Random access iterator over the set bits, in increasing order
+  class iterator
+  {
+  public:
+    using value_type = StorageT;
+    using difference_type = Index_type;
+    using pointer = const StorageT*;
+    using reference = StorageT;
+    using iterator_category = std::random_access_iterator_tag;
+
+    constexpr iterator() noexcept = default;
+
+    RAJA_HOST_DEVICE iterator(const std::uint64_t* words,
+                              const Index_type* ranks,
+                              Index_type num_words,
+                              StorageT begin,
+                              Index_type pos)
+        : m_words(words),
+          m_ranks(ranks),
+          m_num_words(num_words),
+          m_begin(begin),
+          m_pos(pos)
+    {
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE StorageT operator*() const
+    {
+      const Index_type w =
+          detail::bitset_word_of_rank(m_ranks, m_num_words, m_pos);
+      const int k =
+          select_bit(m_words[w], static_cast<int>(m_pos - m_ranks[w]));
+      return static_cast<StorageT>(m_begin + w * word_bits + k);
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE StorageT
+    operator[](difference_type n) const
+    {
+      return *(*this + n);
+    }
+
+    RAJA_HOST_DEVICE iterator& operator++()
+    {
+      ++m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator& operator--()
+    {
+      --m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++m_pos;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --m_pos;
+      return tmp;
+    }
+
+    RAJA_HOST_DEVICE iterator& operator+=(difference_type n)
+    {
+      m_pos += n;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator& operator-=(difference_type n)
+    {
+      m_pos -= n;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator operator+(difference_type n) const
+    {
+      return iterator(m_words, m_ranks, m_num_words, m_begin, m_pos + n);
+    }
+    RAJA_HOST_DEVICE iterator operator-(difference_type n) const
+    {
+      return iterator(m_words, m_ranks, m_num_words, m_begin, m_pos - n);
+    }
+    RAJA_HOST_DEVICE friend iterator operator+(difference_type n,
+                                               iterator const& it)
+    {
+      return it + n;
+    }
+    RAJA_HOST_DEVICE difference_type operator-(iterator const& rhs) const
+    {
+      return m_pos - rhs.m_pos;
+    }
+
+    RAJA_HOST_DEVICE bool operator==(iterator const& rhs) const
+    {
+      return m_pos == rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator!=(iterator const& rhs) const
+    {
+      return m_pos != rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator<(iterator const& rhs) const
+    {
+      return m_pos < rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator>(iterator const& rhs) const
+    {
+      return m_pos > rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator<=(iterator const& rhs) const
+    {
+      return m_pos <= rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator>=(iterator const& rhs) const
+    {
+      return m_pos >= rhs.m_pos;
+    }
+
+  private:
+    const std::uint64_t* m_words = nullptr;
+    const Index_type* m_ranks = nullptr;
+    Index_type m_num_words = 0;
+    StorageT m_begin = 0;
+    Index_type m_pos = 0;
+  };
+
+  //@}
+
+  //@{
+  //!   @name Constructors and destructor.
+
+  /*!
+   * \brief Construct a bitset segment from a packed mask over the range
+   *        [begin, end) and use given camp resource to allocate the
+   *        segment data.
+   *
+   * \param words mask of (end - begin + 63) / 64 words, bit k of word w is
+   *        set when index begin + 64 * w + k is in the segment
+   * \param begin first index of the range
+   * \param end one past the last index of the range
+   * \param resource camp resource defining memory space where the segment
+   *        data live
+   *
+   * Bits past end in the last word are ignored. The mask must live in host
+   * memory.
+   */
+  TypedBitsetSegment(const std::uint64_t* words,
+                     value_type begin,
+                     value_type end,
+                     camp::resources::Resource resource)
+  {
+    initIndexData(words, begin, end, resource);
+  }
+
+  /*!
+   * \brief Construct a bitset segment from a container of mask words over
+   *        the range [begin, end).
+   *
+   * The given container must provide methods begin(), end(), and size(),
+   * hold at least (end - begin + 63) / 64 words, and its data must live in
+   * host memory.
+   */
+  template <typename Container,
+            typename = typename std::enable_if<
+                !std::is_pointer<Container>::value>::type>
+  TypedBitsetSegment(const Container& container,
+                     value_type begin,
+                     value_type end,
+                     camp::resources::Resource resource)
+  {
+    std::vector<std::uint64_t> words(container.begin(), container.end());
+    if (static_cast<Index_type>(words.size()) <
+        (static_cast<Index_type>(end) - static_cast<Index_type>(begin) +
+         word_bits - 1) / word_bits) {
+      RAJA_ABORT_OR_THROW("TypedBitsetSegment: mask shorter than the range");
+    }
+    initIndexData(words.data(), begin, end, resource);
+  }
+
+  //! Disable compiler generated constructor
+  TypedBitsetSegment() = delete;
+
+  //! Copy constructor, a shallow copy as for TypedListSegment
+  RAJA_HOST_DEVICE TypedBitsetSegment(const TypedBitsetSegment& other)
+      : m_words(other.m_words),
+        m_ranks(other.m_ranks),
+        m_num_words(other.m_num_words),
+        m_begin(other.m_begin),
+        m_end(other.m_end)
+  {
+  }
+
+  //! Copy assignment, a shallow copy as for TypedListSegment
+  RAJA_HOST_DEVICE TypedBitsetSegment& operator=(
+      const TypedBitsetSegment& other)
+  {
+    if (this != &other) {
+      clear();
+      m_words = other.m_words;
+      m_ranks = other.m_ranks;
+      m_num_words = other.m_num_words;
+      m_begin = other.m_begin;
+      m_end = other.m_end;
+    }
+    return *this;
+  }
+
+  //! Move constructor
+  RAJA_HOST_DEVICE TypedBitsetSegment(TypedBitsetSegment&& rhs)
+      : m_resource(rhs.m_resource),
+        m_words(rhs.m_words),
+        m_ranks(rhs.m_ranks),
+        m_num_words(rhs.m_num_words),
+        m_begin(rhs.m_begin),
+        m_end(rhs.m_end)
+  {
+    rhs.m_resource = nullptr;
+    rhs.m_words = nullptr;
+    rhs.m_ranks = nullptr;
+    rhs.m_num_words = 0;
+    rhs.m_end = rhs.m_begin;
+  }
+
+  //! Move assignment
+  RAJA_HOST_DEVICE TypedBitsetSegment& operator=(TypedBitsetSegment&& rhs)
+  {
+    if (this != &rhs) {
+      clear();
+      m_resource = rhs.m_resource;
+      m_words = rhs.m_words;
+      m_ranks = rhs.m_ranks;
+      m_num_words = rhs.m_num_words;
+      m_begin = rhs.m_begin;
+      m_end = rhs.m_end;
+
+      rhs.m_resource = nullptr;
+      rhs.m_words = nullptr;
+      rhs.m_ranks = nullptr;
+      rhs.m_num_words = 0;
+      rhs.m_end = rhs.m_begin;
+    }
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE ~TypedBitsetSegment() { clear(); }
+
+  //! Releases the segment data if this segment owns it
+  RAJA_HOST_DEVICE void clear()
+  {
+#if !defined(RAJA_DEVICE_CODE)
+    if (m_resource != nullptr) {
+      if (m_words != nullptr) m_resource->deallocate(m_words);
+      if (m_ranks != nullptr) m_resource->deallocate(m_ranks);
+      delete m_resource;
+    }
+#endif
+    m_resource = nullptr;
+    m_words = nullptr;
+    m_ranks = nullptr;
+    m_num_words = 0;
+    m_end = m_begin;
+  }
+
+  //@}
+
+  //@{
+  //!   @name Accessor methods
+
+  RAJA_HOST_DEVICE iterator begin() const
+  {
+    return iterator(m_words, m_ranks, m_num_words, m_begin, 0);
+  }
+
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    return iterator(m_words, m_ranks, m_num_words, m_begin, size());
+  }
+
+  //! Number of set indices in the segment
+  RAJA_HOST_DEVICE Index_type size() const
+  {
+    return m_ranks != nullptr ? m_ranks[m_num_words] : 0;
+  }
+
+  //! First index of the range covered by the mask
+  RAJA_HOST_DEVICE value_type getRangeBegin() const { return m_begin; }
+
+  //! One past the last index of the range covered by the mask
+  RAJA_HOST_DEVICE value_type getRangeEnd() const { return m_end; }
+
+  RAJA_HOST_DEVICE Index_type getNumWords() const { return m_num_words; }
+
+  //! Number of blocks of block_size set bits
+  RAJA_HOST_DEVICE Index_type getNumBlocks() const
+  {
+    return (size() + block_size - 1) / block_size;
+  }
+
+  //! Always Owned by the segment that copied the mask
+  RAJA_HOST_DEVICE IndexOwnership getIndexOwnership() const
+  {
+    return m_resource != nullptr ? Owned : Unowned;
+  }
+
+  /*!
+   * \brief Call body with every index of block b, in order.
+   *
+   * Block b holds the set bits of rank [b * block_size, (b + 1) *
+   * block_size). Its words are visited one by one, jumping from set bit to
+   * set bit, and with InnerPolicy simd_exec dense words are visited with a
+   * vectorized loop. The segment data must be accessible on the host.
+   */
+  template <typename InnerPolicy, typename Body>
+  RAJA_INLINE void forEachInBlock(Index_type b, Body const& body) const
+  {
+    const Index_type total = size();
+    const Index_type r0 = b * block_size;
+    const Index_type r1 = r0 + block_size < total ? r0 + block_size : total;
+    const Index_type w0 = detail::bitset_word_of_rank(m_ranks, m_num_words, r0);
+    const Index_type w1 =
+        detail::bitset_word_of_rank(m_ranks, m_num_words, r1 - 1);
+
+    for (Index_type w = w0; w <= w1; ++w) {
+      std::uint64_t word = m_words[w];
+      // drop the set bits that belong to the previous and next blocks
+      if (w == w0 && r0 > m_ranks[w]) {
+        const int k = select_bit(word, static_cast<int>(r0 - m_ranks[w]));
+        word &= ~std::uint64_t(0) << k;
+      }
+      if (w == w1 && r1 < m_ranks[w + 1]) {
+        const int k = select_bit(m_words[w], static_cast<int>(r1 - m_ranks[w]));
+        word &= (std::uint64_t(1) << k) - 1;
+      }
+      const Index_type base = static_cast<Index_type>(m_begin) + w * word_bits;
+      detail::bitset_word_loop(InnerPolicy{}, word, base, [&](Index_type i) {
+        body(static_cast<StorageT>(i));
+      });
+    }
+  }
+
+  //@}
+
+  //@{
+  //!   @name Segment comparison methods
+
+  /*!
+   * \brief Compare this segment's indices to an array of values
+   *
+   * Method assumes the segment data lives in host memory space.
+   */
+  bool indicesEqual(const value_type* container, Index_type len) const
+  {
+    if (len != size()) return false;
+    if (len > 0 && container == nullptr) return false;
+    Index_type i = 0;
+    for (Index_type w = 0; w < m_num_words; ++w) {
+      std::uint64_t word = m_words[w];
+      while (word != 0) {
+        const Index_type idx = static_cast<Index_type>(m_begin) +
+                               w * word_bits + count_trailing_zeros(word);
+        if (container[i++] != static_cast<value_type>(idx)) return false;
+        word &= word - 1;
+      }
+    }
+    return true;
+  }
+
+  //@}
+
+  /*!
+   * \brief Swap this segment with another
+   */
+  RAJA_HOST_DEVICE void swap(TypedBitsetSegment& other)
+  {
+    camp::safe_swap(m_resource, other.m_resource);
+    camp::safe_swap(m_words, other.m_words);
+    camp::safe_swap(m_ranks, other.m_ranks);
+    camp::safe_swap(m_num_words, other.m_num_words);
+    camp::safe_swap(m_begin, other.m_begin);
+    camp::safe_swap(m_end, other.m_end);
+  }
+
+private:
+  //
+  // Copy the mask, clear the bits past end, count the set bits before
+  // every word, and copy the result to the memory space of the resource.
+  //
+  void initIndexData(const std::uint64_t* words,
+                     value_type begin,
+                     value_type end,
+                     camp::resources::Resource resource_)
+  {
+    m_begin = begin;
+    m_end = begin;
+    const Index_type len =
+        static_cast<Index_type>(end) - static_cast<Index_type>(begin);
+    if (len <= 0 || words == nullptr) {
+      return;
+    }
+
+    const Index_type num_words = (len + word_bits - 1) / word_bits;
+    std::vector<std::uint64_t> mask(words, words + num_words);
+    const Index_type tail = len % word_bits;
+    if (tail != 0) {
+      mask[num_words - 1] &= (std::uint64_t(1) << tail) - 1;
+    }
+
+    std::vector<Index_type> ranks(num_words + 1);
+    ranks[0] = 0;
+    for (Index_type w = 0; w < num_words; ++w) {
+      ranks[w + 1] = ranks[w] + popcount(mask[w]);
+    }
+
+    m_resource = new camp::resources::Resource(resource_);
+    m_end = end;
+    m_num_words = num_words;
+
+    m_words = m_resource->allocate<std::uint64_t>(num_words);
+    m_resource->memcpy(m_words, mask.data(),
+                       sizeof(std::uint64_t) * num_words);
+
+    m_ranks = m_resource->allocate<Index_type>(num_words + 1);
+    m_resource->memcpy(m_ranks, ranks.data(),
+                       sizeof(Index_type) * (num_words + 1));
+  }
+
+  // Copy of camp resource passed to ctor, only set in the owning segment
+  camp::resources::Resource* m_resource = nullptr;
+
+  // Mask, one bit per index of [m_begin, m_end)
+  std::uint64_t* m_words = nullptr;
+
+  // Number of set bits before each word, and in total at m_num_words
+  Index_type* m_ranks = nullptr;
+
+  // Number of words of the mask
+  Index_type m_num_words = 0;
+
+  // Range covered by the mask
+  value_type m_begin = 0;
+  value_type m_end = 0;
+};
+
+template <typename StorageT>
+constexpr Index_type TypedBitsetSegment<StorageT>::word_bits;
+
+template <typename StorageT>
+constexpr Index_type TypedBitsetSegment<StorageT>::block_size;
+
+//! Alias for A TypedBitsetSegment<Index_type>
+using BitsetSegment = TypedBitsetSegment<Index_type>;
+
+namespace type_traits
+{
+
+template <typename StorageT>
+struct is_blocked_segment<TypedBitsetSegment<StorageT>> : std::true_type {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! Specialization of std::swap for TypedBitsetSegment
+template <typename StorageT>
+RAJA_INLINE void swap(RAJA::TypedBitsetSegment<StorageT>& a,
+                      RAJA::TypedBitsetSegment<StorageT>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,698 @@
+/*!
+ ******************************************************************************
+ *
+ * \file CompressedListSegment.hpp
+ *
+ * \brief  Header file containing definition of RAJA compressed list segment
+ *         class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_CompressedListSegment_HPP
+#define RAJA_CompressedListSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/SegmentBlocks.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! How the entries of one block of a TypedCompressedListSegment are stored
+enum class CompressedBlockKind : std::uint8_t {
+  Run,       //!< base, base+1, ..., no payload
+  Offset8,   //!< base plus an 8-bit offset per entry
+  Offset16,  //!< base plus a 16-bit offset per entry
+  Offset32,  //!< base plus a 32-bit offset per entry
+  Raw        //!< the indices themselves
+};
+
+template <typename StorageT>
+struct CompressedListBlock {
+  //! First index of a run, smallest index of the block otherwise
+  StorageT base;
+  //! Byte offset of the block's entries in the payload
+  std::uint32_t payload;
+  CompressedBlockKind kind;
+};
+
+//! Index at slot of block
+template <typename StorageT>
+RAJA_HOST_DEVICE RAJA_INLINE StorageT
+compressed_list_value(CompressedListBlock<StorageT> const& block,
+                      const unsigned char* payload,
+                      Index_type slot)
+{
+  using unsigned_t = typename std::make_unsigned<StorageT>::type;
+  const unsigned char* entries = payload + block.payload;
+  unsigned_t offset = 0;
+  switch (block.kind) {
+    case CompressedBlockKind::Run:
+      offset = static_cast<unsigned_t>(slot);
+      break;
+    case CompressedBlockKind::Offset8:
+      offset = reinterpret_cast<const std::uint8_t*>(entries)[slot];
+      break;
+    case CompressedBlockKind::Offset16:
+      offset = reinterpret_cast<const std::uint16_t*>(entries)[slot];
+      break;
+    case CompressedBlockKind::Offset32:
+      offset = reinterpret_cast<const std::uint32_t*>(entries)[slot];
+      break;
+    case CompressedBlockKind::Raw:
+      return reinterpret_cast<const StorageT*>(entries)[slot];
+  }
+  return static_cast<StorageT>(static_cast<unsigned_t>(block.base) + offset);
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedCompressedListSegment
+ *
+ * \brief  Segment class representing an arbitrary collection of indices,
+ *         stored compressed.
+ *
+ * \tparam StorageT integral type of the segment indices
+ *
+ * The indices are split into blocks of block_size entries. A block whose
+ * indices are consecutive and increasing is stored as its first index only.
+ * Other blocks store their smallest index and the offset of every entry
+ * from it in 8, 16 or 32 bits, the fewest that hold the block's range of
+ * indices. Index lists that are mostly increasing with short gaps, as the
+ * lists of unstructured mesh traversals, take one byte per index or less
+ * instead of sizeof(StorageT).
+ *
+ * The segment models a random access Iterable like TypedListSegment, so it
+ * can be used with any RAJA::forall policy and in a TypedIndexSet. With host
+ * policies RAJA::forall runs the policy over blocks and decodes the indices
+ * of each block in a loop over the entries; with seq_exec and simd_exec
+ * that loop is not or is vectorized, like the loop over a TypedListSegment.
+ *
+ * Usage:
+ *
+ * \verbatim
+ * camp::resources::Resource resource{ camp resource type };
+ * TypedCompressedListSegment<T> listseg(indices, length, resource);
+ *
+ * forall<exec_pol>(listseg, [=] (T i) {
+ *   // loop body -- use i as index value
+ * });
+ * \endverbatim
+ *
+ * Copies of the segment, like copies of a TypedListSegment, are shallow and
+ * do not own the compressed data.
+ *
+ ******************************************************************************
+ */
+template <typename StorageT>
+class TypedCompressedListSegment
+{
+  static_assert(std::is_integral<StorageT>::value,
+                "TypedCompressedListSegment requires an integral index type");
+
+  using block_type = detail::CompressedListBlock<StorageT>;
+  using unsigned_type = typename std::make_unsigned<StorageT>::type;
+
+public:
+
+  //! Number of indices in a block, only the last block may have fewer
+  static constexpr Index_type block_size = 64;
+
+  //@{
+  //!   @name Types used in implementation based on template parameter.
+
+  //! The underlying value type for index storage
+  using value_type = StorageT;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //! Random access iterator decoding one index per dereference
+  class iterator
+  {
+  public:
+    using value_type = StorageT;
+    using difference_type = Index_type;
+    using pointer = const StorageT*;
+    using reference = StorageT;
+    using iterator_category = std::random_access_iterator_tag;
+
+    constexpr iterator() noexcept = default;
+
+    RAJA_HOST_DEVICE iterator(const block_type* blocks,
+                              const unsigned char* payload,
+                              Index_type pos)
+        : m_blocks(blocks), m_payload(payload), m_pos(pos)
+    {
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE StorageT operator*() const
+    {
+      return detail::compressed_list_value(m_blocks[m_pos / block_size],
+                                           m_payload,
+                                           m_pos % block_size);
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE StorageT
+    operator[](difference_type n) const
+    {
+      return *(*this + n);
+    }
+
+    RAJA_HOST_DEVICE iterator& operator++()
+    {
+      ++m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator& operator--()
+    {
+      --m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++m_pos;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --m_pos;
+      return tmp;
+    }
+
+    RAJA_HOST_DEVICE iterator& operator+=(difference_type n)
+    {
+      m_pos += n;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator& operator-=(difference_type n)
+    {
+      m_pos -= n;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator operator+(difference_type n) const
+    {
+      return iterator(m_blocks, m_payload, m_pos + n);
+    }
+    RAJA_HOST_DEVICE iterator operator-(difference_type n) const
+    {
+      return iterator(m_blocks, m_payload, m_pos - n);
+    }
+    RAJA_HOST_DEVICE friend iterator operator+(difference_type n,
+                                               iterator const& it)
+    {
+      return it + n;
+    }
+    RAJA_HOST_DEVICE difference_type operator-(iterator const& rhs) const
+    {
+      return m_pos - rhs.m_pos;
+    }
+
+    RAJA_HOST_DEVICE bool operator==(iterator const& rhs) const
+    {
+      return m_pos == rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator!=(iterator const& rhs) const
+    {
+      return m_pos != rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator<(iterator const& rhs) const
+    {
+      return m_pos < rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator>(iterator const& rhs) const
+    {
+      return m_pos > rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator<=(iterator const& rhs) const
+    {
+      return m_pos <= rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator>=(iterator const& rhs) const
+    {
+      return m_pos >= rhs.m_pos;
+    }
+
+  private:
+    const block_type* m_blocks = nullptr;
+    const unsigned char* m_payload = nullptr;
+    Index_type m_pos = 0;
+  };
+
+  //@}
+
+  //@{
+  //!   @name Constructors and destructor.
+
+  /*!
+   * \brief Construct a compressed list segment from given array with
+   *        specified length and use given camp resource to allocate the
+   *        compressed data.
+   *
+   * \param values array of indices defining iteration space of segment
+   * \param length number of indices
+   * \param resource camp resource defining memory space where the
+   *        compressed data live
+   *
+   * The indices are compressed on the host, values must live in host memory.
+   */
+  TypedCompressedListSegment(const value_type* values,
+                             Index_type length,
+                             camp::resources::Resource resource)
+  {
+    initIndexData(values, length, resource);
+  }
+
+  /*!
+   * \brief Construct a compressed list segment from given container of
+   *        indices.
+   *
+   * \param container container of indices for segment
+   * \param resource camp resource defining memory space where the
+   *        compressed data live
+   *
+   * The given container must provide methods begin(), end(), and size(),
+   * and its data must live in host memory.
+   */
+  template <typename Container>
+  TypedCompressedListSegment(const Container& container,
+                             camp::resources::Resource resource)
+  {
+    std::vector<value_type> values(container.begin(), container.end());
+    initIndexData(values.data(), static_cast<Index_type>(values.size()),
+                  resource);
+  }
+
+  //! Disable compiler generated constructor
+  TypedCompressedListSegment() = delete;
+
+  //! Copy constructor, a shallow copy as for TypedListSegment
+  RAJA_HOST_DEVICE TypedCompressedListSegment(
+      const TypedCompressedListSegment& other)
+      : m_blocks(other.m_blocks),
+        m_payload(other.m_payload),
+        m_size(other.m_size),
+        m_payload_bytes(other.m_payload_bytes)
+  {
+  }
+
+  //! Copy assignment, a shallow copy as for TypedListSegment
+  RAJA_HOST_DEVICE TypedCompressedListSegment& operator=(
+      const TypedCompressedListSegment& other)
+  {
+    if (this != &other) {
+      clear();
+      m_blocks = other.m_blocks;
+      m_payload = other.m_payload;
+      m_size = other.m_size;
+      m_payload_bytes = other.m_payload_bytes;
+    }
+    return *this;
+  }
+
+  //! Move constructor
+  RAJA_HOST_DEVICE TypedCompressedListSegment(
+      TypedCompressedListSegment&& rhs)
+      : m_resource(rhs.m_resource),
+        m_blocks(rhs.m_blocks),
+        m_payload(rhs.m_payload),
+        m_size(rhs.m_size),
+        m_payload_bytes(rhs.m_payload_bytes)
+  {
+    rhs.m_resource = nullptr;
+    rhs.m_blocks = nullptr;
+    rhs.m_payload = nullptr;
+    rhs.m_size = 0;
+    rhs.m_payload_bytes = 0;
+  }
+
+  //! Move assignment
+  RAJA_HOST_DEVICE TypedCompressedListSegment& operator=(
+      TypedCompressedListSegment&& rhs)
+  {
+    if (this != &rhs) {
+      clear();
+      m_resource = rhs.m_resource;
+      m_blocks = rhs.m_blocks;
+      m_payload = rhs.m_payload;
+      m_size = rhs.m_size;
+      m_payload_bytes = rhs.m_payload_bytes;
+
+      rhs.m_resource = nullptr;
+      rhs.m_blocks = nullptr;
+      rhs.m_payload = nullptr;
+      rhs.m_size = 0;
+      rhs.m_payload_bytes = 0;
+    }
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE ~TypedCompressedListSegment() { clear(); }
+
+  //! Releases the compressed data if this segment owns it
+  RAJA_HOST_DEVICE void clear()
+  {
+#if !defined(RAJA_DEVICE_CODE)
+    if (m_resource != nullptr) {
+      if (m_blocks != nullptr) m_resource->deallocate(m_blocks);
+      if (m_payload != nullptr) m_resource->deallocate(m_payload);
+      delete m_resource;
+    }
+#endif
+    m_resource = nullptr;
+    m_blocks = nullptr;
+    m_payload = nullptr;
+    m_size = 0;
+    m_payload_bytes = 0;
+  }
+
+  //@}
+
+  //@{
+  //!   @name Accessor methods
+
+  RAJA_HOST_DEVICE iterator begin() const
+  {
+    return iterator(m_blocks, m_payload, 0);
+  }
+
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    return iterator(m_blocks, m_payload, m_size);
+  }
+
+  //! Number of indices in the segment
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  RAJA_HOST_DEVICE Index_type getNumBlocks() const
+  {
+    return (m_size + block_size - 1) / block_size;
+  }
+
+  //! Bytes used by the compressed data
+  RAJA_HOST_DEVICE size_t getCompressedBytes() const
+  {
+    return static_cast<size_t>(getNumBlocks()) * sizeof(block_type) +
+           m_payload_bytes;
+  }
+
+  //! Always Owned by the segment that compressed the indices
+  RAJA_HOST_DEVICE IndexOwnership getIndexOwnership() const
+  {
+    return m_resource != nullptr ? Owned : Unowned;
+  }
+
+  /*!
+   * \brief Call body with every index of block b, in order.
+   *
+   * The entries are decoded in a loop over the block, which is vectorized
+   * as a loop with InnerPolicy (seq_exec, simd_exec or loop_exec) is.
+   * The block data must be accessible on the host.
+   */
+  template <typename InnerPolicy, typename Body>
+  RAJA_INLINE void forEachInBlock(Index_type b, Body const& body) const
+  {
+    const block_type block = m_blocks[b];
+    const Index_type len = (b + 1) * block_size <= m_size
+                               ? block_size
+                               : m_size - b * block_size;
+    const unsigned_type base = static_cast<unsigned_type>(block.base);
+    const unsigned char* entries = m_payload + block.payload;
+
+    switch (block.kind) {
+      case detail::CompressedBlockKind::Run:
+        detail::segment_block_loop(InnerPolicy{}, len, [&](Index_type k) {
+          body(static_cast<StorageT>(base + static_cast<unsigned_type>(k)));
+        });
+        break;
+      case detail::CompressedBlockKind::Offset8: {
+        const std::uint8_t* offsets =
+            reinterpret_cast<const std::uint8_t*>(entries);
+        detail::segment_block_loop(InnerPolicy{}, len, [&](Index_type k) {
+          body(static_cast<StorageT>(base + offsets[k]));
+        });
+        break;
+      }
+      case detail::CompressedBlockKind::Offset16: {
+        const std::uint16_t* offsets =
+            reinterpret_cast<const std::uint16_t*>(entries);
+        detail::segment_block_loop(InnerPolicy{}, len, [&](Index_type k) {
+          body(static_cast<StorageT>(base + offsets[k]));
+        });
+        break;
+      }
+      case detail::CompressedBlockKind::Offset32: {
+        const std::uint32_t* offsets =
+            reinterpret_cast<const std::uint32_t*>(entries);
+        detail::segment_block_loop(InnerPolicy{}, len, [&](Index_type k) {
+          body(static_cast<StorageT>(base + offsets[k]));
+        });
+        break;
+      }
+      case detail::CompressedBlockKind::Raw: {
+        const StorageT* values = reinterpret_cast<const StorageT*>(entries);
+        detail::segment_block_loop(InnerPolicy{}, len, [&](Index_type k) {
+          body(values[k]);
+        });
+        break;
+      }
+    }
+  }
+
+  //@}
+
+  //@{
+  //!   @name Segment comparison methods
+
+  /*!
+   * \brief Compare this segment's indices to an array of values
+   *
+   * Method assumes the compressed data lives in host memory space.
+   */
+  bool indicesEqual(const value_type* container, Index_type len) const
+  {
+    if (len != m_size) return false;
+    if (len > 0 && container == nullptr) return false;
+    auto it = begin();
+    for (Index_type i = 0; i < m_size; ++i, ++it) {
+      if (*it != container[i]) return false;
+    }
+    return true;
+  }
+
+  //@}
+
+  /*!
+   * \brief Swap this segment with another
+   */
+  RAJA_HOST_DEVICE void swap(TypedCompressedListSegment& other)
+  {
+    camp::safe_swap(m_resource, other.m_resource);
+    camp::safe_swap(m_blocks, other.m_blocks);
+    camp::safe_swap(m_payload, other.m_payload);
+    camp::safe_swap(m_size, other.m_size);
+    camp::safe_swap(m_payload_bytes, other.m_payload_bytes);
+  }
+
+private:
+  static size_t width_of(detail::CompressedBlockKind kind)
+  {
+    switch (kind) {
+      case detail::CompressedBlockKind::Offset8:
+        return 1;
+      case detail::CompressedBlockKind::Offset16:
+        return 2;
+      case detail::CompressedBlockKind::Offset32:
+        return 4;
+      case detail::CompressedBlockKind::Raw:
+        return sizeof(StorageT);
+      default:
+        return 0;
+    }
+  }
+
+  //
+  // Compress the indices on the host and copy the result to the memory
+  // space of the resource.
+  //
+  void initIndexData(const value_type* values,
+                     Index_type len,
+                     camp::resources::Resource resource_)
+  {
+    if (len <= 0 || values == nullptr) {
+      return;
+    }
+
+    const Index_type num_blocks = (len + block_size - 1) / block_size;
+    std::vector<block_type> blocks(num_blocks);
+    std::vector<unsigned char> payload;
+
+    for (Index_type b = 0; b < num_blocks; ++b) {
+      const value_type* v = values + b * block_size;
+      const Index_type n =
+          (b + 1) * block_size <= len ? block_size : len - b * block_size;
+
+      bool is_run = true;
+      value_type vmin = v[0];
+      value_type vmax = v[0];
+      for (Index_type k = 1; k < n; ++k) {
+        is_run = is_run && static_cast<unsigned_type>(v[k]) ==
+                               static_cast<unsigned_type>(v[0]) +
+                                   static_cast<unsigned_type>(k);
+        vmin = v[k] < vmin ? v[k] : vmin;
+        vmax = v[k] > vmax ? v[k] : vmax;
+      }
+
+      block_type& block = blocks[b];
+      if (is_run) {
+        block.base = v[0];
+        block.payload = 0;
+        block.kind = detail::CompressedBlockKind::Run;
+        continue;
+      }
+
+      const std::uint64_t range = static_cast<std::uint64_t>(
+          static_cast<unsigned_type>(static_cast<unsigned_type>(vmax) -
+                                     static_cast<unsigned_type>(vmin)));
+      block.base = vmin;
+      if (range <= std::numeric_limits<std::uint8_t>::max()) {
+        block.kind = detail::CompressedBlockKind::Offset8;
+      } else if (range <= std::numeric_limits<std::uint16_t>::max()) {
+        block.kind = detail::CompressedBlockKind::Offset16;
+      } else if (range <= std::numeric_limits<std::uint32_t>::max()) {
+        block.kind = detail::CompressedBlockKind::Offset32;
+      } else {
+        block.kind = detail::CompressedBlockKind::Raw;
+      }
+
+      // entries are aligned to their width
+      const size_t width = width_of(block.kind);
+      const size_t start = (payload.size() + width - 1) / width * width;
+      if (start + n * width > std::numeric_limits<std::uint32_t>::max()) {
+        RAJA_ABORT_OR_THROW(
+            "TypedCompressedListSegment: compressed indices exceed 4 GiB");
+      }
+      block.payload = static_cast<std::uint32_t>(start);
+      payload.resize(start + n * width);
+
+      unsigned char* entries = payload.data() + start;
+      for (Index_type k = 0; k < n; ++k) {
+        const unsigned_type offset = static_cast<unsigned_type>(v[k]) -
+                                     static_cast<unsigned_type>(vmin);
+        switch (block.kind) {
+          case detail::CompressedBlockKind::Offset8:
+            reinterpret_cast<std::uint8_t*>(entries)[k] =
+                static_cast<std::uint8_t>(offset);
+            break;
+          case detail::CompressedBlockKind::Offset16:
+            reinterpret_cast<std::uint16_t*>(entries)[k] =
+                static_cast<std::uint16_t>(offset);
+            break;
+          case detail::CompressedBlockKind::Offset32:
+            reinterpret_cast<std::uint32_t*>(entries)[k] =
+                static_cast<std::uint32_t>(offset);
+            break;
+          default:
+            reinterpret_cast<value_type*>(entries)[k] = v[k];
+            break;
+        }
+      }
+    }
+
+    m_resource = new camp::resources::Resource(resource_);
+    m_size = len;
+
+    m_blocks = m_resource->allocate<block_type>(num_blocks);
+    m_resource->memcpy(m_blocks, blocks.data(),
+                       sizeof(block_type) * num_blocks);
+
+    m_payload_bytes = payload.size();
+    if (m_payload_bytes > 0) {
+      m_payload = m_resource->allocate<unsigned char>(m_payload_bytes);
+      m_resource->memcpy(m_payload, payload.data(), m_payload_bytes);
+    }
+  }
+
+  // Copy of camp resource passed to ctor, only set in the owning segment
+  camp::resources::Resource* m_resource = nullptr;
+
+  // One header per block
+  block_type* m_blocks = nullptr;
+
+  // Offsets and raw indices of the blocks that are not runs
+  unsigned char* m_payload = nullptr;
+
+  // Number of indices
+  Index_type m_size = 0;
+
+  // Size of the payload in bytes
+  size_t m_payload_bytes = 0;
+};
+
+template <typename StorageT>
+constexpr Index_type TypedCompressedListSegment<StorageT>::block_size;
+
+//! Alias for A TypedCompressedListSegment<Index_type>
+using CompressedListSegment = TypedCompressedListSegment<Index_type>;
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_compressed_list_segment : std::false_type {
+};
+
+template <typename StorageT>
+struct is_compressed_list_segment<TypedCompressedListSegment<StorageT>>
+    : std::true_type {
+};
+
+template <typename StorageT>
+struct is_blocked_segment<TypedCompressedListSegment<StorageT>>
+    : std::true_type {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! Specialization of std::swap for TypedCompressedListSegment
+template <typename StorageT>
+RAJA_INLINE void swap(RAJA::TypedCompressedListSegment<StorageT>& a,
+                      RAJA::TypedCompressedListSegment<StorageT>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
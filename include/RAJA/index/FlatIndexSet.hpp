@@ -0,0 +1,509 @@
+/*!
+ ******************************************************************************
+ *
+ * \file FlatIndexSet.hpp
+ *
+ * \brief   RAJA header file defining an index set class that stores its
+ *          segments in one contiguous, type-tagged array.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_FlatIndexSet_HPP
+#define RAJA_FlatIndexSet_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/index/IndexSet.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+template <typename... TALL>
+class TypedFlatIndexSet;
+
+namespace detail
+{
+
+//! Position of T in Ts..., sizeof...(Ts) if T is not one of them
+template <typename T, typename... Ts>
+struct flat_type_index;
+
+template <typename T>
+struct flat_type_index<T> : std::integral_constant<int, 0> {
+};
+
+template <typename T, typename... Ts>
+struct flat_type_index<T, T, Ts...> : std::integral_constant<int, 0> {
+};
+
+template <typename T, typename U, typename... Ts>
+struct flat_type_index<T, U, Ts...>
+    : std::integral_constant<int, 1 + flat_type_index<T, Ts...>::value> {
+};
+
+//@{
+//! Type erased operations on a segment of type T stored in a slot
+template <typename T>
+void flat_segment_destroy(void* seg)
+{
+  static_cast<T*>(seg)->~T();
+}
+
+template <typename T>
+void flat_segment_relocate(void* dst, void* src)
+{
+  new (dst) T(std::move(*static_cast<T*>(src)));
+  static_cast<T*>(src)->~T();
+}
+
+template <typename T>
+void flat_segment_copy(void* dst, const void* src)
+{
+  new (dst) T(*static_cast<const T*>(src));
+}
+
+template <typename T>
+bool flat_segment_equal(const void* a, const void* b)
+{
+  return *static_cast<const T*>(a) == *static_cast<const T*>(b);
+}
+
+template <typename T, typename BODY, typename... ARGS>
+void flat_segment_call(const void* seg, BODY& body, ARGS&... args)
+{
+  body(*static_cast<const T*>(seg), std::forward<ARGS>(args)...);
+}
+//@}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Contiguous storage of the segments of a TypedFlatIndexSet.
+ *
+ *         Every segment lives in a slot large enough for any of Ts..., next
+ *         to a one byte tag holding its position in Ts... and the icount it
+ *         starts at. Growing the storage moves the segments over, so list
+ *         segments keep ownership of their indices.
+ *
+ *         A store built from copies of segments of another store (a gathered
+ *         slice) keeps that store alive through keep_alive, since copied
+ *         list segments do not own their indices.
+ *
+ ******************************************************************************
+ */
+template <typename... Ts>
+class FlatSegmentStore
+{
+  static_assert(sizeof...(Ts) > 0 && sizeof...(Ts) < 256,
+                "TypedFlatIndexSet supports between 1 and 255 segment types");
+
+public:
+  using slot_type = typename std::aligned_union<0, Ts...>::type;
+
+  FlatSegmentStore() : m_slots(nullptr), m_size(0), m_capacity(0)
+  {
+    m_icounts.push_back(0);
+  }
+
+  FlatSegmentStore(const FlatSegmentStore&) = delete;
+  FlatSegmentStore& operator=(const FlatSegmentStore&) = delete;
+
+  ~FlatSegmentStore()
+  {
+    using destroy_fn = void (*)(void*);
+    static constexpr destroy_fn destroy[] = {&flat_segment_destroy<Ts>...};
+    for (size_t i = 0; i < m_size; ++i) {
+      destroy[m_types[i]](&m_slots[i]);
+    }
+  }
+
+  size_t size() const { return m_size; }
+
+  std::uint8_t type(size_t i) const { return m_types[i]; }
+
+  const void* slot(size_t i) const { return &m_slots[i]; }
+
+  //! icount at which slot i starts, slot size() starts at the total length
+  Index_type icount(size_t i) const { return m_icounts[i]; }
+
+  void reserve(size_t n)
+  {
+    if (n <= m_capacity) {
+      return;
+    }
+    using relocate_fn = void (*)(void*, void*);
+    static constexpr relocate_fn relocate[] = {&flat_segment_relocate<Ts>...};
+
+    std::unique_ptr<slot_type[]> slots(new slot_type[n]);
+    for (size_t i = 0; i < m_size; ++i) {
+      relocate[m_types[i]](&slots[i], &m_slots[i]);
+    }
+    m_slots = std::move(slots);
+    m_capacity = n;
+    m_types.reserve(n);
+    m_icounts.reserve(n + 1);
+  }
+
+  //! Construct a segment of type T at the end from val
+  template <typename T, typename Tnew>
+  void emplace_back(Tnew&& val)
+  {
+    if (m_size == m_capacity) {
+      reserve(m_capacity ? 2 * m_capacity : 8);
+    }
+    T* seg = new (&m_slots[m_size]) T(std::forward<Tnew>(val));
+    m_types.push_back(static_cast<std::uint8_t>(flat_type_index<T, Ts...>::value));
+    m_icounts.push_back(m_icounts.back() + static_cast<Index_type>(seg->size()));
+    ++m_size;
+  }
+
+  //! Append a copy of slot i of other
+  void copy_back(const FlatSegmentStore& other, size_t i)
+  {
+    using copy_fn = void (*)(void*, const void*);
+    static constexpr copy_fn copy[] = {&flat_segment_copy<Ts>...};
+
+    if (m_size == m_capacity) {
+      reserve(m_capacity ? 2 * m_capacity : 8);
+    }
+    copy[other.m_types[i]](&m_slots[m_size], other.slot(i));
+    m_types.push_back(other.m_types[i]);
+    m_icounts.push_back(m_icounts.back() + other.m_icounts[i + 1] -
+                        other.m_icounts[i]);
+    ++m_size;
+  }
+
+  //! Whether slot i of this and slot j of other hold equal segments
+  bool equal(size_t i, const FlatSegmentStore& other, size_t j) const
+  {
+    using equal_fn = bool (*)(const void*, const void*);
+    static constexpr equal_fn equal_seg[] = {&flat_segment_equal<Ts>...};
+    return m_types[i] == other.m_types[j] &&
+           equal_seg[m_types[i]](slot(i), other.slot(j));
+  }
+
+  std::shared_ptr<const FlatSegmentStore> keep_alive;
+
+private:
+  std::unique_ptr<slot_type[]> m_slots;
+  std::vector<std::uint8_t> m_types;
+  std::vector<Index_type> m_icounts;
+  size_t m_size;
+  size_t m_capacity;
+};
+
+//! Appends a copy of each segment of a TypedIndexSet to a TypedFlatIndexSet
+template <typename FlatSet>
+struct FlatPushBack {
+  FlatSet& set;
+
+  template <typename T>
+  void operator()(T const& seg) const
+  {
+    set.push_back(seg);
+  }
+};
+
+}  // namespace detail
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class representing an index set whose segments are stored by
+ *         value in one contiguous, type-tagged array.
+ *
+ *         TypedFlatIndexSet<T0, T1, ...> supports the traversal interface of
+ *         TypedIndexSet<T0, T1, ...> and can be passed to RAJA::forall with
+ *         the same ExecPolicy<seg_it, seg_exec> policies. A segment is found
+ *         by indexing the array and its type by a table lookup on its tag,
+ *         instead of a per segment allocation and a search through the
+ *         segment types.
+ *
+ *         Copies and slices share the segments of the set they are made
+ *         from: copying and createSlice(begin, end) do not allocate, and
+ *         createSlice over a list of segment ids makes a single allocation.
+ *         A set that shares its segments copies them before push_back, so
+ *         pushing to a copy or slice never changes the set it came from.
+ *
+ *         Usage example:
+ *
+ *         \verbatim
+ *
+ *         RAJA::TypedFlatIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+ *         iset.reserve(nseg);
+ *         iset.push_back(RAJA::RangeSegment(0, 8));
+ *         iset.push_back(RAJA::ListSegment(idx, len, res));
+ *
+ *         using pol = RAJA::ExecPolicy<RAJA::omp_parallel_for_segit,
+ *                                      RAJA::loop_exec>;
+ *         RAJA::forall<pol>(iset.createSlice(0, nseg / 2), body);
+ *
+ *         \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename T0, typename... TREST>
+class TypedFlatIndexSet<T0, TREST...>
+{
+  using store_type = detail::FlatSegmentStore<T0, TREST...>;
+
+public:
+  using value_type = typename T0::value_type;
+
+  static_assert(
+      camp::concepts::all_of<
+          std::is_same<value_type, typename TREST::value_type>...>::value,
+      "All segments must have the same value_type");
+
+  using iterator = Iterators::numeric_iterator<Index_type>;
+
+  //! Construct empty index set
+  TypedFlatIndexSet()
+      : m_store(std::make_shared<store_type>()), m_begin(0), m_end(0)
+  {
+  }
+
+  ///
+  /// Construct from the segments of a TypedIndexSet, in order.
+  ///
+  /// Segments are copied; list segment copies do not own their indices, so
+  /// iset must outlive this set.
+  ///
+  template <typename... SEGS>
+  explicit TypedFlatIndexSet(const TypedIndexSet<SEGS...>& iset)
+      : TypedFlatIndexSet()
+  {
+    reserve(iset.getNumSegments());
+    for (size_t i = 0; i < iset.getNumSegments(); ++i) {
+      iset.segmentCall(i, detail::FlatPushBack<TypedFlatIndexSet>{*this});
+    }
+  }
+
+  //! Returns the number of types this TypedFlatIndexSet can store.
+  static constexpr size_t getNumTypes() { return 1 + sizeof...(TREST); }
+
+  //! Reserve storage for n segments in total
+  void reserve(size_t n)
+  {
+    make_unique_tail();
+    m_store->reserve(n);
+  }
+
+  //! Add copy of segment to back end of index set.
+  template <typename Tnew>
+  void push_back(Tnew&& val)
+  {
+    using seg_type = camp::decay<Tnew>;
+    static_assert(detail::flat_type_index<seg_type, T0, TREST...>::value <
+                      static_cast<int>(getNumTypes()),
+                  "Invalid type for this TypedFlatIndexSet");
+    make_unique_tail();
+    m_store->template emplace_back<seg_type>(std::forward<Tnew>(val));
+    ++m_end;
+  }
+
+  //! Return total number of segments in index set.
+  size_t getNumSegments() const { return m_end - m_begin; }
+
+  //! Return total length -- sum of lengths of all segments
+  size_t getLength() const
+  {
+    return static_cast<size_t>(m_store->icount(m_end) -
+                               m_store->icount(m_begin));
+  }
+
+  //! Return the icount at which segment segid starts
+  Index_type getStartingIcount(size_t segid) const
+  {
+    return m_store->icount(m_begin + segid) - m_store->icount(m_begin);
+  }
+
+  //! Whether segment segid has type P0
+  template <typename P0>
+  bool checkSegmentType(size_t segid) const
+  {
+    return m_store->type(m_begin + segid) ==
+           detail::flat_type_index<camp::decay<P0>, T0, TREST...>::value;
+  }
+
+  //! get specified segment by ID, which must have type P0
+  template <typename P0>
+  P0 const& getSegment(size_t segid) const
+  {
+    return *static_cast<P0 const*>(m_store->slot(m_begin + segid));
+  }
+
+  ///
+  /// Calls the operator "body" with the segment stored at segid.
+  ///
+  /// This requires that "body" be templated, as the segment will be passed
+  /// in as a properly typed object.
+  ///
+  /// The "args..." are passed-thru to the body as arguments AFTER the segment.
+  ///
+  template <typename BODY, typename... ARGS>
+  RAJA_INLINE void segmentCall(size_t segid, BODY&& body, ARGS&&... args) const
+  {
+    using call_fn = void (*)(const void*, BODY&, ARGS&...);
+    static constexpr call_fn call[] = {
+        &detail::flat_segment_call<T0, BODY, ARGS...>,
+        &detail::flat_segment_call<TREST, BODY, ARGS...>...};
+    const size_t i = m_begin + segid;
+    call[m_store->type(i)](m_store->slot(i), body, args...);
+  }
+
+  //! Get an iterator to the end.
+  iterator end() const { return iterator(getNumSegments()); }
+
+  //! Get an iterator to the beginning.
+  iterator begin() const { return iterator(0); }
+
+  //! Return the number of elements in the range.
+  Index_type size() const { return getNumSegments(); }
+
+  //!  @name TypedFlatIndexSet segment subsetting methods (slices ranges)
+  ///
+  /// Return a new TypedFlatIndexSet object that contains the subset of
+  /// segments in this TypedFlatIndexSet with ids in the interval
+  /// [begin, end). The slice shares the segments of this set and does not
+  /// allocate.
+  ///
+  TypedFlatIndexSet createSlice(int begin, int end) const
+  {
+    TypedFlatIndexSet retVal(*this);
+    int numSeg = static_cast<int>(getNumSegments());
+    int minSeg = RAJA::operators::maximum<int>{}(0, begin);
+    int maxSeg = RAJA::operators::minimum<int>{}(end, numSeg);
+    minSeg = RAJA::operators::minimum<int>{}(minSeg, numSeg);
+    retVal.m_begin = m_begin + minSeg;
+    retVal.m_end = m_begin + RAJA::operators::maximum<int>{}(minSeg, maxSeg);
+    return retVal;
+  }
+
+  ///
+  /// Return a new TypedFlatIndexSet object that contains the subset of
+  /// segments in this TypedFlatIndexSet with ids in the given int array.
+  ///
+  /// The segments are copied into one new array; ids outside of this set
+  /// are skipped.
+  ///
+  TypedFlatIndexSet createSlice(const int* segIds, int len) const
+  {
+    return gather(segIds, segIds + len);
+  }
+
+  ///
+  /// Return a new TypedFlatIndexSet object that contains the subset of
+  /// segments in this TypedFlatIndexSet with ids in the argument object.
+  ///
+  /// The object must provide methods begin(), end(), and its
+  /// iterator type must de-reference to an integral value.
+  ///
+  template <typename T>
+  TypedFlatIndexSet createSlice(const T& segIds) const
+  {
+    return gather(segIds.begin(), segIds.end());
+  }
+
+  ///
+  /// Equality operator returns true if all segments are equal; else false.
+  ///
+  bool operator==(const TypedFlatIndexSet& other) const
+  {
+    size_t num_seg = getNumSegments();
+    if (num_seg != other.getNumSegments()) return false;
+
+    for (size_t segid = 0; segid < num_seg; ++segid) {
+      if (!m_store->equal(m_begin + segid,
+                          *other.m_store,
+                          other.m_begin + segid)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //! Inequality operator returns true if any segment is not equal, else false.
+  bool operator!=(const TypedFlatIndexSet& other) const
+  {
+    return (!(*this == other));
+  }
+
+private:
+  //! Copy the segments of this set to a store of its own, unless this set
+  //! is the only user of its store and ends where the store ends
+  void make_unique_tail()
+  {
+    if (m_store.use_count() == 1 && m_end == m_store->size()) {
+      return;
+    }
+    auto store = std::make_shared<store_type>();
+    store->reserve(getNumSegments());
+    for (size_t i = m_begin; i < m_end; ++i) {
+      store->copy_back(*m_store, i);
+    }
+    store->keep_alive = m_store;
+    m_store = std::move(store);
+    m_end -= m_begin;
+    m_begin = 0;
+  }
+
+  template <typename Iter>
+  TypedFlatIndexSet gather(Iter first, Iter last) const
+  {
+    TypedFlatIndexSet retVal;
+    retVal.m_store->keep_alive = m_store;
+    retVal.m_store->reserve(static_cast<size_t>(std::distance(first, last)));
+    int numSeg = static_cast<int>(getNumSegments());
+    for (; first != last; ++first) {
+      int seg = static_cast<int>(*first);
+      if (seg >= 0 && seg < numSeg) {
+        retVal.m_store->copy_back(*m_store, m_begin + seg);
+        ++retVal.m_end;
+      }
+    }
+    return retVal;
+  }
+
+  std::shared_ptr<store_type> m_store;
+  size_t m_begin;
+  size_t m_end;
+};
+
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_flat_index_set
+    : ::RAJA::type_traits::SpecializationOf<RAJA::TypedFlatIndexSet,
+                                            typename std::decay<T>::type> {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
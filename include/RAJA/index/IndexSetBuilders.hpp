@@ -126,6 +126,82 @@ void buildLockFreeColorIndexset(
     RAJA::Index_type* elemPermutation = nullptr,
     RAJA::Index_type* ielemPermutation = nullptr);
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate a color index set from a graph using parallel speculative
+ *        (Gebremedhin-Manne) distance-1 coloring.
+ *
+ *        No two adjacent vertices are in the same segment, so the vertices
+ *        in each segment are independent. Segments are in color order.
+ *        Coloring runs in parallel when OpenMP is enabled.
+ *
+ * \param iset reference to index set generated. Method assumes index set
+ *        is empty (no segments).
+ * \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ * \param adjOffsets neighbors of vertex v are adjacency[adjOffsets[v]] to
+ *        adjacency[adjOffsets[v+1]-1], length numVertex+1.
+ * \param adjacency neighbor array of the graph.
+ * \param numVertex number of vertices in the graph.
+ * \param elemPermutation if not null, filled with the vertices in color
+ *        order. The index set then holds one range segment per color over
+ *        the renumbered vertices, elemPermutation[i] is the original vertex.
+ *        Otherwise segments hold the original vertices, as range segments
+ *        when contiguous and list segments when not.
+ * \param ielemPermutation if not null, and elemPermutation is not null,
+ *        filled with the inverse of elemPermutation.
+ *
+ ******************************************************************************
+ */
+void RAJASHAREDDLL_API buildColorIndexSetDistance1(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* adjOffsets,
+    RAJA::Index_type const* adjacency,
+    RAJA::Index_type numVertex,
+    RAJA::Index_type* elemPermutation = nullptr,
+    RAJA::Index_type* ielemPermutation = nullptr);
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate a lock-free "color" index set from domain to range
+ *        connectivity using parallel speculative distance-2 coloring.
+ *
+ *        Parallel alternative to buildLockFreeColorIndexset, domain entities
+ *        that share a range entity are in different segments. Segments are
+ *        in color order. Coloring runs in parallel when OpenMP is enabled.
+ *
+ * \param iset reference to index set generated. Method assumes index set
+ *        is empty (no segments).
+ * \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ * \param domainToRange range entities of domain entity i are
+ *        domainToRange[i*numRangePerDomain + j], j < numRangePerDomain.
+ * \param numEntity number of domain entities.
+ * \param numRangePerDomain number of range entities per domain entity.
+ * \param numEntityRange number of range entities.
+ * \param elemPermutation if not null, filled with the domain entities in
+ *        color order, the index set then holds one range segment per color
+ *        over the renumbered entities (see buildColorIndexSetDistance1).
+ * \param ielemPermutation if not null, and elemPermutation is not null,
+ *        filled with the inverse of elemPermutation.
+ *
+ ******************************************************************************
+ */
+void RAJASHAREDDLL_API buildColorIndexSetDistance2(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* domainToRange,
+    RAJA::Index_type numEntity,
+    int numRangePerDomain,
+    RAJA::Index_type numEntityRange,
+    RAJA::Index_type* elemPermutation = nullptr,
+    RAJA::Index_type* ielemPermutation = nullptr);
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
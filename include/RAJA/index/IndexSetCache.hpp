@@ -0,0 +1,546 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for saving built index sets to a file and loading
+ *          them back without copying their list segment indices.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_IndexSetCache_HPP
+#define RAJA_IndexSetCache_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/index/FlatIndexSet.hpp"
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/util/types.hpp"
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Streaming 64 bit hash used for cache keys and file checksums. Data is
+ * hashed eight bytes at a time in four independent lanes.
+ */
+class RAJASHAREDDLL_API IndexSetCacheHasher
+{
+public:
+  explicit IndexSetCacheHasher(std::uint64_t seed = 0);
+
+  void update(const void* data, size_t bytes);
+
+  std::uint64_t digest() const;
+
+private:
+  std::uint64_t m_lanes[4];
+  unsigned char m_buffer[32];
+  size_t m_buffered;
+  std::uint64_t m_total;
+  std::uint64_t m_seed;
+};
+
+//! Kinds of segment records in a cache file
+enum IndexSetCacheSegmentKind : std::uint32_t {
+  CACHE_RANGE = 0,
+  CACHE_RANGE_STRIDE = 1,
+  CACHE_LIST = 2
+};
+
+///
+/// One segment of a cached index set.
+///
+/// Ranges store begin, end in a, b; strided ranges store begin, end and
+/// stride in a, b, c; lists store the offset of their first index in the
+/// list data of the file and their length in a, b.
+///
+struct IndexSetCacheRecord {
+  std::uint32_t kind;
+  std::uint32_t unused;
+  std::int64_t a;
+  std::int64_t b;
+  std::int64_t c;
+};
+
+///
+/// Layout of a cache file, all values in host byte order:
+///
+///   IndexSetCacheHeader
+///   IndexSetCacheRecord[num_segments]
+///   std::int64_t[2 * num_intervals]      (begin, end of each interval)
+///   padding up to list_offset, a multiple of 64
+///   index values[list_count]
+///
+/// payload_checksum covers everything after the header, header_checksum
+/// covers the header up to header_checksum.
+///
+struct IndexSetCacheHeader {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t byte_order;
+  std::uint32_t index_bytes;
+  std::uint32_t index_signed;
+  std::uint64_t key;
+  std::uint64_t num_segments;
+  std::uint64_t num_intervals;
+  std::uint64_t list_offset;
+  std::uint64_t list_count;
+  std::uint64_t file_bytes;
+  std::uint64_t payload_checksum;
+  std::uint64_t header_checksum;
+};
+
+//! Current version of the cache file layout
+constexpr std::uint32_t index_set_cache_version = 1;
+
+///
+/// Write a cache file made of the header followed by the given sections.
+/// Fills in the sizes and checksums of the header. The file is written
+/// under a temporary name and renamed, so readers never see part of it.
+///
+/// Returns false if the file could not be written.
+///
+bool RAJASHAREDDLL_API
+writeIndexSetCacheFile(const std::string& path,
+                       IndexSetCacheHeader header,
+                       const std::vector<std::pair<const void*, size_t>>& sections);
+
+//! Whether ISET, a TypedIndexSet or TypedFlatIndexSet, can hold a SEG
+template <typename SEG, typename ISET>
+struct index_set_holds : std::false_type {
+};
+
+template <typename SEG, template <typename...> class ISET, typename... SEGS>
+struct index_set_holds<SEG, ISET<SEGS...>>
+    : camp::concepts::any_of<std::is_same<SEG, SEGS>...> {
+};
+
+//@{
+//! Push a segment into iset if it can hold one, returns whether it did
+template <typename SEG, typename ISET, typename... ARGS>
+bool cache_push_segment(std::true_type, ISET& iset, ARGS&&... args)
+{
+  iset.push_back(SEG(std::forward<ARGS>(args)...));
+  return true;
+}
+
+template <typename SEG, typename ISET, typename... ARGS>
+bool cache_push_segment(std::false_type, ISET&, ARGS&&...)
+{
+  return false;
+}
+//@}
+
+//! Collects the records and list data of the segments of an index set
+template <typename T>
+struct IndexSetCacheWriter {
+  std::vector<IndexSetCacheRecord> records;
+  std::vector<std::pair<const void*, size_t>> lists;
+  std::uint64_t list_count = 0;
+
+  void operator()(TypedRangeSegment<T> const& seg)
+  {
+    records.push_back({CACHE_RANGE,
+                       0,
+                       static_cast<std::int64_t>(*seg.begin()),
+                       static_cast<std::int64_t>(*seg.end()),
+                       1});
+  }
+
+  void operator()(TypedRangeStrideSegment<T> const& seg)
+  {
+    records.push_back({CACHE_RANGE_STRIDE,
+                       0,
+                       static_cast<std::int64_t>(*seg.begin()),
+                       static_cast<std::int64_t>(*seg.end()),
+                       static_cast<std::int64_t>(seg.begin().get_stride())});
+  }
+
+  void operator()(TypedListSegment<T> const& seg)
+  {
+    records.push_back({CACHE_LIST,
+                       0,
+                       static_cast<std::int64_t>(list_count),
+                       static_cast<std::int64_t>(seg.size()),
+                       0});
+    lists.emplace_back(seg.begin(), seg.size() * sizeof(T));
+    list_count += seg.size();
+  }
+};
+
+//@{
+//! Segment intervals of an index set, only TypedIndexSet has them
+template <typename... SEGS>
+std::vector<std::int64_t> cache_intervals(const TypedIndexSet<SEGS...>& iset)
+{
+  std::vector<std::int64_t> intervals;
+  for (size_t i = 0; i < iset.getNumSegmentIntervals(); ++i) {
+    intervals.push_back(iset.getSegmentIntervalBegin(i));
+    intervals.push_back(iset.getSegmentIntervalEnd(i));
+  }
+  return intervals;
+}
+
+template <typename... SEGS>
+std::vector<std::int64_t> cache_intervals(const TypedFlatIndexSet<SEGS...>&)
+{
+  return std::vector<std::int64_t>();
+}
+
+template <typename... SEGS>
+void cache_set_intervals(TypedIndexSet<SEGS...>& iset,
+                         const std::int64_t* intervals,
+                         std::uint64_t num_intervals)
+{
+  for (std::uint64_t i = 0; i < num_intervals; ++i) {
+    iset.setSegmentInterval(i,
+                            static_cast<int>(intervals[2 * i]),
+                            static_cast<int>(intervals[2 * i + 1]));
+  }
+}
+
+template <typename... SEGS>
+void cache_set_intervals(TypedFlatIndexSet<SEGS...>&,
+                         const std::int64_t*,
+                         std::uint64_t)
+{
+}
+//@}
+
+}  // namespace detail
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Key identifying the inputs an index set was built from.
+ *
+ *         Add every input of the builder, e.g. the mesh connectivity, its
+ *         sizes and the builder arguments. A cached index set is used only
+ *         if its key matches.
+ *
+ *         \verbatim
+ *
+ *         RAJA::IndexSetCacheKey key;
+ *         key.add(std::string("lock-free-color")).add(num_zones)
+ *            .add(zone_nodes, 8 * num_zones);
+ *
+ *         \endverbatim
+ *
+ ******************************************************************************
+ */
+class IndexSetCacheKey
+{
+public:
+  IndexSetCacheKey() : m_value(0) {}
+
+  explicit IndexSetCacheKey(std::uint64_t value) : m_value(value) {}
+
+  //! Add bytes bytes of raw data to the key
+  IndexSetCacheKey& add(const void* data, size_t bytes)
+  {
+    detail::IndexSetCacheHasher hasher(m_value);
+    hasher.update(&bytes, sizeof(bytes));
+    hasher.update(data, bytes);
+    m_value = hasher.digest();
+    return *this;
+  }
+
+  //! Add an array of count values to the key
+  template <typename T>
+  IndexSetCacheKey& add(const T* data, size_t count)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "IndexSetCacheKey can only add trivially copyable values");
+    return add(static_cast<const void*>(data), count * sizeof(T));
+  }
+
+  //! Add a single arithmetic value to the key
+  template <typename T>
+  concepts::enable_if_t<IndexSetCacheKey&, std::is_arithmetic<T>> add(T value)
+  {
+    return add(&value, 1);
+  }
+
+  //! Add a string, e.g. the name of the builder, to the key
+  IndexSetCacheKey& add(const std::string& str)
+  {
+    return add(str.data(), str.size());
+  }
+
+  std::uint64_t value() const { return m_value; }
+
+  bool operator==(const IndexSetCacheKey& other) const
+  {
+    return m_value == other.m_value;
+  }
+
+  bool operator!=(const IndexSetCacheKey& other) const
+  {
+    return m_value != other.m_value;
+  }
+
+private:
+  std::uint64_t m_value;
+};
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  File cache for index sets with range, strided range and list
+ *         segments.
+ *
+ *         store() writes an index set, its segment intervals and a key to
+ *         the file. load() maps the file into memory and fills an empty
+ *         index set from it when the file is valid and has the same key.
+ *         The list segments of a loaded index set do not own their indices,
+ *         they point into the mapped file, so the cache must outlive the
+ *         index sets loaded through it. Every mapping made by a cache stays
+ *         valid until the cache is destroyed.
+ *
+ *         The file records the size and signedness of the index type and
+ *         the byte order of the machine that wrote it, and is not loaded on
+ *         a mismatch. List segments must have their indices in host memory.
+ *
+ *         \verbatim
+ *
+ *         RAJA::IndexSetCache cache("colors.rajaisc");
+ *         RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+ *         cache.loadOrBuild(key, iset, [&](auto& is) {
+ *           RAJA::buildLockFreeColorIndexset(is, domain, ...);
+ *         });
+ *
+ *         \endverbatim
+ *
+ ******************************************************************************
+ */
+class RAJASHAREDDLL_API IndexSetCache
+{
+public:
+  explicit IndexSetCache(std::string path);
+
+  IndexSetCache(const IndexSetCache&) = delete;
+  IndexSetCache& operator=(const IndexSetCache&) = delete;
+
+  IndexSetCache(IndexSetCache&& other);
+  IndexSetCache& operator=(IndexSetCache&& other);
+
+  //! Unmaps the files mapped by load
+  ~IndexSetCache();
+
+  const std::string& getPath() const { return m_path; }
+
+  ///
+  /// Fill the empty index set iset from the cache file.
+  ///
+  /// Returns false, leaving iset empty, if the file does not exist, was
+  /// written with another key, index type or file version, fails its
+  /// checksums, or has a segment kind iset cannot hold. With verify false
+  /// the payload checksum is skipped, so that list indices are read from
+  /// disk only when they are used.
+  ///
+  template <typename ISET>
+  bool load(const IndexSetCacheKey& key, ISET& iset, bool verify = true);
+
+  ///
+  /// Write iset to the cache file with the given key, replacing the file.
+  ///
+  /// Returns false if the file could not be written.
+  ///
+  template <typename ISET>
+  bool store(const IndexSetCacheKey& key, const ISET& iset) const;
+
+  ///
+  /// Load iset from the cache file, or call build(iset) and store the
+  /// result when the file cannot be used.
+  ///
+  /// Returns true if iset was loaded from the file.
+  ///
+  template <typename ISET, typename BUILDER>
+  bool loadOrBuild(const IndexSetCacheKey& key, ISET& iset, BUILDER&& build);
+
+private:
+  ///
+  /// Map the cache file and check it against key and index type, returns
+  /// the header of the mapped file, or nullptr if it cannot be used.
+  ///
+  const detail::IndexSetCacheHeader* map(std::uint64_t key,
+                                         std::uint32_t index_bytes,
+                                         std::uint32_t index_signed,
+                                         bool verify);
+
+  //! Undo the last successful map
+  void unmapLast();
+
+  void unmapAll();
+
+  struct Mapping {
+    void* addr;
+    size_t bytes;
+  };
+
+  std::string m_path;
+  std::vector<Mapping> m_mappings;
+};
+
+
+template <typename ISET>
+bool IndexSetCache::load(const IndexSetCacheKey& key, ISET& iset, bool verify)
+{
+  using value_type = typename ISET::value_type;
+  static_assert(std::is_integral<value_type>::value,
+                "IndexSetCache requires an integral index type");
+
+  if (iset.getNumSegments() != 0) {
+    return false;
+  }
+
+  const detail::IndexSetCacheHeader* header =
+      map(key.value(),
+          sizeof(value_type),
+          std::is_signed<value_type>::value,
+          verify);
+  if (header == nullptr) {
+    return false;
+  }
+
+  const char* base = reinterpret_cast<const char*>(header);
+  const detail::IndexSetCacheRecord* records =
+      reinterpret_cast<const detail::IndexSetCacheRecord*>(base +
+                                                           sizeof(*header));
+  const std::int64_t* intervals =
+      reinterpret_cast<const std::int64_t*>(records + header->num_segments);
+  const value_type* list_data =
+      reinterpret_cast<const value_type*>(base + header->list_offset);
+
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  using range_t = TypedRangeSegment<value_type>;
+  using stride_t = TypedRangeStrideSegment<value_type>;
+  using list_t = TypedListSegment<value_type>;
+
+  bool ok = true;
+  for (std::uint64_t s = 0; ok && s < header->num_segments; ++s) {
+    const detail::IndexSetCacheRecord& rec = records[s];
+    switch (rec.kind) {
+      case detail::CACHE_RANGE:
+        ok = detail::cache_push_segment<range_t>(
+            detail::index_set_holds<range_t, ISET>{},
+            iset,
+            static_cast<value_type>(rec.a),
+            static_cast<value_type>(rec.b));
+        break;
+      case detail::CACHE_RANGE_STRIDE:
+        ok = detail::cache_push_segment<stride_t>(
+            detail::index_set_holds<stride_t, ISET>{},
+            iset,
+            static_cast<value_type>(rec.a),
+            static_cast<value_type>(rec.b),
+            static_cast<typename std::make_signed<value_type>::type>(rec.c));
+        break;
+      case detail::CACHE_LIST:
+        ok = rec.a >= 0 && rec.b >= 0 &&
+             static_cast<std::uint64_t>(rec.a + rec.b) <= header->list_count &&
+             detail::cache_push_segment<list_t>(
+                 detail::index_set_holds<list_t, ISET>{},
+                 iset,
+                 list_data + rec.a,
+                 static_cast<Index_type>(rec.b),
+                 host_res,
+                 Unowned);
+        break;
+      default:
+        ok = false;
+    }
+  }
+
+  if (!ok) {
+    iset = ISET();
+    unmapLast();
+    return false;
+  }
+
+  detail::cache_set_intervals(iset, intervals, header->num_intervals);
+  return true;
+}
+
+template <typename ISET>
+bool IndexSetCache::store(const IndexSetCacheKey& key, const ISET& iset) const
+{
+  using value_type = typename ISET::value_type;
+  static_assert(std::is_integral<value_type>::value,
+                "IndexSetCache requires an integral index type");
+
+  detail::IndexSetCacheWriter<value_type> writer;
+  writer.records.reserve(iset.getNumSegments());
+  for (size_t s = 0; s < static_cast<size_t>(iset.getNumSegments()); ++s) {
+    iset.segmentCall(s, writer);
+  }
+  const std::vector<std::int64_t> intervals = detail::cache_intervals(iset);
+
+  detail::IndexSetCacheHeader header{};
+  header.key = key.value();
+  header.index_bytes = sizeof(value_type);
+  header.index_signed = std::is_signed<value_type>::value;
+  header.num_segments = writer.records.size();
+  header.num_intervals = intervals.size() / 2;
+  header.list_count = writer.list_count;
+
+  const size_t records_bytes =
+      writer.records.size() * sizeof(detail::IndexSetCacheRecord);
+  const size_t intervals_bytes = intervals.size() * sizeof(std::int64_t);
+  const size_t lists_begin =
+      sizeof(detail::IndexSetCacheHeader) + records_bytes + intervals_bytes;
+  header.list_offset = (lists_begin + 63) / 64 * 64;
+
+  static const char padding[64] = {};
+  std::vector<std::pair<const void*, size_t>> sections;
+  sections.emplace_back(writer.records.data(), records_bytes);
+  sections.emplace_back(intervals.data(), intervals_bytes);
+  sections.emplace_back(padding, header.list_offset - lists_begin);
+  sections.insert(sections.end(), writer.lists.begin(), writer.lists.end());
+
+  return detail::writeIndexSetCacheFile(m_path, header, sections);
+}
+
+template <typename ISET, typename BUILDER>
+bool IndexSetCache::loadOrBuild(const IndexSetCacheKey& key,
+                                ISET& iset,
+                                BUILDER&& build)
+{
+  if (load(key, iset)) {
+    return true;
+  }
+  build(iset);
+  store(key, iset);
+  return false;
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,147 @@
+/*!
+ ******************************************************************************
+ *
+ * \file SegmentBlocks.hpp
+ *
+ * \brief  Header file containing the traits used by RAJA::forall to run a
+ *         host policy over the blocks of a segment.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SegmentBlocks_HPP
+#define RAJA_SegmentBlocks_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/internal/get_platform.hpp"
+#include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/simd/policy.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace type_traits
+{
+
+/*!
+ * True for segments whose indices RAJA::forall visits block by block on
+ * the host. Such a segment provides
+ *
+ *   Index_type getNumBlocks() const;
+ *   template <typename InnerPolicy, typename Body>
+ *   void forEachInBlock(Index_type b, Body const& body) const;
+ *
+ * where forEachInBlock calls body with every index of block b, in order,
+ * in a loop vectorized as a loop with InnerPolicy is.
+ */
+template <typename T>
+struct is_blocked_segment : std::false_type {
+};
+
+}  // namespace type_traits
+
+namespace detail
+{
+
+/*!
+ * True when RAJA::forall over a Container with Policy runs Policy over the
+ * blocks of the segment instead of over its indices.
+ */
+template <typename Policy, typename Container>
+struct use_segment_blocks
+    : std::integral_constant<
+          bool,
+          type_traits::is_blocked_segment<camp::decay<Container>>::value &&
+              get_platform<camp::decay<Policy>>::value == Platform::host> {
+};
+
+//@{
+//! Policy of the loop over blocks and policy of the loop in each block
+//! of a forall over a blocked segment with Policy.
+template <typename Policy>
+struct segment_block_policies {
+  using block_policy = Policy;
+  using inner_policy = loop_exec;
+};
+
+template <>
+struct segment_block_policies<seq_exec> {
+  using block_policy = seq_exec;
+  using inner_policy = seq_exec;
+};
+
+template <>
+struct segment_block_policies<simd_exec> {
+  using block_policy = loop_exec;
+  using inner_policy = simd_exec;
+};
+//@}
+
+template <typename Policy>
+RAJA_INLINE Policy const& segment_block_policy(Policy const& p, Policy const&)
+{
+  return p;
+}
+
+template <typename BlockPolicy, typename Policy>
+RAJA_INLINE BlockPolicy segment_block_policy(Policy const&, BlockPolicy const&)
+{
+  return BlockPolicy{};
+}
+
+//@{
+//! Loop over [0, len) within one block, with the vectorization a forall
+//! over the segment with the given policy allows.
+template <typename Body>
+RAJA_INLINE void segment_block_loop(seq_exec const&,
+                                    Index_type len,
+                                    Body const& body)
+{
+  RAJA_NO_SIMD
+  for (Index_type k = 0; k < len; ++k) {
+    body(k);
+  }
+}
+
+template <typename Body>
+RAJA_INLINE void segment_block_loop(simd_exec const&,
+                                    Index_type len,
+                                    Body const& body)
+{
+  RAJA_SIMD
+  for (Index_type k = 0; k < len; ++k) {
+    body(k);
+  }
+}
+
+template <typename Body>
+RAJA_INLINE void segment_block_loop(loop_exec const&,
+                                    Index_type len,
+                                    Body const& body)
+{
+  for (Index_type k = 0; k < len; ++k) {
+    body(k);
+  }
+}
+//@}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,395 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing the RAJA expt::Graph record and replay
+ *          construct.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_Graph_HPP
+#define RAJA_PATTERN_Graph_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "RAJA/pattern/Graph/GraphRunner.hpp"
+#include "RAJA/pattern/WorkGroup/WorkStorage.hpp"
+#include "RAJA/policy/loop/WorkGroup/Dispatcher.hpp"
+
+#include "RAJA/internal/get_platform.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/plugins.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief  Handle naming an ordered sequence of nodes in a Graph.
+ *
+ * Nodes recorded on the same stream run in the order they were recorded,
+ * nodes recorded on different streams are independent unless ordered with
+ * Graph::wait_for.
+ */
+struct GraphStream {
+  size_t id;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Graph class template. Records a sequence of forall, kernel and
+ *         launch calls once so they can be replayed many times.
+ *
+ * Each recorded call becomes a node that is stored with the WorkGroup
+ * storage and dispatcher machinery. Dependencies between nodes are given by
+ * the stream a node is recorded on and by Graph::wait_for. When the graph is
+ * instantiated the nodes are sorted into levels of mutually independent
+ * nodes, and replay runs the levels in order using the EXEC_POLICY_T
+ * workgroup execution policy to run the nodes of each level. Plugins are
+ * called once per replay instead of once per node.
+ *
+ * The graph owns copies of the segments and loop bodies so anything the
+ * bodies reference must outlive the graph, or at least the last replay.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   RAJA::expt::Graph<RAJA::omp_work> graph;
+
+   auto s0 = graph.default_stream();
+   auto s1 = graph.stream();
+
+   graph.forall<RAJA::omp_parallel_for_exec>(s0, range, [=] (int i) {
+      a[i] = 1;
+   });
+   graph.forall<RAJA::omp_parallel_for_exec>(s1, range, [=] (int i) {
+      b[i] = 2;
+   });
+   graph.wait_for(s0, s1);
+   graph.forall<RAJA::omp_parallel_for_exec>(s0, range, [=] (int i) {
+      c[i] = a[i] + b[i];
+   });
+
+   graph.instantiate();
+
+   for (int step = 0; step < num_steps; ++step) {
+     graph.replay();
+   }
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename EXEC_POLICY_T,
+          typename ALLOCATOR_T = std::allocator<char>>
+struct Graph
+{
+  static_assert(RAJA::pattern_is<EXEC_POLICY_T, RAJA::Pattern::workgroup_exec>::value,
+      "Graph: EXEC_POLICY_T must be a workgroup exec policy");
+
+  using exec_policy = EXEC_POLICY_T;
+  using Allocator = ALLOCATOR_T;
+  using node_id = size_t;
+  using stream_type = GraphStream;
+
+private:
+  using runner_type = RAJA::detail::GraphRunner<exec_policy>;
+  using dispatcher_type = RAJA::detail::Dispatcher<
+      Platform::host, RAJA::indirect_function_call_dispatch,
+      RAJA::detail::GraphNodeID>;
+  using storage_type = RAJA::detail::WorkStorage<
+      RAJA::ragged_array_of_objects, Allocator, dispatcher_type>;
+
+  static constexpr node_id no_node = static_cast<node_id>(-1);
+
+public:
+  explicit Graph(Allocator const& aloc = Allocator())
+    : m_storage(aloc)
+    , m_stream_last(1, no_node)
+    , m_stream_waits(1)
+  { }
+
+  Graph(Graph const&) = delete;
+  Graph& operator=(Graph const&) = delete;
+
+  Graph(Graph&&) = default;
+  Graph& operator=(Graph&&) = default;
+
+  //! stream used by the record methods that do not take a stream
+  stream_type default_stream() const
+  {
+    return stream_type{0};
+  }
+
+  //! create a new stream independent of all existing streams
+  stream_type stream()
+  {
+    m_stream_last.emplace_back(no_node);
+    m_stream_waits.emplace_back();
+    return stream_type{m_stream_last.size() - 1};
+  }
+
+  //! make the next node recorded on waiter depend on the last node
+  //  recorded on signaller
+  void wait_for(stream_type waiter, stream_type signaller)
+  {
+    node_id last = m_stream_last[signaller.id];
+    if (last != no_node && waiter.id != signaller.id) {
+      m_stream_waits[waiter.id].emplace_back(last);
+    }
+  }
+
+  size_t num_nodes() const
+  {
+    return m_storage.size();
+  }
+
+  //! number of levels in the schedule, valid after instantiate
+  size_t num_levels() const
+  {
+    return m_level_offsets.empty() ? 0 : m_level_offsets.size() - 1;
+  }
+
+  bool is_instantiated() const
+  {
+    return m_instantiated;
+  }
+
+  /*!
+   * \brief Record a forall on stream s.
+   */
+  template < typename ExecPolicy, typename Segment, typename LoopBody >
+  node_id forall(stream_type s, Segment&& seg, LoopBody&& loop_body)
+  {
+    using holder = RAJA::detail::GraphHoldForall<
+        ExecPolicy, camp::decay<Segment>, camp::decay<LoopBody>>;
+    using resource_type = typename holder::resource_type;
+
+    util::PluginContext context{util::make_context<ExecPolicy>()};
+    util::callPreCapturePlugins(context);
+
+    using RAJA::util::trigger_updates_before;
+    auto body = trigger_updates_before(loop_body);
+
+    node_id node = emplace_node<holder>(s,
+        resource_type::get_default(),
+        std::forward<Segment>(seg), std::move(body));
+
+    util::callPostCapturePlugins(context);
+
+    return node;
+  }
+
+  template < typename ExecPolicy, typename Segment, typename LoopBody >
+  node_id forall(Segment&& seg, LoopBody&& loop_body)
+  {
+    return forall<ExecPolicy>(default_stream(),
+                              std::forward<Segment>(seg),
+                              std::forward<LoopBody>(loop_body));
+  }
+
+  /*!
+   * \brief Record a kernel on stream s.
+   */
+  template < typename PolicyType, typename SegmentTuple, typename ... Bodies >
+  node_id kernel(stream_type s, SegmentTuple&& segments, Bodies&&... bodies)
+  {
+    using resource_type = resources::resource_from_pol_t<PolicyType>;
+    using holder = RAJA::detail::GraphHoldKernel<
+        PolicyType, camp::decay<SegmentTuple>, resource_type,
+        camp::decay<Bodies>...>;
+
+    util::PluginContext context{util::make_context<PolicyType>()};
+    util::callPreCapturePlugins(context);
+
+    node_id node = emplace_node<holder>(s,
+        resources::get_default_resource<PolicyType>(),
+        std::forward<SegmentTuple>(segments),
+        std::forward<Bodies>(bodies)...);
+
+    util::callPostCapturePlugins(context);
+
+    return node;
+  }
+
+  template < typename PolicyType, typename SegmentTuple, typename ... Bodies >
+  concepts::enable_if_t<node_id,
+      concepts::negate<std::is_same<camp::decay<SegmentTuple>, stream_type>>>
+  kernel(SegmentTuple&& segments, Bodies&&... bodies)
+  {
+    return kernel<PolicyType>(default_stream(),
+                              std::forward<SegmentTuple>(segments),
+                              std::forward<Bodies>(bodies)...);
+  }
+
+  /*!
+   * \brief Record a host launch on stream s.
+   */
+  template < typename LaunchPolicy, typename LoopBody >
+  node_id launch(stream_type s, LaunchParams const& params,
+                 const char* kernel_name, LoopBody&& body)
+  {
+    using holder = RAJA::detail::GraphHoldLaunch<
+        LaunchPolicy, camp::decay<LoopBody>>;
+
+    return emplace_node<holder>(s, params, kernel_name,
+                                std::forward<LoopBody>(body));
+  }
+
+  template < typename LaunchPolicy, typename LoopBody >
+  node_id launch(stream_type s, LaunchParams const& params, LoopBody&& body)
+  {
+    return launch<LaunchPolicy>(s, params, nullptr,
+                                std::forward<LoopBody>(body));
+  }
+
+  template < typename LaunchPolicy, typename LoopBody >
+  node_id launch(LaunchParams const& params, LoopBody&& body)
+  {
+    return launch<LaunchPolicy>(default_stream(), params, nullptr,
+                                std::forward<LoopBody>(body));
+  }
+
+  /*!
+   * \brief Compute the schedule used by replay.
+   *
+   * Each node is placed in the level after the last level of its
+   * dependencies. Nodes in the same level keep their recording order.
+   */
+  void instantiate()
+  {
+    const size_t num = m_storage.size();
+
+    std::vector<size_t> level(num, 0);
+    size_t num_levels = 0;
+    for (size_t n = 0; n < num; ++n) {
+      for (size_t d = m_dep_offsets[n]; d < m_dep_offsets[n+1]; ++d) {
+        level[n] = std::max(level[n], level[m_deps[d]] + 1);
+      }
+      num_levels = std::max(num_levels, level[n] + 1);
+    }
+
+    m_level_offsets.assign(num_levels + 1, 0);
+    for (size_t n = 0; n < num; ++n) {
+      ++m_level_offsets[level[n] + 1];
+    }
+    for (size_t l = 0; l < num_levels; ++l) {
+      m_level_offsets[l + 1] += m_level_offsets[l];
+    }
+
+    m_schedule.resize(num);
+    std::vector<size_t> fill(m_level_offsets.begin(), m_level_offsets.end());
+    for (size_t n = 0; n < num; ++n) {
+      m_schedule[fill[level[n]]++] = n;
+    }
+
+    m_instantiated = true;
+  }
+
+  /*!
+   * \brief Run all recorded nodes using the precomputed schedule.
+   */
+  void replay()
+  {
+    if (!m_instantiated) {
+      instantiate();
+    }
+
+    util::PluginContext context{util::make_context<exec_policy>()};
+    util::callPreLaunchPlugins(context);
+
+    const size_t num_levels = m_level_offsets.size() - 1;
+    for (size_t l = 0; l < num_levels; ++l) {
+      runner_type::run_level(m_storage,
+                             m_schedule.data() + m_level_offsets[l],
+                             m_level_offsets[l + 1] - m_level_offsets[l]);
+    }
+
+    util::callPostLaunchPlugins(context);
+  }
+
+  void clear()
+  {
+    m_storage.clear();
+    m_deps.clear();
+    m_dep_offsets.assign(1, 0);
+    m_stream_last.assign(1, no_node);
+    m_stream_waits.assign(1, std::vector<node_id>{});
+    m_schedule.clear();
+    m_level_offsets.clear();
+    m_instantiated = false;
+  }
+
+  ~Graph()
+  {
+    clear();
+  }
+
+private:
+  storage_type m_storage;
+
+  // dependencies of node n are m_deps[m_dep_offsets[n], m_dep_offsets[n+1])
+  std::vector<node_id> m_deps;
+  std::vector<size_t> m_dep_offsets{0};
+
+  std::vector<node_id> m_stream_last;
+  std::vector<std::vector<node_id>> m_stream_waits;
+
+  std::vector<size_t> m_schedule;
+  std::vector<size_t> m_level_offsets;
+  bool m_instantiated = false;
+
+  template < typename holder, typename ... holder_ctor_args >
+  node_id emplace_node(stream_type s, holder_ctor_args&&... ctor_args)
+  {
+    m_storage.template emplace<holder>(
+        RAJA::detail::get_Dispatcher<holder, dispatcher_type>(RAJA::loop_work{}),
+        std::forward<holder_ctor_args>(ctor_args)...);
+
+    node_id node = m_storage.size() - 1;
+
+    node_id last = m_stream_last[s.id];
+    if (last != no_node) {
+      m_deps.emplace_back(last);
+    }
+    for (node_id dep : m_stream_waits[s.id]) {
+      m_deps.emplace_back(dep);
+    }
+    m_stream_waits[s.id].clear();
+    m_dep_offsets.emplace_back(m_deps.size());
+
+    m_stream_last[s.id] = node;
+    m_instantiated = false;
+
+    return node;
+  }
+};
+
+template <typename EXEC_POLICY_T, typename ALLOCATOR_T>
+constexpr typename Graph<EXEC_POLICY_T, ALLOCATOR_T>::node_id
+    Graph<EXEC_POLICY_T, ALLOCATOR_T>::no_node;
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,184 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA Graph node holders and GraphRunner.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_GRAPH_GraphRunner_HPP
+#define RAJA_PATTERN_GRAPH_GraphRunner_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <type_traits>
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/kernel.hpp"
+#include "RAJA/pattern/launch/launch_core.hpp"
+
+#include "RAJA/pattern/WorkGroup/Dispatcher.hpp"
+#include "RAJA/policy/WorkGroup.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Tag type used to distinguish the Dispatcher used by Graph nodes
+ */
+struct GraphNodeID { };
+
+/*!
+ * A segment and body holder for forall nodes recorded in a Graph
+ */
+template <typename ExecutionPolicy, typename Segment_type, typename LoopBody>
+struct GraphHoldForall
+{
+  using resource_type = typename resources::get_resource<ExecutionPolicy>::type;
+
+  template < typename segment_in, typename body_in >
+  GraphHoldForall(resource_type r, segment_in&& segment, body_in&& body)
+    : m_resource(r)
+    , m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_INLINE void operator()() const
+  {
+    wrap::forall(m_resource,
+                 ExecutionPolicy(),
+                 m_segment,
+                 m_body);
+  }
+
+private:
+  resource_type m_resource;
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+/*!
+ * A segment tuple and bodies holder for kernel nodes recorded in a Graph.
+ *
+ * The LoopData object is created the first time the node is run, after the
+ * graph storage has stopped moving, and is reused by every later replay.
+ */
+template <typename PolicyType, typename SegmentTuple, typename Resource,
+          typename ... Bodies>
+struct GraphHoldKernel
+{
+  using segment_tuple_t = typename IterableWrapperTuple<SegmentTuple>::type;
+  using param_tuple_t = camp::tuple<>;
+  using loop_data_t = internal::LoopData<segment_tuple_t,
+                                         param_tuple_t,
+                                         Resource,
+                                         Bodies...>;
+  using loop_types_t = internal::makeInitialLoopTypes<loop_data_t>;
+
+  template < typename segments_in, typename ... bodies_in >
+  GraphHoldKernel(Resource r, segments_in&& segments, bodies_in&&... bodies)
+    : m_resource(r)
+    , m_segments(std::forward<segments_in>(segments))
+    , m_bodies(std::forward<bodies_in>(bodies)...)
+  { }
+
+  RAJA_INLINE void operator()() const
+  {
+    if (!m_loop_data) {
+      make_loop_data(camp::make_idx_seq_t<sizeof...(Bodies)>{});
+    }
+
+    RAJA_FORCEINLINE_RECURSIVE
+    internal::execute_statement_list<PolicyType, loop_types_t>(*m_loop_data);
+  }
+
+private:
+  Resource m_resource;
+  SegmentTuple m_segments;
+  camp::tuple<Bodies...> m_bodies;
+  mutable std::unique_ptr<loop_data_t> m_loop_data;
+
+  template < camp::idx_t ... Is >
+  void make_loop_data(camp::idx_seq<Is...>) const
+  {
+    m_loop_data.reset(new loop_data_t(make_wrapped_tuple(m_segments),
+                                      param_tuple_t{},
+                                      m_resource,
+                                      camp::get<Is>(m_bodies)...));
+  }
+};
+
+/*!
+ * A launch parameters and body holder for launch nodes recorded in a Graph
+ */
+template <typename LaunchPolicy, typename LoopBody>
+struct GraphHoldLaunch
+{
+  template < typename body_in >
+  GraphHoldLaunch(LaunchParams const& params, const char* kernel_name,
+                  body_in&& body)
+    : m_params(params)
+    , m_kernel_name(kernel_name)
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_INLINE void operator()() const
+  {
+    using launch_t = LaunchExecute<typename LaunchPolicy::host_policy_t>;
+    launch_t::exec(m_params, m_kernel_name, m_body);
+  }
+
+private:
+  LaunchParams m_params;
+  const char* m_kernel_name;
+  LoopBody m_body;
+};
+
+
+/*!
+ * A class that runs the nodes of one level of a Graph schedule.
+ * The nodes in a level have no dependencies among each other.
+ */
+template <typename EXEC_POLICY_T>
+struct GraphRunner;
+
+/*!
+ * Runs the nodes of a level one after another on the calling thread
+ */
+struct GraphRunnerSerial
+{
+  template < typename WorkContainer >
+  static void run_level(WorkContainer const& storage,
+                        const size_t* nodes,
+                        size_t num_nodes)
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    auto begin = storage.begin();
+    for (size_t i = 0; i < num_nodes; ++i) {
+      value_type::host_call(&begin[nodes[i]]);
+    }
+  }
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
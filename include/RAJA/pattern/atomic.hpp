@@ -22,6 +22,7 @@
 
 #include "RAJA/policy/atomic_auto.hpp"
 #include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/atomic_combining.hpp"
 
 #include "RAJA/util/macros.hpp"
 
@@ -58,6 +59,9 @@ namespace RAJA
  *
  *   builtin_atomic    -- Use the (nonstandard) __sync_fetch_and_XXX functions
  *
+ *   combining_atomic  -- Host only, AtomicViewWrapper adds are combined per
+ *                        thread and flushed with builtin_atomic
+ *
  *   seq_atomic        -- Non-atomic, does an unprotected (raw) operation
  *
  *
@@ -75,6 +79,7 @@ namespace RAJA
  * The implementation code lives in:
  * RAJA/policy/atomic_auto.hpp     -- for auto_atomic
  * RAJA/policy/atomic_builtin.hpp  -- for builtin_atomic
+ * RAJA/policy/atomic_combining.hpp -- for combining_atomic
  * RAJA/policy/XXX/atomic.hpp      -- for omp_atomic, cuda_atomic, etc.
  *
  */
@@ -0,0 +1,658 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining batched small dense matrix operations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_batched_HPP
+#define RAJA_pattern_batched_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/tensor/VectorRegister.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+namespace batched
+{
+
+/*!
+ * View of a batch of small dense ROWS x COLS matrices stored batch
+ * interleaved: entry (i, j) of matrix b is at
+ *
+ *   data[(i*COLS + j)*batch_stride + b]
+ *
+ * so the same entry of consecutive matrices is contiguous and the batched
+ * operations process one SIMD register worth of matrices at a time.
+ *
+ * batch_stride must be at least num_batch. When it is larger the entries
+ * between num_batch and batch_stride are padding, which the batched
+ * operations may read and overwrite to use full register loads and stores.
+ * padded_batch_size gives the smallest stride without partial registers.
+ * All views passed to one batched operation must have the same num_batch
+ * and batch_stride.
+ */
+template <typename T, camp::idx_t ROWS, camp::idx_t COLS>
+struct BatchMatrixView {
+  using element_type = T;
+  using value_type = typename std::remove_const<T>::type;
+
+  static constexpr camp::idx_t s_num_rows = ROWS;
+  static constexpr camp::idx_t s_num_columns = COLS;
+
+  T* data;
+  camp::idx_t num_batch;
+  camp::idx_t batch_stride;
+
+  constexpr BatchMatrixView(T* data_in,
+                            camp::idx_t num_batch_in,
+                            camp::idx_t batch_stride_in)
+      : data(data_in), num_batch(num_batch_in), batch_stride(batch_stride_in)
+  {
+  }
+
+  //! const view of a non-const view
+  template <typename T2,
+            typename std::enable_if<std::is_same<T, T2 const>::value,
+                                    bool>::type = true>
+  constexpr BatchMatrixView(BatchMatrixView<T2, ROWS, COLS> const& other)
+      : data(other.data),
+        num_batch(other.num_batch),
+        batch_stride(other.batch_stride)
+  {
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  T& operator()(camp::idx_t b, camp::idx_t i, camp::idx_t j) const
+  {
+    return data[(i * COLS + j) * batch_stride + b];
+  }
+
+  //! pointer to entry (i, j) of matrix 0
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  T* entry(camp::idx_t i, camp::idx_t j) const
+  {
+    return data + (i * COLS + j) * batch_stride;
+  }
+
+  //! number of elements the view spans, including padding
+  constexpr camp::idx_t size() const { return ROWS * COLS * batch_stride; }
+};
+
+//! batch of N element vectors, stored as N x 1 matrices
+template <typename T, camp::idx_t N>
+using BatchVectorView = BatchMatrixView<T, N, 1>;
+
+/*!
+ * Smallest batch stride, at least num_batch, that is a multiple of the
+ * register width used for element type T.
+ */
+template <typename T, typename REGISTER_POLICY = default_register>
+constexpr camp::idx_t padded_batch_size(camp::idx_t num_batch)
+{
+  return (num_batch + Register<T, REGISTER_POLICY>::s_num_elem - 1) /
+         Register<T, REGISTER_POLICY>::s_num_elem *
+         Register<T, REGISTER_POLICY>::s_num_elem;
+}
+
+//! view of ROWS x COLS matrices at data with a padded batch stride
+template <camp::idx_t ROWS,
+          camp::idx_t COLS,
+          typename REGISTER_POLICY = default_register,
+          typename T>
+constexpr BatchMatrixView<T, ROWS, COLS> make_batch_matrix_view(
+    T* data,
+    camp::idx_t num_batch)
+{
+  return BatchMatrixView<T, ROWS, COLS>(
+      data,
+      num_batch,
+      padded_batch_size<typename std::remove_const<T>::type,
+                        REGISTER_POLICY>(num_batch));
+}
+
+
+namespace detail
+{
+
+template <camp::idx_t N>
+struct check_batched_size {
+  static_assert(N >= 1 && N <= 32,
+                "batched operations support matrix sizes from 1 to 32");
+  static constexpr bool value = true;
+};
+
+template <typename T>
+struct check_batched_solve_type {
+  static_assert(std::is_floating_point<T>::value,
+                "batched factorizations require a floating point type");
+  static constexpr bool value = true;
+};
+
+/*!
+ * Register sized chunk of a batch: lanes [offset, offset+size) of every
+ * entry. size is the register width except for the final chunk of a view
+ * without enough padding.
+ */
+template <typename T, typename REGISTER_POLICY>
+struct BatchChunk {
+  using vector_type = VectorRegister<T, REGISTER_POLICY>;
+  static constexpr camp::idx_t s_width = vector_type::s_num_elem;
+
+  camp::idx_t offset;
+  camp::idx_t size;
+
+  RAJA_INLINE
+  BatchChunk(camp::idx_t chunk, camp::idx_t batch_stride)
+      : offset(chunk * s_width),
+        size(batch_stride - offset < s_width ? batch_stride - offset
+                                             : s_width)
+  {
+  }
+
+  RAJA_INLINE
+  vector_type load(T const* ptr) const
+  {
+    vector_type v;
+    if (size == s_width) {
+      v.load_packed(ptr + offset);
+    } else {
+      v.load_packed_n(ptr + offset, size);
+    }
+    return v;
+  }
+
+  RAJA_INLINE
+  void store(vector_type const& v, T* ptr) const
+  {
+    if (size == s_width) {
+      v.store_packed(ptr + offset);
+    } else {
+      v.store_packed_n(ptr + offset, size);
+    }
+  }
+};
+
+//! number of chunks covering a batch
+template <typename T, typename REGISTER_POLICY>
+RAJA_INLINE camp::idx_t num_chunks(camp::idx_t num_batch)
+{
+  using chunk_t = BatchChunk<T, REGISTER_POLICY>;
+  return (num_batch + chunk_t::s_width - 1) / chunk_t::s_width;
+}
+
+/*!
+ * Abort unless all views have the same num_batch and batch_stride. The
+ * operations size every chunk from one view and use it for all operands,
+ * so a view with a shorter stride would be read or written past its end.
+ */
+template <typename VIEW>
+RAJA_INLINE void check_same_batch(VIEW const&)
+{
+}
+
+template <typename VIEW0, typename VIEW1, typename... VIEWS>
+RAJA_INLINE void check_same_batch(VIEW0 const& v0,
+                                  VIEW1 const& v1,
+                                  VIEWS const&... views)
+{
+  if (v0.num_batch != v1.num_batch || v0.batch_stride != v1.batch_stride) {
+    RAJA_ABORT_OR_THROW("RAJA::expt::batched operands must have the same "
+                        "num_batch and batch_stride");
+  }
+  check_same_batch(v0, views...);
+}
+
+template <typename VEC>
+RAJA_INLINE VEC negate(VEC const& x)
+{
+  return VEC(0).subtract(x);
+}
+
+}  // namespace detail
+
+
+/*!
+ * Copy a batch of matrices from the usual layout, each matrix stored
+ * contiguously and row major, to a batch interleaved view.
+ */
+template <typename ExecPol, typename T, camp::idx_t ROWS, camp::idx_t COLS>
+void pack(T const* src, BatchMatrixView<T, ROWS, COLS> const& dst)
+{
+  RAJA::forall<ExecPol>(
+      RAJA::TypedRangeSegment<camp::idx_t>(0, dst.num_batch),
+      [=](camp::idx_t b) {
+        for (camp::idx_t e = 0; e < ROWS * COLS; ++e) {
+          dst.data[e * dst.batch_stride + b] = src[b * ROWS * COLS + e];
+        }
+      });
+}
+
+/*!
+ * Copy a batch interleaved view to the usual layout, each matrix stored
+ * contiguously and row major.
+ */
+template <typename ExecPol, typename TS, typename T, camp::idx_t ROWS,
+          camp::idx_t COLS>
+void unpack(BatchMatrixView<TS, ROWS, COLS> const& src, T* dst)
+{
+  RAJA::forall<ExecPol>(
+      RAJA::TypedRangeSegment<camp::idx_t>(0, src.num_batch),
+      [=](camp::idx_t b) {
+        for (camp::idx_t e = 0; e < ROWS * COLS; ++e) {
+          dst[b * ROWS * COLS + e] = src.data[e * src.batch_stride + b];
+        }
+      });
+}
+
+
+/*!
+ * Batched matrix multiply, C = alpha*A*B + beta*C for every matrix.
+ *
+ * C must not alias A or B. When beta is zero C is not read.
+ */
+template <typename ExecPol,
+          typename REGISTER_POLICY = default_register,
+          typename TA,
+          typename TB,
+          typename T,
+          camp::idx_t M,
+          camp::idx_t K,
+          camp::idx_t N>
+void gemm(BatchMatrixView<TA, M, K> const& A,
+          BatchMatrixView<TB, K, N> const& B,
+          BatchMatrixView<T, M, N> const& C,
+          typename BatchMatrixView<T, M, N>::value_type alpha = 1,
+          typename BatchMatrixView<T, M, N>::value_type beta = 0)
+{
+  static_assert(detail::check_batched_size<M>::value &&
+                    detail::check_batched_size<K>::value &&
+                    detail::check_batched_size<N>::value,
+                "");
+  detail::check_same_batch(C, A, B);
+  using chunk_t = detail::BatchChunk<T, REGISTER_POLICY>;
+  using vector_t = typename chunk_t::vector_type;
+
+  RAJA::forall<ExecPol>(
+      RAJA::TypedRangeSegment<camp::idx_t>(
+          0, detail::num_chunks<T, REGISTER_POLICY>(C.num_batch)),
+      [=](camp::idx_t c) {
+        const chunk_t chunk(c, C.batch_stride);
+        const vector_t valpha(alpha);
+        const vector_t vbeta(beta);
+
+        for (camp::idx_t i = 0; i < M; ++i) {
+
+          // keep row i of A in registers while it is used for all of C(i,:)
+          vector_t a_row[K];
+          for (camp::idx_t k = 0; k < K; ++k) {
+            a_row[k] = chunk.load(A.entry(i, k));
+          }
+
+          for (camp::idx_t j = 0; j < N; ++j) {
+            vector_t acc = a_row[0].multiply(chunk.load(B.entry(0, j)));
+            for (camp::idx_t k = 1; k < K; ++k) {
+              acc = a_row[k].multiply_add(chunk.load(B.entry(k, j)), acc);
+            }
+            acc = acc.multiply(valpha);
+            if (beta != 0) {
+              acc = chunk.load(C.entry(i, j)).multiply_add(vbeta, acc);
+            }
+            chunk.store(acc, C.entry(i, j));
+          }
+        }
+      });
+}
+
+/*!
+ * Batched matrix vector multiply, y = alpha*A*x + beta*y for every matrix.
+ *
+ * y must not alias A or x. When beta is zero y is not read.
+ */
+template <typename ExecPol,
+          typename REGISTER_POLICY = default_register,
+          typename TA,
+          typename TX,
+          typename T,
+          camp::idx_t M,
+          camp::idx_t N>
+void gemv(BatchMatrixView<TA, M, N> const& A,
+          BatchVectorView<TX, N> const& x,
+          BatchVectorView<T, M> const& y,
+          typename BatchVectorView<T, M>::value_type alpha = 1,
+          typename BatchVectorView<T, M>::value_type beta = 0)
+{
+  static_assert(detail::check_batched_size<M>::value &&
+                    detail::check_batched_size<N>::value,
+                "");
+  detail::check_same_batch(y, A, x);
+  using chunk_t = detail::BatchChunk<T, REGISTER_POLICY>;
+  using vector_t = typename chunk_t::vector_type;
+
+  RAJA::forall<ExecPol>(
+      RAJA::TypedRangeSegment<camp::idx_t>(
+          0, detail::num_chunks<T, REGISTER_POLICY>(y.num_batch)),
+      [=](camp::idx_t c) {
+        const chunk_t chunk(c, y.batch_stride);
+        const vector_t valpha(alpha);
+        const vector_t vbeta(beta);
+
+        vector_t x_reg[N];
+        for (camp::idx_t j = 0; j < N; ++j) {
+          x_reg[j] = chunk.load(x.entry(j, 0));
+        }
+
+        for (camp::idx_t i = 0; i < M; ++i) {
+          vector_t acc = chunk.load(A.entry(i, 0)).multiply(x_reg[0]);
+          for (camp::idx_t j = 1; j < N; ++j) {
+            acc = chunk.load(A.entry(i, j)).multiply_add(x_reg[j], acc);
+          }
+          acc = acc.multiply(valpha);
+          if (beta != 0) {
+            acc = chunk.load(y.entry(i, 0)).multiply_add(vbeta, acc);
+          }
+          chunk.store(acc, y.entry(i, 0));
+        }
+      });
+}
+
+
+/*!
+ * Batched LU factorization in place, A = L*U with L unit lower triangular.
+ *
+ * No pivoting is done, since each SIMD lane would need its own row
+ * permutation, so the matrices must be safe to factor without pivoting,
+ * for example diagonally dominant.
+ */
+template <typename ExecPol,
+          typename REGISTER_POLICY = default_register,
+          typename T,
+          camp::idx_t N>
+void lu_factor(BatchMatrixView<T, N, N> const& A)
+{
+  static_assert(detail::check_batched_size<N>::value &&
+                    detail::check_batched_solve_type<T>::value,
+                "");
+  using chunk_t = detail::BatchChunk<T, REGISTER_POLICY>;
+  using vector_t = typename chunk_t::vector_type;
+
+  RAJA::forall<ExecPol>(
+      RAJA::TypedRangeSegment<camp::idx_t>(
+          0, detail::num_chunks<T, REGISTER_POLICY>(A.num_batch)),
+      [=](camp::idx_t c) {
+        const chunk_t chunk(c, A.batch_stride);
+
+        for (camp::idx_t k = 0; k < N; ++k) {
+          const vector_t inv_pivot =
+              vector_t(1).divide(chunk.load(A.entry(k, k)));
+
+          for (camp::idx_t i = k + 1; i < N; ++i) {
+            const vector_t l = chunk.load(A.entry(i, k)).multiply(inv_pivot);
+            chunk.store(l, A.entry(i, k));
+
+            const vector_t neg_l = detail::negate(l);
+            for (camp::idx_t j = k + 1; j < N; ++j) {
+              chunk.store(neg_l.multiply_add(chunk.load(A.entry(k, j)),
+                                             chunk.load(A.entry(i, j))),
+                          A.entry(i, j));
+            }
+          }
+        }
+      });
+}
+
+/*!
+ * Batched solve with LU factors from lu_factor, X is overwritten with
+ * the solution of A*X = X.
+ */
+template <typename ExecPol,
+          typename REGISTER_POLICY = default_register,
+          typename TLU,
+          typename T,
+          camp::idx_t N,
+          camp::idx_t NRHS>
+void lu_solve(BatchMatrixView<TLU, N, N> const& LU,
+              BatchMatrixView<T, N, NRHS> const& X)
+{
+  static_assert(detail::check_batched_size<N>::value &&
+                    detail::check_batched_size<NRHS>::value &&
+                    detail::check_batched_solve_type<T>::value,
+                "");
+  detail::check_same_batch(X, LU);
+  using chunk_t = detail::BatchChunk<T, REGISTER_POLICY>;
+  using vector_t = typename chunk_t::vector_type;
+
+  RAJA::forall<ExecPol>(
+      RAJA::TypedRangeSegment<camp::idx_t>(
+          0, detail::num_chunks<T, REGISTER_POLICY>(X.num_batch)),
+      [=](camp::idx_t c) {
+        const chunk_t chunk(c, X.batch_stride);
+
+        // forward substitution with unit lower triangular L
+        for (camp::idx_t i = 1; i < N; ++i) {
+          for (camp::idx_t k = 0; k < i; ++k) {
+            const vector_t neg_l = detail::negate(chunk.load(LU.entry(i, k)));
+            for (camp::idx_t r = 0; r < NRHS; ++r) {
+              chunk.store(neg_l.multiply_add(chunk.load(X.entry(k, r)),
+                                             chunk.load(X.entry(i, r))),
+                          X.entry(i, r));
+            }
+          }
+        }
+
+        // backward substitution with U
+        for (camp::idx_t i = N - 1; i >= 0; --i) {
+          for (camp::idx_t k = i + 1; k < N; ++k) {
+            const vector_t neg_u = detail::negate(chunk.load(LU.entry(i, k)));
+            for (camp::idx_t r = 0; r < NRHS; ++r) {
+              chunk.store(neg_u.multiply_add(chunk.load(X.entry(k, r)),
+                                             chunk.load(X.entry(i, r))),
+                          X.entry(i, r));
+            }
+          }
+          const vector_t inv_u =
+              vector_t(1).divide(chunk.load(LU.entry(i, i)));
+          for (camp::idx_t r = 0; r < NRHS; ++r) {
+            chunk.store(chunk.load(X.entry(i, r)).multiply(inv_u),
+                        X.entry(i, r));
+          }
+        }
+      });
+}
+
+
+/*!
+ * Batched Cholesky factorization in place, A = L*L^T for symmetric
+ * positive definite A. Only the lower triangle is read and it is
+ * overwritten with L, the strictly upper triangle is not touched.
+ */
+template <typename ExecPol,
+          typename REGISTER_POLICY = default_register,
+          typename T,
+          camp::idx_t N>
+void cholesky_factor(BatchMatrixView<T, N, N> const& A)
+{
+  static_assert(detail::check_batched_size<N>::value &&
+                    detail::check_batched_solve_type<T>::value,
+                "");
+  using chunk_t = detail::BatchChunk<T, REGISTER_POLICY>;
+  using vector_t = typename chunk_t::vector_type;
+
+  RAJA::forall<ExecPol>(
+      RAJA::TypedRangeSegment<camp::idx_t>(
+          0, detail::num_chunks<T, REGISTER_POLICY>(A.num_batch)),
+      [=](camp::idx_t c) {
+        const chunk_t chunk(c, A.batch_stride);
+
+        for (camp::idx_t j = 0; j < N; ++j) {
+          vector_t d = chunk.load(A.entry(j, j));
+          for (camp::idx_t k = 0; k < j; ++k) {
+            const vector_t l = chunk.load(A.entry(j, k));
+            d = detail::negate(l).multiply_add(l, d);
+          }
+          d = d.sqrt();
+          chunk.store(d, A.entry(j, j));
+
+          const vector_t inv_d = vector_t(1).divide(d);
+          for (camp::idx_t i = j + 1; i < N; ++i) {
+            vector_t s = chunk.load(A.entry(i, j));
+            for (camp::idx_t k = 0; k < j; ++k) {
+              s = detail::negate(chunk.load(A.entry(i, k)))
+                      .multiply_add(chunk.load(A.entry(j, k)), s);
+            }
+            chunk.store(s.multiply(inv_d), A.entry(i, j));
+          }
+        }
+      });
+}
+
+/*!
+ * Batched solve with the Cholesky factor from cholesky_factor, X is
+ * overwritten with the solution of A*X = X.
+ */
+template <typename ExecPol,
+          typename REGISTER_POLICY = default_register,
+          typename TL,
+          typename T,
+          camp::idx_t N,
+          camp::idx_t NRHS>
+void cholesky_solve(BatchMatrixView<TL, N, N> const& L,
+                    BatchMatrixView<T, N, NRHS> const& X)
+{
+  static_assert(detail::check_batched_size<N>::value &&
+                    detail::check_batched_size<NRHS>::value &&
+                    detail::check_batched_solve_type<T>::value,
+                "");
+  detail::check_same_batch(X, L);
+  using chunk_t = detail::BatchChunk<T, REGISTER_POLICY>;
+  using vector_t = typename chunk_t::vector_type;
+
+  RAJA::forall<ExecPol>(
+      RAJA::TypedRangeSegment<camp::idx_t>(
+          0, detail::num_chunks<T, REGISTER_POLICY>(X.num_batch)),
+      [=](camp::idx_t c) {
+        const chunk_t chunk(c, X.batch_stride);
+
+        // forward substitution with L
+        for (camp::idx_t i = 0; i < N; ++i) {
+          for (camp::idx_t k = 0; k < i; ++k) {
+            const vector_t neg_l = detail::negate(chunk.load(L.entry(i, k)));
+            for (camp::idx_t r = 0; r < NRHS; ++r) {
+              chunk.store(neg_l.multiply_add(chunk.load(X.entry(k, r)),
+                                             chunk.load(X.entry(i, r))),
+                          X.entry(i, r));
+            }
+          }
+          const vector_t inv_l = vector_t(1).divide(chunk.load(L.entry(i, i)));
+          for (camp::idx_t r = 0; r < NRHS; ++r) {
+            chunk.store(chunk.load(X.entry(i, r)).multiply(inv_l),
+                        X.entry(i, r));
+          }
+        }
+
+        // backward substitution with L^T
+        for (camp::idx_t i = N - 1; i >= 0; --i) {
+          for (camp::idx_t k = i + 1; k < N; ++k) {
+            const vector_t neg_l = detail::negate(chunk.load(L.entry(k, i)));
+            for (camp::idx_t r = 0; r < NRHS; ++r) {
+              chunk.store(neg_l.multiply_add(chunk.load(X.entry(k, r)),
+                                             chunk.load(X.entry(i, r))),
+                          X.entry(i, r));
+            }
+          }
+          const vector_t inv_l = vector_t(1).divide(chunk.load(L.entry(i, i)));
+          for (camp::idx_t r = 0; r < NRHS; ++r) {
+            chunk.store(chunk.load(X.entry(i, r)).multiply(inv_l),
+                        X.entry(i, r));
+          }
+        }
+      });
+}
+
+
+/*!
+ * Batched matrix inverse by Gauss-Jordan elimination, Ainv = A^-1.
+ *
+ * Like lu_factor no pivoting is done. Ainv must not alias A.
+ */
+template <typename ExecPol,
+          typename REGISTER_POLICY = default_register,
+          typename TA,
+          typename T,
+          camp::idx_t N>
+void inverse(BatchMatrixView<TA, N, N> const& A,
+             BatchMatrixView<T, N, N> const& Ainv)
+{
+  static_assert(detail::check_batched_size<N>::value &&
+                    detail::check_batched_solve_type<T>::value,
+                "");
+  detail::check_same_batch(Ainv, A);
+  using chunk_t = detail::BatchChunk<T, REGISTER_POLICY>;
+  using vector_t = typename chunk_t::vector_type;
+
+  RAJA::forall<ExecPol>(
+      RAJA::TypedRangeSegment<camp::idx_t>(
+          0, detail::num_chunks<T, REGISTER_POLICY>(Ainv.num_batch)),
+      [=](camp::idx_t c) {
+        const chunk_t chunk(c, Ainv.batch_stride);
+
+        for (camp::idx_t i = 0; i < N; ++i) {
+          for (camp::idx_t j = 0; j < N; ++j) {
+            chunk.store(chunk.load(A.entry(i, j)), Ainv.entry(i, j));
+          }
+        }
+
+        // in place Gauss-Jordan, column k of the identity replaces
+        // column k of A as it is eliminated
+        for (camp::idx_t k = 0; k < N; ++k) {
+          const vector_t inv_pivot =
+              vector_t(1).divide(chunk.load(Ainv.entry(k, k)));
+          chunk.store(vector_t(1), Ainv.entry(k, k));
+          for (camp::idx_t j = 0; j < N; ++j) {
+            chunk.store(chunk.load(Ainv.entry(k, j)).multiply(inv_pivot),
+                        Ainv.entry(k, j));
+          }
+
+          for (camp::idx_t i = 0; i < N; ++i) {
+            if (i == k) {
+              continue;
+            }
+            const vector_t neg_f = detail::negate(chunk.load(Ainv.entry(i, k)));
+            chunk.store(vector_t(0), Ainv.entry(i, k));
+            for (camp::idx_t j = 0; j < N; ++j) {
+              chunk.store(neg_f.multiply_add(chunk.load(Ainv.entry(k, j)),
+                                             chunk.load(Ainv.entry(i, j))),
+                          Ainv.entry(i, j));
+            }
+          }
+        }
+      });
+}
+
+}  // namespace batched
+}  // namespace expt
+}  // namespace RAJA
+
+#endif
@@ -19,6 +19,7 @@
 #define RAJA_PATTERN_DETAIL_REDUCE_HPP
 
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/ReproducibleSum.hpp"
 #include "RAJA/util/types.hpp"
 
 #define RAJA_DECLARE_REDUCER(OP, POL, COMBINER)               \
@@ -310,6 +311,55 @@ private:
   Derived &derived() { return *(static_cast<Derived *>(this)); }
 };
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  Combinable base for reproducible sums, each copy accumulates into
+ *         a ReproducibleSum so partial results combine reproducibly.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Reduce, typename Derived>
+class BaseReproducibleCombinable
+{
+protected:
+  BaseReproducibleCombinable const *parent = nullptr;
+  ReproducibleSum<T> mutable my_data;
+
+public:
+  BaseReproducibleCombinable(T init_val, T = T()) : my_data{init_val} {}
+
+  void reset(T init_val, T) { my_data = ReproducibleSum<T>{init_val}; }
+
+  BaseReproducibleCombinable(BaseReproducibleCombinable const &other)
+      : parent{other.parent ? other.parent : &other}
+  {
+  }
+
+  ~BaseReproducibleCombinable()
+  {
+    if (parent) {
+      parent->my_data += my_data;
+    }
+  }
+
+  void combine(T const &other) const { my_data += other; }
+
+  /*!
+   *  \return the calculated reduced value
+   */
+  T get() const { return derived().get_combined(); }
+
+  T get_combined() const { return my_data.get(); }
+
+private:
+  // Convenience method for CRTP
+  const Derived &derived() const
+  {
+    return *(static_cast<const Derived *>(this));
+  }
+};
+
 /*!
  ******************************************************************************
  *
@@ -0,0 +1,85 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the context passed to worklist loop bodies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_worklist_HPP
+#define RAJA_pattern_detail_worklist_HPP
+
+#include "RAJA/config.hpp"
+
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Handle passed to worklist loop bodies to add new work items.
+ *
+ *         Items pushed by a body run in the same call to RAJA::worklist.
+ *         With parallel policies they may run on other threads while the
+ *         body that pushed them is still running, so a body must finish the
+ *         writes a pushed item depends on before pushing it. With
+ *         RAJA::worklist_levels, they run in the next level, after the
+ *         current level is done, and level() is the level of the current
+ *         item.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class WorklistContext
+{
+public:
+  using push_function = void (*)(void*, T const&);
+
+  RAJA_INLINE
+  WorklistContext(void* queue, push_function push, int level = 0)
+      : m_queue(queue), m_push(push), m_level(level)
+  {
+  }
+
+  //! Add item to the work of this worklist
+  RAJA_INLINE
+  void push(T const& item) const { m_push(m_queue, item); }
+
+  //! Level of the current item, 0 outside of worklist_levels
+  RAJA_INLINE
+  int level() const { return m_level; }
+
+private:
+  void* m_queue;
+  push_function m_push;
+  int m_level;
+};
+
+namespace detail
+{
+
+//! WorklistContext push function appending to a std::vector
+template <typename T>
+void worklist_push_back(void* queue, T const& item)
+{
+  static_cast<std::vector<T>*>(queue)->push_back(item);
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -63,6 +63,9 @@
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/policy/MultiPolicy.hpp"
 
+#include "RAJA/index/BitsetSegment.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
+#include "RAJA/index/FlatIndexSet.hpp"
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
@@ -156,6 +159,7 @@ template <typename Res, typename ExecutionPolicy, typename Container, typename L
 RAJA_INLINE concepts::enable_if_t<
     RAJA::resources::EventProxy<Res>,
     concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<detail::use_segment_blocks<ExecutionPolicy, Container>>,
     type_traits::is_range<Container>>
 forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body, ForallParams&& f_params)
 {
@@ -171,6 +175,7 @@ template <typename Res, typename ExecutionPolicy, typename Container, typename L
 RAJA_INLINE concepts::enable_if_t<
     RAJA::resources::EventProxy<Res>,
     concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<detail::use_segment_blocks<ExecutionPolicy, Container>>,
     type_traits::is_range<Container>>
 forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
 {
@@ -183,6 +188,107 @@ forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
 }
 
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over a blocked segment with a host policy
+ *
+ * The policy runs over the blocks of the segment and the indices of each
+ * block are visited in a loop over the block, see
+ * TypedCompressedListSegment::forEachInBlock and
+ * TypedBitsetSegment::forEachInBlock.
+ *
+ ******************************************************************************
+ */
+template <typename Res, typename ExecutionPolicy, typename Container, typename LoopBody, typename ForallParams>
+RAJA_INLINE concepts::enable_if_t<
+    RAJA::resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    detail::use_segment_blocks<ExecutionPolicy, Container>>
+forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body, ForallParams&& f_params)
+{
+  using policies = detail::segment_block_policies<camp::decay<ExecutionPolicy>>;
+  using inner_policy = typename policies::inner_policy;
+
+  camp::decay<Container> segment = c;
+  camp::decay<LoopBody> body = loop_body;
+
+  auto block_body = [=](Index_type b, auto&&... params) {
+    segment.template forEachInBlock<inner_policy>(
+        b, [&](typename camp::decay<Container>::value_type i) {
+          body(i, params...);
+        });
+  };
+
+  RAJA_FORCEINLINE_RECURSIVE
+  return forall_impl(r,
+                     detail::segment_block_policy(
+                         p, typename policies::block_policy{}),
+                     TypedRangeSegment<Index_type>(0, segment.getNumBlocks()),
+                     block_body,
+                     std::forward<ForallParams>(f_params));
+}
+
+template <typename Res, typename ExecutionPolicy, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    RAJA::resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    detail::use_segment_blocks<ExecutionPolicy, Container>>
+forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
+{
+  return forall(r,
+                std::forward<ExecutionPolicy>(p),
+                std::forward<Container>(c),
+                std::forward<LoopBody>(loop_body),
+                expt::get_empty_forall_param_pack());
+}
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over containers on an asynchronous host resource
+ *
+ * The loop is enqueued on the resource's stream and run there with the
+ * default synchronous host resource.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Container, typename LoopBody, typename ForallParams>
+RAJA_INLINE concepts::enable_if_t<
+    RAJA::resources::EventProxy<resources::HostAsync>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>>
+forall(resources::HostAsync r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body, ForallParams&& f_params)
+{
+  camp::decay<ExecutionPolicy> pol = p;
+  camp::decay<Container> container = c;
+  camp::decay<LoopBody> body = loop_body;
+  camp::decay<ForallParams> params = f_params;
+
+  r.enqueue([=]() mutable {
+    auto host_res = resources::Host::get_default();
+    forall_impl(host_res, pol, container, body, params);
+  });
+
+  return RAJA::resources::EventProxy<resources::HostAsync>(r);
+}
+
+template <typename ExecutionPolicy, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    RAJA::resources::EventProxy<resources::HostAsync>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>>
+forall(resources::HostAsync r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
+{
+  return wrap::forall(r,
+                      std::forward<ExecutionPolicy>(p),
+                      std::forward<Container>(c),
+                      std::forward<LoopBody>(loop_body),
+                      expt::get_empty_forall_param_pack());
+}
+
+
 /*!
  ******************************************************************************
  *
@@ -270,6 +376,59 @@ RAJA_INLINE resources::EventProxy<Res> forall(Res r,
   return RAJA::resources::EventProxy<Res>(r);
 }
 
+/*!
+******************************************************************************
+*
+* \brief Execute segments of a TypedFlatIndexSet, the segments are looked up
+*        with a table on their type tag.
+*
+******************************************************************************
+*/
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename... SegmentTypes,
+          typename LoopBody,
+          typename ForallParams>
+RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res r,
+                                                ExecPolicy<SegmentIterPolicy,
+                                                SegmentExecPolicy>,
+                                                const TypedFlatIndexSet<SegmentTypes...>& iset,
+                                                LoopBody loop_body,
+                                                ForallParams f_params)
+{
+  auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
+  wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
+    iset.segmentCall(segID,
+                     detail::CallForallIcount(iset.getStartingIcount(segID)),
+                     SegmentExecPolicy(),
+                     loop_body,
+                     r,
+                     f_params);
+  });
+  return RAJA::resources::EventProxy<Res>(r);
+}
+
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes,
+          typename ForallParams>
+RAJA_INLINE resources::EventProxy<Res> forall(Res r,
+                                         ExecPolicy<SegmentIterPolicy,
+                                         SegmentExecPolicy>,
+                                         const TypedFlatIndexSet<SegmentTypes...>& iset,
+                                         LoopBody loop_body,
+                                         ForallParams f_params)
+{
+  auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
+  wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
+    iset.segmentCall(segID, detail::CallForall{}, SegmentExecPolicy(), loop_body, r, f_params);
+  });
+  return RAJA::resources::EventProxy<Res>(r);
+}
+
 }  // end namespace wrap
 
 
@@ -300,7 +459,8 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
                                                      IdxSet&& c,
                                                      Params&&... params)
 {
-  static_assert(type_traits::is_index_set<IdxSet>::value,
+  static_assert(type_traits::is_index_set<IdxSet>::value ||
+                    type_traits::is_flat_index_set<IdxSet>::value,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
@@ -308,7 +468,17 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
   auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
   //expt::check_forall_optional_args(loop_body, f_params);
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  if (!util::plugins_active()) {
+    return wrap::forall_Icount(r,
+                               std::forward<ExecutionPolicy>(p),
+                               std::forward<IdxSet>(c),
+                               std::forward<decltype(loop_body)>(loop_body),
+                               f_params);
+  }
+
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>,
+                         camp::decay<decltype(loop_body)>>(c, params...)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -355,7 +525,8 @@ RAJA_INLINE concepts::enable_if_t<
     type_traits::is_indexset_policy<ExecutionPolicy>>
 forall(ExecutionPolicy&& p, Res r, IdxSet&& c, Params&&... params)
 {
-  static_assert(type_traits::is_index_set<IdxSet>::value,
+  static_assert(type_traits::is_index_set<IdxSet>::value ||
+                    type_traits::is_flat_index_set<IdxSet>::value,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
@@ -363,7 +534,17 @@ forall(ExecutionPolicy&& p, Res r, IdxSet&& c, Params&&... params)
   auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
   expt::check_forall_optional_args(loop_body, f_params);
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  if (!util::plugins_active()) {
+    return wrap::forall(r,
+                        std::forward<ExecutionPolicy>(p),
+                        std::forward<IdxSet>(c),
+                        std::forward<decltype(loop_body)>(loop_body),
+                        f_params);
+  }
+
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>,
+                         camp::decay<decltype(loop_body)>>(c, params...)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -456,7 +637,18 @@ forall_Icount(ExecutionPolicy&& p,
   auto&& loop_body = expt::get_lambda(std::forward<FirstParam>(first), std::forward<Params>(params)...);
   //expt::check_forall_optional_args(loop_body, f_params);
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  if (!util::plugins_active()) {
+    return wrap::forall_Icount(r,
+                               std::forward<ExecutionPolicy>(p),
+                               std::forward<Container>(c),
+                               icount,
+                               std::forward<decltype(loop_body)>(loop_body),
+                               f_params);
+  }
+
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>,
+                         camp::decay<decltype(loop_body)>>(c, first, params...)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -524,7 +716,17 @@ forall(ExecutionPolicy&& p, Res r, Container&& c, Params&&... params)
   auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
   expt::check_forall_optional_args(loop_body, f_params);
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  if (!util::plugins_active()) {
+    return wrap::forall(r,
+                        std::forward<ExecutionPolicy>(p),
+                        std::forward<Container>(c),
+                        std::forward<decltype(loop_body)>(loop_body),
+                        f_params);
+  }
+
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>,
+                         camp::decay<decltype(loop_body)>>(c, params...)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
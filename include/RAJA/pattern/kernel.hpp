@@ -106,7 +106,9 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
                                                                   Resource resource,
                                                                   Bodies &&... bodies)
 {
-  util::PluginContext context{util::make_context<PolicyType>()};
+  util::PluginContext context{
+      util::make_context<PolicyType, camp::list<camp::decay<Bodies>...>>(
+          segments)};
 
   // TODO: test that all policy members model the Executor policy concept
   // TODO: add a static_assert for functors which cannot be invoked with
@@ -141,6 +143,15 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
 
   using loop_types_t = internal::makeInitialLoopTypes<loop_data_t>;
 
+  // expt:: reducers accumulate in the LoopData and its thread private copies
+  // on the host, they are written to their targets after the kernel
+  static_assert(!expt::detail::has_reducer_params<param_tuple_t>::value ||
+                    std::is_same<Resource, resources::Host>::value,
+                "RAJA::expt reducers in kernel_param are only supported by "
+                "host kernel policies");
+
+  expt::detail::kernel_params_init(loop_data.param_tuple);
+
   util::callPreLaunchPlugins(context);
 
   // Execute!
@@ -149,6 +160,8 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
 
   util::callPostLaunchPlugins(context);
 
+  expt::detail::kernel_params_resolve(loop_data.param_tuple);
+
   return resources::EventProxy<Resource>(resource);
 }
 
@@ -208,6 +221,7 @@ RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> ke
 #include "RAJA/pattern/kernel/Region.hpp"
 #include "RAJA/pattern/kernel/Tile.hpp"
 #include "RAJA/pattern/kernel/TileTCount.hpp"
+#include "RAJA/pattern/kernel/TileTuning.hpp"
 
 
 #endif /* RAJA_pattern_kernel_HPP */
@@ -246,6 +246,10 @@ struct LambdaArgSwitchboard<Types, LambdaArg<lambda_arg_seg_t, id>>
 
 };
 
+/*
+ * expt:: reducers are passed as a reference to their value, other params
+ * as a reference to the param
+ */
 template<typename Types, camp::idx_t id>
 struct LambdaArgSwitchboard<Types, LambdaArg<lambda_arg_param_t, id>>
 {
@@ -254,9 +258,9 @@ struct LambdaArgSwitchboard<Types, LambdaArg<lambda_arg_param_t, id>>
   RAJA_INLINE
   constexpr
   static auto extract(Data &&data)->
-    typename std::add_lvalue_reference<camp::tuple_element_t<id,typename camp::decay<Data>::param_tuple_t>>::type
+    decltype(expt::detail::kernel_lambda_arg(camp::get<id>(data.param_tuple)))
   {
-    return camp::get<id>(data.param_tuple);
+    return expt::detail::kernel_lambda_arg(camp::get<id>(data.param_tuple));
   }
 };
 
@@ -331,10 +335,11 @@ struct StatementExecutor<statement::Lambda<LambdaIndex>, Types> {
     using offset_tuple_t = typename Data_t::offset_tuple_t;
     using param_tuple_t = typename Data_t::param_tuple_t;
 
+    // params without lambda arguments, like expt::KernelName, are skipped
     invoke_lambda<LambdaIndex, Types>(
         std::forward<Data>(data),
         camp::make_idx_seq_t<camp::tuple_size<offset_tuple_t>::value>{},
-        camp::make_idx_seq_t<camp::tuple_size<param_tuple_t>::value>{});
+        expt::detail::lambda_param_seq<param_tuple_t>{});
 
   }
 };
@@ -0,0 +1,189 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for kernels with tuned dynamic tile sizes.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_TileTuning_HPP
+#define RAJA_pattern_kernel_TileTuning_HPP
+
+#include "RAJA/config.hpp"
+
+#include <string>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/kernel/Tile.hpp"
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/TileTuner.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+
+template <typename T>
+struct is_tile_size : std::is_same<camp::decay<T>, TileSize> {
+};
+
+template <typename... Ts>
+struct count_tile_sizes : std::integral_constant<camp::idx_t, 0> {
+};
+
+template <typename T, typename... Ts>
+struct count_tile_sizes<T, Ts...>
+    : std::integral_constant<camp::idx_t,
+                             camp::idx_t(is_tile_size<T>::value) +
+                                 count_tile_sizes<Ts...>::value> {
+};
+
+template <typename... Ts>
+struct count_tile_sizes<camp::tuple<Ts...>> : count_tile_sizes<Ts...> {
+};
+
+//@{
+//! Extent of segment I, 0 if there is no segment I
+template <camp::idx_t I, typename SegmentTuple>
+RAJA_INLINE Index_type tuned_tile_extent(SegmentTuple const& segments,
+                                         std::true_type)
+{
+  return static_cast<Index_type>(
+      util::detail::iteration_count(camp::get<I>(segments), 0));
+}
+
+template <camp::idx_t I, typename SegmentTuple>
+RAJA_INLINE Index_type tuned_tile_extent(SegmentTuple const&, std::false_type)
+{
+  return 0;
+}
+//@}
+
+///
+/// Extents of the segments tiled by the TileSize params; tile_dynamic<N>
+/// tiles segment N with the size in param N.
+///
+template <typename ParamTuple, typename SegmentTuple, camp::idx_t... I>
+RAJA_INLINE TileTuner::Shape tuned_tile_shape(SegmentTuple const& segments,
+                                              camp::idx_seq<I...>)
+{
+  using segment_tuple_t = camp::decay<SegmentTuple>;
+  const bool tiled[] = {
+      false, is_tile_size<camp::tuple_element_t<I, ParamTuple>>::value...};
+  const Index_type extents[] = {
+      0,
+      tuned_tile_extent<I>(
+          segments,
+          std::integral_constant<
+              bool,
+              (I < camp::tuple_size<segment_tuple_t>::value)>{})...};
+
+  TileTuner::Shape shape;
+  for (size_t p = 1; p < sizeof(tiled) / sizeof(tiled[0]); ++p) {
+    if (tiled[p]) {
+      shape.push_back(extents[p]);
+    }
+  }
+  return shape;
+}
+
+//@{
+//! Copy of a param, with the next tuned size for a TileSize
+template <typename T>
+RAJA_INLINE T tuned_tile_param(T const& param,
+                               TileTuner::Sizes const&,
+                               size_t&)
+{
+  return param;
+}
+
+RAJA_INLINE TileSize tuned_tile_param(TileSize const&,
+                                      TileTuner::Sizes const& sizes,
+                                      size_t& next)
+{
+  return TileSize{sizes[next++]};
+}
+//@}
+
+template <typename ParamTuple, camp::idx_t... I>
+RAJA_INLINE camp::decay<ParamTuple> tuned_tile_params(
+    ParamTuple const& params,
+    TileTuner::Sizes const& sizes,
+    camp::idx_seq<I...>)
+{
+  // braced initializers are evaluated in order
+  size_t next = 0;
+  return camp::decay<ParamTuple>{
+      tuned_tile_param(camp::get<I>(params), sizes, next)...};
+}
+
+}  // namespace internal
+
+/*!
+ * \brief Run kernel_param with the TileSize params set by a TileTuner.
+ *
+ * The kernel is tuned per name and the extents of the segments tiled with
+ * tile_dynamic, so the TileSize in param N must be the size for
+ * tile_dynamic<N>. The sizes in params are only used for the tuple type.
+ *
+ * \verbatim
+ *
+ *   RAJA::kernel_param_tuned<KernelPol>(
+ *       tuner, "transpose",
+ *       RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, M)),
+ *       RAJA::make_tuple(RAJA::TileSize{16}, RAJA::TileSize{16}),
+ *       [=](int i, int j) { ... });
+ *
+ * \endverbatim
+ */
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>>
+kernel_param_tuned(TileTuner& tuner,
+                   const std::string& name,
+                   SegmentTuple&& segments,
+                   ParamTuple&& params,
+                   Bodies&&... bodies)
+{
+  using param_tuple_t = camp::decay<ParamTuple>;
+  using param_seq_t =
+      camp::make_idx_seq_t<camp::tuple_size<param_tuple_t>::value>;
+
+  static_assert(internal::count_tile_sizes<param_tuple_t>::value > 0,
+                "kernel_param_tuned needs TileSize params to tune");
+
+  auto res = resources::get_default_resource<PolicyType>();
+  const TileTuner::Shape shape =
+      internal::tuned_tile_shape<param_tuple_t>(segments, param_seq_t{});
+
+  tuner.run(name, shape, shape.size(), [&](TileTuner::Sizes const& sizes) {
+    RAJA::kernel_param_resource<PolicyType>(
+        std::forward<SegmentTuple>(segments),
+        internal::tuned_tile_params(params, sizes, param_seq_t{}),
+        res,
+        std::forward<Bodies>(bodies)...);
+  });
+
+  return resources::EventProxy<resources::resource_from_pol_t<PolicyType>>(
+      res);
+}
+
+}  // namespace RAJA
+
+#endif /* RAJA_pattern_kernel_TileTuning_HPP */
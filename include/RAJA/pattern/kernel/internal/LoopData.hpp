@@ -28,6 +28,7 @@
 #include "camp/camp.hpp"
 
 #include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/params/kernel.hpp"
 #include "RAJA/pattern/kernel/internal/StatementList.hpp"
 #include "RAJA/pattern/kernel/internal/Template.hpp"
 
@@ -102,11 +103,31 @@ using index_types_from_segments =
 
 
 
+template <typename Data>
+struct LoopDataPrivatizer;
+
+/*!
+ * LoopData with expt:: reducers in its params gets a privatizer that folds
+ * the private accumulators back, others are privatized by plain copies.
+ */
+template <typename Data,
+          typename ParamTuple,
+          bool = expt::detail::has_reducer_params<ParamTuple>::value>
+struct LoopDataPrivatizerBase {
+};
+
+template <typename Data, typename ParamTuple>
+struct LoopDataPrivatizerBase<Data, ParamTuple, true> {
+  using privatizer = LoopDataPrivatizer<Data>;
+};
+
 template <typename SegmentTuple,
           typename ParamTuple,
           typename Resource,
           typename... Bodies>
-struct LoopData {
+struct LoopData
+    : LoopDataPrivatizerBase<LoopData<SegmentTuple, ParamTuple, Resource, Bodies...>,
+                             ParamTuple> {
 
   using Self = LoopData<SegmentTuple, ParamTuple, Resource, Bodies...>;
 
@@ -213,8 +234,49 @@ struct GenericWrapper : GenericWrapperBase {
 };
 
 
+/*!
+ * Thread private copy of a LoopData with expt:: reducers. The reducers
+ * restart from their identity and are folded into the parent LoopData when
+ * the copy is destroyed. Copies, as made by firstprivate, start over from
+ * the same parent.
+ */
+template <typename Data>
+struct LoopDataPrivatizer {
+  using value_type = camp::decay<Data>;
+  using reference_type = value_type &;
+  // thread_privatize hands out the parent by const reference. Other threads
+  // fold into it while this one copies it, so both hold the same lock.
+  value_type *parent;
+  value_type priv;
+
+  LoopDataPrivatizer(const value_type &o)
+      : parent{const_cast<value_type *>(&o)},
+        priv{expt::detail::kernel_params_shared_copy(o)}
+  {
+    expt::detail::kernel_params_private_init(priv.param_tuple);
+  }
+
+  LoopDataPrivatizer(const LoopDataPrivatizer &o)
+      : parent{o.parent}, priv{o.priv}
+  {
+    expt::detail::kernel_params_private_init(priv.param_tuple);
+  }
+
+  ~LoopDataPrivatizer()
+  {
+    expt::detail::kernel_params_fold(parent->param_tuple, priv.param_tuple);
+  }
+
+  RAJA_INLINE
+  reference_type get_priv() { return priv; }
+};
+
 /*!
  * Convenience object used to create thread-private a LoopData object.
+ *
+ * expt:: reducers in the params of the private copy restart from their
+ * identity and are folded into the parent LoopData when the copy is
+ * destroyed, both are no-ops for other params.
  */
 template <typename T>
 struct NestedPrivatizer {
@@ -222,13 +284,33 @@ struct NestedPrivatizer {
   using value_type = camp::decay<T>;
   using reference_type = value_type &;
 
+  data_t *parent_data;
   data_t privatized_data;
   value_type privatized_wrapper;
 
   RAJA_INLINE
-  constexpr NestedPrivatizer(const T &o)
-      : privatized_data{o.data}, privatized_wrapper(privatized_data)
+  NestedPrivatizer(const T &o)
+      : parent_data{&o.data},
+        privatized_data{expt::detail::kernel_params_shared_copy(o.data)},
+        privatized_wrapper(privatized_data)
+  {
+    expt::detail::kernel_params_private_init(privatized_data.param_tuple);
+  }
+
+  RAJA_INLINE
+  NestedPrivatizer(const NestedPrivatizer &o)
+      : parent_data{o.parent_data},
+        privatized_data{o.privatized_data},
+        privatized_wrapper(privatized_data)
+  {
+    expt::detail::kernel_params_private_init(privatized_data.param_tuple);
+  }
+
+  RAJA_INLINE
+  ~NestedPrivatizer()
   {
+    expt::detail::kernel_params_fold(parent_data->param_tuple,
+                                     privatized_data.param_tuple);
   }
 
   RAJA_INLINE
@@ -236,7 +318,6 @@ struct NestedPrivatizer {
 };
 
 
-
 }  // end namespace internal
 }  // end namespace RAJA
 
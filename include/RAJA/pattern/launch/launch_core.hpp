@@ -28,6 +28,9 @@
 #include "camp/concepts.hpp"
 #include "camp/tuple.hpp"
 
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/pattern/params/forall.hpp"
+
 //Odd dependecy with atomics is breaking CI builds
 //#include "RAJA/util/View.hpp"
 
@@ -161,12 +164,16 @@ public:
 
   void *shared_mem_ptr;
 
+  //Set by host launch policies whose threads form one team,
+  //teamSync is then a barrier of those threads
+  bool host_team_sync;
+
 #if defined(RAJA_ENABLE_SYCL)
   mutable cl::sycl::nd_item<3> *itm;
 #endif
 
   RAJA_HOST_DEVICE LaunchContext()
-    : shared_mem_offset(0), shared_mem_ptr(nullptr)
+    : shared_mem_offset(0), shared_mem_ptr(nullptr), host_team_sync(false)
   {
   }
 
@@ -208,6 +215,12 @@ public:
 #if defined(RAJA_DEVICE_CODE) && !defined(RAJA_ENABLE_SYCL)
     __syncthreads();
 #endif
+
+#if !defined(RAJA_DEVICE_CODE) && defined(RAJA_ENABLE_OPENMP)
+    if (host_team_sync) {
+#pragma omp barrier
+    }
+#endif
   }
 };
 
@@ -231,6 +244,29 @@ void launch(LaunchParams const &params, const char *kernel_name, BODY const &bod
   launch_t::exec(params, kernel_name, body);
 }
 
+//Policy based launch with expt params, the body is the last argument
+//and takes the context followed by one argument per reducer:
+//
+//  launch<pol>(params, expt::Reduce<RAJA::operators::plus>(&sum),
+//    [=](LaunchContext ctx, double &_sum) { ... });
+//
+//Host policies only, reducers are privatized per thread of the launch
+template <typename LAUNCH_POLICY,
+          typename P0,
+          typename... Params,
+          typename std::enable_if<
+              expt::detail::is_forall_param<P0>::value>::type * = nullptr>
+void launch(LaunchParams const &params, P0 &&p0, Params &&... rest)
+{
+  auto f_params = expt::make_forall_param_pack(std::forward<P0>(p0),
+                                               std::forward<Params>(rest)...);
+  auto &&body = expt::get_lambda(std::forward<P0>(p0),
+                                 std::forward<Params>(rest)...);
+
+  using launch_t = LaunchExecute<typename LAUNCH_POLICY::host_policy_t>;
+  launch_t::exec(params, f_params, body);
+}
+
 
 //Run time based policy launch
 template <typename POLICY_LIST, typename BODY>
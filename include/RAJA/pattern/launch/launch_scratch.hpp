@@ -0,0 +1,167 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the dynamic shared memory arena used
+ *          by the host RAJA::launch policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_scratch_HPP
+#define RAJA_pattern_launch_scratch_HPP
+
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Per thread buffer for the dynamic shared memory of host launches.
+ *
+ * The buffer is kept between launches and grows to the largest size asked
+ * for, so repeated launches do not call the allocator. New buffers are
+ * zeroed by the owning thread, which places their pages in the memory
+ * closest to that thread under a first touch page policy.
+ */
+class LaunchScratch
+{
+public:
+  static constexpr std::size_t alignment = 64;
+  static constexpr std::size_t page_size = 4096;
+
+  LaunchScratch() = default;
+  LaunchScratch(LaunchScratch const&) = delete;
+  LaunchScratch& operator=(LaunchScratch const&) = delete;
+
+  ~LaunchScratch() { std::free(m_allocation); }
+
+  //! Largest size asked for so far, the buffer holds at least this much.
+  std::size_t capacity() const { return m_capacity; }
+
+  bool in_use() const { return m_in_use; }
+
+  //! Returns a buffer of at least bytes, aligned to alignment.
+  char* acquire(std::size_t bytes)
+  {
+    if (bytes > m_capacity) {
+      grow(bytes);
+    }
+    m_in_use = true;
+    return m_buffer;
+  }
+
+  void release() { m_in_use = false; }
+
+  //! Frees the buffer, only when it is not in use.
+  void reset()
+  {
+    if (!m_in_use) {
+      std::free(m_allocation);
+      m_allocation = nullptr;
+      m_buffer = nullptr;
+      m_capacity = 0;
+    }
+  }
+
+private:
+  void* m_allocation = nullptr;
+  char* m_buffer = nullptr;
+  std::size_t m_capacity = 0;
+  bool m_in_use = false;
+
+  void grow(std::size_t bytes)
+  {
+    const std::size_t capacity = (bytes + page_size - 1) / page_size * page_size;
+
+    void* allocation = std::malloc(capacity + alignment - 1);
+    if (allocation == nullptr) {
+      RAJA_ABORT_OR_THROW("LaunchScratch: failed to allocate shared memory");
+    }
+    std::free(m_allocation);
+
+    const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(allocation);
+    m_allocation = allocation;
+    m_buffer = reinterpret_cast<char*>((addr + alignment - 1) &
+                                       ~(std::uintptr_t)(alignment - 1));
+    m_capacity = capacity;
+
+    std::memset(m_buffer, 0, m_capacity);
+  }
+};
+
+//! The calling thread's buffer.
+RAJA_INLINE LaunchScratch& launch_scratch()
+{
+  static thread_local LaunchScratch scratch;
+  return scratch;
+}
+
+/*!
+ * Dynamic shared memory of one launch from the calling thread's
+ * LaunchScratch. A launch nested in the body of another launch on the same
+ * thread finds the buffer in use and gets a buffer of its own instead.
+ */
+class LaunchScratchLease
+{
+public:
+  explicit LaunchScratchLease(std::size_t bytes)
+  {
+    LaunchScratch& scratch = launch_scratch();
+    if (!scratch.in_use()) {
+      m_scratch = &scratch;
+      m_ptr = scratch.acquire(bytes);
+    } else {
+      m_ptr = static_cast<char*>(std::malloc(bytes));
+    }
+  }
+
+  LaunchScratchLease(LaunchScratchLease const&) = delete;
+  LaunchScratchLease& operator=(LaunchScratchLease const&) = delete;
+
+  ~LaunchScratchLease()
+  {
+    if (m_scratch != nullptr) {
+      m_scratch->release();
+    } else {
+      std::free(m_ptr);
+    }
+  }
+
+  char* get() const { return m_ptr; }
+
+private:
+  LaunchScratch* m_scratch = nullptr;
+  char* m_ptr = nullptr;
+};
+
+}  // namespace detail
+
+/*!
+ * Frees the calling thread's dynamic shared memory buffer kept by the host
+ * launch policies. The next launch on the thread allocates a new one.
+ */
+RAJA_INLINE void release_launch_scratch()
+{
+  detail::launch_scratch().reset();
+}
+
+}  // namespace RAJA
+
+#endif
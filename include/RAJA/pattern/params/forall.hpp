@@ -2,8 +2,11 @@
 #define FORALL_PARAM_HPP
 
 #include "RAJA/policy/sequential/params/reduce.hpp"
+#include "RAJA/policy/sequential/params/kernel_name.hpp"
 #include "RAJA/policy/tbb/params/reduce.hpp"
+#include "RAJA/policy/tbb/params/kernel_name.hpp"
 #include "RAJA/policy/openmp/params/reduce.hpp"
+#include "RAJA/policy/openmp/params/kernel_name.hpp"
 #include "RAJA/policy/openmp_target/params/reduce.hpp"
 #include "RAJA/policy/cuda/params/reduce.hpp"
 #include "RAJA/policy/cuda/params/kernel_name.hpp"
@@ -0,0 +1,256 @@
+#ifndef RAJA_KERNEL_PARAM_HPP
+#define RAJA_KERNEL_PARAM_HPP
+
+#include <mutex>
+#include <type_traits>
+
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/pattern/params/forall.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+namespace detail
+{
+
+  //===========================================================================
+  //
+  //
+  // Param tuple traits for RAJA::kernel_param.
+  //
+  // The param tuple of a kernel may hold expt:: params (Reduce, ReduceLoc,
+  // KernelName) next to ordinary params. Reducers are given to the lambdas
+  // as a reference to their value. The value lives in the LoopData, so a
+  // thread private copy of the LoopData carries a private accumulator that
+  // is folded into its parent once, when the private copy goes away.
+  //
+  //
+  template<typename OP, typename T>
+  std::true_type is_reducer_param_impl(const Reducer<OP, T>*);
+  std::false_type is_reducer_param_impl(const void*);
+
+  template<typename T>
+  using is_reducer_param = decltype(is_reducer_param_impl(std::declval<camp::decay<T>*>()));
+
+  template<typename Tuple>
+  struct has_reducer_params : std::false_type {};
+
+  template<typename... Ts>
+  struct has_reducer_params<camp::tuple<Ts...>>
+      : camp::concepts::any_of<is_reducer_param<Ts>...> {};
+
+  // Params given to a Lambda without arguments, KernelName has none.
+  template<typename T, bool = is_forall_param<T>::value>
+  struct is_lambda_param : std::true_type {};
+
+  template<typename T>
+  struct is_lambda_param<T, true>
+      : std::integral_constant<bool, (camp::decay<T>::num_lambda_args > 0)> {};
+
+  template<typename Tuple, typename Seq, typename Out = camp::idx_seq<>>
+  struct lambda_param_seq_impl {
+    using type = Out;
+  };
+
+  template<typename Tuple, camp::idx_t I, camp::idx_t... Is, camp::idx_t... Os>
+  struct lambda_param_seq_impl<Tuple, camp::idx_seq<I, Is...>, camp::idx_seq<Os...>>
+      : lambda_param_seq_impl<
+            Tuple,
+            camp::idx_seq<Is...>,
+            typename std::conditional<
+                is_lambda_param<camp::tuple_element_t<I, Tuple>>::value,
+                camp::idx_seq<Os..., I>,
+                camp::idx_seq<Os...>>::type> {};
+
+  template<typename Tuple>
+  using lambda_param_seq = typename lambda_param_seq_impl<
+      Tuple,
+      camp::make_idx_seq_t<camp::tuple_size<Tuple>::value>>::type;
+  //===========================================================================
+
+
+
+  //===========================================================================
+  //
+  //
+  // Lambda argument of a single param.
+  //
+  //
+  template<typename P>
+  RAJA_HOST_DEVICE RAJA_INLINE
+  camp::concepts::enable_if_t<typename P::value_type&, is_reducer_param<P>>
+  kernel_lambda_arg(P& p)
+  {
+    return p.val;
+  }
+
+  template<typename P>
+  RAJA_HOST_DEVICE RAJA_INLINE
+  camp::concepts::enable_if_t<P&, camp::concepts::negate<is_reducer_param<P>>>
+  kernel_lambda_arg(P& p)
+  {
+    return p;
+  }
+  //===========================================================================
+
+
+
+  //===========================================================================
+  //
+  //
+  // Per param init, private reset, fold and resolve.
+  //
+  // Init and resolve run once per kernel on the host and use the sequential
+  // implementations. Other params are left alone.
+  //
+  //
+  template<typename P>
+  camp::concepts::enable_if<is_forall_param<P>>
+  kernel_param_init(P& p) { init<RAJA::seq_exec>(p); }
+
+  template<typename P>
+  camp::concepts::enable_if<camp::concepts::negate<is_forall_param<P>>>
+  kernel_param_init(P&) {}
+
+  template<typename P>
+  camp::concepts::enable_if<is_forall_param<P>>
+  kernel_param_resolve(P& p) { resolve<RAJA::seq_exec>(p); }
+
+  template<typename P>
+  camp::concepts::enable_if<camp::concepts::negate<is_forall_param<P>>>
+  kernel_param_resolve(P&) {}
+
+  template<typename P>
+  camp::concepts::enable_if<is_reducer_param<P>>
+  kernel_param_reset(P& p)
+  {
+    p.val = typename P::value_type(P::op::identity());
+  }
+
+  template<typename P>
+  camp::concepts::enable_if<camp::concepts::negate<is_reducer_param<P>>>
+  kernel_param_reset(P&) {}
+
+  template<typename P>
+  camp::concepts::enable_if<is_reducer_param<P>>
+  kernel_param_fold(P& out, const P& in)
+  {
+    out.val = typename P::op{}(out.val, in.val);
+  }
+
+  template<typename P>
+  camp::concepts::enable_if<camp::concepts::negate<is_reducer_param<P>>>
+  kernel_param_fold(P&, const P&) {}
+  //===========================================================================
+
+
+
+  //===========================================================================
+  //
+  //
+  // Param tuple wide operations.
+  //
+  //
+  template<typename Tuple, camp::idx_t... Seq>
+  void kernel_params_init(Tuple& params, camp::idx_seq<Seq...>)
+  {
+    CAMP_EXPAND(kernel_param_init(camp::get<Seq>(params)));
+  }
+
+  template<typename Tuple, camp::idx_t... Seq>
+  void kernel_params_resolve(Tuple& params, camp::idx_seq<Seq...>)
+  {
+    CAMP_EXPAND(kernel_param_resolve(camp::get<Seq>(params)));
+  }
+
+  template<typename Tuple, camp::idx_t... Seq>
+  void kernel_params_reset(Tuple& params, camp::idx_seq<Seq...>)
+  {
+    CAMP_EXPAND(kernel_param_reset(camp::get<Seq>(params)));
+  }
+
+  template<typename Tuple, camp::idx_t... Seq>
+  void kernel_params_fold(Tuple& out, const Tuple& in, camp::idx_seq<Seq...>)
+  {
+    CAMP_EXPAND(kernel_param_fold(camp::get<Seq>(out), camp::get<Seq>(in)));
+  }
+
+  template<typename Tuple>
+  using kernel_params_seq = camp::make_idx_seq_t<camp::tuple_size<Tuple>::value>;
+
+  template<typename Tuple>
+  void kernel_params_init(Tuple& params)
+  {
+    kernel_params_init(params, kernel_params_seq<Tuple>{});
+  }
+
+  template<typename Tuple>
+  void kernel_params_resolve(Tuple& params)
+  {
+    kernel_params_resolve(params, kernel_params_seq<Tuple>{});
+  }
+
+  /*!
+   * Starts a thread private copy of the params, reducers restart from their
+   * identity so that folding the copy back counts each update once.
+   */
+  template<typename Tuple>
+  void kernel_params_private_init(Tuple& params)
+  {
+    kernel_params_reset(params, kernel_params_seq<Tuple>{});
+  }
+
+  //! Serializes the folds into shared params and the copies made of them.
+  inline std::mutex& kernel_params_mutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  /*!
+   * Folds a thread private copy of the params into its parent. The parent
+   * may be shared by the threads of a parallel region, the threads finish
+   * one at a time.
+   */
+  template<typename Tuple>
+  camp::concepts::enable_if<has_reducer_params<Tuple>>
+  kernel_params_fold(Tuple& parent, const Tuple& priv)
+  {
+    std::lock_guard<std::mutex> lock(kernel_params_mutex());
+    kernel_params_fold(parent, priv, kernel_params_seq<Tuple>{});
+  }
+
+  template<typename Tuple>
+  camp::concepts::enable_if<camp::concepts::negate<has_reducer_params<Tuple>>>
+  kernel_params_fold(Tuple&, const Tuple&) {}
+
+  /*!
+   * Copy of a LoopData whose params other threads may be folding into,
+   * e.g. when TBB tasks start while others finish, taken between folds.
+   */
+  template<typename Data>
+  camp::concepts::enable_if_t<
+      Data,
+      has_reducer_params<typename Data::param_tuple_t>>
+  kernel_params_shared_copy(const Data& data)
+  {
+    std::lock_guard<std::mutex> lock(kernel_params_mutex());
+    return data;
+  }
+
+  template<typename Data>
+  camp::concepts::enable_if_t<
+      Data,
+      camp::concepts::negate<has_reducer_params<typename Data::param_tuple_t>>>
+  kernel_params_shared_copy(const Data& data)
+  {
+    return data;
+  }
+  //===========================================================================
+
+} //  namespace detail
+} //  namespace expt
+} //  namespace RAJA
+
+#endif //  RAJA_KERNEL_PARAM_HPP
@@ -1,6 +1,7 @@
 #ifndef RAJA_PARAMS_BASE
 #define RAJA_PARAMS_BASE
 
+#include <type_traits>
 
 namespace RAJA
 {
@@ -20,6 +21,9 @@ namespace detail
   
   };
 
+  template<typename T>
+  struct is_forall_param : std::is_base_of<ForallParamBase, camp::decay<T>> {};
+
 } // namespace detail
 
 } // namespace expt
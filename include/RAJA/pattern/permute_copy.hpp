@@ -0,0 +1,491 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the permute_copy pattern, which copies
+ *          between views whose layouts order the dimensions differently.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_permute_copy_HPP
+#define RAJA_pattern_permute_copy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/macros.hpp"
+
+#if defined(RAJA_ENABLE_VECTORIZATION)
+#include "RAJA/pattern/tensor.hpp"
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Extents and strides of a permute_copy, with the dimensions reordered so
+ * the last is stride-1 in the source. When the destination is stride-1 in
+ * another dimension, that one is second to last and the copy is a
+ * transpose of those two dimensions. The remaining, outer, dimensions are
+ * ordered by decreasing destination stride.
+ */
+template <camp::idx_t N_DIMS>
+struct PermuteCopyPlan {
+  Index_type size[N_DIMS];
+  Index_type src_stride[N_DIMS];
+  Index_type dst_stride[N_DIMS];
+  //! true when the last two dimensions are transposed
+  bool transpose;
+  //! number of outer dimensions
+  camp::idx_t num_outer;
+
+  //! source and destination offsets of the outer index outer
+  RAJA_INLINE void outer_offsets(Index_type outer,
+                                 Index_type& src_offset,
+                                 Index_type& dst_offset) const
+  {
+    src_offset = 0;
+    dst_offset = 0;
+    for (camp::idx_t d = num_outer - 1; d >= 0; --d) {
+      const Index_type i = outer % size[d];
+      outer /= size[d];
+      src_offset += i * src_stride[d];
+      dst_offset += i * dst_stride[d];
+    }
+  }
+};
+
+//! the dimension with the smallest stride among those with extent above 1
+template <camp::idx_t N_DIMS>
+RAJA_INLINE camp::idx_t permute_copy_unit_dim(Index_type const* size,
+                                              Index_type const* stride)
+{
+  camp::idx_t unit = 0;
+  for (camp::idx_t d = 1; d < N_DIMS; ++d) {
+    if (size[d] > 1 && (size[unit] <= 1 || stride[d] < stride[unit])) {
+      unit = d;
+    }
+  }
+  return unit;
+}
+
+template <typename Layout, camp::idx_t... Dims>
+RAJA_INLINE void permute_copy_layout(Layout const& layout,
+                                     Index_type* size,
+                                     Index_type* stride,
+                                     camp::idx_seq<Dims...>)
+{
+  camp::sink((size[Dims] = layout.template get_dim_size<Dims>())...);
+  camp::sink((stride[Dims] = layout.template get_dim_stride<Dims>())...);
+}
+
+/*!
+ * Destinations of at least this many bytes are written with streaming
+ * stores when the tiles are transposed in registers. They would not stay
+ * in a core's cache anyway, and streaming stores do not read the
+ * destination cache lines before writing them, which otherwise costs a
+ * third of the memory traffic of a transpose.
+ */
+constexpr Index_type permute_copy_streaming_bytes = Index_type(1) << 21;
+
+/*!
+ * Copies one tile of a transpose, rows [b0, b1) of the source and columns
+ * [a0, a1), element by element.
+ */
+template <typename Src, typename Dst, bool USE_REGISTERS>
+struct PermuteCopyTile {
+  static constexpr camp::idx_t s_width = 1;
+
+  RAJA_INLINE static void copy(Src const* src,
+                               Index_type src_row_stride,
+                               Index_type src_col_stride,
+                               Dst* dst,
+                               Index_type dst_row_stride,
+                               Index_type dst_col_stride,
+                               Index_type b0,
+                               Index_type b1,
+                               Index_type a0,
+                               Index_type a1,
+                               bool = false)
+  {
+    for (Index_type a = a0; a < a1; ++a) {
+      for (Index_type b = b0; b < b1; ++b) {
+        dst[a * dst_col_stride + b * dst_row_stride] =
+            src[b * src_row_stride + a * src_col_stride];
+      }
+    }
+  }
+};
+
+#if defined(RAJA_ENABLE_VECTORIZATION)
+
+/*!
+ * Transposes the square block held in rows with Eklundh's algorithm,
+ * log2(width) rounds of pairwise transpose_shuffle operations. The level
+ * is a template parameter so each round compiles to the shuffles of that
+ * level alone.
+ */
+template <typename REGISTER,
+          camp::idx_t LVL,
+          bool DONE = ((camp::idx_t(1) << LVL) >= REGISTER::s_num_elem)>
+struct PermuteCopyTranspose {
+  RAJA_INLINE static void apply(REGISTER* rows)
+  {
+    constexpr camp::idx_t skip = camp::idx_t(1) << LVL;
+    for (camp::idx_t i = 0; i < REGISTER::s_num_elem; ++i) {
+      if ((i & skip) == 0) {
+        const REGISTER x = rows[i];
+        rows[i] = x.transpose_shuffle_left(LVL, rows[i + skip]);
+        rows[i + skip] = x.transpose_shuffle_right(LVL, rows[i + skip]);
+      }
+    }
+    PermuteCopyTranspose<REGISTER, LVL + 1>::apply(rows);
+  }
+};
+
+template <typename REGISTER, camp::idx_t LVL>
+struct PermuteCopyTranspose<REGISTER, LVL, true> {
+  RAJA_INLINE static void apply(REGISTER*) {}
+};
+
+/*!
+ * Copies one tile of a transpose through registers: each square block of
+ * register width rows is loaded, transposed with the register
+ * transpose_shuffle operations and stored as register width columns. The
+ * ragged edges of the tile are copied element by element.
+ *
+ * With streaming, the blocks are stored with streaming stores, starting at
+ * the first column where the destination is aligned to the register.
+ *
+ * Requires unit stride along the columns of the source and the rows of
+ * the destination, and with streaming a destination column stride that is
+ * a multiple of the register width, which the caller checks.
+ */
+template <typename T>
+struct PermuteCopyTile<T, T, true> {
+  using register_type = RAJA::expt::Register<T, RAJA::expt::default_register>;
+  using scalar_tile = PermuteCopyTile<T, T, false>;
+
+  static constexpr camp::idx_t s_width = register_type::s_num_elem;
+
+  RAJA_INLINE static void copy(T const* src,
+                               Index_type src_row_stride,
+                               Index_type src_col_stride,
+                               T* dst,
+                               Index_type dst_row_stride,
+                               Index_type dst_col_stride,
+                               Index_type b0,
+                               Index_type b1,
+                               Index_type a0,
+                               Index_type a1,
+                               bool streaming = false)
+  {
+    Index_type b_begin = b0;
+    if (streaming) {
+      const Index_type misalign = static_cast<Index_type>(
+          reinterpret_cast<std::uintptr_t>(dst + b0) / sizeof(T) % s_width);
+      b_begin = std::min(b0 + (s_width - misalign) % s_width, b1);
+    }
+    const Index_type b_end = b_begin + (b1 - b_begin) / s_width * s_width;
+    const Index_type a_end = a0 + (a1 - a0) / s_width * s_width;
+
+    // a outer, so consecutive blocks store to consecutive destination
+    // cache lines
+    for (Index_type a = a0; a < a_end; a += s_width) {
+      for (Index_type b = b_begin; b < b_end; b += s_width) {
+        register_type rows[s_width];
+        for (camp::idx_t i = 0; i < s_width; ++i) {
+          rows[i].load_packed(src + (b + i) * src_row_stride + a);
+        }
+
+        PermuteCopyTranspose<register_type, 0>::apply(rows);
+
+        if (streaming) {
+          for (camp::idx_t i = 0; i < s_width; ++i) {
+            rows[i].store_packed_streaming(dst + (a + i) * dst_col_stride + b);
+          }
+        } else {
+          for (camp::idx_t i = 0; i < s_width; ++i) {
+            rows[i].store_packed(dst + (a + i) * dst_col_stride + b);
+          }
+        }
+      }
+    }
+    if (streaming) {
+      register_type::streaming_fence();
+    }
+
+    // ragged left and right edges, then bottom edge
+    scalar_tile::copy(src, src_row_stride, src_col_stride,
+                      dst, dst_row_stride, dst_col_stride,
+                      b0, b_begin, a0, a_end);
+    scalar_tile::copy(src, src_row_stride, src_col_stride,
+                      dst, dst_row_stride, dst_col_stride,
+                      b_end, b1, a0, a_end);
+    scalar_tile::copy(src, src_row_stride, src_col_stride,
+                      dst, dst_row_stride, dst_col_stride,
+                      b0, b1, a_end, a1);
+  }
+};
+
+//! lanes of the default register for T, 1 when T has no register
+template <typename T, bool = std::is_floating_point<T>::value>
+struct permute_copy_register_width
+    : std::integral_constant<camp::idx_t, 1> {
+};
+
+template <typename T>
+struct permute_copy_register_width<T, true>
+    : std::integral_constant<
+          camp::idx_t,
+          RAJA::expt::Register<T, RAJA::expt::default_register>::s_num_elem> {
+};
+
+//! registers are used for matching floating point types wider than a lane
+template <typename Src, typename Dst>
+struct permute_copy_use_registers
+    : std::integral_constant<bool,
+                             std::is_same<Src, Dst>::value &&
+                                 (permute_copy_register_width<Dst>::value >
+                                  1)> {
+};
+
+#else
+
+template <typename Src, typename Dst>
+struct permute_copy_use_registers : std::false_type {
+};
+
+#endif
+
+}  // namespace detail
+
+
+/*!
+ * Copy the elements of src into dst, dst(i, j, ...) = src(i, j, ...).
+ *
+ * The two views must have the same number of dimensions and extents, but
+ * may have different layouts, for example two permutations from
+ * RAJA::make_permuted_layout. This converts between array-of-structs and
+ * struct-of-arrays storage, when the struct member is one of the
+ * dimensions, and transposes matrices.
+ *
+ * When both layouts are stride-1 in the same dimension the copy streams
+ * contiguous runs. Otherwise it is a transpose of the dimensions that are
+ * stride-1 in src and in dst, which is cut into tile_size x tile_size
+ * tiles so that both the reads and the writes of a tile stay in cache.
+ * The default of 32 keeps a tile of doubles within the L1 cache and the
+ * pages of a tile within the first level TLB.
+ *
+ * With RAJA_ENABLE_VECTORIZATION, tiles of matching float or double
+ * elements are transposed in registers, a square block of the register
+ * width at a time. Destinations of permute_copy_streaming_bytes or more
+ * are then written with streaming stores, when the destination rows all
+ * have the same alignment to the register width.
+ *
+ * The runs or tiles are distributed with the host execution policy
+ * ExecPol, e.g. RAJA::omp_parallel_for_exec or RAJA::tbb_for_exec.
+ */
+template <typename ExecPol, typename SrcView, typename DstView>
+void permute_copy(SrcView const& src,
+                  DstView const& dst,
+                  camp::idx_t tile_size = 32)
+{
+  using src_layout_type = camp::decay<decltype(src.get_layout())>;
+  using dst_layout_type = camp::decay<decltype(dst.get_layout())>;
+  constexpr camp::idx_t n_dims = src_layout_type::n_dims;
+  static_assert(n_dims == dst_layout_type::n_dims,
+                "RAJA::permute_copy views must have the same dimensions");
+
+  using src_type = typename std::remove_const<
+      typename std::remove_pointer<camp::decay<decltype(src.get_data())>>::
+          type>::type;
+  using dst_type = typename std::remove_pointer<
+      camp::decay<decltype(dst.get_data())>>::type;
+  using tile_type = detail::PermuteCopyTile<
+      src_type,
+      dst_type,
+      detail::permute_copy_use_registers<src_type, dst_type>::value>;
+
+  if (tile_size < 1) {
+    RAJA_ABORT_OR_THROW("RAJA::permute_copy tile_size must be positive");
+  }
+
+  Index_type size[n_dims];
+  Index_type dst_size[n_dims];
+  Index_type src_stride[n_dims];
+  Index_type dst_stride[n_dims];
+  detail::permute_copy_layout(src.get_layout(),
+                              size,
+                              src_stride,
+                              camp::make_idx_seq_t<n_dims>{});
+  detail::permute_copy_layout(dst.get_layout(),
+                              dst_size,
+                              dst_stride,
+                              camp::make_idx_seq_t<n_dims>{});
+  Index_type total = 1;
+  for (camp::idx_t d = 0; d < n_dims; ++d) {
+    if (size[d] != dst_size[d]) {
+      RAJA_ABORT_OR_THROW("RAJA::permute_copy views must have the same extents");
+    }
+    total *= size[d];
+  }
+  if (total == 0) {
+    return;
+  }
+
+  const camp::idx_t a = detail::permute_copy_unit_dim<n_dims>(size, src_stride);
+  const camp::idx_t b = detail::permute_copy_unit_dim<n_dims>(size, dst_stride);
+
+  // outer dimensions, slowest destination stride first
+  camp::idx_t order[n_dims];
+  camp::idx_t num_outer = 0;
+  for (camp::idx_t d = 0; d < n_dims; ++d) {
+    if (d != a && d != b) {
+      order[num_outer++] = d;
+    }
+  }
+  std::sort(order, order + num_outer, [&](camp::idx_t x, camp::idx_t y) {
+    return dst_stride[x] > dst_stride[y];
+  });
+  if (b != a) {
+    order[n_dims - 2] = b;
+  }
+  order[n_dims - 1] = a;
+
+  detail::PermuteCopyPlan<n_dims> plan;
+  for (camp::idx_t d = 0; d < n_dims; ++d) {
+    plan.size[d] = size[order[d]];
+    plan.src_stride[d] = src_stride[order[d]];
+    plan.dst_stride[d] = dst_stride[order[d]];
+  }
+  plan.transpose = b != a;
+  plan.num_outer = num_outer;
+
+  Index_type num_outer_elem = 1;
+  for (camp::idx_t d = 0; d < num_outer; ++d) {
+    num_outer_elem *= plan.size[d];
+  }
+
+  src_type const* src_ptr = src.get_data();
+  dst_type* dst_ptr = dst.get_data();
+  const Index_type tile = static_cast<Index_type>(tile_size);
+  const Index_type a_size = plan.size[n_dims - 1];
+
+  if (!plan.transpose) {
+    // contiguous runs along a, cut into chunks of tile*tile elements so
+    // short outer extents still give every thread work
+    const Index_type chunk = tile * tile;
+    const Index_type num_chunks = (a_size + chunk - 1) / chunk;
+    const Index_type src_a_stride = plan.src_stride[n_dims - 1];
+    const Index_type dst_a_stride = plan.dst_stride[n_dims - 1];
+
+    RAJA::forall<ExecPol>(
+        TypedRangeSegment<Index_type>(0, num_outer_elem * num_chunks),
+        [=](Index_type item) {
+          const Index_type c = item % num_chunks;
+          Index_type src_offset, dst_offset;
+          plan.outer_offsets(item / num_chunks, src_offset, dst_offset);
+
+          const Index_type a0 = c * chunk;
+          const Index_type a1 = std::min(a0 + chunk, a_size);
+          src_type const* s = src_ptr + src_offset;
+          dst_type* d = dst_ptr + dst_offset;
+          if (src_a_stride == 1 && dst_a_stride == 1) {
+            std::copy(s + a0, s + a1, d + a0);
+          } else {
+            for (Index_type i = a0; i < a1; ++i) {
+              d[i * dst_a_stride] = s[i * src_a_stride];
+            }
+          }
+        });
+    return;
+  }
+
+  // transpose of (b, a) in tiles, a varies fastest so consecutive tiles
+  // read consecutive source memory
+  const Index_type b_size = plan.size[n_dims - 2];
+  const Index_type src_row_stride = plan.src_stride[n_dims - 2];
+  const Index_type src_col_stride = plan.src_stride[n_dims - 1];
+  const Index_type dst_row_stride = plan.dst_stride[n_dims - 2];
+  const Index_type dst_col_stride = plan.dst_stride[n_dims - 1];
+  const bool unit_stride = src_col_stride == 1 && dst_row_stride == 1;
+
+  // an extent shorter than the tile, such as the members of a struct,
+  // widens the tiles along the other one to keep the elements of a tile,
+  // so each row is still read or written in runs of whole cache lines
+  const Index_type a_tile = tile * std::max(tile / b_size, Index_type(1));
+  const Index_type b_tile = tile * std::max(tile / a_size, Index_type(1));
+
+  // streaming stores need every destination row to have the same
+  // alignment, and room for a register block from the first aligned b.
+  // The b tiles are then shifted to start where the rows are aligned.
+  const Index_type width = tile_type::s_width;
+  bool streaming = unit_stride && width > 1 &&
+                   total * static_cast<Index_type>(sizeof(dst_type)) >=
+                       detail::permute_copy_streaming_bytes &&
+                   dst_col_stride % width == 0;
+  for (camp::idx_t d = 0; d < num_outer; ++d) {
+    streaming = streaming && plan.dst_stride[d] % width == 0;
+  }
+  const Index_type b_aligned =
+      (width - static_cast<Index_type>(
+                   reinterpret_cast<std::uintptr_t>(dst_ptr) /
+                   sizeof(dst_type) % width)) % width;
+  streaming = streaming && b_size - b_aligned >= width;
+  const Index_type b_shift =
+      streaming ? (b_tile - b_aligned % b_tile) % b_tile : 0;
+
+  const Index_type num_a_tiles = (a_size + a_tile - 1) / a_tile;
+  const Index_type num_b_tiles = (b_size + b_shift + b_tile - 1) / b_tile;
+
+  RAJA::forall<ExecPol>(
+      TypedRangeSegment<Index_type>(0,
+                                    num_outer_elem * num_b_tiles * num_a_tiles),
+      [=](Index_type item) {
+        const Index_type ta = item % num_a_tiles;
+        const Index_type tb = (item / num_a_tiles) % num_b_tiles;
+        Index_type src_offset, dst_offset;
+        plan.outer_offsets(item / num_a_tiles / num_b_tiles,
+                           src_offset,
+                           dst_offset);
+
+        const Index_type a0 = ta * a_tile;
+        const Index_type a1 = std::min(a0 + a_tile, a_size);
+        const Index_type b0 = std::max(tb * b_tile - b_shift, Index_type(0));
+        const Index_type b1 = std::min((tb + 1) * b_tile - b_shift, b_size);
+        if (unit_stride) {
+          tile_type::copy(src_ptr + src_offset, src_row_stride, 1,
+                          dst_ptr + dst_offset, 1, dst_col_stride,
+                          b0, b1, a0, a1, streaming);
+        } else {
+          detail::PermuteCopyTile<src_type, dst_type, false>::copy(
+              src_ptr + src_offset, src_row_stride, src_col_stride,
+              dst_ptr + dst_offset, dst_row_stride, dst_col_stride,
+              b0, b1, a0, a1);
+        }
+      });
+}
+
+}  // namespace RAJA
+
+#endif
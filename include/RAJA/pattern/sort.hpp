@@ -322,6 +322,490 @@ stable_sort_pairs(ExecPolicy&& p,
       comp);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  nth element execution pattern
+*
+*         Moves the item that would be at index nth in sorted order to nth,
+*         with no item before nth comparing after it and no item after nth
+*         comparing before it.
+*
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container
+*range
+* \param[in] nth index of the item to select, nothing is done if it is not
+*in the container
+* \param[in] comp comparison function to apply for nth_element
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+nth_element(ExecPolicy&& p,
+            Res r,
+            Container&& c,
+            RAJA::detail::ContainerDiff<Container> nth,
+            Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  auto begin_it = begin(c);
+  auto end_it   = end(c);
+  auto N = distance(begin_it, end_it);
+
+  if (N > 1 && nth >= 0 && nth < N) {
+    return impl::sort::select(r, p, begin_it, begin_it + nth, end_it, comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+nth_element(ExecPolicy&& p,
+            Container&& c,
+            RAJA::detail::ContainerDiff<Container> nth,
+            Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::nth_element(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      nth,
+      comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partial sort execution pattern
+*
+*         Moves the k items that come first in sorted order to the front of
+*         the range in sorted order, the order of the other items is
+*         unspecified.
+*
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container
+*range
+* \param[in] k number of items to sort, the whole range is sorted if k is
+*at least its size
+* \param[in] comp comparison function to apply for partial_sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+partial_sort(ExecPolicy&& p,
+             Res r,
+             Container&& c,
+             RAJA::detail::ContainerDiff<Container> k,
+             Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  auto begin_it = begin(c);
+  auto end_it   = end(c);
+  auto N = distance(begin_it, end_it);
+
+  if (N > 1 && k >= N) {
+    return impl::sort::unstable(r, p, begin_it, end_it, comp);
+  } else if (N > 1 && k > 0) {
+    // the last of the k items is in place after select
+    impl::sort::select(r, p, begin_it, begin_it + (k-1), end_it, comp);
+    if (k > 2) {
+      return impl::sort::unstable(r, p, begin_it, begin_it + (k-1), comp);
+    }
+    return resources::EventProxy<Res>(r);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+partial_sort(ExecPolicy&& p,
+             Container&& c,
+             RAJA::detail::ContainerDiff<Container> k,
+             Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partial_sort(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      k,
+      comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  top k execution pattern
+*
+*         Moves the k items that come first in sorted order to the front of
+*         the range in unspecified order. Use operators::greater as comp to
+*         get the k largest items.
+*
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container
+*range
+* \param[in] k number of items to select
+* \param[in] comp comparison function to apply for top_k
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+top_k(ExecPolicy&& p,
+      Res r,
+      Container&& c,
+      RAJA::detail::ContainerDiff<Container> k,
+      Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  auto begin_it = begin(c);
+  auto end_it   = end(c);
+  auto N = distance(begin_it, end_it);
+
+  if (N > 1 && k > 0 && k < N) {
+    return impl::sort::select(r, p, begin_it, begin_it + (k-1), end_it, comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+top_k(ExecPolicy&& p,
+      Container&& c,
+      RAJA::detail::ContainerDiff<Container> k,
+      Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::top_k(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      k,
+      comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  nth element pairs execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess Container or range of keys to select from
+* \param[in,out] values RandomAccess Container or range of values to reorder
+* along with keys
+* \param[in] nth index of the key to select, nothing is done if it is not
+*in keys
+* \param[in] comp comparison function to apply to keys for nth_element
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename ValContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>>
+nth_element_pairs(ExecPolicy&& p,
+                  Res r,
+                  KeyContainer&& keys,
+                  ValContainer&& vals,
+                  RAJA::detail::ContainerDiff<KeyContainer> nth,
+                  Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<KeyContainer>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+
+  auto begin_key = begin(keys);
+  auto end_key   = end(keys);
+  auto N = distance(begin_key, end_key);
+
+  if (N > 1 && nth >= 0 && nth < N) {
+    return impl::sort::select_pairs(r, p, begin_key, begin_key + nth, end_key,
+                                    begin(vals), comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<ValContainer>>
+nth_element_pairs(ExecPolicy&& p,
+                  KeyContainer&& keys,
+                  ValContainer&& vals,
+                  RAJA::detail::ContainerDiff<KeyContainer> nth,
+                  Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::nth_element_pairs(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<ValContainer>(vals),
+      nth,
+      comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partial sort pairs execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess Container or range of keys to be sorted
+* \param[in,out] values RandomAccess Container or range of values to reorder
+* along with keys
+* \param[in] k number of keys to sort
+* \param[in] comp comparison function to apply to keys for partial_sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename ValContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>>
+partial_sort_pairs(ExecPolicy&& p,
+                   Res r,
+                   KeyContainer&& keys,
+                   ValContainer&& vals,
+                   RAJA::detail::ContainerDiff<KeyContainer> k,
+                   Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<KeyContainer>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+
+  auto begin_key = begin(keys);
+  auto end_key   = end(keys);
+  auto N = distance(begin_key, end_key);
+
+  if (N > 1 && k >= N) {
+    return impl::sort::unstable_pairs(r, p, begin_key, end_key,
+                                      begin(vals), comp);
+  } else if (N > 1 && k > 0) {
+    // the last of the k keys is in place after select
+    impl::sort::select_pairs(r, p, begin_key, begin_key + (k-1), end_key,
+                             begin(vals), comp);
+    if (k > 2) {
+      return impl::sort::unstable_pairs(r, p, begin_key, begin_key + (k-1),
+                                        begin(vals), comp);
+    }
+    return resources::EventProxy<Res>(r);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<ValContainer>>
+partial_sort_pairs(ExecPolicy&& p,
+                   KeyContainer&& keys,
+                   ValContainer&& vals,
+                   RAJA::detail::ContainerDiff<KeyContainer> k,
+                   Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partial_sort_pairs(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<ValContainer>(vals),
+      k,
+      comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  top k pairs execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess Container or range of keys to select from
+* \param[in,out] values RandomAccess Container or range of values to reorder
+* along with keys
+* \param[in] k number of keys to select
+* \param[in] comp comparison function to apply to keys for top_k
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename ValContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>>
+top_k_pairs(ExecPolicy&& p,
+            Res r,
+            KeyContainer&& keys,
+            ValContainer&& vals,
+            RAJA::detail::ContainerDiff<KeyContainer> k,
+            Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<KeyContainer>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+
+  auto begin_key = begin(keys);
+  auto end_key   = end(keys);
+  auto N = distance(begin_key, end_key);
+
+  if (N > 1 && k > 0 && k < N) {
+    return impl::sort::select_pairs(r, p, begin_key, begin_key + (k-1), end_key,
+                                    begin(vals), comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<ValContainer>>
+top_k_pairs(ExecPolicy&& p,
+            KeyContainer&& keys,
+            ValContainer&& vals,
+            RAJA::detail::ContainerDiff<KeyContainer> k,
+            Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::top_k_pairs(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<ValContainer>(vals),
+      k,
+      comp);
+}
+
 }  // end inline namespace policy_by_value_interface
 
 // =============================================================================
@@ -434,6 +918,168 @@ stable_sort_pairs(Res r, Args &&... args)
       ExecPolicy(), r, std::forward<Args>(args)...);
 }
 
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * nth_element
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+nth_element(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::nth_element<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+nth_element(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::nth_element(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * partial_sort
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+partial_sort(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partial_sort<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+partial_sort(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::partial_sort(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * top_k
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+top_k(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::top_k<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+top_k(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::top_k(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * nth_element_pairs
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+nth_element_pairs(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::nth_element_pairs<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+nth_element_pairs(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::nth_element_pairs(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * partial_sort_pairs
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+partial_sort_pairs(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partial_sort_pairs<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+partial_sort_pairs(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::partial_sort_pairs(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * top_k_pairs
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+top_k_pairs(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::top_k_pairs<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+top_k_pairs(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::top_k_pairs(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,29 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file including sparse matrix formats and kernels.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_sparse_HPP
+#define RAJA_pattern_sparse_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/pattern/sparse/CSRMatrix.hpp"
+
+#if defined(RAJA_ENABLE_VECTORIZATION)
+#include "RAJA/pattern/sparse/SellMatrix.hpp"
+#endif
+
+#endif
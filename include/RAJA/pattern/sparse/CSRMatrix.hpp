@@ -0,0 +1,224 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the CSR sparse matrix and its kernels.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_sparse_CSRMatrix_HPP
+#define RAJA_pattern_sparse_CSRMatrix_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace sparse
+{
+
+/*!
+ * Host sparse matrix in compressed sparse row format.
+ *
+ * The nonzeros of row i are at positions row_offsets()[i] to
+ * row_offsets()[i+1] of col_indices() and values(), with increasing
+ * column indices.
+ */
+template <typename T, typename IndexType = RAJA::Index_type>
+class CSRMatrix
+{
+public:
+  using value_type = T;
+  using index_type = IndexType;
+
+  CSRMatrix() : m_row_offsets(1, IndexType(0)) {}
+
+  /*!
+   * Take ownership of CSR arrays, row_offsets has num_rows+1 entries
+   * and column indices must increase within each row.
+   */
+  CSRMatrix(IndexType num_rows,
+            IndexType num_cols,
+            std::vector<IndexType> row_offsets,
+            std::vector<IndexType> col_indices,
+            std::vector<T> values)
+      : m_num_rows(num_rows),
+        m_num_cols(num_cols),
+        m_row_offsets(std::move(row_offsets)),
+        m_col_indices(std::move(col_indices)),
+        m_values(std::move(values))
+  {
+    if (m_row_offsets.size() != static_cast<size_t>(num_rows) + 1 ||
+        m_col_indices.size() != m_values.size() ||
+        static_cast<size_t>(m_row_offsets.back()) != m_values.size()) {
+      RAJA_ABORT_OR_THROW("CSRMatrix arrays have inconsistent sizes");
+    }
+  }
+
+  /*!
+   * Build from coordinate (row, column, value) triplets in any order,
+   * duplicate entries are summed.
+   */
+  static CSRMatrix from_coo(IndexType num_rows,
+                            IndexType num_cols,
+                            std::vector<IndexType> const& rows,
+                            std::vector<IndexType> const& cols,
+                            std::vector<T> const& vals)
+  {
+    if (rows.size() != cols.size() || rows.size() != vals.size()) {
+      RAJA_ABORT_OR_THROW("CSRMatrix::from_coo arrays have different sizes");
+    }
+
+    std::vector<size_t> order(vals.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+      return rows[a] < rows[b] || (rows[a] == rows[b] && cols[a] < cols[b]);
+    });
+
+    std::vector<IndexType> row_offsets(static_cast<size_t>(num_rows) + 1,
+                                       IndexType(0));
+    std::vector<IndexType> col_indices;
+    std::vector<T> values;
+    col_indices.reserve(vals.size());
+    values.reserve(vals.size());
+
+    for (size_t n = 0; n < order.size(); ++n) {
+      const size_t e = order[n];
+      if (rows[e] < 0 || rows[e] >= num_rows || cols[e] < 0 ||
+          cols[e] >= num_cols) {
+        RAJA_ABORT_OR_THROW("CSRMatrix::from_coo entry out of range");
+      }
+      if (n > 0 && rows[e] == rows[order[n - 1]] &&
+          cols[e] == cols[order[n - 1]]) {
+        values.back() += vals[e];
+      } else {
+        col_indices.push_back(cols[e]);
+        values.push_back(vals[e]);
+        ++row_offsets[rows[e] + 1];
+      }
+    }
+    std::partial_sum(row_offsets.begin(), row_offsets.end(),
+                     row_offsets.begin());
+
+    return CSRMatrix(num_rows,
+                     num_cols,
+                     std::move(row_offsets),
+                     std::move(col_indices),
+                     std::move(values));
+  }
+
+  IndexType num_rows() const { return m_num_rows; }
+  IndexType num_cols() const { return m_num_cols; }
+  IndexType num_nonzeros() const
+  {
+    return static_cast<IndexType>(m_values.size());
+  }
+
+  IndexType const* row_offsets() const { return m_row_offsets.data(); }
+  IndexType const* col_indices() const { return m_col_indices.data(); }
+  T const* values() const { return m_values.data(); }
+  T* values() { return m_values.data(); }
+
+  //! positions of the nonzeros of a row in col_indices() and values()
+  TypedRangeSegment<IndexType> row_range(IndexType row) const
+  {
+    return TypedRangeSegment<IndexType>(m_row_offsets[row],
+                                        m_row_offsets[row + 1]);
+  }
+
+  IndexType row_length(IndexType row) const
+  {
+    return m_row_offsets[row + 1] - m_row_offsets[row];
+  }
+
+private:
+  IndexType m_num_rows = 0;
+  IndexType m_num_cols = 0;
+  std::vector<IndexType> m_row_offsets;
+  std::vector<IndexType> m_col_indices;
+  std::vector<T> m_values;
+};
+
+
+/*!
+ * Sparse matrix vector multiply, y = alpha*A*x + beta*y.
+ *
+ * Rows are distributed with ExecPol. When beta is zero y is not read.
+ */
+template <typename ExecPol, typename T, typename IndexType>
+void spmv(CSRMatrix<T, IndexType> const& A,
+          T const* x,
+          T* y,
+          T alpha = T(1),
+          T beta = T(0))
+{
+  IndexType const* row_offsets = A.row_offsets();
+  IndexType const* col_indices = A.col_indices();
+  T const* values = A.values();
+
+  RAJA::forall<ExecPol>(
+      TypedRangeSegment<IndexType>(0, A.num_rows()), [=](IndexType i) {
+        T sum(0);
+        for (IndexType k = row_offsets[i]; k < row_offsets[i + 1]; ++k) {
+          sum += values[k] * x[col_indices[k]];
+        }
+        y[i] = (beta == T(0)) ? alpha * sum : alpha * sum + beta * y[i];
+      });
+}
+
+/*!
+ * Sparse matrix times dense matrix, Y = alpha*A*X + beta*Y.
+ *
+ * X is num_cols x num_vectors and Y is num_rows x num_vectors, both row
+ * major. Rows are distributed with ExecPol. When beta is zero Y is not read.
+ */
+template <typename ExecPol, typename T, typename IndexType>
+void spmm(CSRMatrix<T, IndexType> const& A,
+          T const* X,
+          IndexType num_vectors,
+          T* Y,
+          T alpha = T(1),
+          T beta = T(0))
+{
+  IndexType const* row_offsets = A.row_offsets();
+  IndexType const* col_indices = A.col_indices();
+  T const* values = A.values();
+
+  RAJA::forall<ExecPol>(
+      TypedRangeSegment<IndexType>(0, A.num_rows()), [=](IndexType i) {
+        T* y = Y + i * num_vectors;
+        for (IndexType c = 0; c < num_vectors; ++c) {
+          y[c] = (beta == T(0)) ? T(0) : beta * y[c];
+        }
+        for (IndexType k = row_offsets[i]; k < row_offsets[i + 1]; ++k) {
+          const T a = alpha * values[k];
+          T const* x = X + col_indices[k] * num_vectors;
+          for (IndexType c = 0; c < num_vectors; ++c) {
+            y[c] += a * x[c];
+          }
+        }
+      });
+}
+
+}  // namespace sparse
+}  // namespace RAJA
+
+#endif
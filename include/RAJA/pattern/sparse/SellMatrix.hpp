@@ -0,0 +1,358 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the SELL-C-sigma sparse matrix and its
+ *          vectorized kernels.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_sparse_SellMatrix_HPP
+#define RAJA_pattern_sparse_SellMatrix_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/sparse/CSRMatrix.hpp"
+#include "RAJA/pattern/tensor/VectorRegister.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace sparse
+{
+
+/*!
+ * Host sparse matrix in SELL-C-sigma (sliced ELLPACK) format.
+ *
+ * Within each window of sigma consecutive rows, rows are sorted by
+ * decreasing length. The sorted rows are grouped into slices of C rows, and
+ * each slice is stored column major and padded to its longest row, so the
+ * k-th nonzeros of the C rows of a slice are contiguous. The kernels load
+ * them into a VectorRegister of C lanes and vectorize across rows, with a
+ * gather of x through the column indices.
+ *
+ * Column and row indices are stored with the integer element type of the
+ * register, so gathers and scatters use them directly. Padding entries have
+ * value 0 and column 0.
+ *
+ * sigma = 1 keeps the row order, larger windows reduce padding at the cost
+ * of locality in y. sigma is rounded up to a multiple of C.
+ */
+template <typename T,
+          typename REGISTER_POLICY = RAJA::expt::default_register,
+          camp::idx_t C = RAJA::expt::Register<T, REGISTER_POLICY>::s_num_elem>
+class SellMatrix
+{
+public:
+  using value_type = T;
+  using vector_type = RAJA::expt::VectorRegister<T, REGISTER_POLICY, C>;
+  using index_vector_type = typename vector_type::int_vector_type;
+  using index_type = typename vector_type::int_element_type;
+
+  static constexpr camp::idx_t s_slice_height = C;
+
+  SellMatrix() : m_slice_offsets(1, index_type(0)) {}
+
+  template <typename IndexType>
+  SellMatrix(CSRMatrix<T, IndexType> const& csr,
+             typename CSRMatrix<T, IndexType>::index_type sigma)
+      : m_num_rows(static_cast<index_type>(csr.num_rows())),
+        m_num_cols(static_cast<index_type>(csr.num_cols()))
+  {
+    if (static_cast<long long>(csr.num_rows()) + C >
+            static_cast<long long>(std::numeric_limits<index_type>::max()) ||
+        static_cast<long long>(csr.num_cols()) >
+            static_cast<long long>(std::numeric_limits<index_type>::max())) {
+      RAJA_ABORT_OR_THROW(
+          "SellMatrix dimensions exceed the register index type");
+    }
+
+    const IndexType num_rows = csr.num_rows();
+    const IndexType height = static_cast<IndexType>(C);
+    const IndexType num_slices = (num_rows + height - 1) / height;
+    const IndexType window =
+        sigma <= 1 ? 1 : (sigma + height - 1) / height * height;
+
+    // sort rows by decreasing length within each window
+    std::vector<IndexType> order(num_rows);
+    std::iota(order.begin(), order.end(), IndexType(0));
+    if (window > 1) {
+      for (IndexType w = 0; w < num_rows; w += window) {
+        const IndexType w_end = std::min(w + window, num_rows);
+        std::stable_sort(order.begin() + w,
+                         order.begin() + w_end,
+                         [&](IndexType a, IndexType b) {
+                           return csr.row_length(a) > csr.row_length(b);
+                         });
+      }
+    }
+
+    m_row_perm.assign(static_cast<size_t>(num_slices) * C, index_type(0));
+    m_row_lengths.assign(num_rows, index_type(0));
+    m_slice_offsets.assign(static_cast<size_t>(num_slices) + 1,
+                           index_type(0));
+    for (IndexType s = 0; s < num_slices; ++s) {
+      IndexType width = 0;
+      for (IndexType r = s * height; r < std::min((s + 1) * height, num_rows);
+           ++r) {
+        m_row_perm[r] = static_cast<index_type>(order[r]);
+        m_row_lengths[r] = static_cast<index_type>(csr.row_length(order[r]));
+        width = std::max(width, csr.row_length(order[r]));
+      }
+      if (static_cast<long long>(m_slice_offsets[s]) + width * height >
+          static_cast<long long>(std::numeric_limits<index_type>::max())) {
+        RAJA_ABORT_OR_THROW(
+            "SellMatrix storage exceeds the register index type");
+      }
+      m_slice_offsets[s + 1] =
+          m_slice_offsets[s] + static_cast<index_type>(width * height);
+    }
+
+    m_col_indices.assign(m_slice_offsets.back(), index_type(0));
+    m_values.assign(m_slice_offsets.back(), T(0));
+    for (IndexType s = 0; s < num_slices; ++s) {
+      for (IndexType r = s * height; r < std::min((s + 1) * height, num_rows);
+           ++r) {
+        IndexType j = 0;
+        for (IndexType k : csr.row_range(order[r])) {
+          const size_t pos = m_slice_offsets[s] + j * height + (r - s * height);
+          m_col_indices[pos] = static_cast<index_type>(csr.col_indices()[k]);
+          m_values[pos] = csr.values()[k];
+          ++j;
+        }
+      }
+    }
+    m_num_nonzeros = static_cast<index_type>(csr.num_nonzeros());
+  }
+
+  //! convert back to CSR, dropping padding
+  template <typename IndexType = RAJA::Index_type>
+  CSRMatrix<T, IndexType> to_csr() const
+  {
+    std::vector<IndexType> row_offsets(static_cast<size_t>(m_num_rows) + 1,
+                                       IndexType(0));
+    for (index_type r = 0; r < m_num_rows; ++r) {
+      row_offsets[m_row_perm[r] + 1] = static_cast<IndexType>(m_row_lengths[r]);
+    }
+    std::partial_sum(row_offsets.begin(), row_offsets.end(),
+                     row_offsets.begin());
+
+    std::vector<IndexType> col_indices(m_num_nonzeros);
+    std::vector<T> values(m_num_nonzeros);
+    for (index_type r = 0; r < m_num_rows; ++r) {
+      const index_type s = r / C;
+      IndexType dst = row_offsets[m_row_perm[r]];
+      for (index_type j = 0; j < m_row_lengths[r]; ++j, ++dst) {
+        const size_t pos = m_slice_offsets[s] + j * C + (r - s * C);
+        col_indices[dst] = static_cast<IndexType>(m_col_indices[pos]);
+        values[dst] = m_values[pos];
+      }
+    }
+
+    return CSRMatrix<T, IndexType>(static_cast<IndexType>(m_num_rows),
+                                   static_cast<IndexType>(m_num_cols),
+                                   std::move(row_offsets),
+                                   std::move(col_indices),
+                                   std::move(values));
+  }
+
+  index_type num_rows() const { return m_num_rows; }
+  index_type num_cols() const { return m_num_cols; }
+  index_type num_nonzeros() const { return m_num_nonzeros; }
+  index_type num_slices() const
+  {
+    return static_cast<index_type>(m_slice_offsets.size() - 1);
+  }
+  index_type slice_width(index_type s) const
+  {
+    return (m_slice_offsets[s + 1] - m_slice_offsets[s]) / C;
+  }
+
+  //! stored entries, including padding
+  index_type num_stored() const { return m_slice_offsets.back(); }
+
+  index_type const* slice_offsets() const { return m_slice_offsets.data(); }
+  index_type const* col_indices() const { return m_col_indices.data(); }
+  index_type const* row_perm() const { return m_row_perm.data(); }
+  T const* values() const { return m_values.data(); }
+
+private:
+  index_type m_num_rows = 0;
+  index_type m_num_cols = 0;
+  index_type m_num_nonzeros = 0;
+  std::vector<index_type> m_slice_offsets;
+  std::vector<index_type> m_col_indices;
+  std::vector<index_type> m_row_perm;
+  std::vector<index_type> m_row_lengths;
+  std::vector<T> m_values;
+};
+
+
+/*!
+ * Sparse matrix vector multiply, y = alpha*A*x + beta*y.
+ *
+ * Slices are distributed with ExecPol, the rows of a slice are computed
+ * together in one VectorRegister. When beta is zero y is not read.
+ */
+template <typename ExecPol,
+          typename T,
+          typename REGISTER_POLICY,
+          camp::idx_t C>
+void spmv(SellMatrix<T, REGISTER_POLICY, C> const& A,
+          T const* x,
+          T* y,
+          T alpha = T(1),
+          T beta = T(0))
+{
+  using matrix_t = SellMatrix<T, REGISTER_POLICY, C>;
+  using vector_t = typename matrix_t::vector_type;
+  using index_vector_t = typename matrix_t::index_vector_type;
+  using index_t = typename matrix_t::index_type;
+
+  index_t const* slice_offsets = A.slice_offsets();
+  index_t const* col_indices = A.col_indices();
+  index_t const* row_perm = A.row_perm();
+  T const* values = A.values();
+  const index_t num_rows = A.num_rows();
+
+  RAJA::forall<ExecPol>(
+      TypedRangeSegment<index_t>(0, A.num_slices()), [=](index_t s) {
+        vector_t acc(T(0));
+        for (index_t k = slice_offsets[s]; k < slice_offsets[s + 1]; k += C) {
+          index_vector_t cols;
+          cols.load_packed(col_indices + k);
+          vector_t xv;
+          xv.gather(x, cols);
+          vector_t a;
+          a.load_packed(values + k);
+          acc = a.multiply_add(xv, acc);
+        }
+        acc = acc.multiply(vector_t(alpha));
+
+        index_vector_t rows;
+        rows.load_packed(row_perm + s * C);
+        const index_t num_lanes =
+            num_rows - s * C < C ? num_rows - s * C : index_t(C);
+        if (num_lanes == C) {
+          if (beta != T(0)) {
+            vector_t yv;
+            yv.gather(y, rows);
+            acc = yv.multiply_add(vector_t(beta), acc);
+          }
+          acc.scatter(y, rows);
+        } else {
+          if (beta != T(0)) {
+            vector_t yv;
+            yv.gather_n(y, rows, num_lanes);
+            acc = yv.multiply_add(vector_t(beta), acc);
+          }
+          acc.scatter_n(y, rows, num_lanes);
+        }
+      });
+}
+
+/*!
+ * Sparse matrix times dense matrix, Y = alpha*A*X + beta*Y.
+ *
+ * X is num_cols x num_vectors and Y is num_rows x num_vectors, both row
+ * major. Slices are distributed with ExecPol. When beta is zero Y is not
+ * read. num_rows*num_vectors and num_cols*num_vectors must fit in the
+ * register index type, otherwise spmm aborts or throws.
+ */
+template <typename ExecPol,
+          typename T,
+          typename REGISTER_POLICY,
+          camp::idx_t C,
+          typename IndexType>
+void spmm(SellMatrix<T, REGISTER_POLICY, C> const& A,
+          T const* X,
+          IndexType num_vectors,
+          T* Y,
+          T alpha = T(1),
+          T beta = T(0))
+{
+  using matrix_t = SellMatrix<T, REGISTER_POLICY, C>;
+  using vector_t = typename matrix_t::vector_type;
+  using index_vector_t = typename matrix_t::index_vector_type;
+  using index_t = typename matrix_t::index_type;
+
+  index_t const* slice_offsets = A.slice_offsets();
+  index_t const* col_indices = A.col_indices();
+  index_t const* row_perm = A.row_perm();
+  T const* values = A.values();
+  const index_t num_rows = A.num_rows();
+
+  // rows and columns are scaled by num_vectors in the index type
+  const long long max_index =
+      static_cast<long long>(std::numeric_limits<index_t>::max());
+  if (static_cast<long long>(num_vectors) > max_index ||
+      static_cast<long long>(num_rows) * num_vectors > max_index ||
+      static_cast<long long>(A.num_cols()) * num_vectors > max_index) {
+    RAJA_ABORT_OR_THROW("spmm num_vectors exceeds the register index type");
+  }
+  const index_t nv = static_cast<index_t>(num_vectors);
+
+  RAJA::forall<ExecPol>(
+      TypedRangeSegment<index_t>(0, A.num_slices()), [=](index_t s) {
+        index_vector_t rows;
+        rows.load_packed(row_perm + s * C);
+        rows = rows.multiply(index_vector_t(nv));
+        const index_t num_lanes =
+            num_rows - s * C < C ? num_rows - s * C : index_t(C);
+
+        for (index_t v = 0; v < nv; ++v) {
+          vector_t acc(T(0));
+          for (index_t k = slice_offsets[s]; k < slice_offsets[s + 1];
+               k += C) {
+            index_vector_t cols;
+            cols.load_packed(col_indices + k);
+            vector_t xv;
+            xv.gather(X + v, cols.multiply(index_vector_t(nv)));
+            vector_t a;
+            a.load_packed(values + k);
+            acc = a.multiply_add(xv, acc);
+          }
+          acc = acc.multiply(vector_t(alpha));
+
+          if (num_lanes == C) {
+            if (beta != T(0)) {
+              vector_t yv;
+              yv.gather(Y + v, rows);
+              acc = yv.multiply_add(vector_t(beta), acc);
+            }
+            acc.scatter(Y + v, rows);
+          } else {
+            if (beta != T(0)) {
+              vector_t yv;
+              yv.gather_n(Y + v, rows, num_lanes);
+              acc = yv.multiply_add(vector_t(beta), acc);
+            }
+            acc.scatter_n(Y + v, rows, num_lanes);
+          }
+        }
+      });
+}
+
+}  // namespace sparse
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,299 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the temporally blocked stencil pattern.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_stencil_HPP
+#define RAJA_pattern_stencil_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ * Temporal blocking parameters of RAJA::expt::stencil.
+ *
+ * The interior is cut into tiles of tile_width along every dimension but
+ * the last, which is cut into inner_tile_width, and each tile advances time_block steps while its data is in cache.
+ * time_block is reduced when a tile is narrower than 2*time_block*radius.
+ */
+struct StencilBlocking {
+  //! largest offset in any dimension the stencil body reads
+  camp::idx_t radius = 1;
+  //! time steps advanced per pass over the grid
+  camp::idx_t time_block = 8;
+  //! tile extent along every dimension but the last
+  camp::idx_t tile_width = 32;
+  //! tile extent along the last, stride-1, dimension, wider so that rows
+  //! are long enough to vectorize and prefetch
+  camp::idx_t inner_tile_width = 1024;
+};
+
+namespace detail
+{
+
+template <camp::idx_t N_DIMS>
+struct StencilSweep;
+
+template <>
+struct StencilSweep<1> {
+  template <typename View, typename Idx, typename Body>
+  RAJA_INLINE static void apply(View const& in,
+                                View const& out,
+                                Idx const* lo,
+                                Idx const* hi,
+                                Body const& body)
+  {
+    RAJA_SIMD
+    for (Idx i = lo[0]; i < hi[0]; ++i) {
+      body(in, out, i);
+    }
+  }
+};
+
+template <>
+struct StencilSweep<2> {
+  template <typename View, typename Idx, typename Body>
+  RAJA_INLINE static void apply(View const& in,
+                                View const& out,
+                                Idx const* lo,
+                                Idx const* hi,
+                                Body const& body)
+  {
+    for (Idx i = lo[0]; i < hi[0]; ++i) {
+      RAJA_SIMD
+      for (Idx j = lo[1]; j < hi[1]; ++j) {
+        body(in, out, i, j);
+      }
+    }
+  }
+};
+
+template <>
+struct StencilSweep<3> {
+  template <typename View, typename Idx, typename Body>
+  RAJA_INLINE static void apply(View const& in,
+                                View const& out,
+                                Idx const* lo,
+                                Idx const* hi,
+                                Body const& body)
+  {
+    for (Idx i = lo[0]; i < hi[0]; ++i) {
+      for (Idx j = lo[1]; j < hi[1]; ++j) {
+        RAJA_SIMD
+        for (Idx k = lo[2]; k < hi[2]; ++k) {
+          body(in, out, i, j, k);
+        }
+      }
+    }
+  }
+};
+
+/*!
+ * Range [s_lo, s_hi) of one dimension at step s of a time block, for tile
+ * t of the interior [lo, hi), or for the gap around the boundary between
+ * tiles t and t+1. Tiles shrink by r per step on the sides facing other
+ * tiles, and gaps grow by r per step into the space left.
+ */
+template <typename Idx>
+RAJA_INLINE void stencil_range(bool gap,
+                               Idx t,
+                               Idx s,
+                               Idx lo,
+                               Idx hi,
+                               Idx width,
+                               Idx num_tiles,
+                               Idx r,
+                               Idx& s_lo,
+                               Idx& s_hi)
+{
+  const Idx skew = (s - 1) * r;
+  if (gap) {
+    const Idx boundary = lo + (t + 1) * width;
+    s_lo = std::max(boundary - skew, lo);
+    s_hi = std::min(boundary + skew, hi);
+  } else {
+    const Idx t_lo = lo + t * width;
+    const Idx t_hi = std::min(t_lo + width, hi);
+    s_lo = t > 0 ? t_lo + skew : t_lo;
+    s_hi = t < num_tiles - 1 ? t_hi - skew : t_hi;
+  }
+}
+
+template <typename Layout, camp::idx_t... Dims>
+RAJA_INLINE void stencil_interior(Layout const& layout,
+                                  camp::idx_t radius,
+                                  typename Layout::IndexLinear* begin,
+                                  typename Layout::IndexLinear* end,
+                                  camp::idx_seq<Dims...>)
+{
+  camp::sink((begin[Dims] = layout.template get_dim_begin<Dims>() + radius)...);
+  camp::sink((end[Dims] = layout.template get_dim_begin<Dims>() +
+                          layout.template get_dim_size<Dims>() - radius)...);
+}
+
+}  // namespace detail
+
+
+/*!
+ * Advance a stencil num_steps time steps with temporal blocking.
+ *
+ * a and b are views with the same OffsetLayout, of 1 to 3 dimensions,
+ * including a halo of blocking.radius points on every side. Each step calls
+ *
+ *   body(in, out, i)        (1D)
+ *   body(in, out, i, j)     (2D)
+ *   body(in, out, i, j, k)  (3D)
+ *
+ * for every interior point, which must write out(i, ...) from values of in
+ * within radius of the point. Steps alternate between the two views, the
+ * first step reads a. The halo is never written so it must hold the
+ * boundary values in both views. Returns the view holding the final state,
+ * a when num_steps is even and b otherwise.
+ *
+ * Tiles are trapezoids in time and every dimension (split tiling): every
+ * tile first advances time_block steps over a box that shrinks by radius
+ * per step on the sides facing other tiles, then the regions left around
+ * the tile boundaries, inverted trapezoids in some of the dimensions, are
+ * filled in, 2^n_dims phases in all. Each region only depends on the
+ * phases before it, so the tiles of a phase run in parallel with ExecPol,
+ * and each reuses its box from cache for time_block steps instead of
+ * streaming the grid every step. Results are identical to running the
+ * steps one after another. The loop over the last dimension is marked
+ * RAJA_SIMD, the points of a row are independent since in and out are
+ * different views.
+ */
+template <typename ExecPol, typename View, typename Body>
+View stencil(View a,
+             View b,
+             camp::idx_t num_steps,
+             StencilBlocking const& blocking,
+             Body const& body)
+{
+  using layout_type = typename View::layout_type;
+  using Idx = typename layout_type::IndexLinear;
+  constexpr camp::idx_t n_dims = layout_type::n_dims;
+  static_assert(n_dims >= 1 && n_dims <= 3,
+                "RAJA::expt::stencil supports 1 to 3 dimensional views");
+  using sweep_t = detail::StencilSweep<n_dims>;
+
+  if (blocking.radius < 1 || blocking.tile_width < 1 ||
+      blocking.inner_tile_width < 1 || blocking.time_block < 1) {
+    RAJA_ABORT_OR_THROW("RAJA::expt::stencil invalid blocking parameters");
+  }
+
+  Idx begin[n_dims];
+  Idx end[n_dims];
+  detail::stencil_interior(a.get_layout(),
+                           blocking.radius,
+                           begin,
+                           end,
+                           camp::make_idx_seq_t<n_dims>{});
+  for (camp::idx_t d = 0; d < n_dims; ++d) {
+    if (end[d] <= begin[d]) {
+      return num_steps % 2 == 0 ? a : b;
+    }
+  }
+
+  const Idx r = static_cast<Idx>(blocking.radius);
+  Idx width[n_dims];
+  Idx num_tiles[n_dims];
+  for (camp::idx_t d = 0; d < n_dims; ++d) {
+    width[d] = static_cast<Idx>(d == n_dims - 1 ? blocking.inner_tile_width
+                                                : blocking.tile_width);
+    num_tiles[d] = (end[d] - begin[d] + width[d] - 1) / width[d];
+  }
+
+  // gaps must not overlap: width >= 2*time_block*radius
+  const camp::idx_t min_width =
+      n_dims > 1 ? std::min(blocking.tile_width, blocking.inner_tile_width)
+                 : blocking.inner_tile_width;
+  const camp::idx_t max_block =
+      std::max<camp::idx_t>(1, min_width / (2 * blocking.radius));
+  const camp::idx_t time_block = std::min(blocking.time_block, max_block);
+
+  View views[2] = {a, b};
+
+  for (camp::idx_t step = 0; step < num_steps; step += time_block) {
+    const Idx nsteps =
+        static_cast<Idx>(std::min(time_block, num_steps - step));
+    const View v0 = views[step % 2];
+    const View v1 = views[(step + 1) % 2];
+
+    // phase bit d set means the gaps around the tile boundaries of
+    // dimension d, any region only reads the phases with a subset of its
+    // bits and only overwrites values the phases with a superset read
+    for (camp::idx_t phase = 0; phase < (camp::idx_t(1) << n_dims);
+         ++phase) {
+      Idx count[n_dims];
+      Idx num_items = 1;
+      for (camp::idx_t d = 0; d < n_dims; ++d) {
+        count[d] = (phase >> d) & 1 ? num_tiles[d] - 1 : num_tiles[d];
+        num_items *= count[d];
+      }
+      if (num_items == 0 || (phase != 0 && nsteps < 2)) {
+        continue;
+      }
+
+      RAJA::forall<ExecPol>(
+          TypedRangeSegment<Idx>(0, num_items), [=](Idx item) {
+            Idx t[n_dims];
+            for (camp::idx_t d = n_dims; d-- > 0;) {
+              t[d] = item % count[d];
+              item /= count[d];
+            }
+            for (Idx s = phase == 0 ? 1 : 2; s <= nsteps; ++s) {
+              Idx s_lo[n_dims];
+              Idx s_hi[n_dims];
+              for (camp::idx_t d = 0; d < n_dims; ++d) {
+                detail::stencil_range<Idx>((phase >> d) & 1,
+                                           t[d],
+                                           s,
+                                           begin[d],
+                                           end[d],
+                                           width[d],
+                                           num_tiles[d],
+                                           r,
+                                           s_lo[d],
+                                           s_hi[d]);
+              }
+              sweep_t::apply(s % 2 == 1 ? v0 : v1,
+                             s % 2 == 1 ? v1 : v0,
+                             s_lo,
+                             s_hi,
+                             body);
+            }
+          });
+    }
+  }
+
+  return views[num_steps % 2];
+}
+
+}  // namespace expt
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,293 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining lane masks for SIMD/SIMT registers.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_TensorMask_HPP
+#define RAJA_pattern_tensor_TensorMask_HPP
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "camp/camp.hpp"
+
+#include <cstdint>
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * A mask with one bit per lane of a register or tensor register.
+   *
+   * Masks are returned by the element-wise comparisons (cmp_lt, cmp_eq, ...)
+   * and consumed by blend, select and the masked stores.  Lane i is bit
+   * i%64 of word i/64, so the lanes of register r of a tensor register are
+   * a contiguous run of bits within one word.
+   */
+  template<camp::idx_t NUM_LANES>
+  class TensorMask
+  {
+    public:
+      using self_type = TensorMask<NUM_LANES>;
+      using word_type = uint64_t;
+
+      static constexpr camp::idx_t s_num_lanes = NUM_LANES;
+      static constexpr camp::idx_t s_word_bits = 64;
+      static constexpr camp::idx_t s_num_words = (NUM_LANES + s_word_bits - 1) / s_word_bits;
+
+    private:
+      word_type m_words[s_num_words];
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      constexpr
+      word_type s_low_bits(camp::idx_t width) {
+        return width >= s_word_bits ? ~word_type(0) : (word_type(1) << width) - 1;
+      }
+
+      // bits of word w that correspond to a lane
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      constexpr
+      word_type s_valid_bits(camp::idx_t w) {
+        return s_low_bits(s_num_lanes - w*s_word_bits);
+      }
+
+    public:
+
+      /*!
+       * @brief Default constructor, all lanes cleared
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      TensorMask() {
+        for(camp::idx_t w = 0;w < s_num_words;++ w){
+          m_words[w] = 0;
+        }
+      }
+
+      /*!
+       * @brief Sets all lanes to value
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      explicit TensorMask(bool value) {
+        for(camp::idx_t w = 0;w < s_num_words;++ w){
+          m_words[w] = value ? s_valid_bits(w) : 0;
+        }
+      }
+
+      /*!
+       * @brief Creates a mask from the low bits of a word, bit i is lane i
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      self_type s_from_bits(word_type bits) {
+        self_type mask;
+        mask.m_words[0] = bits & s_valid_bits(0);
+        return mask;
+      }
+
+      /*!
+       * @brief Returns whether lane i is set
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      bool get(camp::idx_t i) const {
+        return (m_words[i / s_word_bits] >> (i % s_word_bits)) & 1;
+      }
+
+      /*!
+       * @brief Sets or clears lane i
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &set(bool value, camp::idx_t i) {
+        word_type bit = word_type(1) << (i % s_word_bits);
+        if(value){
+          m_words[i / s_word_bits] |= bit;
+        }
+        else{
+          m_words[i / s_word_bits] &= ~bit;
+        }
+        return *this;
+      }
+
+      /*!
+       * @brief Returns the bits of lanes [lane, lane+width), which must not
+       * span two words
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      word_type get_bits(camp::idx_t lane, camp::idx_t width) const {
+        return (m_words[lane / s_word_bits] >> (lane % s_word_bits)) & s_low_bits(width);
+      }
+
+      /*!
+       * @brief Sets lanes [lane, lane+width) from the low bits of bits, the
+       * lanes must not span two words
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &set_bits(word_type bits, camp::idx_t lane, camp::idx_t width) {
+        camp::idx_t shift = lane % s_word_bits;
+        word_type field = s_low_bits(width) << shift;
+        word_type &word = m_words[lane / s_word_bits];
+        word = (word & ~field) | ((bits << shift) & field);
+        return *this;
+      }
+
+      /*!
+       * @brief Returns true if any lane is set
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      bool any() const {
+        word_type bits = 0;
+        for(camp::idx_t w = 0;w < s_num_words;++ w){
+          bits |= m_words[w];
+        }
+        return bits != 0;
+      }
+
+      /*!
+       * @brief Returns true if all lanes are set
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      bool all() const {
+        for(camp::idx_t w = 0;w < s_num_words;++ w){
+          if(m_words[w] != s_valid_bits(w)){
+            return false;
+          }
+        }
+        return true;
+      }
+
+      /*!
+       * @brief Returns true if no lane is set
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      bool none() const {
+        return !any();
+      }
+
+      /*!
+       * @brief Returns the number of lanes that are set
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      camp::idx_t count() const {
+        camp::idx_t n = 0;
+        for(camp::idx_t w = 0;w < s_num_words;++ w){
+          for(word_type bits = m_words[w];bits != 0;bits &= bits - 1){
+            ++ n;
+          }
+        }
+        return n;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type operator&(self_type const &x) const {
+        self_type result;
+        for(camp::idx_t w = 0;w < s_num_words;++ w){
+          result.m_words[w] = m_words[w] & x.m_words[w];
+        }
+        return result;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type operator|(self_type const &x) const {
+        self_type result;
+        for(camp::idx_t w = 0;w < s_num_words;++ w){
+          result.m_words[w] = m_words[w] | x.m_words[w];
+        }
+        return result;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type operator^(self_type const &x) const {
+        self_type result;
+        for(camp::idx_t w = 0;w < s_num_words;++ w){
+          result.m_words[w] = m_words[w] ^ x.m_words[w];
+        }
+        return result;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type operator~() const {
+        self_type result;
+        for(camp::idx_t w = 0;w < s_num_words;++ w){
+          result.m_words[w] = ~m_words[w] & s_valid_bits(w);
+        }
+        return result;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &operator&=(self_type const &x) {
+        *this = *this & x;
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &operator|=(self_type const &x) {
+        *this = *this | x;
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &operator^=(self_type const &x) {
+        *this = *this ^ x;
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      bool operator==(self_type const &x) const {
+        for(camp::idx_t w = 0;w < s_num_words;++ w){
+          if(m_words[w] != x.m_words[w]){
+            return false;
+          }
+        }
+        return true;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      bool operator!=(self_type const &x) const {
+        return !(*this == x);
+      }
+
+  };
+
+} // namespace expt
+} // namespace RAJA
+
+
+#endif
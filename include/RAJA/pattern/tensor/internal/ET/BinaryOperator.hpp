@@ -24,6 +24,7 @@
 
 #include "RAJA/pattern/tensor/internal/ET/ExpressionTemplateBase.hpp"
 #include "RAJA/pattern/tensor/internal/ET/BinaryOperatorTraits.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterMath.hpp"
 
 
 namespace RAJA
@@ -33,6 +34,7 @@ namespace internal
 namespace expt
 {
 
+  class RegisterConcreteBase;
 
   namespace ET
   {
@@ -140,6 +142,36 @@ namespace expt
     }
 
 
+    /*!
+     * Element-wise power of two tensor expressions, or of a tensor
+     * expression and a scalar
+     */
+    template<typename ACCURACY = RAJA::expt::math_accurate,
+      typename LEFT_OPERAND, typename RIGHT_OPERAND,
+      typename std::enable_if<std::is_base_of<TensorExpressionConcreteBase, LEFT_OPERAND>::value ||
+                              std::is_base_of<TensorExpressionConcreteBase, RIGHT_OPERAND>::value, bool>::type = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    auto pow(LEFT_OPERAND const &left, RIGHT_OPERAND const &right) ->
+    TensorPow<ACCURACY, normalize_operand_t<LEFT_OPERAND>, normalize_operand_t<RIGHT_OPERAND>>
+    {
+      return TensorPow<ACCURACY, normalize_operand_t<LEFT_OPERAND>, normalize_operand_t<RIGHT_OPERAND>>(normalizeOperand(left), normalizeOperand(right));
+    }
+
+    /*!
+     * Element-wise power of two registers or tensor registers
+     */
+    template<typename ACCURACY = RAJA::expt::math_accurate, typename REGISTER,
+      typename std::enable_if<std::is_base_of<RegisterConcreteBase, REGISTER>::value ||
+                              std::is_base_of<TensorRegisterConcreteBase, REGISTER>::value, bool>::type = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    REGISTER pow(REGISTER const &left, REGISTER const &right)
+    {
+      return left.template pow<ACCURACY>(right);
+    }
+
+
 //    /*
 //     * Overload for:    arithmetic / tensorexpression
 //
@@ -161,6 +193,12 @@ namespace expt
   } // namespace internal
 } // namespace expt
 
+
+namespace expt
+{
+  using internal::expt::ET::pow;
+} // namespace expt
+
 }  // namespace RAJA
 
 
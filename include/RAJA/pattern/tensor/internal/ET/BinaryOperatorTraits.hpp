@@ -76,6 +76,172 @@ namespace expt
 
 
 
+    /*!
+     * Element-wise comparisons, which evaluate to the left operand's
+     * mask_type.  A scalar right operand is broadcast.
+     */
+    struct TensorOperatorEqual
+    {
+
+      template<typename LEFT, typename RIGHT>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      auto eval(LEFT const &left, RIGHT const &right) ->
+        decltype(left.cmp_eq(left))
+      {
+        return left.cmp_eq(LEFT(right));
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("Equal");
+      }
+    };
+
+    struct TensorOperatorNotEqual
+    {
+
+      template<typename LEFT, typename RIGHT>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      auto eval(LEFT const &left, RIGHT const &right) ->
+        decltype(left.cmp_ne(left))
+      {
+        return left.cmp_ne(LEFT(right));
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("NotEqual");
+      }
+    };
+
+    struct TensorOperatorLess
+    {
+
+      template<typename LEFT, typename RIGHT>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      auto eval(LEFT const &left, RIGHT const &right) ->
+        decltype(left.cmp_lt(left))
+      {
+        return left.cmp_lt(LEFT(right));
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("Less");
+      }
+    };
+
+    struct TensorOperatorLessEqual
+    {
+
+      template<typename LEFT, typename RIGHT>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      auto eval(LEFT const &left, RIGHT const &right) ->
+        decltype(left.cmp_le(left))
+      {
+        return left.cmp_le(LEFT(right));
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("LessEqual");
+      }
+    };
+
+    struct TensorOperatorGreater
+    {
+
+      template<typename LEFT, typename RIGHT>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      auto eval(LEFT const &left, RIGHT const &right) ->
+        decltype(left.cmp_gt(left))
+      {
+        return left.cmp_gt(LEFT(right));
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("Greater");
+      }
+    };
+
+    struct TensorOperatorGreaterEqual
+    {
+
+      template<typename LEFT, typename RIGHT>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      auto eval(LEFT const &left, RIGHT const &right) ->
+        decltype(left.cmp_ge(left))
+      {
+        return left.cmp_ge(LEFT(right));
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("GreaterEqual");
+      }
+    };
+
+    /*!
+     * Element-wise power, a scalar operand on either side is broadcast
+     */
+    template<typename ACCURACY>
+    struct TensorOperatorPow
+    {
+
+      template<typename LEFT, typename RIGHT,
+        typename std::enable_if<!std::is_arithmetic<LEFT>::value, bool>::type = true>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      LEFT eval(LEFT const &left, RIGHT const &right)
+      {
+        return left.template pow<ACCURACY>(LEFT(right));
+      }
+
+      template<typename LEFT, typename RIGHT,
+        typename std::enable_if<std::is_arithmetic<LEFT>::value, bool>::type = true>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      RIGHT eval(LEFT const &left, RIGHT const &right)
+      {
+        return RIGHT(left).template pow<ACCURACY>(right);
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("Pow");
+      }
+    };
+
+
     template<typename OPERATOR, typename LEFT_OPERAND, typename RIGHT_OPERAND>
     class TensorBinaryOperator;
 
@@ -85,6 +251,27 @@ namespace expt
     template<typename LHS, typename RHS>
     using TensorSubtract = TensorBinaryOperator<TensorOperatorSubtract, LHS, RHS>;
 
+    template<typename LHS, typename RHS>
+    using TensorEqual = TensorBinaryOperator<TensorOperatorEqual, LHS, RHS>;
+
+    template<typename LHS, typename RHS>
+    using TensorNotEqual = TensorBinaryOperator<TensorOperatorNotEqual, LHS, RHS>;
+
+    template<typename LHS, typename RHS>
+    using TensorLess = TensorBinaryOperator<TensorOperatorLess, LHS, RHS>;
+
+    template<typename LHS, typename RHS>
+    using TensorLessEqual = TensorBinaryOperator<TensorOperatorLessEqual, LHS, RHS>;
+
+    template<typename LHS, typename RHS>
+    using TensorGreater = TensorBinaryOperator<TensorOperatorGreater, LHS, RHS>;
+
+    template<typename LHS, typename RHS>
+    using TensorGreaterEqual = TensorBinaryOperator<TensorOperatorGreaterEqual, LHS, RHS>;
+
+    template<typename ACCURACY, typename LHS, typename RHS>
+    using TensorPow = TensorBinaryOperator<TensorOperatorPow<ACCURACY>, LHS, RHS>;
+
 
 
 
@@ -145,6 +145,60 @@ namespace expt
           return TensorDivide<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
         }
 
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorEqual<self_type, normalize_operand_t<RHS>>
+        operator==(RHS const &rhs) const {
+          return TensorEqual<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorNotEqual<self_type, normalize_operand_t<RHS>>
+        operator!=(RHS const &rhs) const {
+          return TensorNotEqual<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorLess<self_type, normalize_operand_t<RHS>>
+        operator<(RHS const &rhs) const {
+          return TensorLess<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorLessEqual<self_type, normalize_operand_t<RHS>>
+        operator<=(RHS const &rhs) const {
+          return TensorLessEqual<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorGreater<self_type, normalize_operand_t<RHS>>
+        operator>(RHS const &rhs) const {
+          return TensorGreater<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorGreaterEqual<self_type, normalize_operand_t<RHS>>
+        operator>=(RHS const &rhs) const {
+          return TensorGreaterEqual<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
+        }
+
         RAJA_SUPPRESS_HD_WARN
         RAJA_INLINE
         RAJA_HOST_DEVICE
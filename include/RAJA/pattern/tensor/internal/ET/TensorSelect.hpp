@@ -0,0 +1,129 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining element-wise selection of tensors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_ET_TensorSelect_HPP
+#define RAJA_pattern_tensor_ET_TensorSelect_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/tensor/internal/ET/ExpressionTemplateBase.hpp"
+
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+
+  namespace ET
+  {
+
+    /*!
+     * Element-wise select: the true operand where the condition holds, and
+     * the false operand elsewhere.
+     *
+     * The condition is an element-wise comparison, such as x(i) < y(i), and
+     * determines the shape of the result.  Either operand may be a scalar.
+     */
+    template<typename COND_TYPE, typename TRUE_TYPE, typename FALSE_TYPE>
+    class TensorSelect :  public TensorExpressionBase<TensorSelect<COND_TYPE, TRUE_TYPE, FALSE_TYPE>> {
+      public:
+        using self_type = TensorSelect<COND_TYPE, TRUE_TYPE, FALSE_TYPE>;
+        using cond_type = COND_TYPE;
+        using true_type = TRUE_TYPE;
+        using false_type = FALSE_TYPE;
+        using result_type = typename COND_TYPE::result_type;
+        using element_type = typename result_type::element_type;
+        using index_type = typename COND_TYPE::index_type;
+
+        static constexpr camp::idx_t s_num_dims = COND_TYPE::s_num_dims;
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorSelect(cond_type const &cond, true_type const &true_value, false_type const &false_value) :
+        m_cond{cond}, m_true{true_value}, m_false{false_value}
+        {}
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        index_type getDimSize(index_type dim) const {
+          return m_cond.getDimSize(dim);
+        }
+
+        template<typename TILE_TYPE>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        result_type eval(TILE_TYPE const &tile) const
+        {
+          return result_type(m_false.eval(tile)).blend(result_type(m_true.eval(tile)),
+                                                       m_cond.eval(tile));
+        }
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        void print_ast() const {
+          printf("Select(");
+          m_cond.print_ast();
+          printf(", ");
+          m_true.print_ast();
+          printf(", ");
+          m_false.print_ast();
+          printf(")");
+        }
+
+      private:
+        cond_type m_cond;
+        true_type m_true;
+        false_type m_false;
+    };
+
+
+    /*!
+     * Element-wise select(cond, t, f), cond ? t : f in each element
+     */
+    template<typename COND_TYPE, typename TRUE_TYPE, typename FALSE_TYPE,
+      typename std::enable_if<std::is_base_of<TensorExpressionConcreteBase, COND_TYPE>::value, bool>::type = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    TensorSelect<COND_TYPE, normalize_operand_t<TRUE_TYPE>, normalize_operand_t<FALSE_TYPE>>
+    select(COND_TYPE const &cond, TRUE_TYPE const &true_value, FALSE_TYPE const &false_value)
+    {
+      return TensorSelect<COND_TYPE, normalize_operand_t<TRUE_TYPE>, normalize_operand_t<FALSE_TYPE>>(
+          cond, normalizeOperand(true_value), normalizeOperand(false_value));
+    }
+
+
+  } // namespace ET
+
+  } // namespace internal
+} // namespace expt
+
+
+namespace expt
+{
+  using internal::expt::ET::select;
+} // namespace expt
+
+}  // namespace RAJA
+
+
+#endif
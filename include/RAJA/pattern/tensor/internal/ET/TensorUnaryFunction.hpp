@@ -0,0 +1,343 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining element-wise tensor math functions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_ET_TensorUnaryFunction_HPP
+#define RAJA_pattern_tensor_ET_TensorUnaryFunction_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/tensor/internal/ET/ExpressionTemplateBase.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterMath.hpp"
+
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+  class RegisterConcreteBase;
+
+  class TensorRegisterConcreteBase;
+
+  namespace ET
+  {
+
+    struct TensorFunctionSqrt
+    {
+
+      template<typename ARG>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      ARG eval(ARG const &arg)
+      {
+        return arg.sqrt();
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("Sqrt");
+      }
+    };
+
+    struct TensorFunctionRsqrt
+    {
+
+      template<typename ARG>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      ARG eval(ARG const &arg)
+      {
+        return arg.rsqrt();
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("Rsqrt");
+      }
+    };
+
+    struct TensorFunctionAbs
+    {
+
+      template<typename ARG>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      ARG eval(ARG const &arg)
+      {
+        return arg.abs();
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("Abs");
+      }
+    };
+
+    template<typename ACCURACY>
+    struct TensorFunctionExp
+    {
+
+      template<typename ARG>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      ARG eval(ARG const &arg)
+      {
+        return arg.template exp<ACCURACY>();
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("Exp");
+      }
+    };
+
+    template<typename ACCURACY>
+    struct TensorFunctionLog
+    {
+
+      template<typename ARG>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      ARG eval(ARG const &arg)
+      {
+        return arg.template log<ACCURACY>();
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("Log");
+      }
+    };
+
+
+
+    /*!
+     * Applies an element-wise FUNCTION to a tensor expression
+     */
+    template<typename FUNCTION, typename ET_TYPE>
+    class TensorUnaryFunction :  public TensorExpressionBase<TensorUnaryFunction<FUNCTION, ET_TYPE>> {
+      public:
+        using self_type = TensorUnaryFunction<FUNCTION, ET_TYPE>;
+        using function_type = FUNCTION;
+        using rhs_type = ET_TYPE;
+        using tensor_type = typename ET_TYPE::result_type;
+        using element_type = typename tensor_type::element_type;
+        using index_type = typename ET_TYPE::index_type;
+
+        using result_type = tensor_type;
+        using tile_type = typename ET_TYPE::tile_type;
+        static constexpr camp::idx_t s_num_dims = ET_TYPE::s_num_dims;
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorUnaryFunction(rhs_type const &tensor) :
+        m_tensor{tensor}
+        {}
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        index_type getDimSize(index_type dim) const {
+          return m_tensor.getDimSize(dim);
+        }
+
+        template<typename TILE_TYPE>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        result_type eval(TILE_TYPE const &tile) const
+        {
+          return function_type::eval(result_type(m_tensor.eval(tile)));
+        }
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        void print_ast() const {
+          function_type::print_ast();
+          printf("(");
+          m_tensor.print_ast();
+          printf(")");
+        }
+
+      private:
+        rhs_type m_tensor;
+    };
+
+
+    template<typename T>
+    using enable_if_tensor_expression_t =
+        typename std::enable_if<std::is_base_of<TensorExpressionConcreteBase, T>::value, bool>::type;
+
+    template<typename T>
+    using enable_if_register_t =
+        typename std::enable_if<std::is_base_of<RegisterConcreteBase, T>::value ||
+                                std::is_base_of<TensorRegisterConcreteBase, T>::value, bool>::type;
+
+    /*!
+     * Element-wise square root of a tensor expression
+     */
+    template<typename ET_TYPE, enable_if_tensor_expression_t<ET_TYPE> = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    TensorUnaryFunction<TensorFunctionSqrt, ET_TYPE>
+    sqrt(ET_TYPE const &x)
+    {
+      return TensorUnaryFunction<TensorFunctionSqrt, ET_TYPE>(x);
+    }
+
+    /*!
+     * Element-wise square root of a register or tensor register
+     */
+    template<typename REGISTER, enable_if_register_t<REGISTER> = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    REGISTER sqrt(REGISTER const &x)
+    {
+      return TensorFunctionSqrt::eval(x);
+    }
+
+    /*!
+     * Element-wise reciprocal square root of a tensor expression
+     */
+    template<typename ET_TYPE, enable_if_tensor_expression_t<ET_TYPE> = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    TensorUnaryFunction<TensorFunctionRsqrt, ET_TYPE>
+    rsqrt(ET_TYPE const &x)
+    {
+      return TensorUnaryFunction<TensorFunctionRsqrt, ET_TYPE>(x);
+    }
+
+    /*!
+     * Element-wise reciprocal square root of a register or tensor register
+     */
+    template<typename REGISTER, enable_if_register_t<REGISTER> = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    REGISTER rsqrt(REGISTER const &x)
+    {
+      return TensorFunctionRsqrt::eval(x);
+    }
+
+    /*!
+     * Element-wise absolute value of a tensor expression
+     */
+    template<typename ET_TYPE, enable_if_tensor_expression_t<ET_TYPE> = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    TensorUnaryFunction<TensorFunctionAbs, ET_TYPE>
+    abs(ET_TYPE const &x)
+    {
+      return TensorUnaryFunction<TensorFunctionAbs, ET_TYPE>(x);
+    }
+
+    /*!
+     * Element-wise absolute value of a register or tensor register
+     */
+    template<typename REGISTER, enable_if_register_t<REGISTER> = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    REGISTER abs(REGISTER const &x)
+    {
+      return TensorFunctionAbs::eval(x);
+    }
+
+    /*!
+     * Element-wise exponential of a tensor expression
+     */
+    template<typename ACCURACY = RAJA::expt::math_accurate, typename ET_TYPE, enable_if_tensor_expression_t<ET_TYPE> = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    TensorUnaryFunction<TensorFunctionExp<ACCURACY>, ET_TYPE>
+    exp(ET_TYPE const &x)
+    {
+      return TensorUnaryFunction<TensorFunctionExp<ACCURACY>, ET_TYPE>(x);
+    }
+
+    /*!
+     * Element-wise exponential of a register or tensor register
+     */
+    template<typename ACCURACY = RAJA::expt::math_accurate, typename REGISTER, enable_if_register_t<REGISTER> = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    REGISTER exp(REGISTER const &x)
+    {
+      return TensorFunctionExp<ACCURACY>::eval(x);
+    }
+
+    /*!
+     * Element-wise natural logarithm of a tensor expression
+     */
+    template<typename ACCURACY = RAJA::expt::math_accurate, typename ET_TYPE, enable_if_tensor_expression_t<ET_TYPE> = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    TensorUnaryFunction<TensorFunctionLog<ACCURACY>, ET_TYPE>
+    log(ET_TYPE const &x)
+    {
+      return TensorUnaryFunction<TensorFunctionLog<ACCURACY>, ET_TYPE>(x);
+    }
+
+    /*!
+     * Element-wise natural logarithm of a register or tensor register
+     */
+    template<typename ACCURACY = RAJA::expt::math_accurate, typename REGISTER, enable_if_register_t<REGISTER> = true>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    REGISTER log(REGISTER const &x)
+    {
+      return TensorFunctionLog<ACCURACY>::eval(x);
+    }
+
+
+
+  } // namespace ET
+
+  } // namespace internal
+} // namespace expt
+
+
+namespace expt
+{
+  using internal::expt::ET::sqrt;
+  using internal::expt::ET::rsqrt;
+  using internal::expt::ET::abs;
+  using internal::expt::ET::exp;
+  using internal::expt::ET::log;
+} // namespace expt
+
+}  // namespace RAJA
+
+
+#endif
@@ -28,7 +28,9 @@
 #include "RAJA/pattern/tensor/internal/ET/TensorMultiplyAdd.hpp"
 #include "RAJA/pattern/tensor/internal/ET/TensorNegate.hpp"
 #include "RAJA/pattern/tensor/internal/ET/TensorScalarLiteral.hpp"
+#include "RAJA/pattern/tensor/internal/ET/TensorSelect.hpp"
 #include "RAJA/pattern/tensor/internal/ET/TensorTranspose.hpp"
+#include "RAJA/pattern/tensor/internal/ET/TensorUnaryFunction.hpp"
 
 
 
@@ -21,6 +21,7 @@
 #include "camp/camp.hpp"
 #include "RAJA/config.hpp"
 #include "RAJA/pattern/tensor/MatrixRegister.hpp"
+#include "RAJA/pattern/tensor/stats.hpp"
 
 
 namespace RAJA
@@ -93,9 +94,7 @@ namespace expt
       typename std::enable_if<(s_C_minor_dim_registers != 0), dummy>::type
       multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
       {
-#if defined(RAJA_ENABLE_VECTOR_STATS) && !defined(__CUDA_ARCH__)
-        RAJA::tensor_stats::num_matrix_mm_multacc_row_row ++;
-#endif
+        RAJA_TENSOR_STAT(num_matrix_mm_multacc_row_row, 0, 0, 2*N_SIZE*M_SIZE*O_SIZE);
 
         constexpr camp::idx_t num_bc_reg_per_row = s_C_minor_dim_registers;
 
@@ -128,6 +127,8 @@ namespace expt
       typename std::enable_if<(s_C_minor_dim_registers == 0), dummy>::type
       multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
       {
+        RAJA_TENSOR_STAT(num_matrix_mm_multacc_row_row, 0, 0, 2*N_SIZE*M_SIZE*O_SIZE);
+
         constexpr camp::idx_t bc_segbits = result_type::s_segbits;
         constexpr camp::idx_t a_segments_per_register = 1<<bc_segbits;
 
@@ -166,6 +167,7 @@ namespace expt
       static
       RAJA_INLINE
       void multiply(left_type const &A, right_type const &B, result_type &C){
+        RAJA_TENSOR_STAT(num_matrix_mm_mult_row_row, 0, 0, 0);
         C = result_type(0);
         multiply_accumulate(A, B, C);
       }
@@ -236,11 +238,7 @@ namespace expt
         typename std::enable_if<(s_C_minor_dim_registers != 0), dummy>::type
         multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
         {
-
-  #if defined(RAJA_ENABLE_VECTOR_STATS) && !defined(__CUDA_ARCH__)
-          RAJA::tensor_stats::num_matrix_mm_multacc_row_row ++;
-  #endif
-
+          RAJA_TENSOR_STAT(num_matrix_mm_multacc_col_col, 0, 0, 2*N_SIZE*M_SIZE*O_SIZE);
 
           constexpr camp::idx_t num_ac_reg_per_col = s_C_minor_dim_registers;
 
@@ -274,6 +272,8 @@ namespace expt
         typename std::enable_if<(s_C_minor_dim_registers == 0), dummy>::type
         multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
         {
+          RAJA_TENSOR_STAT(num_matrix_mm_multacc_col_col, 0, 0, 2*N_SIZE*M_SIZE*O_SIZE);
+
           constexpr camp::idx_t ac_segbits = result_type::s_segbits;
           constexpr camp::idx_t b_segments_per_register = 1<<ac_segbits;
 
@@ -320,6 +320,7 @@ namespace expt
         static
         RAJA_INLINE
         void multiply(left_type const &A, right_type const &B, result_type &C){
+          RAJA_TENSOR_STAT(num_matrix_mm_mult_col_col, 0, 0, 0);
           C = result_type(0);
           self_type::multiply_accumulate(A, B, C);
         }
@@ -22,6 +22,7 @@
 #include "RAJA/config.hpp"
 #include "RAJA/pattern/tensor/MatrixRegister.hpp"
 #include "RAJA/pattern/tensor/internal/MatrixMatrixMultiply.hpp"
+#include "RAJA/pattern/tensor/stats.hpp"
 #include "RAJA/util/BitMask.hpp"
 
 //#define DEBUG_MATRIX_LOAD_STORE
@@ -271,10 +272,12 @@ namespace expt
             if(self.is_ref_packed<STRIDE_ONE_DIM>()){
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+                RAJA_TENSOR_STAT(num_matrix_load_packed, self_type::s_num_rows*self_type::s_num_columns*sizeof(*ptr), 0, 0);
                 self.load_packed(ptr, ref.m_stride[0], ref.m_stride[1]);
               }
               // partial
               else{
+                RAJA_TENSOR_STAT(num_matrix_load_packed, ref.m_tile.m_size[0]*ref.m_tile.m_size[1]*sizeof(*ptr), 0, 0);
                 self.load_packed_nm(ptr, ref.m_stride[0], ref.m_stride[1],
                                     ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
               }
@@ -285,10 +288,12 @@ namespace expt
             {
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+                RAJA_TENSOR_STAT(num_matrix_load_strided, self_type::s_num_rows*self_type::s_num_columns*sizeof(*ptr), 0, 0);
                 self.load_strided(ptr, ref.m_stride[0], ref.m_stride[1]);
               }
               // partial
               else{
+                RAJA_TENSOR_STAT(num_matrix_load_strided, ref.m_tile.m_size[0]*ref.m_tile.m_size[1]*sizeof(*ptr), 0, 0);
                 self.load_strided_nm(ptr, ref.m_stride[0], ref.m_stride[1],
                                          ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
               }
@@ -311,10 +316,12 @@ namespace expt
             {
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+                RAJA_TENSOR_STAT(num_matrix_store_packed, 0, self_type::s_num_rows*self_type::s_num_columns*sizeof(*ptr), 0);
                 self.store_packed(ptr, ref.m_stride[0], ref.m_stride[1]);
               }
               // partial
               else{
+                RAJA_TENSOR_STAT(num_matrix_store_packed, 0, ref.m_tile.m_size[0]*ref.m_tile.m_size[1]*sizeof(*ptr), 0);
                 self.store_packed_nm(ptr, ref.m_stride[0], ref.m_stride[1],
                                          ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
               }
@@ -325,10 +332,12 @@ namespace expt
             {
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+                RAJA_TENSOR_STAT(num_matrix_store_strided, 0, self_type::s_num_rows*self_type::s_num_columns*sizeof(*ptr), 0);
                 self.store_strided(ptr, ref.m_stride[0], ref.m_stride[1]);
               }
               // partial
               else{
+                RAJA_TENSOR_STAT(num_matrix_store_strided, 0, ref.m_tile.m_size[0]*ref.m_tile.m_size[1]*sizeof(*ptr), 0);
                 self.store_strided_nm(ptr, ref.m_stride[0], ref.m_stride[1],
                                          ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
               }
@@ -369,10 +378,12 @@ namespace expt
             if(self.is_ref_packed<STRIDE_ONE_DIM>()){
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+                RAJA_TENSOR_STAT(num_matrix_load_packed, self_type::s_num_rows*self_type::s_num_columns*sizeof(*ptr), 0, 0);
                 self.load_packed(ptr, ref.m_stride[0], ref.m_stride[1]);
               }
               // partial
               else{
+                RAJA_TENSOR_STAT(num_matrix_load_packed, ref.m_tile.m_size[0]*ref.m_tile.m_size[1]*sizeof(*ptr), 0, 0);
                 self.load_packed_nm(ptr, ref.m_stride[0], ref.m_stride[1],
                                     ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
               }
@@ -383,10 +394,12 @@ namespace expt
             {
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+                RAJA_TENSOR_STAT(num_matrix_load_strided, self_type::s_num_rows*self_type::s_num_columns*sizeof(*ptr), 0, 0);
                 self.load_strided(ptr, ref.m_stride[0], ref.m_stride[1]);
               }
               // partial
               else{
+                RAJA_TENSOR_STAT(num_matrix_load_strided, ref.m_tile.m_size[0]*ref.m_tile.m_size[1]*sizeof(*ptr), 0, 0);
                 self.load_strided_nm(ptr, ref.m_stride[0], ref.m_stride[1],
                                          ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
               }
@@ -409,10 +422,12 @@ namespace expt
             {
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+                RAJA_TENSOR_STAT(num_matrix_store_packed, 0, self_type::s_num_rows*self_type::s_num_columns*sizeof(*ptr), 0);
                 self.store_packed(ptr, ref.m_stride[0], ref.m_stride[1]);
               }
               // partial
               else{
+                RAJA_TENSOR_STAT(num_matrix_store_packed, 0, ref.m_tile.m_size[0]*ref.m_tile.m_size[1]*sizeof(*ptr), 0);
                 self.store_packed_nm(ptr, ref.m_stride[0], ref.m_stride[1],
                                          ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
               }
@@ -423,10 +438,12 @@ namespace expt
             {
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+                RAJA_TENSOR_STAT(num_matrix_store_strided, 0, self_type::s_num_rows*self_type::s_num_columns*sizeof(*ptr), 0);
                 self.store_strided(ptr, ref.m_stride[0], ref.m_stride[1]);
               }
               // partial
               else{
+                RAJA_TENSOR_STAT(num_matrix_store_strided, 0, ref.m_tile.m_size[0]*ref.m_tile.m_size[1]*sizeof(*ptr), 0);
                 self.store_strided_nm(ptr, ref.m_stride[0], ref.m_stride[1],
                                          ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
               }
@@ -24,9 +24,13 @@
 
 #include "camp/camp.hpp"
 #include "RAJA/pattern/tensor/TensorLayout.hpp"
+#include "RAJA/pattern/tensor/TensorMask.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterMath.hpp"
 #include "RAJA/pattern/tensor/internal/TensorRef.hpp"
 #include "RAJA/util/BitMask.hpp"
 
+#include <cmath>
+
 #include "RAJA/policy/tensor/arch.hpp"
 
 namespace RAJA
@@ -126,6 +130,8 @@ namespace expt
       using int_element_type = typename RegisterTraits<REGISTER_POLICY, T>::int_element_type;
       using int_vector_type = RAJA::expt::Register<int_element_type, REGISTER_POLICY>;
 
+      using mask_type = RAJA::expt::TensorMask<RegisterTraits<REGISTER_POLICY, T>::s_num_elem>;
+
     private:
 
       RAJA_HOST_DEVICE
@@ -217,9 +223,6 @@ namespace expt
       RAJA_HOST_DEVICE
       RAJA_INLINE
       self_type &gather(element_type const *ptr, RAJA::expt::Register<T2, REGISTER_POLICY> offsets){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
         for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
           getThis()->set(ptr[offsets.get(i)], i);
         }
@@ -240,9 +243,6 @@ namespace expt
       RAJA_HOST_DEVICE
       RAJA_INLINE
       self_type &gather_n(element_type const *ptr, RAJA::expt::Register<T2, REGISTER_POLICY> const &offsets, camp::idx_t N){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
           for(camp::idx_t i = 0;i < N;++ i){
             getThis()->set(ptr[offsets.get(i)], i);
           }
@@ -325,9 +325,6 @@ namespace expt
       RAJA_HOST_DEVICE
       RAJA_INLINE
       self_type const &scatter(element_type *ptr, RAJA::expt::Register<T2, REGISTER_POLICY> const &offsets) const {
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
         for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
           ptr[offsets.get(i)] = getThis()->get(i);
         }
@@ -347,9 +344,6 @@ namespace expt
       RAJA_HOST_DEVICE
       RAJA_INLINE
       self_type const &scatter_n(element_type *ptr, RAJA::expt::Register<T2, REGISTER_POLICY> const &offsets, camp::idx_t N) const {
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
         for(camp::idx_t i = 0;i < N;++ i){
           ptr[offsets.get(i)] = getThis()->get(i);
         }
@@ -779,6 +773,293 @@ namespace expt
         return getThis()->max(N);
       }
 
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is equal to x
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type cmp_eq(self_type const &x) const
+      {
+        mask_type mask;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          mask.set(getThis()->get(i) == x.get(i), i);
+        }
+        return mask;
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is not equal to x
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type cmp_ne(self_type const &x) const
+      {
+        mask_type mask;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          mask.set(getThis()->get(i) != x.get(i), i);
+        }
+        return mask;
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is less than x
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type cmp_lt(self_type const &x) const
+      {
+        mask_type mask;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          mask.set(getThis()->get(i) < x.get(i), i);
+        }
+        return mask;
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is less than or equal to x
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type cmp_le(self_type const &x) const
+      {
+        mask_type mask;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          mask.set(getThis()->get(i) <= x.get(i), i);
+        }
+        return mask;
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is greater than x
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type cmp_gt(self_type const &x) const
+      {
+        mask_type mask;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          mask.set(getThis()->get(i) > x.get(i), i);
+        }
+        return mask;
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is greater than or equal to x
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type cmp_ge(self_type const &x) const
+      {
+        mask_type mask;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          mask.set(getThis()->get(i) >= x.get(i), i);
+        }
+        return mask;
+      }
+
+      /*!
+       * @brief Element-wise select: b in the lanes where mask is set, and
+       * (*this) in the others
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type blend(self_type const &b, mask_type const &mask) const
+      {
+        self_type result = *getThis();
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          if(mask.get(i)){
+            result.set(b.get(i), i);
+          }
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Stores the lanes where mask is set, other memory locations
+       * are not touched
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const
+      {
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          if(mask.get(i)){
+            ptr[i] = getThis()->get(i);
+          }
+        }
+        return *getThis();
+      }
+
+      /*!
+       * @brief Store entire register to consecutive memory locations,
+       * bypassing the caches where the architecture supports it
+       *
+       * ptr must be aligned to the size of the register.  Streaming stores
+       * are weakly ordered: call streaming_fence() before another thread
+       * reads the stored values.
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type const &store_packed_streaming(element_type *ptr) const
+      {
+        return getThis()->store_packed(ptr);
+      }
+
+      /*!
+       * @brief Orders preceding streaming stores before later stores
+       */
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static void streaming_fence()
+      {
+      }
+
+      /*!
+       * @brief Element-wise absolute value
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type abs() const
+      {
+        self_type result;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          element_type v = getThis()->get(i);
+          result.set(v <= element_type(0) ? element_type(0) - v : v, i);
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Element-wise square root
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type sqrt() const
+      {
+        self_type result;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          result.set(std::sqrt(getThis()->get(i)), i);
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Element-wise reciprocal square root
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type rsqrt() const
+      {
+        return self_type(element_type(1)).divide(getThis()->sqrt());
+      }
+
+      /*!
+       * @brief Element-wise round to nearest integer, ties to even
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type round() const
+      {
+        self_type result;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          result.set(std::nearbyint(getThis()->get(i)), i);
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Element-wise (*this) * 2^n, where n holds integer values
+       *
+       * Only defined when 2^n is a normal number.  Architecture versions
+       * may build 2^n from its exponent bits, so unlike std::ldexp they
+       * need not handle overflow, underflow or non-integer n.  This is a
+       * building block of the register exp and pow.
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type ldexp(self_type const &n) const
+      {
+        self_type result;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          result.set(std::ldexp(getThis()->get(i), static_cast<int>(n.get(i))), i);
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Element-wise split into a mantissa in [1/2, 1), which is
+       * returned, and an exponent, which is stored in e
+       *
+       * Only defined for positive normal values.  Architecture versions
+       * may read the exponent field, so unlike std::frexp the results for
+       * zeros, subnormals, negative values, infinities and NaN are
+       * unspecified.  This is a building block of the register log and
+       * pow, which only pass it positive normal values.
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type frexp(self_type &e) const
+      {
+        self_type result;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          int exponent = 0;
+          result.set(std::frexp(getThis()->get(i), &exponent), i);
+          e.set(element_type(exponent), i);
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Element-wise exponential
+       *
+       * ACCURACY is a RAJA::expt::math_accuracy, which trades ulps of error
+       * for speed.
+       */
+      template<typename ACCURACY = RAJA::expt::math_accurate>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type exp() const
+      {
+        return RegisterMath<self_type>::template exp<ACCURACY::s_max_ulp>(*getThis());
+      }
+
+      /*!
+       * @brief Element-wise natural logarithm
+       */
+      template<typename ACCURACY = RAJA::expt::math_accurate>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type log() const
+      {
+        return RegisterMath<self_type>::template log<ACCURACY::s_max_ulp>(*getThis());
+      }
+
+      /*!
+       * @brief Element-wise (*this) to the power y
+       */
+      template<typename ACCURACY = RAJA::expt::math_accurate>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type pow(self_type const &y) const
+      {
+        return RegisterMath<self_type>::template pow<ACCURACY::s_max_ulp>(*getThis(), y);
+      }
+
       /*!
        * Provides vector-level building block for matrix transpose operations.
        *
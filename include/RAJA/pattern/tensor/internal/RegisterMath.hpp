@@ -0,0 +1,661 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining math functions for SIMD/SIMT registers.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_RegisterMath_HPP
+#define RAJA_pattern_tensor_RegisterMath_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include <limits>
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * Selects the accuracy of the register exp, log and pow functions.
+   *
+   * MAX_ULP is the largest error, in units in the last place, that the
+   * caller accepts.  Each function uses the cheapest of its implementations
+   * whose error is within MAX_ULP, or its most accurate one.  exp and log
+   * are within 1 ulp at best, and pow within 2 ulp.
+   */
+  template<int MAX_ULP>
+  struct math_accuracy
+  {
+    static_assert(MAX_ULP >= 1, "register math functions are not correctly rounded");
+
+    static constexpr int s_max_ulp = MAX_ULP;
+  };
+
+  /*!
+   * Default accuracy: exp and log within 1 ulp, pow within 2 ulp
+   */
+  using math_accurate = math_accuracy<1>;
+
+  /*!
+   * Shorter polynomials and no compensation: all within 4 ulp
+   */
+  using math_fast = math_accuracy<4>;
+
+} // namespace expt
+
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Constants used by the register math functions.
+   */
+  template<typename T>
+  struct RegisterMathTraits;
+
+  template<>
+  struct RegisterMathTraits<double>
+  {
+      // 2^27, splits a value into halves whose products are exact
+      RAJA_HOST_DEVICE
+      static constexpr double split() { return 134217728.0; }
+
+      RAJA_HOST_DEVICE
+      static constexpr double log2e() { return 1.44269504088896338700e+00; }
+
+      // ln(2) = ln2_hi + ln2_lo, where n*ln2_hi is exact for any exponent n
+      RAJA_HOST_DEVICE
+      static constexpr double ln2_hi() { return 6.93147180369123816490e-01; }
+
+      RAJA_HOST_DEVICE
+      static constexpr double ln2_lo() { return 1.90821492927058770002e-10; }
+
+      // exp() arguments are clamped to a range just wider than the one
+      // that neither overflows nor underflows
+      RAJA_HOST_DEVICE
+      static constexpr double exp_min_arg() { return -746.0; }
+
+      RAJA_HOST_DEVICE
+      static constexpr double exp_max_arg() { return 710.0; }
+
+      // subnormal arguments of log() are scaled by 2^54
+      RAJA_HOST_DEVICE
+      static constexpr double min_normal() { return 2.2250738585072014e-308; }
+
+      RAJA_HOST_DEVICE
+      static constexpr double subnormal_scale() { return 18014398509481984.0; }
+
+      RAJA_HOST_DEVICE
+      static constexpr double subnormal_bits() { return 54.0; }
+
+      RAJA_HOST_DEVICE
+      static constexpr double sqrt_half() { return 7.07106781186547524401e-01; }
+
+      // log(1+f) = 2s + s*R(s^2) with s = f/(2+f), R from fdlibm
+      RAJA_HOST_DEVICE
+      static constexpr double log_coef(int k) {
+        return k == 0 ? 6.666666666666735130e-01 :
+               k == 1 ? 3.999999999940941908e-01 :
+               k == 2 ? 2.857142874366239149e-01 :
+               k == 3 ? 2.222219843214978396e-01 :
+               k == 4 ? 1.818357216161805012e-01 :
+               k == 5 ? 1.531383769920937332e-01 :
+                        1.479819860511658591e-01;
+      }
+
+      // degree of the exp(r) Taylor polynomial, |r| <= ln(2)/2,
+      // errors are 0.87 and 2.3 ulp
+      RAJA_HOST_DEVICE
+      static constexpr int exp_degree(int max_ulp) {
+        return max_ulp >= 3 ? 12 : 13;
+      }
+
+      // number of terms in R(s^2), and whether the rounding of s is
+      // compensated, errors are 0.54 and 1.9 ulp
+      RAJA_HOST_DEVICE
+      static constexpr int log_terms(int) {
+        return 7;
+      }
+
+      RAJA_HOST_DEVICE
+      static constexpr bool log_compensated(int max_ulp) {
+        return max_ulp < 2;
+      }
+
+      // 2/3 = two_thirds_hi + two_thirds_lo, and the degree of the atanh
+      // series of the log used by pow
+      RAJA_HOST_DEVICE
+      static constexpr double two_thirds_hi() { return 6.66666666666666629659e-01; }
+
+      RAJA_HOST_DEVICE
+      static constexpr double two_thirds_lo() { return 3.70074341541718826265e-17; }
+
+      RAJA_HOST_DEVICE
+      static constexpr int log_extended_degree() { return 12; }
+  };
+
+  template<>
+  struct RegisterMathTraits<float>
+  {
+      // 2^12, splits a value into halves whose products are exact
+      RAJA_HOST_DEVICE
+      static constexpr float split() { return 4096.0f; }
+
+      RAJA_HOST_DEVICE
+      static constexpr float log2e() { return 1.4426950409e+00f; }
+
+      // ln(2) = ln2_hi + ln2_lo, where n*ln2_hi is exact for any exponent n
+      RAJA_HOST_DEVICE
+      static constexpr float ln2_hi() { return 6.9313812256e-01f; }
+
+      RAJA_HOST_DEVICE
+      static constexpr float ln2_lo() { return 9.0580006145e-06f; }
+
+      // exp() arguments are clamped to a range just wider than the one
+      // that neither overflows nor underflows
+      RAJA_HOST_DEVICE
+      static constexpr float exp_min_arg() { return -104.0f; }
+
+      RAJA_HOST_DEVICE
+      static constexpr float exp_max_arg() { return 89.0f; }
+
+      // subnormal arguments of log() are scaled by 2^24
+      RAJA_HOST_DEVICE
+      static constexpr float min_normal() { return 1.17549435e-38f; }
+
+      RAJA_HOST_DEVICE
+      static constexpr float subnormal_scale() { return 16777216.0f; }
+
+      RAJA_HOST_DEVICE
+      static constexpr float subnormal_bits() { return 24.0f; }
+
+      RAJA_HOST_DEVICE
+      static constexpr float sqrt_half() { return 7.0710678119e-01f; }
+
+      // log(1+f) = 2s + s*R(s^2) with s = f/(2+f), R from fdlibm
+      RAJA_HOST_DEVICE
+      static constexpr float log_coef(int k) {
+        return k == 0 ? 6.6666668653e-01f :
+               k == 1 ? 4.0000000596e-01f :
+               k == 2 ? 2.8571429849e-01f :
+                        2.2222198546e-01f;
+      }
+
+      // degree of the exp(r) Taylor polynomial, |r| <= ln(2)/2,
+      // errors are 0.91 and 2.7 ulp
+      RAJA_HOST_DEVICE
+      static constexpr int exp_degree(int max_ulp) {
+        return max_ulp >= 3 ? 6 : 7;
+      }
+
+      // number of terms in R(s^2), and whether the rounding of s is
+      // compensated, errors are 0.54, 1.9 and 2.5 ulp
+      RAJA_HOST_DEVICE
+      static constexpr int log_terms(int max_ulp) {
+        return max_ulp >= 3 ? 3 : 4;
+      }
+
+      RAJA_HOST_DEVICE
+      static constexpr bool log_compensated(int max_ulp) {
+        return max_ulp < 2;
+      }
+
+      // 2/3 = two_thirds_hi + two_thirds_lo, and the degree of the atanh
+      // series of the log used by pow
+      RAJA_HOST_DEVICE
+      static constexpr float two_thirds_hi() { return 6.6666668653e-01f; }
+
+      RAJA_HOST_DEVICE
+      static constexpr float two_thirds_lo() { return -1.9868215517e-08f; }
+
+      RAJA_HOST_DEVICE
+      static constexpr int log_extended_degree() { return 6; }
+  };
+
+
+  /*!
+   * Taylor coefficients 1/k! of exp()
+   */
+  template<typename T>
+  struct RegisterMathExpCoef
+  {
+      RAJA_HOST_DEVICE
+      static constexpr T coef(int k) {
+        return k <= 1 ? T(1) : coef(k-1) / T(k);
+      }
+  };
+
+  /*!
+   * Coefficients of R(s^2) in log()
+   */
+  template<typename T>
+  struct RegisterMathLogCoef
+  {
+      RAJA_HOST_DEVICE
+      static constexpr T coef(int k) {
+        return RegisterMathTraits<T>::log_coef(k);
+      }
+  };
+
+  /*!
+   * Coefficients 2/(2k+3) of the atanh series in the log used by pow
+   */
+  template<typename T>
+  struct RegisterMathAtanhCoef
+  {
+      RAJA_HOST_DEVICE
+      static constexpr T coef(int k) {
+        return T(2) / T(2*k+3);
+      }
+  };
+
+  /*!
+   * Horner evaluation of c_K + c_{K+1} x + ... + c_DEGREE x^(DEGREE-K),
+   * unrolled at compile time.
+   */
+  template<typename COEF, typename REGISTER, int K, int DEGREE>
+  struct RegisterMathHorner
+  {
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static REGISTER eval(REGISTER const &x) {
+        return RegisterMathHorner<COEF, REGISTER, K+1, DEGREE>::eval(x).multiply_add(x, REGISTER(COEF::coef(K)));
+      }
+  };
+
+  template<typename COEF, typename REGISTER, int DEGREE>
+  struct RegisterMathHorner<COEF, REGISTER, DEGREE, DEGREE>
+  {
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static REGISTER eval(REGISTER const &) {
+        return REGISTER(COEF::coef(DEGREE));
+      }
+  };
+
+
+  /*!
+   * Element-wise exp, log and pow built from register operations.
+   *
+   * These only use the arithmetic, compare, blend, round, ldexp and frexp
+   * operations of REGISTER, so they work for any register type, and are
+   * as fast as those operations are on each architecture.
+   *
+   * exp reduces its argument to r = x - n*ln(2), |r| <= ln(2)/2, and
+   * evaluates a Taylor polynomial.  log reduces its argument to a mantissa
+   * m in [sqrt(1/2), sqrt(2)) and uses log(m) = 2*atanh((m-1)/(m+1)).  pow
+   * carries log(x) and y*log(x) as unevaluated sums of two values, so its
+   * error does not grow with the magnitude of y*log(x).
+   */
+  template<typename REGISTER>
+  struct RegisterMath
+  {
+      using register_type = REGISTER;
+      using element_type = typename REGISTER::element_type;
+      using mask_type = typename REGISTER::mask_type;
+      using traits = RegisterMathTraits<element_type>;
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static register_type s_value(element_type value) {
+        return register_type(value);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static element_type s_inf() {
+        return std::numeric_limits<element_type>::infinity();
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static element_type s_nan() {
+        return std::numeric_limits<element_type>::quiet_NaN();
+      }
+
+      /*!
+       * hi + lo = a + b exactly
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static void two_sum(register_type const &a, register_type const &b,
+                          register_type &hi, register_type &lo)
+      {
+        hi = a.add(b);
+        register_type bb = hi.subtract(a);
+        lo = a.subtract(hi.subtract(bb)).add(b.subtract(bb));
+      }
+
+      /*!
+       * hi + lo = a + b exactly, requires |a| >= |b|
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static void fast_two_sum(register_type const &a, register_type const &b,
+                               register_type &hi, register_type &lo)
+      {
+        hi = a.add(b);
+        lo = b.subtract(hi.subtract(a));
+      }
+
+      /*!
+       * hi + lo = a exactly, where hi and lo each have half of the bits
+       *
+       * This is Veltkamp's splitting with c = a*(2^s+1) computed as
+       * a*2^s + a, whose product is exact.  The compiler may then contract
+       * any of the products here and in two_product into FMAs without
+       * changing the results.
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static void split(register_type const &a,
+                        register_type &hi, register_type &lo)
+      {
+        register_type c = a.multiply(s_value(traits::split())).add(a);
+        hi = c.subtract(c.subtract(a));
+        lo = a.subtract(hi);
+      }
+
+      /*!
+       * hi + lo = a * b exactly (Dekker's product, does not need an FMA)
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static void two_product(register_type const &a, register_type const &b,
+                              register_type &hi, register_type &lo)
+      {
+        register_type a_hi, a_lo, b_hi, b_lo;
+        split(a, a_hi, a_lo);
+        split(b, b_hi, b_lo);
+
+        hi = a.multiply(b);
+        lo = a_hi.multiply(b_hi).subtract(hi);
+        lo = lo.add(a_hi.multiply(b_lo));
+        lo = lo.add(a_lo.multiply(b_hi));
+        lo = lo.add(a_lo.multiply(b_lo));
+      }
+
+      /*!
+       * exp(hi + lo), where lo is at most an ulp of hi
+       */
+      template<int MAX_ULP>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static register_type exp_sum(register_type const &hi, register_type const &lo)
+      {
+        // clamp so that overflow and underflow come out of the final scaling
+        // as inf and zero
+        register_type x = hi.vmax(s_value(traits::exp_min_arg())).vmin(s_value(traits::exp_max_arg()));
+
+        register_type n = x.multiply(s_value(traits::log2e())).round();
+
+        // Cody-Waite reduction to r + r_lo, n*ln2_hi is exact
+        register_type t = x.subtract(n.multiply(s_value(traits::ln2_hi())));
+        register_type c = n.multiply(s_value(traits::ln2_lo()));
+        register_type r_hi = t.subtract(c);
+        register_type r_lo = t.subtract(r_hi).subtract(c);
+
+        // fold in lo, which can be much larger than r_lo
+        register_type r, lo_err;
+        two_sum(r_hi, lo.blend(s_value(0), x.cmp_ne(hi)), r, lo_err);
+        r_lo = r_lo.add(lo_err);
+
+        // exp(r) = 1 + (r + (r_lo + r^2 * Q(r))), the last two additions
+        // are the only rounding errors that are not scaled down by r
+        register_type q = RegisterMathHorner<RegisterMathExpCoef<element_type>,
+                                             register_type, 2,
+                                             traits::exp_degree(MAX_ULP)>::eval(r);
+        register_type p = r.add(r.multiply(r).multiply_add(q, r_lo)).add(s_value(1));
+
+        // scale by 2^n in two steps, so that both factors are normal
+        register_type n1 = n.multiply(s_value(0.5)).round();
+        p = p.ldexp(n1).ldexp(n.subtract(n1));
+
+        // NaN arguments pass through
+        return p.blend(hi, hi.cmp_ne(hi));
+      }
+
+      /*!
+       * x = m * 2^e for x > 0, with m in [sqrt(1/2), sqrt(2)), returns
+       * f = m-1, which is exact
+       *
+       * Subnormals are scaled before frexp.  Lanes of x that are zero,
+       * negative, infinite or NaN give unspecified values, which the
+       * callers replace.
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static register_type log_reduce(register_type const &x, register_type &e)
+      {
+        // bring subnormals into the normal range
+        mask_type tiny = x.cmp_lt(s_value(traits::min_normal()));
+        register_type xs = x.blend(x.multiply(s_value(traits::subnormal_scale())), tiny);
+
+        // x = m * 2^e with m in [1/2, 1)
+        register_type m = xs.frexp(e);
+        e = e.blend(e.subtract(s_value(traits::subnormal_bits())), tiny);
+
+        // move m into [sqrt(1/2), sqrt(2))
+        mask_type low = m.cmp_lt(s_value(traits::sqrt_half()));
+        m = m.blend(m.add(m), low);
+        e = e.blend(e.subtract(s_value(1)), low);
+
+        return m.subtract(s_value(1));
+      }
+
+      /*!
+       * s = f/u with its rounding error s_lo, where u = 2+f
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static register_type log_quotient_lo(register_type const &f,
+                                           register_type const &u,
+                                           register_type const &s)
+      {
+        // rounding error of 2+f, and the remainder of the division
+        register_type u_lo = f.subtract(u.subtract(s_value(2)));
+        register_type p_hi, p_lo;
+        two_product(s, u, p_hi, p_lo);
+        return f.subtract(p_hi).subtract(p_lo).subtract(s.multiply(u_lo)).divide(u);
+      }
+
+      /*!
+       * log(0) = -inf and log(inf) = inf
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static register_type log_special(register_type const &x,
+                                       register_type const &result,
+                                       register_type &lo)
+      {
+        mask_type zero = x.cmp_eq(s_value(0));
+        mask_type inf = x.cmp_eq(s_value(s_inf()));
+        lo = lo.blend(s_value(0), zero | inf);
+        return result.blend(s_value(-s_inf()), zero).blend(x, inf);
+      }
+
+      /*!
+       * log(x) = hi + lo for x >= 0, where lo is at most an ulp of hi.
+       *
+       * If COMPENSATED is false the rounding errors of the argument
+       * reduction are not tracked, and lo is zero.
+       */
+      template<int MAX_ULP, bool COMPENSATED>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static register_type log_sum(register_type const &x, register_type &lo)
+      {
+        register_type e;
+        register_type f = log_reduce(x, e);
+
+        // log(m) = 2s + s*R(s^2), with s = f/(2+f)
+        register_type u = f.add(s_value(2));
+        register_type s = f.divide(u);
+        register_type z = s.multiply(s);
+        register_type R = z.multiply(
+            RegisterMathHorner<RegisterMathLogCoef<element_type>,
+                               register_type, 0,
+                               traits::log_terms(MAX_ULP)-1>::eval(z));
+
+        // e*ln2_hi is exact
+        register_type tail = s.multiply(R).add(e.multiply(s_value(traits::ln2_lo())));
+
+        register_type result;
+        if(COMPENSATED){
+          register_type s_lo = log_quotient_lo(f, u, s);
+
+          register_type sum_hi, sum_lo;
+          two_sum(e.multiply(s_value(traits::ln2_hi())), s.add(s), sum_hi, sum_lo);
+          fast_two_sum(sum_hi, sum_lo.add(tail.add(s_lo.add(s_lo))), result, lo);
+        }
+        else{
+          result = e.multiply(s_value(traits::ln2_hi())).add(s.add(s).add(tail));
+          lo = s_value(0);
+        }
+
+        return log_special(x, result, lo);
+      }
+
+      /*!
+       * log(x) = hi + lo for x >= 0, with an error of about 2^-9 ulp, for
+       * pow.
+       *
+       * pow multiplies log(x) by y, which amplifies the error of log(x) by
+       * up to |y*log(x)|, several hundred before the result overflows.  The
+       * rounding of the s*R(s^2) term limits log_sum to about 2^-4 ulp, so
+       * here s^3 * 2/3 is carried as an unevaluated sum, and the rest of
+       * the atanh series to a higher degree.
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static register_type log_sum_extended(register_type const &x, register_type &lo)
+      {
+        register_type e;
+        register_type f = log_reduce(x, e);
+
+        // log(m) = 2s + s^3*(2/3 + z*T(z)), with s = f/(2+f) and z = s^2
+        register_type u = f.add(s_value(2));
+        register_type s = f.divide(u);
+        register_type s_lo = log_quotient_lo(f, u, s);
+
+        // s^3 = s3_hi + s3_lo, including the first order term of s_lo
+        register_type z, z_lo, s3_hi, s3_lo;
+        two_product(s, s, z, z_lo);
+        two_product(s, z, s3_hi, s3_lo);
+        s3_lo = s3_lo.add(s.multiply(z_lo)).add(s_value(3).multiply(z).multiply(s_lo));
+
+        register_type t = z.multiply(
+            RegisterMathHorner<RegisterMathAtanhCoef<element_type>,
+                               register_type, 1,
+                               traits::log_extended_degree()>::eval(z));
+
+        register_type c_hi = s_value(traits::two_thirds_hi());
+        register_type tail_hi, tail_lo;
+        two_product(s3_hi, c_hi, tail_hi, tail_lo);
+        tail_lo = tail_lo.add(s3_hi.multiply(t.add(s_value(traits::two_thirds_lo()))))
+                         .add(s3_lo.multiply(c_hi));
+
+        // e*ln2_hi + 2s + tail_hi exactly, the rest only needs to be
+        // accurate relative to itself
+        register_type sum_hi, sum_lo, a_hi, a_lo;
+        two_sum(e.multiply(s_value(traits::ln2_hi())), s.add(s), sum_hi, sum_lo);
+        two_sum(sum_hi, tail_hi, a_hi, a_lo);
+        register_type rest = sum_lo.add(a_lo).add(tail_lo).add(s_lo.add(s_lo))
+                                   .add(e.multiply(s_value(traits::ln2_lo())));
+
+        register_type result;
+        fast_two_sum(a_hi, rest, result, lo);
+
+        return log_special(x, result, lo);
+      }
+
+      template<int MAX_ULP>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static register_type exp(register_type const &x)
+      {
+        return exp_sum<MAX_ULP>(x, s_value(0));
+      }
+
+      template<int MAX_ULP>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static register_type log(register_type const &x)
+      {
+        register_type lo;
+        register_type result = log_sum<MAX_ULP, traits::log_compensated(MAX_ULP)>(x, lo);
+
+        // log of negative numbers and NaN is NaN
+        result = result.blend(s_value(s_nan()), x.cmp_lt(s_value(0)));
+        return result.blend(x, x.cmp_ne(x));
+      }
+
+      template<int MAX_ULP>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static register_type pow(register_type const &x, register_type const &y)
+      {
+        // y*log|x| as hi + lo
+        register_type log_lo;
+        register_type log_hi = log_sum_extended(x.abs(), log_lo);
+
+        register_type p_hi, p_lo;
+        two_product(y, log_hi, p_hi, p_lo);
+        register_type hi, lo;
+        fast_two_sum(p_hi, p_lo.add(y.multiply(log_lo)), hi, lo);
+
+        // the low part is inf or NaN when the product overflows or is
+        // infinite, and exp(p_hi) is then 0 or inf anyway
+        mask_type huge = p_hi.abs().cmp_gt(s_value(-traits::exp_min_arg())) | hi.cmp_ne(hi);
+        hi = hi.blend(p_hi, huge);
+        lo = lo.blend(s_value(0), huge);
+
+        // errors are 1.3 ulp, or 2.7 ulp with the shorter exp polynomial
+        register_type result = exp_sum<(MAX_ULP >= 4 ? MAX_ULP : 1)>(hi, lo);
+
+        // sign and special cases of IEEE pow
+        register_type zero = s_value(0);
+        register_type one = s_value(1);
+        register_type half_y = y.multiply(s_value(0.5));
+        mask_type y_int = y.round().cmp_eq(y);
+        mask_type y_odd = y_int & half_y.round().cmp_ne(half_y);
+
+        // x < 0, including -0
+        mask_type x_neg = x.cmp_lt(zero) | (x.cmp_eq(zero) & one.divide(x).cmp_lt(zero));
+
+        // negated by a multiply, so that zero results become -0
+        result = result.blend(result.multiply(s_value(-1)), x_neg & y_odd);
+
+        mask_type x_finite_neg = x.cmp_lt(zero) & x.cmp_gt(s_value(-s_inf()));
+        result = result.blend(s_value(s_nan()), x_finite_neg & ~y_int);
+
+        // NaN arguments, the log above need not pass them through
+        result = result.blend(x.add(y), x.cmp_ne(x) | y.cmp_ne(y));
+
+        mask_type one_result = y.cmp_eq(zero) | x.cmp_eq(one) |
+            (x.cmp_eq(s_value(-1)) & y.abs().cmp_eq(s_value(s_inf())));
+        return result.blend(one, one_result);
+      }
+  };
+
+} // namespace expt
+} // namespace internal
+} // namespace RAJA
+
+
+#endif
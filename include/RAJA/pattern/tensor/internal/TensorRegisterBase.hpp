@@ -24,7 +24,9 @@
 
 #include "camp/camp.hpp"
 #include "RAJA/pattern/tensor/TensorLayout.hpp"
+#include "RAJA/pattern/tensor/TensorMask.hpp"
 #include "RAJA/pattern/tensor/internal/TensorRef.hpp"
+#include "RAJA/pattern/tensor/stats.hpp"
 
 namespace RAJA
 {
@@ -125,6 +127,13 @@ namespace expt
 
       using register_policy = REGISTER_POLICY;
 
+      static constexpr camp::idx_t s_register_lanes = RegisterTraits<REGISTER_POLICY,T>::s_num_elem;
+
+      /*!
+       * One bit per register lane, lane l of register r is bit r*s_register_lanes+l
+       */
+      using mask_type = RAJA::expt::TensorMask<s_num_registers*s_register_lanes>;
+
     private:
 
       RAJA_HOST_DEVICE
@@ -346,6 +355,8 @@ namespace expt
       RAJA_INLINE
       self_type add(self_type const &mat) const {
         self_type result;
+        RAJA_TENSOR_STAT(num_vector_add, 0, 0, RAJA::product<camp::idx_t>(SIZES...));
+
         for(camp::idx_t i = 0;i < s_num_registers;++ i){
           result.vec(i) = m_registers[i].add(mat.vec(i));
         }
@@ -356,6 +367,8 @@ namespace expt
       RAJA_INLINE
       self_type subtract(self_type const &mat) const {
         self_type result;
+        RAJA_TENSOR_STAT(num_vector_subtract, 0, 0, RAJA::product<camp::idx_t>(SIZES...));
+
         for(camp::idx_t i = 0;i < s_num_registers;++ i){
           result.vec(i) = m_registers[i].subtract(mat.vec(i));
         }
@@ -370,6 +383,8 @@ namespace expt
       RAJA_INLINE
       self_type multiply(self_type const &x) const {
         self_type result;
+        RAJA_TENSOR_STAT(num_vector_multiply, 0, 0, RAJA::product<camp::idx_t>(SIZES...));
+
         for(camp::idx_t i = 0;i < s_num_registers;++ i){
           result.vec(i) = m_registers[i].multiply(x.vec(i));
         }
@@ -383,6 +398,8 @@ namespace expt
       RAJA_INLINE
       self_type multiply_add(self_type const &x, self_type const &add) const {
         self_type result;
+        RAJA_TENSOR_STAT(num_vector_fma, 0, 0, 2*RAJA::product<camp::idx_t>(SIZES...));
+
         for(camp::idx_t i = 0;i < s_num_registers;++ i){
           result.vec(i) = m_registers[i].multiply_add(x.vec(i), add.vec(i));
         }
@@ -393,6 +410,8 @@ namespace expt
       RAJA_INLINE
       self_type divide(self_type const &mat) const {
         self_type result;
+        RAJA_TENSOR_STAT(num_vector_divide, 0, 0, RAJA::product<camp::idx_t>(SIZES...));
+
         for(camp::idx_t reg = 0;reg < s_num_registers;++ reg){
           result.vec(reg) = m_registers[reg].divide(mat.vec(reg));
         }
@@ -411,6 +430,8 @@ namespace expt
       element_type dot(self_type const &x) const
       {
         element_type result(0);
+        RAJA_TENSOR_STAT(num_vector_dot, 0, 0, 2*RAJA::product<camp::idx_t>(SIZES...));
+
 
         for(camp::idx_t reg = 0;reg < s_num_registers;++ reg){
           result += m_registers[reg].multiply(x.vec(reg)).sum();
@@ -700,6 +721,188 @@ namespace expt
 
 
 
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type cmp_eq(self_type const &x) const {
+        mask_type mask;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          mask.set_bits(m_registers[i].cmp_eq(x.vec(i)).get_bits(0, s_register_lanes),
+                        i*s_register_lanes, s_register_lanes);
+        }
+        return mask;
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is not equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type cmp_ne(self_type const &x) const {
+        mask_type mask;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          mask.set_bits(m_registers[i].cmp_ne(x.vec(i)).get_bits(0, s_register_lanes),
+                        i*s_register_lanes, s_register_lanes);
+        }
+        return mask;
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is less than x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type cmp_lt(self_type const &x) const {
+        mask_type mask;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          mask.set_bits(m_registers[i].cmp_lt(x.vec(i)).get_bits(0, s_register_lanes),
+                        i*s_register_lanes, s_register_lanes);
+        }
+        return mask;
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is less than or equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type cmp_le(self_type const &x) const {
+        mask_type mask;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          mask.set_bits(m_registers[i].cmp_le(x.vec(i)).get_bits(0, s_register_lanes),
+                        i*s_register_lanes, s_register_lanes);
+        }
+        return mask;
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is greater than x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type cmp_gt(self_type const &x) const {
+        mask_type mask;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          mask.set_bits(m_registers[i].cmp_gt(x.vec(i)).get_bits(0, s_register_lanes),
+                        i*s_register_lanes, s_register_lanes);
+        }
+        return mask;
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is greater than or equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type cmp_ge(self_type const &x) const {
+        mask_type mask;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          mask.set_bits(m_registers[i].cmp_ge(x.vec(i)).get_bits(0, s_register_lanes),
+                        i*s_register_lanes, s_register_lanes);
+        }
+        return mask;
+      }
+
+      /*!
+       * @brief Element-wise select: b in the lanes where mask is set, and
+       * (*this) in the others
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type blend(self_type const &b, mask_type const &mask) const {
+        using register_mask_type = typename register_type::mask_type;
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].blend(b.vec(i),
+              register_mask_type::s_from_bits(mask.get_bits(i*s_register_lanes, s_register_lanes)));
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Element-wise absolute value
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type abs() const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].abs();
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Element-wise square root
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type sqrt() const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].sqrt();
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Element-wise reciprocal square root
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type rsqrt() const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].rsqrt();
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Element-wise exponential, see RAJA::expt::math_accuracy
+       */
+      template<typename ACCURACY = RAJA::expt::math_accurate>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type exp() const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].template exp<ACCURACY>();
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Element-wise natural logarithm, see RAJA::expt::math_accuracy
+       */
+      template<typename ACCURACY = RAJA::expt::math_accurate>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type log() const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].template log<ACCURACY>();
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Element-wise (*this) to the power y
+       */
+      template<typename ACCURACY = RAJA::expt::math_accurate>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type pow(self_type const &y) const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].template pow<ACCURACY>(y.vec(i));
+        }
+        return result;
+      }
+
+
       RAJA_HOST_DEVICE
       RAJA_INLINE
       register_type &vec(int i){
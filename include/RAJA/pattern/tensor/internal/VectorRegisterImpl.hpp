@@ -47,6 +47,7 @@ namespace expt
       using element_type = camp::decay<T>;
       using layout_type = TensorLayout<0>;
       using register_type = Register<T, REGISTER_POLICY>;
+      using mask_type = typename base_type::mask_type;
 
       static constexpr camp::idx_t s_num_elem = SIZE;
 
@@ -256,16 +257,12 @@ namespace expt
             if(STRIDE_ONE_DIM == 0){
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
-              #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_packed ++;
-              #endif
+                RAJA_TENSOR_STAT(num_vector_load_packed, self_type::s_num_elem*sizeof(*ptr), 0, 0);
                 self.load_packed(ptr);
               }
               // partial
               else{
-              #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_packed_n ++;
-              #endif
+                RAJA_TENSOR_STAT(num_vector_load_packed_n, ref.m_tile.m_size[0]*sizeof(*ptr), 0, 0);
                 self.load_packed_n(ptr, ref.m_tile.m_size[0]);
               }
     
@@ -275,16 +272,12 @@ namespace expt
             {
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
-              #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_strided ++;
-              #endif
+                RAJA_TENSOR_STAT(num_vector_load_strided, self_type::s_num_elem*sizeof(*ptr), 0, 0);
                 self.load_strided(ptr, ref.m_stride[0]);
               }
               // partial
               else{
-              #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_strided_n ++;
-              #endif
+                RAJA_TENSOR_STAT(num_vector_load_strided_n, ref.m_tile.m_size[0]*sizeof(*ptr), 0, 0);
                 self.load_strided_n(ptr, ref.m_stride[0], ref.m_tile.m_size[0]);
               }
             }
@@ -305,16 +298,12 @@ namespace expt
             if(STRIDE_ONE_DIM == 0){
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
-    #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_packed ++;
-    #endif
+                RAJA_TENSOR_STAT(num_vector_store_packed, 0, self_type::s_num_elem*sizeof(*ptr), 0);
                 self.store_packed(ptr);
               }
               // partial
               else{
-    #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_packed_n ++;
-    #endif
+                RAJA_TENSOR_STAT(num_vector_store_packed_n, 0, ref.m_tile.m_size[0]*sizeof(*ptr), 0);
                 self.store_packed_n(ptr, ref.m_tile.m_size[0]);
               }
     
@@ -324,16 +313,12 @@ namespace expt
             {
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
-    #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_strided ++;
-    #endif
+                RAJA_TENSOR_STAT(num_vector_store_strided, 0, self_type::s_num_elem*sizeof(*ptr), 0);
                 self.store_strided(ptr, ref.m_stride[0]);
               }
               // partial
               else{
-    #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_strided_n ++;
-    #endif
+                RAJA_TENSOR_STAT(num_vector_store_strided_n, 0, ref.m_tile.m_size[0]*sizeof(*ptr), 0);
                 self.store_strided_n(ptr, ref.m_stride[0], ref.m_tile.m_size[0]);
               }
             }
@@ -366,16 +351,12 @@ namespace expt
             if(STRIDE_ONE_DIM == 0){
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
-              #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_packed ++;
-              #endif
+                RAJA_TENSOR_STAT(num_vector_load_packed, self_type::s_num_elem*sizeof(*ptr), 0, 0);
                 self.load_packed(ptr);
               }
               // partial
               else{
-              #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_packed_n ++;
-              #endif
+                RAJA_TENSOR_STAT(num_vector_load_packed_n, ref.m_tile.m_size[0]*sizeof(*ptr), 0, 0);
                 self.load_packed_n(ptr, ref.m_tile.m_size[0]);
               }
     
@@ -385,16 +366,12 @@ namespace expt
             {
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
-              #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_strided ++;
-              #endif
+                RAJA_TENSOR_STAT(num_vector_load_strided, self_type::s_num_elem*sizeof(*ptr), 0, 0);
                 self.load_strided(ptr, ref.m_stride[0]);
               }
               // partial
               else{
-              #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_strided_n ++;
-              #endif
+                RAJA_TENSOR_STAT(num_vector_load_strided_n, ref.m_tile.m_size[0]*sizeof(*ptr), 0, 0);
                 self.load_strided_n(ptr, ref.m_stride[0], ref.m_tile.m_size[0]);
               }
             }
@@ -415,16 +392,12 @@ namespace expt
             if(STRIDE_ONE_DIM == 0){
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
-    #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_packed ++;
-    #endif
+                RAJA_TENSOR_STAT(num_vector_store_packed, 0, self_type::s_num_elem*sizeof(*ptr), 0);
                 self.store_packed(ptr);
               }
               // partial
               else{
-    #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_packed_n ++;
-    #endif
+                RAJA_TENSOR_STAT(num_vector_store_packed_n, 0, ref.m_tile.m_size[0]*sizeof(*ptr), 0);
                 self.store_packed_n(ptr, ref.m_tile.m_size[0]);
               }
     
@@ -434,16 +407,12 @@ namespace expt
             {
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
-    #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_strided ++;
-    #endif
+                RAJA_TENSOR_STAT(num_vector_store_strided, 0, self_type::s_num_elem*sizeof(*ptr), 0);
                 self.store_strided(ptr, ref.m_stride[0]);
               }
               // partial
               else{
-    #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_strided_n ++;
-    #endif
+                RAJA_TENSOR_STAT(num_vector_store_strided_n, 0, ref.m_tile.m_size[0]*sizeof(*ptr), 0);
                 self.store_strided_n(ptr, ref.m_stride[0], ref.m_tile.m_size[0]);
               }
             }
@@ -620,6 +589,26 @@ namespace expt
         return *this;
       }
 
+      /*!
+       * @brief Store the elements where mask is set to consecutive memory
+       * locations, other locations are not touched
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const
+      {
+        using register_mask_type = typename register_type::mask_type;
+        for(camp::idx_t reg = 0;reg < s_num_full_registers;++ reg){
+          m_registers[reg].store_packed_masked(ptr+reg*s_register_num_elem,
+              register_mask_type::s_from_bits(mask.get_bits(reg*s_register_num_elem, s_register_num_elem)));
+        }
+        if(s_num_partial_lanes){
+          m_registers[s_final_register].store_packed_masked(ptr+s_final_register*s_register_num_elem,
+              register_mask_type::s_from_bits(mask.get_bits(s_final_register*s_register_num_elem, s_num_partial_lanes)));
+        }
+        return *this;
+      }
+
       /*!
        * Loads a strided full vector from memory
        */
@@ -27,60 +27,154 @@
 #include "RAJA/config.hpp"
 #include "camp/camp.hpp"
 
+#include "RAJA/util/macros.hpp"
+
 namespace RAJA
 {
 namespace expt
 {
+
+/*!
+ * Statistics on tensor register operations.
+ *
+ * Counts are kept per thread and per kernel. Each thread attributes its
+ * operations to the innermost kernel it opened with beginKernel, or a
+ * KernelScope. Host forall loops given a RAJA::expt::KernelName parameter
+ * open one on the calling thread for the duration of the loop, and their
+ * OpenMP and TBB worker threads enter it too. Each kernel records operation
+ * counts, bytes loaded and stored, and flops, so printVectorStats can report
+ * the arithmetic intensity of every kernel and how much of its traffic used
+ * strided instead of packed loads and stores.
+ *
+ * The reset, get and print functions must not be called while tensor
+ * operations are running on other threads.
+ */
 struct tensor_stats
 {
-    static int indent;
-
-  static camp::idx_t num_vector_copy;
-  static camp::idx_t num_vector_copy_ctor;
-  static camp::idx_t num_vector_broadcast_ctor;
-
-  static camp::idx_t num_vector_load_packed;
-  static camp::idx_t num_vector_load_packed_n;
-  static camp::idx_t num_vector_load_strided;
-  static camp::idx_t num_vector_load_strided_n;
-
-  static camp::idx_t num_vector_store_packed;
-  static camp::idx_t num_vector_store_packed_n;
-  static camp::idx_t num_vector_store_strided;
-  static camp::idx_t num_vector_store_strided_n;
-
-  static camp::idx_t num_vector_broadcast;
-
-  static camp::idx_t num_vector_get;
-  static camp::idx_t num_vector_set;
-
-  static camp::idx_t num_vector_add;
-  static camp::idx_t num_vector_subtract;
-  static camp::idx_t num_vector_multiply;
-  static camp::idx_t num_vector_divide;
-
-  static camp::idx_t num_vector_fma;
-  static camp::idx_t num_vector_fms;
-
-  static camp::idx_t num_vector_sum;
-  static camp::idx_t num_vector_max;
-  static camp::idx_t num_vector_min;
-  static camp::idx_t num_vector_vmax;
-  static camp::idx_t num_vector_vmin;
-  static camp::idx_t num_vector_dot;
-
-
-  static camp::idx_t num_matrix_mm_mult_row_row;
-  static camp::idx_t num_matrix_mm_multacc_row_row;
-  static camp::idx_t num_matrix_mm_mult_col_col;
-  static camp::idx_t num_matrix_mm_multacc_col_col;
+  enum stat_id : int {
+    num_vector_copy,
+    num_vector_copy_ctor,
+    num_vector_broadcast_ctor,
+
+    num_vector_load_packed,
+    num_vector_load_packed_n,
+    num_vector_load_strided,
+    num_vector_load_strided_n,
+
+    num_vector_store_packed,
+    num_vector_store_packed_n,
+    num_vector_store_strided,
+    num_vector_store_strided_n,
+
+    num_vector_broadcast,
+
+    num_vector_get,
+    num_vector_set,
+
+    num_vector_add,
+    num_vector_subtract,
+    num_vector_multiply,
+    num_vector_divide,
+
+    num_vector_fma,
+    num_vector_fms,
+
+    num_vector_sum,
+    num_vector_max,
+    num_vector_min,
+    num_vector_vmax,
+    num_vector_vmin,
+    num_vector_dot,
+
+    num_matrix_load_packed,
+    num_matrix_load_strided,
+    num_matrix_store_packed,
+    num_matrix_store_strided,
+
+    num_matrix_mm_mult_row_row,
+    num_matrix_mm_multacc_row_row,
+    num_matrix_mm_mult_col_col,
+    num_matrix_mm_multacc_col_col,
+
+    num_stat_ids
+  };
+
+  struct counters
+  {
+    camp::idx_t count[num_stat_ids];
+    camp::idx_t bytes_loaded;
+    camp::idx_t bytes_stored;
+    camp::idx_t flops;
+  };
+
+  //! add an operation to the calling thread's counters for the current kernel
+  static void record(stat_id id,
+                     camp::idx_t bytes_loaded,
+                     camp::idx_t bytes_stored,
+                     camp::idx_t flops);
+
+  //! attribute the calling thread's operations to the named kernel until
+  //  the matching endKernel
+  static void beginKernel(const char* name);
+  //! as beginKernel, for a kernel id returned by currentKernel
+  static void enterKernel(int id);
+  static void endKernel();
+
+  //! id of the innermost kernel open on the calling thread, 0 if none
+  static int currentKernel();
+
+  //! counters of the named kernel summed over threads, operations outside
+  //  of any kernel are under the name ""
+  static counters getKernelStats(const char* name);
 
   static void resetVectorStats();
   static void printVectorStats();
 
+  //! opens a kernel for the lifetime of the object
+  class KernelScope
+  {
+  public:
+    explicit KernelScope(const char* name) { beginKernel(name); }
+    explicit KernelScope(int id) { enterKernel(id); }
+    ~KernelScope() { endKernel(); }
+
+    KernelScope(KernelScope const&) = delete;
+    KernelScope& operator=(KernelScope const&) = delete;
+  };
 };
 
 } // namespace expt
 } // namespace RAJA
 
+
+/*!
+ * Record a tensor operation when RAJA_ENABLE_VECTOR_STATS is defined,
+ * device code does not record.
+ */
+#if defined(RAJA_ENABLE_VECTOR_STATS) && !defined(RAJA_DEVICE_CODE)
+#define RAJA_TENSOR_STAT(STAT, BYTES_LOADED, BYTES_STORED, FLOPS)       \
+  ::RAJA::expt::tensor_stats::record(::RAJA::expt::tensor_stats::STAT, \
+                                     (BYTES_LOADED),                   \
+                                     (BYTES_STORED),                   \
+                                     (FLOPS))
+#else
+#define RAJA_TENSOR_STAT(STAT, BYTES_LOADED, BYTES_STORED, FLOPS)
+#endif
+
+/*!
+ * Carry the kernel open on the thread that starts a parallel host loop into
+ * the threads running the loop: RAJA_TENSOR_STAT_KERNEL_CAPTURE(ID) declares
+ * ID on the starting thread and RAJA_TENSOR_STAT_KERNEL_ENTER(ID) enters the
+ * kernel until the end of the enclosing scope on a running thread.
+ */
+#if defined(RAJA_ENABLE_VECTOR_STATS) && !defined(RAJA_DEVICE_CODE)
+#define RAJA_TENSOR_STAT_KERNEL_CAPTURE(ID) \
+  const int ID = ::RAJA::expt::tensor_stats::currentKernel()
+#define RAJA_TENSOR_STAT_KERNEL_ENTER(ID) \
+  ::RAJA::expt::tensor_stats::KernelScope ID##_scope(ID)
+#else
+#define RAJA_TENSOR_STAT_KERNEL_CAPTURE(ID)
+#define RAJA_TENSOR_STAT_KERNEL_ENTER(ID)
+#endif
+
 #endif
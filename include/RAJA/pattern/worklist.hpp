@@ -0,0 +1,109 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA worklist declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_worklist_HPP
+#define RAJA_worklist_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/detail/worklist.hpp"
+
+namespace RAJA
+{
+
+/*!
+******************************************************************************
+*
+* \brief  worklist execution pattern
+*
+*         Calls body(item, ctx) for each item in items, where body may add
+*         new items with ctx.push(item). Returns when all items, initial
+*         and pushed, have been processed. Items are processed in no
+*         particular order; host parallel policies run them from per
+*         thread deques with work stealing, with no barriers between
+*         generations of items.
+*
+*         Items must be trivially copyable, e.g. indices.
+*
+* \param[in] items RandomAccess Container or range of initial items
+* \param[in] body loop body, body(T const& item, RAJA::WorklistContext<T>& ctx)
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename Body,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>>
+worklist(Container&& items, Body&& body)
+{
+  using std::begin;
+  using std::end;
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  Res r = Res::get_default();
+  return impl::worklist::unordered(r, ExecPolicy{},
+                                   begin(items), end(items),
+                                   std::forward<Body>(body));
+}
+
+/*!
+******************************************************************************
+*
+* \brief  level synchronous worklist execution pattern
+*
+*         Like worklist, but the items pushed while processing one level
+*         of items form the next level, which starts after the whole level
+*         is done. ctx.level() gives the level of the current item.
+*
+* \param[in] items RandomAccess Container or range of level 0 items
+* \param[in] body loop body, body(T const& item, RAJA::WorklistContext<T>& ctx)
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename Body,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>>
+worklist_levels(Container&& items, Body&& body)
+{
+  using std::begin;
+  using std::end;
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  Res r = Res::get_default();
+  return impl::worklist::levels(r, ExecPolicy{},
+                                begin(items), end(items),
+                                std::forward<Body>(body));
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
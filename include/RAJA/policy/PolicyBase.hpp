@@ -123,6 +123,10 @@ namespace reduce
 struct ordered {
 };
 
+//! results are bitwise identical for any thread count or schedule
+struct reproducible {
+};
+
 }  // namespace reduce
 
 
@@ -20,6 +20,9 @@
 
 #include "RAJA/config.hpp"
 
+#include <atomic>
+#include <type_traits>
+
 #include "RAJA/util/TypeConvert.hpp"
 #include "RAJA/util/macros.hpp"
 
@@ -233,6 +236,56 @@ RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_CAS_oper_sc(T volatile *acc,
 }
 
 
+/*!
+ * Atomic add using a native fetch and add where one is available.
+ * Integral types use the builtin fetch and add, float and double use
+ * std::atomic_ref when the standard library provides it, which may use an
+ * instruction the CAS loop can not. Other types, including bool, use the CAS
+ * loop.
+ * Returns the OLD value that was replaced by the result of this operation.
+ */
+template <typename T>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<std::is_integral<T>::value &&
+                                !std::is_same<T, bool>::value,
+                            T>::type
+    builtin_atomic_fetch_add(T volatile *acc, T value)
+{
+#if defined(RAJA_COMPILER_MSVC) || (defined(_WIN32) && defined(__INTEL_COMPILER))
+  return builtin_atomic_CAS_oper(acc, [=](T a) { return a + value; });
+#else
+  return __atomic_fetch_add(acc, value, __ATOMIC_ACQ_REL);
+#endif
+}
+
+template <typename T>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<std::is_same<T, float>::value ||
+                                std::is_same<T, double>::value,
+                            T>::type
+    builtin_atomic_fetch_add(T volatile *acc, T value)
+{
+#if defined(__cpp_lib_atomic_ref) && !defined(__HIP_DEVICE_COMPILE__)
+  return std::atomic_ref<T>(*const_cast<T *>(acc))
+      .fetch_add(value, std::memory_order_acq_rel);
+#else
+  return builtin_atomic_CAS_oper(acc, [=](T a) { return a + value; });
+#endif
+}
+
+template <typename T>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<(!std::is_integral<T>::value ||
+                                 std::is_same<T, bool>::value) &&
+                                !std::is_same<T, float>::value &&
+                                !std::is_same<T, double>::value,
+                            T>::type
+    builtin_atomic_fetch_add(T volatile *acc, T value)
+{
+  return builtin_atomic_CAS_oper(acc, [=](T a) { return a + value; });
+}
+
+
 }  // namespace detail
 
 
@@ -241,7 +294,7 @@ RAJA_DEVICE_HIP RAJA_INLINE T atomicAdd(builtin_atomic,
                                         T volatile *acc,
                                         T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a + value; });
+  return detail::builtin_atomic_fetch_add(acc, value);
 }
 
 
@@ -0,0 +1,304 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the write combining atomic policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_atomic_combining_HPP
+#define RAJA_policy_atomic_combining_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "RAJA/policy/atomic_builtin.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Host atomic policy that combines repeated updates to the same address.
+ *
+ * Through an AtomicViewWrapper each copy of the view keeps a small direct
+ * mapped cache, indexed by a hash of the address, of pending adds. Adds to
+ * a cached address are combined locally and written with FlushPolicy atomics
+ * when the entry is evicted or the view copy is destroyed. RAJA host loops,
+ * with or without expt:: parameters, give every thread its own copy of the
+ * loop body, and destroy those copies before returning, so all updates are
+ * visible when the loop returns.
+ *
+ * The view must be captured by value.
+ *
+ * Used through the atomicXXX functions or an AtomicRef the policy performs
+ * FlushPolicy atomics without combining, since those return the old value.
+ */
+template <typename FlushPolicy, size_t CacheEntries = 64>
+struct combining_atomic_explicit {
+};
+
+//! Write combining atomic policy flushing with builtin atomics
+using combining_atomic = combining_atomic_explicit<builtin_atomic>;
+
+
+namespace detail
+{
+
+/*!
+ * Direct mapped cache of pending atomic adds owned by one thread.
+ *
+ * Copies start empty, so each pending add is flushed exactly once by the
+ * object that recorded it.
+ */
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+class CombiningAtomicCache
+{
+  static_assert(CacheEntries > 0 && (CacheEntries & (CacheEntries - 1)) == 0,
+                "combining atomic cache size must be a power of two");
+
+public:
+  CombiningAtomicCache() = default;
+
+  CombiningAtomicCache(CombiningAtomicCache const&) {}
+
+  CombiningAtomicCache& operator=(CombiningAtomicCache const&)
+  {
+    flush();
+    return *this;
+  }
+
+  ~CombiningAtomicCache() { flush(); }
+
+  RAJA_INLINE void add(T* ptr, T value)
+  {
+    const size_t slot = hash(ptr);
+    if (m_ptrs[slot] == ptr) {
+      m_vals[slot] += value;
+    } else {
+      if (m_ptrs[slot] != nullptr) {
+        atomicAdd(FlushPolicy{}, m_ptrs[slot], m_vals[slot]);
+      }
+      m_ptrs[slot] = ptr;
+      m_vals[slot] = value;
+    }
+  }
+
+  //! write the pending add to ptr, if any
+  RAJA_INLINE void flush(T* ptr)
+  {
+    const size_t slot = hash(ptr);
+    if (m_ptrs[slot] == ptr) {
+      atomicAdd(FlushPolicy{}, m_ptrs[slot], m_vals[slot]);
+      m_ptrs[slot] = nullptr;
+    }
+  }
+
+  //! drop the pending add to ptr, if any
+  RAJA_INLINE void discard(T* ptr)
+  {
+    const size_t slot = hash(ptr);
+    if (m_ptrs[slot] == ptr) {
+      m_ptrs[slot] = nullptr;
+    }
+  }
+
+  //! write all pending adds
+  void flush()
+  {
+    for (size_t slot = 0; slot < CacheEntries; ++slot) {
+      if (m_ptrs[slot] != nullptr) {
+        atomicAdd(FlushPolicy{}, m_ptrs[slot], m_vals[slot]);
+        m_ptrs[slot] = nullptr;
+      }
+    }
+  }
+
+private:
+  T* m_ptrs[CacheEntries] = {};
+  T m_vals[CacheEntries];
+
+  static constexpr int log2_entries(size_t n)
+  {
+    return n <= 1 ? 0 : 1 + log2_entries(n / 2);
+  }
+
+  //! Fibonacci hash of the element index, so strided addresses spread out
+  RAJA_INLINE static size_t hash(T* ptr)
+  {
+    constexpr int bits = log2_entries(CacheEntries);
+    const std::uint64_t idx =
+        static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(ptr) /
+                                   sizeof(T));
+    return bits == 0
+               ? 0
+               : static_cast<size_t>((idx * 0x9E3779B97F4A7C15ull) >>
+                                     (64 - bits));
+  }
+};
+
+/*!
+ * Reference to a value updated through a combining atomic view.
+ *
+ * Adds are buffered so the compound assignments do not return a value.
+ * Loads and stores see the adds made through the same view copy.
+ */
+template <typename T, typename Cache>
+class CombiningAtomicRef
+{
+public:
+  using value_type = T;
+
+  RAJA_INLINE CombiningAtomicRef(Cache& cache, T* ptr)
+      : m_cache(cache), m_ptr(ptr)
+  {
+  }
+
+  CombiningAtomicRef& operator=(CombiningAtomicRef const&) = delete;
+
+  RAJA_INLINE void operator+=(T rhs) const { m_cache.add(m_ptr, rhs); }
+
+  RAJA_INLINE void operator-=(T rhs) const { m_cache.add(m_ptr, -rhs); }
+
+  RAJA_INLINE T operator=(T rhs) const
+  {
+    m_cache.discard(m_ptr);
+    *m_ptr = rhs;
+    return rhs;
+  }
+
+  RAJA_INLINE T load() const
+  {
+    m_cache.flush(m_ptr);
+    return *m_ptr;
+  }
+
+  RAJA_INLINE operator T() const { return load(); }
+
+private:
+  Cache& m_cache;
+  T* m_ptr;
+};
+
+}  // namespace detail
+
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicAdd(combining_atomic_explicit<FlushPolicy, CacheEntries>,
+                        T volatile *acc,
+                        T value)
+{
+  return atomicAdd(FlushPolicy{}, acc, value);
+}
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicSub(combining_atomic_explicit<FlushPolicy, CacheEntries>,
+                        T volatile *acc,
+                        T value)
+{
+  return atomicSub(FlushPolicy{}, acc, value);
+}
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicMin(combining_atomic_explicit<FlushPolicy, CacheEntries>,
+                        T volatile *acc,
+                        T value)
+{
+  return atomicMin(FlushPolicy{}, acc, value);
+}
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicMax(combining_atomic_explicit<FlushPolicy, CacheEntries>,
+                        T volatile *acc,
+                        T value)
+{
+  return atomicMax(FlushPolicy{}, acc, value);
+}
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicInc(combining_atomic_explicit<FlushPolicy, CacheEntries>,
+                        T volatile *acc)
+{
+  return atomicInc(FlushPolicy{}, acc);
+}
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicInc(combining_atomic_explicit<FlushPolicy, CacheEntries>,
+                        T volatile *acc,
+                        T compare)
+{
+  return atomicInc(FlushPolicy{}, acc, compare);
+}
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicDec(combining_atomic_explicit<FlushPolicy, CacheEntries>,
+                        T volatile *acc)
+{
+  return atomicDec(FlushPolicy{}, acc);
+}
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicDec(combining_atomic_explicit<FlushPolicy, CacheEntries>,
+                        T volatile *acc,
+                        T compare)
+{
+  return atomicDec(FlushPolicy{}, acc, compare);
+}
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicAnd(combining_atomic_explicit<FlushPolicy, CacheEntries>,
+                        T volatile *acc,
+                        T value)
+{
+  return atomicAnd(FlushPolicy{}, acc, value);
+}
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicOr(combining_atomic_explicit<FlushPolicy, CacheEntries>,
+                       T volatile *acc,
+                       T value)
+{
+  return atomicOr(FlushPolicy{}, acc, value);
+}
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicXor(combining_atomic_explicit<FlushPolicy, CacheEntries>,
+                        T volatile *acc,
+                        T value)
+{
+  return atomicXor(FlushPolicy{}, acc, value);
+}
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicExchange(
+    combining_atomic_explicit<FlushPolicy, CacheEntries>,
+    T volatile *acc,
+    T value)
+{
+  return atomicExchange(FlushPolicy{}, acc, value);
+}
+
+template <typename T, typename FlushPolicy, size_t CacheEntries>
+RAJA_INLINE T atomicCAS(combining_atomic_explicit<FlushPolicy, CacheEntries>,
+                        T volatile *acc,
+                        T compare,
+                        T value)
+{
+  return atomicCAS(FlushPolicy{}, acc, compare, value);
+}
+
+}  // namespace RAJA
+
+#endif
@@ -20,5 +20,6 @@
 
 #include "RAJA/policy/loop/WorkGroup/Dispatcher.hpp"
 #include "RAJA/policy/loop/WorkGroup/WorkRunner.hpp"
+#include "RAJA/policy/loop/WorkGroup/GraphRunner.hpp"
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,46 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA GraphRunner class specializations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_loop_WorkGroup_GraphRunner_HPP
+#define RAJA_loop_WorkGroup_GraphRunner_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+
+#include "RAJA/pattern/Graph/GraphRunner.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Runs the nodes of a graph level one after another
+ */
+template <>
+struct GraphRunner<RAJA::loop_work>
+    : GraphRunnerSerial
+{ };
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -19,6 +19,7 @@
 #define RAJA_pattern_launch_loop_HPP
 
 #include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/pattern/launch/launch_scratch.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
 #include "RAJA/policy/loop/policy.hpp"
 
@@ -45,11 +46,11 @@ struct LaunchExecute<RAJA::seq_launch_t> {
   {
     LaunchContext ctx;
 
-    ctx.shared_mem_ptr = (char*) malloc(params.shared_mem_size);
+    detail::LaunchScratchLease shared_mem(params.shared_mem_size);
+    ctx.shared_mem_ptr = shared_mem.get();
 
     body(ctx);
 
-    free(ctx.shared_mem_ptr);
     ctx.shared_mem_ptr = nullptr;
   }
 
@@ -60,17 +61,35 @@ struct LaunchExecute<RAJA::seq_launch_t> {
 
     LaunchContext ctx;
 
-    char *kernel_local_mem = new char[params.shared_mem_size];
-    ctx.shared_mem_ptr = kernel_local_mem;
+    detail::LaunchScratchLease shared_mem(params.shared_mem_size);
+    ctx.shared_mem_ptr = shared_mem.get();
 
     body(ctx);
 
-    delete[] kernel_local_mem;
     ctx.shared_mem_ptr = nullptr;
 
     return resources::EventProxy<resources::Resource>(res);
   }
 
+  template <typename BODY, typename ForallParam>
+  static concepts::enable_if<expt::type_traits::is_ForallParamPack<ForallParam>>
+  exec(LaunchParams const &params, ForallParam &f_params, BODY const &body)
+  {
+    using EXEC_POL = RAJA::seq_exec;
+    expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+
+    LaunchContext ctx;
+
+    detail::LaunchScratchLease shared_mem(params.shared_mem_size);
+    ctx.shared_mem_ptr = shared_mem.get();
+
+    expt::invoke_body(f_params, body, ctx);
+
+    ctx.shared_mem_ptr = nullptr;
+
+    expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+  }
+
 };
 
 template <typename SEGMENT>
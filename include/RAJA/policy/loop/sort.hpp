@@ -154,6 +154,50 @@ stable_pairs(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief select nth item of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+select(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter nth,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::intro_select(begin, nth, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief select nth item of given range of pairs using comparison
+               function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+select_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_nth,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  auto begin = RAJA::zip(keys_begin, vals_begin);
+  auto nth = RAJA::zip(keys_nth, vals_begin+(keys_nth-keys_begin));
+  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  RAJA::detail::intro_select(begin, nth, end, RAJA::compare_first<zip_ref>(comp));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace sort
 
 }  // namespace impl
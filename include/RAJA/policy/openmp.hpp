@@ -40,6 +40,7 @@
 #include "RAJA/policy/openmp/region.hpp"
 #include "RAJA/policy/openmp/scan.hpp"
 #include "RAJA/policy/openmp/sort.hpp"
+#include "RAJA/policy/openmp/worklist.hpp"
 #include "RAJA/policy/openmp/synchronize.hpp"
 #include "RAJA/policy/openmp/launch.hpp"
 #include "RAJA/policy/openmp/WorkGroup.hpp"
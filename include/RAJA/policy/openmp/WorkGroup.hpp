@@ -20,5 +20,6 @@
 
 #include "RAJA/policy/openmp/WorkGroup/Dispatcher.hpp"
 #include "RAJA/policy/openmp/WorkGroup/WorkRunner.hpp"
+#include "RAJA/policy/openmp/WorkGroup/GraphRunner.hpp"
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,67 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA GraphRunner class specializations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_openmp_WorkGroup_GraphRunner_HPP
+#define RAJA_openmp_WorkGroup_GraphRunner_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+#include "RAJA/pattern/Graph/GraphRunner.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Runs the independent nodes of a graph level concurrently, one node per
+ * OpenMP thread. A level with a single node is run on the calling thread so
+ * the node can use every thread for its own OpenMP policy.
+ */
+template <>
+struct GraphRunner<RAJA::omp_work>
+{
+  template < typename WorkContainer >
+  static void run_level(WorkContainer const& storage,
+                        const size_t* nodes,
+                        size_t num_nodes)
+  {
+    if (num_nodes < 2) {
+      GraphRunnerSerial::run_level(storage, nodes, num_nodes);
+      return;
+    }
+
+    using value_type = typename WorkContainer::value_type;
+
+    auto begin = storage.begin();
+    const long len = static_cast<long>(num_nodes);
+#pragma omp parallel for schedule(dynamic, 1)
+    for (long i = 0; i < len; ++i) {
+      value_type::host_call(&begin[nodes[i]]);
+    }
+  }
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
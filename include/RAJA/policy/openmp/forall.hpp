@@ -44,6 +44,7 @@
 #include "RAJA/pattern/region.hpp"
 
 #include "RAJA/pattern/params/forall.hpp"
+#include "RAJA/pattern/tensor/stats.hpp"
 
 #include "RAJA/policy/openmp/params/forall.hpp"
 
@@ -329,6 +330,229 @@ forall_impl(resources::Host host_res,
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// OpenMP taskloop policy implementation
+///
+
+namespace internal
+{
+
+  //
+  // Iterations per task, about four tasks per thread in the current team
+  // when the policy does not give a grainsize
+  //
+  template <int Grainsize, typename Diff>
+  RAJA_INLINE Diff taskloop_chunk(Diff distance)
+  {
+    if (Grainsize > 0) {
+      return static_cast<Diff>(Grainsize);
+    }
+    const Diff num_tasks = static_cast<Diff>(4 * omp_get_num_threads());
+    const Diff chunk = (distance + num_tasks - 1) / num_tasks;
+    return chunk > 0 ? chunk : Diff(1);
+  }
+
+  //
+  // One task, runs iterations [first, last) with a private copy of the body
+  //
+  template <typename Iterator, typename Diff, typename Func>
+  RAJA_INLINE void taskloop_task(Iterator begin_it,
+                                 Diff first,
+                                 Diff last,
+                                 Func const& loop_body)
+  {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto& body = privatizer.get_priv();
+    for (Diff i = first; i < last; ++i) {
+      body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp taskloop, one task per chunk of iterations
+  //
+  template <int Grainsize, typename Iterator, typename Diff, typename Func>
+  RAJA_INLINE void taskloop_generate(std::false_type,
+                                     Iterator begin_it,
+                                     Diff distance_it,
+                                     Func const& loop_body)
+  {
+    const Diff chunk = taskloop_chunk<Grainsize>(distance_it);
+    const Diff num_tasks = (distance_it + chunk - 1) / chunk;
+    #pragma omp taskloop grainsize(1) shared(loop_body)
+    for (Diff t = 0; t < num_tasks; ++t) {
+      const Diff last = (t + 1) * chunk;
+      taskloop_task(begin_it, t * chunk,
+                    last < distance_it ? last : distance_it, loop_body);
+    }
+  }
+
+  //
+  // omp taskloop nogroup, tasks take a copy of the body since they may run
+  // after the loop returns
+  //
+  template <int Grainsize, typename Iterator, typename Diff, typename Func>
+  RAJA_INLINE void taskloop_generate(std::true_type,
+                                     Iterator begin_it,
+                                     Diff distance_it,
+                                     Func const& loop_body)
+  {
+    const Diff chunk = taskloop_chunk<Grainsize>(distance_it);
+    const Diff num_tasks = (distance_it + chunk - 1) / chunk;
+    #pragma omp taskloop grainsize(1) nogroup firstprivate(loop_body)
+    for (Diff t = 0; t < num_tasks; ++t) {
+      const Diff last = (t + 1) * chunk;
+      taskloop_task(begin_it, t * chunk,
+                    last < distance_it ? last : distance_it, loop_body);
+    }
+  }
+
+  //
+  // The encountering thread generates the tasks, outside of a parallel
+  // region one thread of a new region does
+  //
+  template <int Grainsize, typename NoGroup, typename Iterable, typename Func>
+  RAJA_INLINE void forall_impl_taskloop(NoGroup nogroup,
+                                        Iterable&& iter,
+                                        Func const& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    if (omp_in_parallel()) {
+      taskloop_generate<Grainsize>(nogroup, begin_it, distance_it, loop_body);
+    } else {
+      #pragma omp parallel
+      #pragma omp single
+      taskloop_generate<Grainsize>(nogroup, begin_it, distance_it, loop_body);
+    }
+  }
+
+  //
+  // omp taskloop with forall parameters, each task combines its parameters
+  // into f_params. The loop always waits for its tasks so the parameters
+  // can be resolved.
+  //
+  template <typename ExecPol,
+            int Grainsize,
+            typename Iterator,
+            typename Diff,
+            typename Func,
+            typename ForallParam>
+  RAJA_INLINE void taskloop_generate_params(Iterator begin_it,
+                                            Diff distance_it,
+                                            Func const& loop_body,
+                                            ForallParam& f_params)
+  {
+    ForallParam init_params(f_params);
+    const Diff chunk = taskloop_chunk<Grainsize>(distance_it);
+    const Diff num_tasks = (distance_it + chunk - 1) / chunk;
+    #pragma omp taskloop grainsize(1) shared(loop_body, f_params, init_params)
+    for (Diff t = 0; t < num_tasks; ++t) {
+      const Diff last = (t + 1) * chunk < distance_it ? (t + 1) * chunk
+                                                      : distance_it;
+      ForallParam task_params(init_params);
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(loop_body);
+      auto& body = privatizer.get_priv();
+      for (Diff i = t * chunk; i < last; ++i) {
+        RAJA::expt::invoke_body(task_params, body, begin_it[i]);
+      }
+      #pragma omp critical(ompTaskloopParamCritical)
+      RAJA::expt::ParamMultiplexer::combine<ExecPol>(f_params, task_params);
+    }
+  }
+
+  template <typename ExecPol,
+            int Grainsize,
+            typename Iterable,
+            typename Func,
+            typename ForallParam>
+  RAJA_INLINE void forall_impl_taskloop_params(Iterable&& iter,
+                                               Func const& loop_body,
+                                               ForallParam& f_params)
+  {
+    RAJA::expt::ParamMultiplexer::init<ExecPol>(f_params);
+
+    RAJA_EXTRACT_BED_IT(iter);
+    if (omp_in_parallel()) {
+      taskloop_generate_params<ExecPol, Grainsize>(begin_it, distance_it, loop_body, f_params);
+    } else {
+      #pragma omp parallel
+      #pragma omp single
+      taskloop_generate_params<ExecPol, Grainsize>(begin_it, distance_it, loop_body, f_params);
+    }
+
+    RAJA::expt::ParamMultiplexer::resolve<ExecPol>(f_params);
+  }
+
+}  // end namespace internal
+
+template <typename Iterable, typename Func, int Grainsize, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_taskloop_exec<Grainsize>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  internal::forall_impl_taskloop<Grainsize>(std::false_type{}, std::forward<Iterable>(iter), loop_body);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Iterable, typename Func, int Grainsize, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_taskloop_nogroup_exec<Grainsize>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  internal::forall_impl_taskloop<Grainsize>(std::true_type{}, std::forward<Iterable>(iter), loop_body);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Iterable, typename Func, int Grainsize, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>>
+forall_impl(resources::Host host_res,
+            const omp_taskloop_exec<Grainsize>& p,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  using EXEC_POL = camp::decay<decltype(p)>;
+  internal::forall_impl_taskloop_params<EXEC_POL, Grainsize>(std::forward<Iterable>(iter), loop_body, f_params);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Iterable, typename Func, int Grainsize, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>>
+forall_impl(resources::Host host_res,
+            const omp_taskloop_nogroup_exec<Grainsize>& p,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  using EXEC_POL = camp::decay<decltype(p)>;
+  internal::forall_impl_taskloop_params<EXEC_POL, Grainsize>(std::forward<Iterable>(iter), loop_body, f_params);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
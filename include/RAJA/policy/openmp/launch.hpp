@@ -19,12 +19,19 @@
 #define RAJA_pattern_launch_openmp_HPP
 
 #include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/pattern/launch/launch_scratch.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/forall.hpp"
 
 
 namespace RAJA
 {
 
+/*!
+ * Every thread of the parallel region runs the launch body with its own
+ * dynamic shared memory, taken from the thread's LaunchScratch buffer so
+ * that repeated launches do not allocate.
+ */
 template <>
 struct LaunchExecute<RAJA::omp_launch_t> {
 
@@ -39,37 +46,117 @@ struct LaunchExecute<RAJA::omp_launch_t> {
         using RAJA::internal::thread_privatize;
         auto loop_body = thread_privatize(body);
 
-        ctx.shared_mem_ptr = (char*) malloc(params.shared_mem_size);
+        detail::LaunchScratchLease shared_mem(params.shared_mem_size);
+        ctx.shared_mem_ptr = shared_mem.get();
 
         loop_body.get_priv()(ctx);
 
-        free(ctx.shared_mem_ptr);
         ctx.shared_mem_ptr = nullptr;
     });
   }
 
   template <typename BODY>
   static resources::EventProxy<resources::Resource>
-  exec(RAJA::resources::Resource res, LaunchParams const &params, const char *, BODY const &body)
+  exec(RAJA::resources::Resource res, LaunchParams const &params, const char *kernel_name, BODY const &body)
   {
-    RAJA::region<RAJA::omp_parallel_region>([&]() {
+    exec(params, kernel_name, body);
 
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+  // Each thread runs the body with its own copy of the params, the copies
+  // are combined once at the end of the parallel region
+  template <typename BODY, typename ForallParam>
+  static concepts::enable_if<expt::type_traits::is_ForallParamPack<ForallParam>>
+  exec(LaunchParams const &params, ForallParam &f_params, BODY const &body)
+  {
+    using EXEC_POL = RAJA::omp_launch_t;
+    expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+    RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+#pragma omp parallel reduction(combine : f_params)
+    {
         LaunchContext ctx;
 
         using RAJA::internal::thread_privatize;
         auto loop_body = thread_privatize(body);
 
-        ctx.shared_mem_ptr = (char*) malloc(params.shared_mem_size);
+        detail::LaunchScratchLease shared_mem(params.shared_mem_size);
+        ctx.shared_mem_ptr = shared_mem.get();
 
-        loop_body.get_priv()(ctx);
+        expt::invoke_body(f_params, loop_body.get_priv(), ctx);
 
-        free(ctx.shared_mem_ptr);
         ctx.shared_mem_ptr = nullptr;
+    }
+
+    expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+  }
+
+};
+
+/*!
+ * The threads of the parallel region form one team. They share one
+ * dynamic shared memory buffer, from the launching thread's LaunchScratch,
+ * and ctx.teamSync() is a barrier of the region. With a sequential teams
+ * loop and omp_for_exec threads loops a tiled kernel written for a GPU,
+ * filling shared memory, synchronizing and then reading it, runs as is.
+ */
+template <>
+struct LaunchExecute<RAJA::omp_team_launch_t> {
+
+
+  template <typename BODY>
+  static void exec(LaunchParams const &params, const char *, BODY const &body)
+  {
+    detail::LaunchScratchLease shared_mem(params.shared_mem_size);
+
+    RAJA::region<RAJA::omp_parallel_region>([&]() {
+
+        LaunchContext ctx;
+        ctx.shared_mem_ptr = shared_mem.get();
+        ctx.host_team_sync = true;
+
+        using RAJA::internal::thread_privatize;
+        auto loop_body = thread_privatize(body);
+
+        loop_body.get_priv()(ctx);
     });
+  }
+
+  template <typename BODY>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchParams const &params, const char *kernel_name, BODY const &body)
+  {
+    exec(params, kernel_name, body);
 
     return resources::EventProxy<resources::Resource>(res);
   }
 
+  template <typename BODY, typename ForallParam>
+  static concepts::enable_if<expt::type_traits::is_ForallParamPack<ForallParam>>
+  exec(LaunchParams const &params, ForallParam &f_params, BODY const &body)
+  {
+    using EXEC_POL = RAJA::omp_team_launch_t;
+    expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+    RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+    detail::LaunchScratchLease shared_mem(params.shared_mem_size);
+
+#pragma omp parallel reduction(combine : f_params)
+    {
+        LaunchContext ctx;
+        ctx.shared_mem_ptr = shared_mem.get();
+        ctx.host_team_sync = true;
+
+        using RAJA::internal::thread_privatize;
+        auto loop_body = thread_privatize(body);
+
+        expt::invoke_body(f_params, loop_body.get_priv(), ctx);
+    }
+
+    expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+  }
+
 };
 
 
@@ -42,9 +42,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for reduction(combine : f_params)
+      RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
+#pragma omp parallel reduction(combine : f_params)
+      {
+      RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      #pragma omp for
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        RAJA::expt::invoke_body(f_params, body.get_priv(), begin_it[i]);
+      }
       }
 
       RAJA::expt::ParamMultiplexer::resolve<ExecPol>(f_params);
@@ -67,9 +74,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(static) reduction(combine : f_params)
+      RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
+#pragma omp parallel reduction(combine : f_params)
+      {
+      RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      #pragma omp for schedule(static)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        RAJA::expt::invoke_body(f_params, body.get_priv(), begin_it[i]);
+      }
       }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
@@ -92,9 +106,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(static, ChunkSize) reduction(combine : f_params)
+      RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
+#pragma omp parallel reduction(combine : f_params)
+      {
+      RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      #pragma omp for schedule(static, ChunkSize)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        RAJA::expt::invoke_body(f_params, body.get_priv(), begin_it[i]);
+      }
       }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
@@ -114,9 +135,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(runtime) reduction(combine : f_params)
+      RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
+#pragma omp parallel reduction(combine : f_params)
+      {
+      RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      #pragma omp for schedule(runtime)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        RAJA::expt::invoke_body(f_params, body.get_priv(), begin_it[i]);
+      }
       }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
@@ -136,11 +164,15 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
+      RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
 #pragma omp parallel
       {
+      RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
       #pragma omp for nowait reduction(combine : f_params)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        RAJA::expt::invoke_body(f_params, body.get_priv(), begin_it[i]);
       }
       }
 
@@ -162,9 +194,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(dynamic) reduction(combine : f_params)
+      RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
+#pragma omp parallel reduction(combine : f_params)
+      {
+      RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      #pragma omp for schedule(dynamic)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        RAJA::expt::invoke_body(f_params, body.get_priv(), begin_it[i]);
+      }
       }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
@@ -185,9 +224,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(dynamic, ChunkSize) reduction(combine : f_params)
+      RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
+#pragma omp parallel reduction(combine : f_params)
+      {
+      RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      #pragma omp for schedule(dynamic, ChunkSize)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        RAJA::expt::invoke_body(f_params, body.get_priv(), begin_it[i]);
+      }
       }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
@@ -208,9 +254,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(guided) reduction(combine : f_params)
+      RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
+#pragma omp parallel reduction(combine : f_params)
+      {
+      RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      #pragma omp for schedule(guided)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        RAJA::expt::invoke_body(f_params, body.get_priv(), begin_it[i]);
+      }
       }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
@@ -231,9 +284,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(guided, ChunkSize) reduction(combine : f_params)
+      RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
+#pragma omp parallel reduction(combine : f_params)
+      {
+      RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      #pragma omp for schedule(guided, ChunkSize)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        RAJA::expt::invoke_body(f_params, body.get_priv(), begin_it[i]);
+      }
       }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
@@ -254,11 +314,15 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
+      RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
 #pragma omp parallel
       {
+      RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
       #pragma omp for schedule(static) nowait reduction(combine : f_params)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        RAJA::expt::invoke_body(f_params, body.get_priv(), begin_it[i]);
       }
       }
 
@@ -280,11 +344,15 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
+      RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
 #pragma omp parallel
       {
+      RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
       #pragma omp for schedule(static, ChunkSize) nowait reduction(combine : f_params)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        RAJA::expt::invoke_body(f_params, body.get_priv(), begin_it[i]);
       }
       }
 
@@ -0,0 +1,46 @@
+#ifndef OMP_KERNELNAME_HPP
+#define OMP_KERNELNAME_HPP
+
+#include "RAJA/pattern/params/kernel_name.hpp"
+#include "RAJA/pattern/tensor/stats.hpp"
+
+namespace RAJA {
+namespace expt {
+namespace detail {
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+  // Init
+  template<typename EXEC_POL>
+  camp::concepts::enable_if< type_traits::is_openmp_policy<EXEC_POL> >
+  init(KernelName& kn)
+  {
+#if defined(RAJA_ENABLE_VECTOR_STATS)
+    tensor_stats::beginKernel(kn.name);
+#else
+    RAJA_UNUSED_VAR(kn);
+#endif
+  }
+
+  // Combine
+  template<typename EXEC_POL>
+  camp::concepts::enable_if< type_traits::is_openmp_policy<EXEC_POL> >
+  combine(KernelName&, const KernelName&) {}
+
+  // Resolve
+  template<typename EXEC_POL>
+  camp::concepts::enable_if< type_traits::is_openmp_policy<EXEC_POL> >
+  resolve(KernelName&)
+  {
+#if defined(RAJA_ENABLE_VECTOR_STATS)
+    tensor_stats::endKernel();
+#endif
+  }
+
+#endif
+
+} //  namespace detail
+} //  namespace expt
+} //  namespace RAJA
+
+#endif //  OMP_KERNELNAME_HPP
@@ -76,6 +76,9 @@ struct For {
 struct NoWait {
 };
 
+struct Taskloop {
+};
+
 static constexpr int default_chunk_size = -1;
 
 struct Auto : public internal::Schedule<omp_sched_auto, default_chunk_size>{
@@ -122,6 +125,18 @@ struct omp_launch_t
                                             Platform::host> {
 };
 
+///
+///  Struct supporting OpenMP parallel region for Teams where the threads
+///  of the region form one team, sharing the dynamic shared memory and
+///  synchronizing with ctx.teamSync()
+///
+struct omp_team_launch_t
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 
 ///
 ///  Struct supporting OpenMP 'for nowait schedule( )'
@@ -225,6 +240,39 @@ using omp_parallel_for_guided_exec = omp_parallel_exec<omp_for_schedule_exec<omp
 using omp_parallel_for_runtime_exec = omp_parallel_exec<omp_for_schedule_exec<omp::Runtime>>;
 
 
+///
+///  Struct supporting OpenMP 'taskloop'. Iterations are split into tasks of
+///  Grainsize iterations, or about four tasks per thread of the current team
+///  when Grainsize is not given. The calling thread generates the tasks, so
+///  loops compose with application tasks; outside a parallel region one is
+///  created. The loop waits for its tasks to complete.
+///
+template <int Grainsize = default_chunk_size>
+struct omp_taskloop_exec : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                          Pattern::forall,
+                                                          Launch::undefined,
+                                                          Platform::host,
+                                                          omp::Taskloop> {
+  constexpr static int grainsize = Grainsize;
+};
+
+///
+///  Struct supporting OpenMP 'taskloop nogroup'. Same as omp_taskloop_exec
+///  but the loop may return before its tasks complete, the caller must wait
+///  for them (e.g., with 'omp taskwait') before using the results. Inside a
+///  parallel region, data referenced by the loop body must outlive the tasks.
+///
+template <int Grainsize = default_chunk_size>
+struct omp_taskloop_nogroup_exec : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                          Pattern::forall,
+                                                          Launch::undefined,
+                                                          Platform::host,
+                                                          omp::Taskloop,
+                                                          omp::NoWait> {
+  constexpr static int grainsize = Grainsize;
+};
+
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -283,6 +331,13 @@ struct omp_reduce_ordered
     : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
 };
 
+///
+struct omp_reduce_reproducible
+    : make_policy_pattern_t<Policy::openmp,
+                            Pattern::reduce,
+                            reduce::reproducible> {
+};
+
 ///
 struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
                                                       Pattern::synchronize,
@@ -377,11 +432,20 @@ using policy::omp::omp_for_guided_exec;
 ///
 using policy::omp::omp_for_runtime_exec;
 
+///
+/// Type aliases for 'omp taskloop' loop execution, usable inside or outside
+/// of a parallel region
+///
+using policy::omp::omp_taskloop_exec;
+///
+using policy::omp::omp_taskloop_nogroup_exec;
+
 ///
 /// Type aliases for omp parallel region
 ///
 using policy::omp::omp_parallel_region;
 using policy::omp::omp_launch_t;
+using policy::omp::omp_team_launch_t;
 
 ///
 /// Type aliases for omp reductions
@@ -389,6 +453,7 @@ using policy::omp::omp_launch_t;
 using policy::omp::omp_reduce;
 ///
 using policy::omp::omp_reduce_ordered;
+using policy::omp::omp_reduce_reproducible;
 
 ///
 /// Type aliases for omp reductions
@@ -124,6 +124,42 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce_ordered, detail::ReduceOMPOrdered)
 
+///////////////////////////////////////////////////////////////////////////////
+//
+// Reproducible sum reductions are included below, results do not depend on
+// the number of threads or the schedule.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+template <typename T, typename Reduce>
+class ReduceOMPReproducible
+    : public reduce::detail::
+          BaseReproducibleCombinable<T, Reduce, ReduceOMPReproducible<T, Reduce>>
+{
+  using Base = reduce::detail::
+      BaseReproducibleCombinable<T, Reduce, ReduceOMPReproducible>;
+
+public:
+  using Base::Base;
+  //! prohibit compiler-generated default ctor
+  ReduceOMPReproducible() = delete;
+
+  ~ReduceOMPReproducible()
+  {
+    if (Base::parent) {
+#pragma omp critical(ompReduceReproducibleCritical)
+      Base::parent->my_data += Base::my_data;
+      Base::parent = nullptr;
+    }
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_REDUCER(Sum, omp_reduce_reproducible, detail::ReduceOMPReproducible)
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_OPENMP guard
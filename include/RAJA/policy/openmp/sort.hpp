@@ -23,6 +23,9 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <new>
+#include <vector>
 
 #include <omp.h>
 
@@ -30,8 +33,11 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/sort.hpp"
+#include "RAJA/util/select.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
 namespace RAJA
@@ -186,6 +192,298 @@ void sort(Sorter sorter,
   }
 }
 
+/*!
+        \brief find the first index i in [first, last) of a sorted range
+               such that begin[i] does not compare less than begin[pivot]
+*/
+template <typename Iter, typename Compare>
+inline RAJA::detail::IterDiff<Iter>
+lower_bound_index(Iter begin,
+                  RAJA::detail::IterDiff<Iter> first,
+                  RAJA::detail::IterDiff<Iter> last,
+                  RAJA::detail::IterDiff<Iter> pivot,
+                  Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  while (first < last) {
+    const diff_type middle = first + (last - first)/2;
+    if (comp(begin[middle], begin[pivot])) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  return first;
+}
+
+/*!
+        \brief find the first index i in [first, last) of a sorted range
+               such that begin[pivot] compares less than begin[i]
+*/
+template <typename Iter, typename Compare>
+inline RAJA::detail::IterDiff<Iter>
+upper_bound_index(Iter begin,
+                  RAJA::detail::IterDiff<Iter> first,
+                  RAJA::detail::IterDiff<Iter> last,
+                  RAJA::detail::IterDiff<Iter> pivot,
+                  Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  while (first < last) {
+    const diff_type middle = first + (last - first)/2;
+    if (comp(begin[pivot], begin[middle])) {
+      last = middle;
+    } else {
+      first = middle + 1;
+    }
+  }
+  return first;
+}
+
+/*!
+        \brief multisequence selection, split the sorted sequences
+               [chunks[j], chunks[j+1]) so the elements before the splits
+               are the first rank elements of their stable merge
+
+        Equal elements are ordered by sequence index, then by position.
+        The split of sequence j is written to split[j], hi and pos are
+        scratch space of length num_chunks.
+*/
+template <typename Iter, typename Compare>
+inline void multisequence_select(Iter begin,
+                                 const RAJA::detail::IterDiff<Iter>* chunks,
+                                 RAJA::detail::IterDiff<Iter> num_chunks,
+                                 RAJA::detail::IterDiff<Iter> rank,
+                                 RAJA::detail::IterDiff<Iter>* split,
+                                 RAJA::detail::IterDiff<Iter>* hi,
+                                 RAJA::detail::IterDiff<Iter>* pos,
+                                 Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  // the split of sequence i always lies in [split[i], hi[i]]
+  for (diff_type i = 0; i < num_chunks; ++i) {
+    split[i] = chunks[i];
+    hi[i]    = chunks[i+1];
+  }
+
+  for (;;) {
+
+    // bisect the sequence with the widest remaining interval
+    diff_type j = 0;
+    for (diff_type i = 1; i < num_chunks; ++i) {
+      if (hi[i] - split[i] > hi[j] - split[j]) {
+        j = i;
+      }
+    }
+    if (hi[j] == split[j]) {
+      break;
+    }
+
+    const diff_type pivot = split[j] + (hi[j] - split[j])/2;
+
+    // find the elements of each sequence that precede begin[pivot]
+    diff_type pivot_rank = 0;
+    for (diff_type i = 0; i < num_chunks; ++i) {
+      if (i < j) {
+        pos[i] = upper_bound_index(begin, chunks[i], chunks[i+1], pivot, comp);
+      } else if (i == j) {
+        pos[i] = pivot;
+      } else {
+        pos[i] = lower_bound_index(begin, chunks[i], chunks[i+1], pivot, comp);
+      }
+      pivot_rank += pos[i] - chunks[i];
+    }
+
+    if (pivot_rank < rank) {
+      // begin[pivot] and everything preceding it are before the split
+      pos[j] = pivot + 1;
+      for (diff_type i = 0; i < num_chunks; ++i) {
+        split[i] = std::max(split[i], pos[i]);
+      }
+    } else {
+      // begin[pivot] and everything following it are after the split
+      for (diff_type i = 0; i < num_chunks; ++i) {
+        hi[i] = std::min(hi[i], pos[i]);
+      }
+    }
+  }
+}
+
+/*!
+        \brief stable sort given range using sorter and comparison function
+               by sorting a chunk per thread then merging all the chunks
+               in one pass into copyarr
+
+        Each thread merges into its own part of copyarr, the bounds of each
+        part in every chunk are found by multisequence selection. splits
+        must have space for (num_threads+1)*num_threads indices.
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline void stable_sort_multiway_parallel_region(
+    Sorter sorter,
+    Iter begin,
+    RAJA::detail::IterDiff<Iter> n,
+    RAJA::detail::IterVal<Iter>* copyarr,
+    RAJA::detail::IterDiff<Iter>* splits,
+    Compare comp)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  const diff_type num_threads = omp_get_num_threads();
+
+  const diff_type thread_id = omp_get_thread_num();
+
+  // chunk j is [chunks[j], chunks[j+1]) in begin before the merge
+  // and is the range written by thread j in copyarr during the merge
+  std::vector<diff_type> chunks(num_threads+1);
+  for (diff_type j = 0; j <= num_threads; ++j) {
+    chunks[j] = firstIndex(n, num_threads, j);
+  }
+
+  // this thread sorts range [chunks[thread_id], chunks[thread_id+1])
+  sorter(begin + chunks[thread_id], begin + chunks[thread_id+1], comp);
+
+#pragma omp barrier
+
+  // row t of splits holds the split of every chunk at rank chunks[t]
+  diff_type* split      = splits + thread_id*num_threads;
+  diff_type* next_split = split + num_threads;
+  {
+    std::vector<diff_type> scratch(2*num_threads);
+    multisequence_select(begin, chunks.data(), num_threads, chunks[thread_id],
+                         split, scratch.data(), scratch.data() + num_threads,
+                         comp);
+    if (thread_id == num_threads-1) {
+      std::copy(chunks.begin()+1, chunks.end(), next_split);
+    }
+  }
+
+#pragma omp barrier
+
+  // k-way merge of the parts of each chunk in [split, next_split),
+  // equal elements are taken from the lowest chunk first
+  std::vector<diff_type> cur(split, split + num_threads);
+  std::vector<diff_type> heap;
+  heap.reserve(num_threads);
+  for (diff_type j = 0; j < num_threads; ++j) {
+    if (cur[j] < next_split[j]) {
+      heap.push_back(j);
+    }
+  }
+
+  auto merges_after = [&](diff_type a, diff_type b) {
+    return comp(begin[cur[b]], begin[cur[a]]) ||
+           (!comp(begin[cur[a]], begin[cur[b]]) && b < a);
+  };
+  std::make_heap(heap.begin(), heap.end(), merges_after);
+
+  diff_type out = chunks[thread_id];
+  while (heap.size() > 1) {
+    std::pop_heap(heap.begin(), heap.end(), merges_after);
+    const diff_type j = heap.back();
+    new(&copyarr[out++]) value_type(std::move(begin[cur[j]]));
+    if (++cur[j] < next_split[j]) {
+      std::push_heap(heap.begin(), heap.end(), merges_after);
+    } else {
+      heap.pop_back();
+    }
+  }
+  if (!heap.empty()) {
+    const diff_type j = heap.front();
+    for (; cur[j] < next_split[j]; ++cur[j]) {
+      new(&copyarr[out++]) value_type(std::move(begin[cur[j]]));
+    }
+  }
+
+#pragma omp barrier
+
+  std::move(copyarr + chunks[thread_id], copyarr + chunks[thread_id+1],
+            begin + chunks[thread_id]);
+}
+
+/*!
+        \brief stable sort given range using sorter and comparison function
+               with a single parallel multiway merge pass
+
+        Unlike sort, which merges pairwise in log2(p) passes over the data,
+        the sorted chunks are merged in one pass with all threads active.
+        Uses O(N) additional memory.
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline
+void stable_sort_multiway(Sorter sorter,
+                          Iter begin,
+                          Iter end,
+                          Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  constexpr diff_type min_iterates_per_task = get_min_iterates_per_task();
+
+  const diff_type n = end - begin;
+
+  const diff_type max_threads = omp_get_max_threads();
+
+  const diff_type requested_num_threads = std::min((n+min_iterates_per_task-1)/min_iterates_per_task, max_threads);
+
+  if (requested_num_threads <= 1) {
+
+    sorter(begin, end, comp);
+
+  } else {
+
+    // Manage the lifetime of the buffer and objects constructed in the buffer
+    using buf_deleter_type = FreeAlignedType<value_type, diff_type>;
+    buf_deleter_type buf_deleter;
+
+    std::unique_ptr<value_type, buf_deleter_type&> copy_buf(
+        RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, n * sizeof(value_type) ),
+        buf_deleter);
+
+    value_type* copyarr = copy_buf.get();
+
+    // check memory allocation worked
+    if (copyarr == nullptr) {
+      RAJA_ABORT_OR_THROW( "stable_sort_multiway temporary memory allocation failed" );
+    }
+
+    std::vector<diff_type> splits((requested_num_threads+1)*requested_num_threads);
+
+#pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
+    {
+      stable_sort_multiway_parallel_region(sorter, begin, n, copyarr, splits.data(), comp);
+    }
+
+    // every object in the buffer was constructed by the merge
+    buf_deleter.size = n;
+  }
+}
+
+/*!
+        \brief run func(c) for each chunk c in [0, num_chunks) in parallel
+*/
+struct ForChunks
+{
+  template <typename Func>
+  void operator()(int num_chunks, Func&& func) const
+  {
+#pragma omp parallel for schedule(static)
+    for (int c = 0; c < num_chunks; ++c) {
+      func(c);
+    }
+  }
+};
+
+/*!
+        \brief number of chunks for parallel selection, a few per thread
+               to even out the work
+*/
+inline int select_num_chunks() { return 4 * omp_get_max_threads(); }
+
 } // namespace openmp
 
 } // namespace detail
@@ -221,7 +519,7 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::openmp::sort(detail::StableSorter{}, begin, end, comp);
+  detail::openmp::stable_sort_multiway(detail::StableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -265,7 +563,54 @@ stable_pairs(
   auto begin  = RAJA::zip(keys_begin, vals_begin);
   auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
   using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::openmp::stable_sort_multiway(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief select nth item of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+select(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter nth,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::sample_select(begin, RAJA::detail::NoSelectVals{},
+                              end - begin, nth - begin, comp,
+                              detail::openmp::select_num_chunks(),
+                              detail::openmp::ForChunks{});
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief select nth item of given range of pairs using comparison
+               function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+select_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_nth,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  RAJA::detail::sample_select(keys_begin, vals_begin,
+                              keys_end - keys_begin, keys_nth - keys_begin,
+                              comp,
+                              detail::openmp::select_num_chunks(),
+                              detail::openmp::ForChunks{});
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -0,0 +1,344 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA worklist declarations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_worklist_openmp_HPP
+#define RAJA_worklist_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/detail/worklist.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace worklist
+{
+
+namespace detail
+{
+namespace openmp
+{
+
+/*!
+ * \brief Lock free work stealing deque.
+ *
+ * The owning thread pushes and takes at the bottom, other threads steal
+ * from the top. This is the Chase-Lev deque with the memory orders of
+ * Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models",
+ * PPoPP 2013. Buffers replaced when growing are kept until the deque is
+ * destroyed, as thieves may still read them.
+ */
+template <typename T>
+class StealingDeque
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "worklist items must be trivially copyable");
+
+  struct Buffer {
+    explicit Buffer(std::int64_t capacity_)
+        : capacity(capacity_), items(new std::atomic<T>[capacity_])
+    {
+    }
+
+    T get(std::int64_t i) const
+    {
+      return items[i & (capacity - 1)].load(std::memory_order_relaxed);
+    }
+
+    void put(std::int64_t i, T const& item)
+    {
+      items[i & (capacity - 1)].store(item, std::memory_order_relaxed);
+    }
+
+    const std::int64_t capacity;
+    std::unique_ptr<std::atomic<T>[]> items;
+  };
+
+public:
+  StealingDeque() : m_top(0), m_bottom(0)
+  {
+    m_buffers.emplace_back(new Buffer(64));
+    m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+  }
+
+  //! Called by the owning thread only
+  void push(T const& item)
+  {
+    const std::int64_t b = m_bottom.load(std::memory_order_relaxed);
+    const std::int64_t t = m_top.load(std::memory_order_acquire);
+    Buffer* buf = m_buffer.load(std::memory_order_relaxed);
+    if (b - t > buf->capacity - 1) {
+      buf = grow(buf, t, b);
+    }
+    buf->put(b, item);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+  }
+
+  //! Called by the owning thread only, returns false if empty
+  bool take(T& item)
+  {
+    const std::int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+    Buffer* buf = m_buffer.load(std::memory_order_relaxed);
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t t = m_top.load(std::memory_order_relaxed);
+
+    bool found = false;
+    if (t <= b) {
+      item = buf->get(b);
+      found = true;
+      if (t == b) {
+        // last item, race against thieves for it
+        found = m_top.compare_exchange_strong(t,
+                                              t + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+      }
+    } else {
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return found;
+  }
+
+  //! Called by any thread, returns false if empty or lost a race
+  bool steal(T& item)
+  {
+    std::int64_t t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::int64_t b = m_bottom.load(std::memory_order_acquire);
+    if (t < b) {
+      Buffer* buf = m_buffer.load(std::memory_order_acquire);
+      item = buf->get(t);
+      return m_top.compare_exchange_strong(t,
+                                           t + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed);
+    }
+    return false;
+  }
+
+private:
+  Buffer* grow(Buffer* buf, std::int64_t t, std::int64_t b)
+  {
+    m_buffers.emplace_back(new Buffer(2 * buf->capacity));
+    Buffer* bigger = m_buffers.back().get();
+    for (std::int64_t i = t; i < b; ++i) {
+      bigger->put(i, buf->get(i));
+    }
+    m_buffer.store(bigger, std::memory_order_release);
+    return bigger;
+  }
+
+  // owner and thieves update different ends, keep them on separate lines
+  alignas(64) std::atomic<std::int64_t> m_top;
+  alignas(64) std::atomic<std::int64_t> m_bottom;
+  std::atomic<Buffer*> m_buffer;
+  std::vector<std::unique_ptr<Buffer>> m_buffers;
+};
+
+//! Work of an unordered worklist, shared by the threads running it
+template <typename T>
+struct StealingWork {
+  explicit StealingWork(int num_deques)
+      : deques(new StealingDeque<T>[num_deques]), pending(0)
+  {
+  }
+
+  std::unique_ptr<StealingDeque<T>[]> deques;
+
+  //! items pushed and not yet finished
+  std::atomic<std::int64_t> pending;
+};
+
+//! Queue of one thread, new items go to the deque of that thread
+template <typename T>
+struct StealingQueue {
+  StealingWork<T>* work;
+  StealingDeque<T>* deque;
+};
+
+template <typename T>
+void stealing_push(void* queue, T const& item)
+{
+  StealingQueue<T>* q = static_cast<StealingQueue<T>*>(queue);
+  q->work->pending.fetch_add(1, std::memory_order_relaxed);
+  q->deque->push(item);
+}
+
+}  // namespace openmp
+}  // namespace detail
+
+/*!
+        \brief run body on the items in [begin, end) and the items it pushes,
+               each thread works from its own deque and steals from the
+               others when it runs out
+*/
+template <typename ExecPolicy, typename Iter, typename Body>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+unordered(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Body&& body)
+{
+  using T = RAJA::detail::IterVal<Iter>;
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using RAJA::detail::firstIndex;
+  using work_type = detail::openmp::StealingWork<T>;
+  using queue_type = detail::openmp::StealingQueue<T>;
+
+  const diff_type n = std::distance(begin, end);
+  if (n <= 0) {
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+
+  work_type work(omp_get_max_threads());
+  work.pending.store(n, std::memory_order_relaxed);
+
+#pragma omp parallel
+  {
+    const int num_threads = omp_get_num_threads();
+    const int thread_id = omp_get_thread_num();
+
+    queue_type queue{&work, &work.deques[thread_id]};
+    WorklistContext<T> ctx(&queue, &detail::openmp::stealing_push<T>);
+    auto thread_body = body;
+
+    // each thread starts with a contiguous part of the initial items
+    const diff_type i_end = firstIndex(n, num_threads, thread_id + 1);
+    for (diff_type i = firstIndex(n, num_threads, thread_id); i < i_end;
+         ++i) {
+      queue.deque->push(*(begin + i));
+    }
+
+    std::uint32_t rng = 2654435761u * (thread_id + 1);
+    T item;
+    while (work.pending.load(std::memory_order_acquire) > 0) {
+      bool found = queue.deque->take(item);
+      for (int tries = 0; !found && tries < num_threads; ++tries) {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        const int victim = static_cast<int>(rng % num_threads);
+        if (victim != thread_id) {
+          found = work.deques[victim].steal(item);
+        }
+      }
+      if (found) {
+        thread_body(item, ctx);
+        work.pending.fetch_sub(1, std::memory_order_acq_rel);
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief run body on the items in [begin, end), then on the items
+               they push, level by level
+*/
+template <typename ExecPolicy, typename Iter, typename Body>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+levels(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Body&& body)
+{
+  using T = RAJA::detail::IterVal<Iter>;
+
+  std::vector<T> frontier(begin, end);
+  std::vector<T> next;
+  std::vector<std::vector<T>> pushed(omp_get_max_threads());
+  std::vector<size_t> offsets(pushed.size() + 1, 0);
+  long num_items = static_cast<long>(frontier.size());
+  int level = 0;
+
+#pragma omp parallel
+  {
+    const int thread_id = omp_get_thread_num();
+    std::vector<T>& mine = pushed[thread_id];
+    auto thread_body = body;
+
+    while (num_items > 0) {
+      WorklistContext<T> ctx(&mine,
+                             &RAJA::detail::worklist_push_back<T>,
+                             level);
+
+#pragma omp for schedule(dynamic, 64)
+      for (long i = 0; i < num_items; ++i) {
+        thread_body(frontier[i], ctx);
+      }
+
+#pragma omp single
+      {
+        for (size_t p = 0; p < pushed.size(); ++p) {
+          offsets[p + 1] = offsets[p] + pushed[p].size();
+        }
+        next.resize(offsets.back());
+      }
+
+      std::copy(mine.begin(), mine.end(), next.begin() + offsets[thread_id]);
+      mine.clear();
+
+#pragma omp barrier
+#pragma omp single
+      {
+        frontier.swap(next);
+        num_items = static_cast<long>(frontier.size());
+        ++level;
+      }
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace worklist
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
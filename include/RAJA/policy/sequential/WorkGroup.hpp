@@ -20,5 +20,6 @@
 
 #include "RAJA/policy/sequential/WorkGroup/Dispatcher.hpp"
 #include "RAJA/policy/sequential/WorkGroup/WorkRunner.hpp"
+#include "RAJA/policy/sequential/WorkGroup/GraphRunner.hpp"
 
 #endif  // closing endif for header file include guard
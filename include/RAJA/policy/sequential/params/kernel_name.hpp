@@ -0,0 +1,42 @@
+#ifndef SEQ_KERNELNAME_HPP
+#define SEQ_KERNELNAME_HPP
+
+#include "RAJA/pattern/params/kernel_name.hpp"
+#include "RAJA/pattern/tensor/stats.hpp"
+
+namespace RAJA {
+namespace expt {
+namespace detail {
+
+  // Init
+  template<typename EXEC_POL>
+  camp::concepts::enable_if< std::is_same< EXEC_POL, RAJA::seq_exec> >
+  init(KernelName& kn)
+  {
+#if defined(RAJA_ENABLE_VECTOR_STATS)
+    tensor_stats::beginKernel(kn.name);
+#else
+    RAJA_UNUSED_VAR(kn);
+#endif
+  }
+
+  // Combine
+  template<typename EXEC_POL>
+  camp::concepts::enable_if< std::is_same< EXEC_POL, RAJA::seq_exec> >
+  combine(KernelName&, const KernelName&) {}
+
+  // Resolve
+  template<typename EXEC_POL>
+  camp::concepts::enable_if< std::is_same< EXEC_POL, RAJA::seq_exec> >
+  resolve(KernelName&)
+  {
+#if defined(RAJA_ENABLE_VECTOR_STATS)
+    tensor_stats::endKernel();
+#endif
+  }
+
+} //  namespace detail
+} //  namespace expt
+} //  namespace RAJA
+
+#endif //  SEQ_KERNELNAME_HPP
@@ -50,11 +50,27 @@ public:
   using Base::Base;
 };
 
+template <typename T, typename Reduce>
+class ReduceSeqReproducible
+    : public reduce::detail::
+          BaseReproducibleCombinable<T, Reduce, ReduceSeqReproducible<T, Reduce>>
+{
+  using Base = reduce::detail::
+      BaseReproducibleCombinable<T, Reduce, ReduceSeqReproducible<T, Reduce>>;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceSeqReproducible() = delete;
+
+  using Base::Base;
+};
 
 }  // namespace detail
 
 RAJA_DECLARE_ALL_REDUCERS(seq_reduce, detail::ReduceSeq)
 
+RAJA_DECLARE_REDUCER(Sum, seq_reduce_reproducible, detail::ReduceSeqReproducible)
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -108,6 +108,44 @@ stable_pairs(
       keys_begin, keys_end, vals_begin, comp);
 }
 
+/*!
+        \brief select nth item of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+select(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter nth,
+    Iter end,
+    Compare comp)
+{
+  return RAJA::impl::sort::select(host_res, ::RAJA::loop_exec{},
+      begin, nth, end, comp);
+}
+
+/*!
+        \brief select nth item of given range of pairs using comparison
+               function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+select_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_nth,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  return RAJA::impl::sort::select_pairs(host_res, ::RAJA::loop_exec{},
+      keys_begin, keys_nth, keys_end, vals_begin, comp);
+}
+
 }  // namespace sort
 
 }  // namespace impl
@@ -0,0 +1,122 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA worklist declarations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_worklist_sequential_HPP
+#define RAJA_worklist_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/detail/worklist.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace worklist
+{
+
+namespace detail
+{
+
+template <typename T>
+void fifo_push(void* queue, T const& item)
+{
+  static_cast<std::deque<T>*>(queue)->push_back(item);
+}
+
+}  // namespace detail
+
+/*!
+        \brief run body on the items in [begin, end) and the items it pushes,
+               in first in first out order
+*/
+template <typename ExecPolicy, typename Iter, typename Body>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      concepts::any_of<
+                        type_traits::is_sequential_policy<ExecPolicy>,
+                        type_traits::is_loop_policy<ExecPolicy>>>
+unordered(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Body&& body)
+{
+  using T = RAJA::detail::IterVal<Iter>;
+
+  std::deque<T> queue(begin, end);
+  WorklistContext<T> ctx(&queue, &detail::fifo_push<T>);
+
+  while (!queue.empty()) {
+    const T item = queue.front();
+    queue.pop_front();
+    body(item, ctx);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief run body on the items in [begin, end), then on the items
+               they push, level by level
+*/
+template <typename ExecPolicy, typename Iter, typename Body>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      concepts::any_of<
+                        type_traits::is_sequential_policy<ExecPolicy>,
+                        type_traits::is_loop_policy<ExecPolicy>>>
+levels(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Body&& body)
+{
+  using T = RAJA::detail::IterVal<Iter>;
+
+  std::vector<T> frontier(begin, end);
+  std::vector<T> next;
+
+  for (int level = 0; !frontier.empty(); ++level) {
+    WorklistContext<T> ctx(&next, &RAJA::detail::worklist_push_back<T>, level);
+    for (T const& item : frontier) {
+      body(item, ctx);
+    }
+    frontier.swap(next);
+    next.clear();
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace worklist
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
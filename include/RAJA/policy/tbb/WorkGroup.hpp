@@ -20,6 +20,7 @@
 
 #include "RAJA/policy/tbb/WorkGroup/Dispatcher.hpp"
 #include "RAJA/policy/tbb/WorkGroup/WorkRunner.hpp"
+#include "RAJA/policy/tbb/WorkGroup/GraphRunner.hpp"
 
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,69 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA GraphRunner class specializations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_tbb_WorkGroup_GraphRunner_HPP
+#define RAJA_tbb_WorkGroup_GraphRunner_HPP
+
+#include "RAJA/config.hpp"
+
+#include <tbb/tbb.h>
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+#include "RAJA/pattern/Graph/GraphRunner.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Runs the independent nodes of a graph level as TBB tasks so nodes and
+ * any TBB loops inside them share one work stealing scheduler.
+ */
+template <>
+struct GraphRunner<RAJA::tbb_work>
+{
+  template < typename WorkContainer >
+  static void run_level(WorkContainer const& storage,
+                        const size_t* nodes,
+                        size_t num_nodes)
+  {
+    if (num_nodes < 2) {
+      GraphRunnerSerial::run_level(storage, nodes, num_nodes);
+      return;
+    }
+
+    using value_type = typename WorkContainer::value_type;
+    using brange = ::tbb::blocked_range<size_t>;
+
+    auto begin = storage.begin();
+    ::tbb::parallel_for(brange(0, num_nodes, 1), [=](const brange& r) {
+      for (size_t i = r.begin(); i != r.end(); ++i) {
+        value_type::host_call(&begin[nodes[i]]);
+      }
+    });
+  }
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -33,6 +33,7 @@
 #include "RAJA/internal/fault_tolerance.hpp"
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/params/forall.hpp"
+#include "RAJA/pattern/tensor/stats.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -90,6 +91,7 @@ forall_impl(resources::Host host_res,
   size_t dist = std::abs(distance(begin(iter), end(iter)));
 
   expt::ParamMultiplexer::init<tbb_for_dynamic>(f_params);
+  RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
 
   f_params = ::tbb::parallel_reduce(
       brange(0, dist, p.grain_size),
@@ -97,11 +99,12 @@ forall_impl(resources::Host host_res,
       f_params,
 
       [=](const brange& r, ForallParam fp) {
+        RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
         using RAJA::internal::thread_privatize;
         auto privatizer = thread_privatize(loop_body);
         auto body = privatizer.get_priv();
         for (auto i = r.begin(); i != r.end(); ++i)
-          expt::invoke_body(fp, loop_body, b[i]);
+          expt::invoke_body(fp, body, b[i]);
         return fp;
       },
 
@@ -186,7 +189,8 @@ forall_impl(resources::Host host_res,
   auto b = begin(iter);
   size_t dist = std::abs(distance(begin(iter), end(iter)));
 
-  expt::ParamMultiplexer::init<tbb_for_dynamic>(f_params);
+  expt::ParamMultiplexer::init<tbb_for_static<ChunkSize>>(f_params);
+  RAJA_TENSOR_STAT_KERNEL_CAPTURE(stats_kernel);
 
   auto fp = ::tbb::parallel_reduce(
       brange(0, dist, ChunkSize),
@@ -194,24 +198,25 @@ forall_impl(resources::Host host_res,
       f_params,
 
       [=](const brange& r, ForallParam fp) {
+        RAJA_TENSOR_STAT_KERNEL_ENTER(stats_kernel);
         using RAJA::internal::thread_privatize;
         auto privatizer = thread_privatize(loop_body);
         auto body = privatizer.get_priv();
         for (auto i = r.begin(); i != r.end(); ++i)
-          expt::invoke_body(fp, loop_body, b[i]);
+          expt::invoke_body(fp, body, b[i]);
         return fp;
       },
 
       [](ForallParam lhs, ForallParam rhs) -> ForallParam {
-        expt::ParamMultiplexer::combine<tbb_for_dynamic>(lhs, rhs);
+        expt::ParamMultiplexer::combine<tbb_for_static<ChunkSize>>(lhs, rhs);
         return lhs;
       },
       tbb_static_partitioner{}
 
   );
-  expt::ParamMultiplexer::combine<tbb_for_dynamic>(f_params, fp);
+  expt::ParamMultiplexer::combine<tbb_for_static<ChunkSize>>(f_params, fp);
 
-  expt::ParamMultiplexer::resolve<tbb_for_dynamic>(f_params);
+  expt::ParamMultiplexer::resolve<tbb_for_static<ChunkSize>>(f_params);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -0,0 +1,381 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing user interface for RAJA::launch::tbb
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_tbb_HPP
+#define RAJA_pattern_launch_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <cstdlib>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/pattern/params/kernel.hpp"
+#include "RAJA/policy/tbb/forall.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
+
+
+namespace RAJA
+{
+
+/*!
+ * The launch body runs once on the calling thread. Loops in the body using
+ * tbb_for_static or tbb_for_dynamic policies run as TBB parallel_for loops,
+ * so a teams loop maps each team to a TBB task and idle threads steal teams.
+ * Loops over two or three segments run over a blocked_range2d/3d which TBB
+ * splits recursively along its longest dimension.
+ *
+ * Dynamic shared memory is not supported: the teams run as concurrent tasks
+ * which all use the one LaunchContext captured by the body, so they can not
+ * be given buffers of their own. A launch with shared_mem_size > 0 aborts or
+ * throws.
+ *
+ * expt::KernelName is accepted, expt reducers are not: the body runs once
+ * so the reducer arguments would be shared by the tasks of its loops.
+ */
+template <>
+struct LaunchExecute<RAJA::tbb_launch_t> {
+
+  template <typename BODY>
+  static void exec(LaunchParams const &params, const char *RAJA_UNUSED_ARG(kernel_name), BODY const &body)
+  {
+    check_shared_mem(params);
+
+    LaunchContext ctx;
+
+    body(ctx);
+  }
+
+  template <typename BODY>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchParams const &params, const char *RAJA_UNUSED_ARG(kernel_name), BODY const &body)
+  {
+    check_shared_mem(params);
+
+    LaunchContext ctx;
+
+    body(ctx);
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+  template <typename BODY, typename ForallParam>
+  static concepts::enable_if<expt::type_traits::is_ForallParamPack<ForallParam>>
+  exec(LaunchParams const &params, ForallParam &f_params, BODY const &body)
+  {
+    static_assert(!expt::detail::has_reducer_params<typename ForallParam::Base>::value,
+                  "tbb_launch_t does not support RAJA::expt reducers, use "
+                  "RAJA::forall or RAJA::kernel with a TBB policy");
+
+    check_shared_mem(params);
+
+    using EXEC_POL = RAJA::tbb_for_dynamic;
+    expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+
+    LaunchContext ctx;
+
+    expt::invoke_body(f_params, body, ctx);
+
+    expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+  }
+
+private:
+  static void check_shared_mem(LaunchParams const &params)
+  {
+    if (params.shared_mem_size > 0) {
+      RAJA_ABORT_OR_THROW("tbb_launch_t does not support dynamic shared "
+                          "memory, teams run as concurrent TBB tasks");
+    }
+  }
+
+};
+
+namespace detail
+{
+
+/*!
+ * Loop implementations shared by the TBB loop policies, each TBB task
+ * privatizes the loop body and calls func with it and the local indices.
+ */
+template <typename Partitioner, std::size_t GrainSize>
+struct TbbLaunchLoop {
+
+  template <typename BODY, typename Func>
+  static RAJA_INLINE void for_1d(int len0, BODY const &body, Func const &func)
+  {
+    using brange = ::tbb::blocked_range<int>;
+    ::tbb::parallel_for(
+        brange(0, len0, GrainSize),
+        [&](const brange &r) {
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(body);
+          auto &loop_body = privatizer.get_priv();
+          for (int i = r.begin(); i != r.end(); ++i) {
+            func(loop_body, i);
+          }
+        },
+        Partitioner{});
+  }
+
+  template <typename BODY, typename Func>
+  static RAJA_INLINE void for_2d(int len0,
+                                 int len1,
+                                 BODY const &body,
+                                 Func const &func)
+  {
+    using brange = ::tbb::blocked_range2d<int>;
+    ::tbb::parallel_for(
+        brange(0, len1, GrainSize, 0, len0, GrainSize),
+        [&](const brange &r) {
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(body);
+          auto &loop_body = privatizer.get_priv();
+          for (int j = r.rows().begin(); j != r.rows().end(); ++j) {
+            for (int i = r.cols().begin(); i != r.cols().end(); ++i) {
+              func(loop_body, i, j);
+            }
+          }
+        },
+        Partitioner{});
+  }
+
+  template <typename BODY, typename Func>
+  static RAJA_INLINE void for_3d(int len0,
+                                 int len1,
+                                 int len2,
+                                 BODY const &body,
+                                 Func const &func)
+  {
+    using brange = ::tbb::blocked_range3d<int>;
+    ::tbb::parallel_for(
+        brange(0, len2, GrainSize, 0, len1, GrainSize, 0, len0, GrainSize),
+        [&](const brange &r) {
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(body);
+          auto &loop_body = privatizer.get_priv();
+          for (int k = r.pages().begin(); k != r.pages().end(); ++k) {
+            for (int j = r.rows().begin(); j != r.rows().end(); ++j) {
+              for (int i = r.cols().begin(); i != r.cols().end(); ++i) {
+                func(loop_body, i, j, k);
+              }
+            }
+          }
+        },
+        Partitioner{});
+  }
+};
+
+template <typename Partitioner, std::size_t GrainSize, typename SEGMENT>
+struct TbbLoopExecute {
+
+  using loop_t = TbbLaunchLoop<Partitioner, GrainSize>;
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    loop_t::for_1d(len, body, [&](auto &loop_body, int i) {
+      loop_body(*(segment.begin() + i));
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    loop_t::for_2d(len0, len1, body, [&](auto &loop_body, int i, int j) {
+      loop_body(*(segment0.begin() + i), *(segment1.begin() + j));
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    loop_t::for_3d(len0, len1, len2, body,
+                   [&](auto &loop_body, int i, int j, int k) {
+      loop_body(*(segment0.begin() + i),
+                *(segment1.begin() + j),
+                *(segment2.begin() + k));
+    });
+  }
+};
+
+template <typename Partitioner, std::size_t GrainSize, typename SEGMENT>
+struct TbbLoopICountExecute {
+
+  using loop_t = TbbLaunchLoop<Partitioner, GrainSize>;
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    loop_t::for_1d(len, body, [&](auto &loop_body, int i) {
+      loop_body(*(segment.begin() + i), i);
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    loop_t::for_2d(len0, len1, body, [&](auto &loop_body, int i, int j) {
+      loop_body(*(segment0.begin() + i), *(segment1.begin() + j), i, j);
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    loop_t::for_3d(len0, len1, len2, body,
+                   [&](auto &loop_body, int i, int j, int k) {
+      loop_body(*(segment0.begin() + i),
+                *(segment1.begin() + j),
+                *(segment2.begin() + k),
+                i,
+                j,
+                k);
+    });
+  }
+};
+
+template <typename Partitioner, std::size_t GrainSize, typename SEGMENT>
+struct TbbTileExecute {
+
+  using loop_t = TbbLaunchLoop<Partitioner, GrainSize>;
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+    loop_t::for_1d(numTiles, body, [&](auto &loop_body, int i) {
+      loop_body(segment.slice(i * tile_size, tile_size));
+    });
+  }
+};
+
+template <typename Partitioner, std::size_t GrainSize, typename SEGMENT>
+struct TbbTileICountExecute {
+
+  using loop_t = TbbLaunchLoop<Partitioner, GrainSize>;
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+    loop_t::for_1d(numTiles, body, [&](auto &loop_body, int i) {
+      loop_body(segment.slice(i * tile_size, tile_size), i);
+    });
+  }
+};
+
+}  // namespace detail
+
+//
+// tbb_for_static partitions loops statically, tbb_for_dynamic lets TBB
+// split loops adaptively with work stealing
+//
+template <std::size_t GrainSize, typename SEGMENT>
+struct LoopExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TbbLoopExecute<tbb_static_partitioner, GrainSize, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct LoopExecute<tbb_for_dynamic, SEGMENT>
+    : detail::TbbLoopExecute<::tbb::auto_partitioner, 1, SEGMENT> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct LoopICountExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TbbLoopICountExecute<tbb_static_partitioner, GrainSize, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<tbb_for_dynamic, SEGMENT>
+    : detail::TbbLoopICountExecute<::tbb::auto_partitioner, 1, SEGMENT> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct TileExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TbbTileExecute<tbb_static_partitioner, GrainSize, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileExecute<tbb_for_dynamic, SEGMENT>
+    : detail::TbbTileExecute<::tbb::auto_partitioner, 1, SEGMENT> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct TileICountExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TbbTileICountExecute<tbb_static_partitioner, GrainSize, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileICountExecute<tbb_for_dynamic, SEGMENT>
+    : detail::TbbTileICountExecute<::tbb::auto_partitioner, 1, SEGMENT> {
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif
@@ -11,19 +11,19 @@ namespace detail {
 
   // Init
   template<typename EXEC_POL, typename OP, typename T>
-  camp::concepts::enable_if< std::is_same< EXEC_POL, RAJA::tbb_for_dynamic> >
+  camp::concepts::enable_if< type_traits::is_tbb_policy<EXEC_POL> >
   init(Reducer<OP, T>& red) {
     red.val = OP::identity();
   }
   // Combine
   template<typename EXEC_POL, typename OP, typename T>
-  camp::concepts::enable_if< std::is_same< EXEC_POL, RAJA::tbb_for_dynamic> >
+  camp::concepts::enable_if< type_traits::is_tbb_policy<EXEC_POL> >
   combine(Reducer<OP, T>& out, const Reducer<OP, T>& in) {
     out.val = OP{}(out.val, in.val);
   }
   // Resolve
   template<typename EXEC_POL, typename OP, typename T>
-  camp::concepts::enable_if< std::is_same< EXEC_POL, RAJA::tbb_for_dynamic> >
+  camp::concepts::enable_if< type_traits::is_tbb_policy<EXEC_POL> >
   resolve(Reducer<OP, T>& red) {
     *red.target = OP{}(red.val, *red.target);
   }
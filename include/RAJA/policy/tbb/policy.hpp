@@ -65,6 +65,16 @@ using tbb_for_exec = tbb_for_static<>;
 ///
 using tbb_segit = tbb_for_exec;
 
+///
+/// Launch policy, teams loops inside the launch run as TBB tasks
+///
+struct tbb_launch_t
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 ///
 /// WorkGroup execution policies
 ///
@@ -88,13 +98,24 @@ struct tbb_reduce : make_policy_pattern_launch_platform_t<Policy::tbb,
                                                           Platform::host> {
 };
 
+///
+struct tbb_reduce_reproducible
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            reduce::reproducible> {
+};
+
 }  // namespace tbb
 }  // namespace policy
 
 using policy::tbb::tbb_for_dynamic;
 using policy::tbb::tbb_for_exec;
 using policy::tbb::tbb_for_static;
+using policy::tbb::tbb_launch_t;
 using policy::tbb::tbb_reduce;
+using policy::tbb::tbb_reduce_reproducible;
 using policy::tbb::tbb_segit;
 using policy::tbb::tbb_work;
 
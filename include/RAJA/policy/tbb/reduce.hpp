@@ -82,10 +82,54 @@ public:
    */
   T& local() { return data->local(); }
 };
+
+template <typename T, typename Reduce>
+class ReduceTBBReproducible
+{
+  using accumulator_type = ReproducibleSum<T>;
+
+  //! TBB native per-thread container
+  std::shared_ptr<tbb::combinable<accumulator_type>> data;
+
+public:
+  //! default constructor calls the reset method
+  ReduceTBBReproducible() { reset(T(), T()); }
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceTBBReproducible(T init_val, T initializer)
+  {
+    reset(init_val, initializer);
+  }
+
+  void reset(T init_val, T)
+  {
+    data = std::make_shared<tbb::combinable<accumulator_type>>();
+    data->local() += init_val;
+  }
+
+  /*!
+   *  \return the calculated reduced value, the same for any combine order
+   */
+  T get() const
+  {
+    return data
+        ->combine([](accumulator_type lhs, accumulator_type const& rhs) {
+          return lhs += rhs;
+        })
+        .get();
+  }
+
+  /*!
+   *  \return update the local value
+   */
+  void combine(const T& other) { data->local() += other; }
+};
 }  // namespace detail
 
 RAJA_DECLARE_ALL_REDUCERS(tbb_reduce, detail::ReduceTBB)
 
+RAJA_DECLARE_REDUCER(Sum, tbb_reduce_reproducible, detail::ReduceTBBReproducible)
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_TBB guard
@@ -33,6 +33,7 @@
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/policy/loop/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/util/select.hpp"
 
 namespace RAJA
 {
@@ -129,6 +130,27 @@ void tbb_sort(Sorter sorter,
   }
 }
 
+/*!
+        \brief run func(c) for each chunk c in [0, num_chunks) in parallel
+*/
+struct TbbForChunks
+{
+  template <typename Func>
+  void operator()(int num_chunks, Func&& func) const
+  {
+    tbb::parallel_for(0, num_chunks, [&](int c) { func(c); });
+  }
+};
+
+/*!
+        \brief number of chunks for parallel selection, a few per thread
+               to even out the work
+*/
+inline int tbb_select_num_chunks()
+{
+  return 4 * tbb::this_task_arena::max_concurrency();
+}
+
 } // namespace detail
 
 /*!
@@ -211,6 +233,53 @@ stable_pairs(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief select nth item of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+select(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter nth,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::sample_select(begin, RAJA::detail::NoSelectVals{},
+                              end - begin, nth - begin, comp,
+                              detail::tbb_select_num_chunks(),
+                              detail::TbbForChunks{});
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief select nth item of given range of pairs using comparison
+               function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+select_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_nth,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  RAJA::detail::sample_select(keys_begin, vals_begin,
+                              keys_end - keys_begin, keys_nth - keys_begin,
+                              comp,
+                              detail::tbb_select_num_chunks(),
+                              detail::TbbForChunks{});
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace sort
 
 }  // namespace impl
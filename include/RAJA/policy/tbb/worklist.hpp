@@ -0,0 +1,128 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA worklist declarations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_worklist_tbb_HPP
+#define RAJA_worklist_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <vector>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/detail/worklist.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace worklist
+{
+
+namespace detail
+{
+
+template <typename T>
+void tbb_feeder_push(void* queue, T const& item)
+{
+  static_cast<tbb::parallel_do_feeder<T>*>(queue)->add(item);
+}
+
+}  // namespace detail
+
+/*!
+        \brief run body on the items in [begin, end) and the items it pushes,
+               using the work stealing of the TBB scheduler
+*/
+template <typename ExecPolicy, typename Iter, typename Body>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+unordered(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Body&& body)
+{
+  using T = RAJA::detail::IterVal<Iter>;
+
+  tbb::parallel_do(begin, end,
+                   [&](T const& item, tbb::parallel_do_feeder<T>& feeder) {
+                     WorklistContext<T> ctx(&feeder,
+                                            &detail::tbb_feeder_push<T>);
+                     body(item, ctx);
+                   });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief run body on the items in [begin, end), then on the items
+               they push, level by level
+*/
+template <typename ExecPolicy, typename Iter, typename Body>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+levels(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Body&& body)
+{
+  using T = RAJA::detail::IterVal<Iter>;
+  using range_type = tbb::blocked_range<size_t>;
+
+  std::vector<T> frontier(begin, end);
+  std::vector<T> next;
+  tbb::enumerable_thread_specific<std::vector<T>> pushed;
+
+  for (int level = 0; !frontier.empty(); ++level) {
+    tbb::parallel_for(range_type(0, frontier.size()),
+                      [&](range_type const& r) {
+                        std::vector<T>& mine = pushed.local();
+                        WorklistContext<T> ctx(
+                            &mine, &RAJA::detail::worklist_push_back<T>, level);
+                        for (size_t i = r.begin(); i != r.end(); ++i) {
+                          body(frontier[i], ctx);
+                        }
+                      });
+
+    next.clear();
+    for (std::vector<T>& mine : pushed) {
+      next.insert(next.end(), mine.begin(), mine.end());
+      mine.clear();
+    }
+    frontier.swap(next);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace worklist
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
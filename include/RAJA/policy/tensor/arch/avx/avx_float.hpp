@@ -48,10 +48,27 @@ namespace expt
 
       using int_vector_type = Register<int32_t, avx_register>;
 
+      using mask_type = base_type::mask_type;
+
 
     private:
       register_type m_value;
 
+      RAJA_INLINE
+      __m256i createLaneMask(mask_type const &mask) const {
+        // Expand a lane bitmask
+        camp::idx_t bits = mask.get_bits(0, 8);
+        return _mm256_set_epi32(
+            bits & 128 ? -1 : 0,
+            bits & 64 ? -1 : 0,
+            bits & 32 ? -1 : 0,
+            bits & 16 ? -1 : 0,
+            bits & 8 ? -1 : 0,
+            bits & 4 ? -1 : 0,
+            bits & 2 ? -1 : 0,
+            bits & 1 ? -1 : 0);
+      }
+
       RAJA_INLINE
       __m256i createMask(camp::idx_t N) const {
         // Generate a mask
@@ -182,6 +199,24 @@ namespace expt
         return *this;
       }
 
+      /*!
+       * @brief Store entire register to consecutive memory locations,
+       * bypassing the caches, ptr must be 32 byte aligned
+       */
+      RAJA_INLINE
+      self_type const &store_packed_streaming(element_type *ptr) const{
+        _mm256_stream_ps(ptr, m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Orders preceding streaming stores before later stores
+       */
+      RAJA_INLINE
+      static void streaming_fence(){
+        _mm_sfence();
+      }
+
       /*!
        * @brief Store entire register to consecutive memory locations
        *
@@ -477,6 +512,137 @@ namespace expt
       {
         return self_type(_mm256_min_ps(m_value, a.m_value));
       }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is equal to x
+       */
+      RAJA_INLINE
+      mask_type cmp_eq(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm256_movemask_ps(_mm256_cmp_ps(m_value, x.m_value, _CMP_EQ_OQ)));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is not equal to x
+       */
+      RAJA_INLINE
+      mask_type cmp_ne(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm256_movemask_ps(_mm256_cmp_ps(m_value, x.m_value, _CMP_NEQ_UQ)));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is less than x
+       */
+      RAJA_INLINE
+      mask_type cmp_lt(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm256_movemask_ps(_mm256_cmp_ps(m_value, x.m_value, _CMP_LT_OQ)));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is less than or equal to x
+       */
+      RAJA_INLINE
+      mask_type cmp_le(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm256_movemask_ps(_mm256_cmp_ps(m_value, x.m_value, _CMP_LE_OQ)));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is greater than x
+       */
+      RAJA_INLINE
+      mask_type cmp_gt(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm256_movemask_ps(_mm256_cmp_ps(m_value, x.m_value, _CMP_GT_OQ)));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is greater than or equal to x
+       */
+      RAJA_INLINE
+      mask_type cmp_ge(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm256_movemask_ps(_mm256_cmp_ps(m_value, x.m_value, _CMP_GE_OQ)));
+      }
+
+      /*!
+       * @brief Element-wise select: b in the lanes where mask is set, and
+       * (*this) in the others
+       */
+      RAJA_INLINE
+      self_type blend(self_type const &b, mask_type const &mask) const
+      {
+        return self_type(_mm256_blendv_ps(m_value, b.m_value, _mm256_castsi256_ps(createLaneMask(mask))));
+      }
+
+      /*!
+       * @brief Stores the lanes where mask is set
+       */
+      RAJA_INLINE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const
+      {
+        _mm256_maskstore_ps(ptr, createLaneMask(mask), m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Element-wise absolute value, clears the sign bits
+       */
+      RAJA_INLINE
+      self_type abs() const
+      {
+        return self_type(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), m_value));
+      }
+
+      /*!
+       * @brief Element-wise square root
+       */
+      RAJA_INLINE
+      self_type sqrt() const
+      {
+        return self_type(_mm256_sqrt_ps(m_value));
+      }
+
+      /*!
+       * @brief Element-wise round to nearest integer, ties to even
+       */
+      RAJA_INLINE
+      self_type round() const
+      {
+        return self_type(_mm256_round_ps(m_value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+      }
+
+      /*!
+       * @brief Permute-and-shuffle left step of a register transpose,
+       * see RegisterBase::transpose_shuffle_left
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_left(camp::idx_t lvl, self_type const &y) const
+      {
+        switch(lvl){
+          case 0: return self_type(_mm256_blend_ps(m_value, _mm256_moveldup_ps(y.m_value), 0xAA));
+          case 1: return self_type(_mm256_shuffle_ps(m_value, y.m_value, _MM_SHUFFLE(1, 0, 1, 0)));
+          case 2: return self_type(_mm256_permute2f128_ps(m_value, y.m_value, 0x20));
+          default: return base_type::transpose_shuffle_left(lvl, y);
+        }
+      }
+
+      /*!
+       * @brief Permute-and-shuffle right step of a register transpose,
+       * see RegisterBase::transpose_shuffle_right
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_right(int lvl, self_type const &y) const
+      {
+        switch(lvl){
+          case 0: return self_type(_mm256_blend_ps(_mm256_movehdup_ps(m_value), y.m_value, 0xAA));
+          case 1: return self_type(_mm256_shuffle_ps(m_value, y.m_value, _MM_SHUFFLE(3, 2, 3, 2)));
+          case 2: return self_type(_mm256_permute2f128_ps(m_value, y.m_value, 0x31));
+          default: return base_type::transpose_shuffle_right(lvl, y);
+        }
+      }
   };
 
 
@@ -48,9 +48,19 @@ namespace expt
 
       using int_vector_type = Register<int64_t, avx2_register>;
 
+      using mask_type = base_type::mask_type;
+
     private:
       register_type m_value;
 
+      RAJA_INLINE
+      __m256i createLaneMask(mask_type const &mask) const {
+        // Expand a lane bitmask, testing one bit in each lane
+        __m256i lanes = _mm256_set_epi64x(8, 4, 2, 1);
+        __m256i bits = _mm256_set1_epi64x(mask.get_bits(0, 4));
+        return _mm256_cmpeq_epi64(_mm256_and_si256(bits, lanes), lanes);
+      }
+
       RAJA_INLINE
       __m256i createMask(camp::idx_t N) const {
         // Generate a mask
@@ -137,9 +147,6 @@ namespace expt
        */
       RAJA_INLINE
       self_type &load_packed(element_type const *ptr){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_packed ++;
-#endif
         m_value = _mm256_loadu_pd(ptr);
         return *this;
       }
@@ -151,9 +158,6 @@ namespace expt
        */
       RAJA_INLINE
       self_type &load_packed_n(element_type const *ptr, camp::idx_t N){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_packed_n ++;
-#endif
         m_value = _mm256_maskload_pd(ptr, createMask(N));
         return *this;
       }
@@ -164,9 +168,6 @@ namespace expt
        */
       RAJA_INLINE
       self_type &load_strided(element_type const *ptr, camp::idx_t stride){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided ++;
-#endif
         m_value = _mm256_i64gather_pd(ptr,
                                       createStridedOffsets(stride),
                                       sizeof(element_type));
@@ -181,9 +182,6 @@ namespace expt
        */
       RAJA_INLINE
       self_type &load_strided_n(element_type const *ptr, camp::idx_t stride, camp::idx_t N){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
         m_value = _mm256_mask_i64gather_pd(_mm256_setzero_pd(),
                                       ptr,
                                       createStridedOffsets(stride),
@@ -203,9 +201,6 @@ namespace expt
        */
       RAJA_INLINE
       self_type &gather(element_type const *ptr, int_vector_type offsets){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
         m_value = _mm256_i64gather_pd(ptr,
                                       offsets.get_register(),
                                       sizeof(element_type));
@@ -223,9 +218,6 @@ namespace expt
        */
       RAJA_INLINE
       self_type &gather_n(element_type const *ptr, int_vector_type offsets, camp::idx_t N){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
         m_value = _mm256_mask_i64gather_pd(_mm256_setzero_pd(),
                                       ptr,
                                       offsets.get_register(),
@@ -241,22 +233,34 @@ namespace expt
        */
       RAJA_INLINE
       self_type const &store_packed(element_type *ptr) const{
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_packed ++;
-#endif
         _mm256_storeu_pd(ptr, m_value);
         return *this;
       }
 
+      /*!
+       * @brief Store entire register to consecutive memory locations,
+       * bypassing the caches, ptr must be 32 byte aligned
+       */
+      RAJA_INLINE
+      self_type const &store_packed_streaming(element_type *ptr) const{
+        _mm256_stream_pd(ptr, m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Orders preceding streaming stores before later stores
+       */
+      RAJA_INLINE
+      static void streaming_fence(){
+        _mm_sfence();
+      }
+
       /*!
        * @brief Store entire register to consecutive memory locations
        *
        */
       RAJA_INLINE
       self_type const &store_packed_n(element_type *ptr, camp::idx_t N) const{
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_packed_n ++;
-#endif
         _mm256_maskstore_pd(ptr, createMask(N), m_value);
         return *this;
       }
@@ -267,9 +271,6 @@ namespace expt
        */
       RAJA_INLINE
       self_type const &store_strided(element_type *ptr, camp::idx_t stride) const{
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_strided ++;
-#endif
         for(camp::idx_t i = 0;i < 4;++ i){
           ptr[i*stride] = m_value[i];
         }
@@ -283,9 +284,6 @@ namespace expt
        */
       RAJA_INLINE
       self_type const &store_strided_n(element_type *ptr, camp::idx_t stride, camp::idx_t N) const{
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_strided_n ++;
-#endif
         for(camp::idx_t i = 0;i < N;++ i){
           ptr[i*stride] = m_value[i];
         }
@@ -549,6 +547,168 @@ namespace expt
       {
         return self_type(_mm256_min_pd(m_value, a.m_value));
       }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is equal to x
+       */
+      RAJA_INLINE
+      mask_type cmp_eq(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm256_movemask_pd(_mm256_cmp_pd(m_value, x.m_value, _CMP_EQ_OQ)));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is not equal to x
+       */
+      RAJA_INLINE
+      mask_type cmp_ne(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm256_movemask_pd(_mm256_cmp_pd(m_value, x.m_value, _CMP_NEQ_UQ)));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is less than x
+       */
+      RAJA_INLINE
+      mask_type cmp_lt(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm256_movemask_pd(_mm256_cmp_pd(m_value, x.m_value, _CMP_LT_OQ)));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is less than or equal to x
+       */
+      RAJA_INLINE
+      mask_type cmp_le(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm256_movemask_pd(_mm256_cmp_pd(m_value, x.m_value, _CMP_LE_OQ)));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is greater than x
+       */
+      RAJA_INLINE
+      mask_type cmp_gt(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm256_movemask_pd(_mm256_cmp_pd(m_value, x.m_value, _CMP_GT_OQ)));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is greater than or equal to x
+       */
+      RAJA_INLINE
+      mask_type cmp_ge(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm256_movemask_pd(_mm256_cmp_pd(m_value, x.m_value, _CMP_GE_OQ)));
+      }
+
+      /*!
+       * @brief Element-wise select: b in the lanes where mask is set, and
+       * (*this) in the others
+       */
+      RAJA_INLINE
+      self_type blend(self_type const &b, mask_type const &mask) const
+      {
+        return self_type(_mm256_blendv_pd(m_value, b.m_value, _mm256_castsi256_pd(createLaneMask(mask))));
+      }
+
+      /*!
+       * @brief Stores the lanes where mask is set
+       */
+      RAJA_INLINE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const
+      {
+        _mm256_maskstore_pd(ptr, createLaneMask(mask), m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Element-wise absolute value, clears the sign bits
+       */
+      RAJA_INLINE
+      self_type abs() const
+      {
+        return self_type(_mm256_andnot_pd(_mm256_set1_pd(-0.0), m_value));
+      }
+
+      /*!
+       * @brief Element-wise square root
+       */
+      RAJA_INLINE
+      self_type sqrt() const
+      {
+        return self_type(_mm256_sqrt_pd(m_value));
+      }
+
+      /*!
+       * @brief Element-wise round to nearest integer, ties to even
+       */
+      RAJA_INLINE
+      self_type round() const
+      {
+        return self_type(_mm256_round_pd(m_value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+      }
+
+      /*!
+       * @brief Element-wise (*this) * 2^n, for 2^n in the normal range,
+       * see RegisterBase::ldexp
+       */
+      RAJA_INLINE
+      self_type ldexp(self_type const &n) const
+      {
+        // n+1023 lands in the low mantissa bits of 2^52+n+1023, and is
+        // shifted into the exponent field of 2^n
+        __m256i e = _mm256_castpd_si256(_mm256_add_pd(n.m_value, _mm256_set1_pd(4503599627370496.0 + 1023.0)));
+        return self_type(_mm256_mul_pd(m_value, _mm256_castsi256_pd(_mm256_slli_epi64(e, 52))));
+      }
+
+      /*!
+       * @brief Element-wise split of positive normal values into a
+       * mantissa in [1/2, 1), which is returned, and an exponent in e,
+       * see RegisterBase::frexp
+       */
+      RAJA_INLINE
+      self_type frexp(self_type &e) const
+      {
+        __m256i bits = _mm256_castpd_si256(m_value);
+
+        // the exponent field as a double, through 2^52 + field
+        __m256d two52 = _mm256_set1_pd(4503599627370496.0);
+        __m256i field = _mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_castpd_si256(two52));
+        e = self_type(_mm256_sub_pd(_mm256_castsi256_pd(field), _mm256_set1_pd(4503599627370496.0 + 1022.0)));
+
+        __m256i mantissa = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)),
+                                           _mm256_set1_epi64x(0x3FE0000000000000LL));
+        return self_type(_mm256_castsi256_pd(mantissa));
+      }
+
+      /*!
+       * @brief Permute-and-shuffle left step of a register transpose,
+       * see RegisterBase::transpose_shuffle_left
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_left(camp::idx_t lvl, self_type const &y) const
+      {
+        switch(lvl){
+          case 0: return self_type(_mm256_unpacklo_pd(m_value, y.m_value));
+          case 1: return self_type(_mm256_permute2f128_pd(m_value, y.m_value, 0x20));
+          default: return base_type::transpose_shuffle_left(lvl, y);
+        }
+      }
+
+      /*!
+       * @brief Permute-and-shuffle right step of a register transpose,
+       * see RegisterBase::transpose_shuffle_right
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_right(int lvl, self_type const &y) const
+      {
+        switch(lvl){
+          case 0: return self_type(_mm256_unpackhi_pd(m_value, y.m_value));
+          case 1: return self_type(_mm256_permute2f128_pd(m_value, y.m_value, 0x31));
+          default: return base_type::transpose_shuffle_right(lvl, y);
+        }
+      }
   };
 
 
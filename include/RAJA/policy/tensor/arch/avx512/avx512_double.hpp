@@ -49,6 +49,8 @@ namespace expt
 
       using int_vector_type = Register<int64_t, avx512_register>;
 
+      using mask_type = base_type::mask_type;
+
 
     private:
       register_type m_value;
@@ -186,6 +188,24 @@ namespace expt
         return *this;
       }
 
+      /*!
+       * @brief Store entire register to consecutive memory locations,
+       * bypassing the caches, ptr must be 64 byte aligned
+       */
+      RAJA_INLINE
+      self_type const &store_packed_streaming(element_type *ptr) const{
+        _mm512_stream_pd(ptr, m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Orders preceding streaming stores before later stores
+       */
+      RAJA_INLINE
+      static void streaming_fence(){
+        _mm_sfence();
+      }
+
       /*!
        * @brief Store entire register to consecutive memory locations
        *
@@ -380,6 +400,161 @@ namespace expt
       {
         return self_type(_mm512_min_pd(m_value, a.m_value));
       }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is equal to x
+       */
+      RAJA_INLINE
+      mask_type cmp_eq(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm512_cmp_pd_mask(m_value, x.m_value, _CMP_EQ_OQ));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is not equal to x
+       */
+      RAJA_INLINE
+      mask_type cmp_ne(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm512_cmp_pd_mask(m_value, x.m_value, _CMP_NEQ_UQ));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is less than x
+       */
+      RAJA_INLINE
+      mask_type cmp_lt(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm512_cmp_pd_mask(m_value, x.m_value, _CMP_LT_OQ));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is less than or equal to x
+       */
+      RAJA_INLINE
+      mask_type cmp_le(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm512_cmp_pd_mask(m_value, x.m_value, _CMP_LE_OQ));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is greater than x
+       */
+      RAJA_INLINE
+      mask_type cmp_gt(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm512_cmp_pd_mask(m_value, x.m_value, _CMP_GT_OQ));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is greater than or equal to x
+       */
+      RAJA_INLINE
+      mask_type cmp_ge(self_type const &x) const
+      {
+        return mask_type::s_from_bits(_mm512_cmp_pd_mask(m_value, x.m_value, _CMP_GE_OQ));
+      }
+
+      /*!
+       * @brief Element-wise select: b in the lanes where mask is set, and
+       * (*this) in the others
+       */
+      RAJA_INLINE
+      self_type blend(self_type const &b, mask_type const &mask) const
+      {
+        return self_type(_mm512_mask_blend_pd(__mmask8(mask.get_bits(0, 8)), m_value, b.m_value));
+      }
+
+      /*!
+       * @brief Stores the lanes where mask is set
+       */
+      RAJA_INLINE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const
+      {
+        _mm512_mask_storeu_pd(ptr, __mmask8(mask.get_bits(0, 8)), m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Element-wise absolute value
+       */
+      RAJA_INLINE
+      self_type abs() const
+      {
+        return self_type(_mm512_abs_pd(m_value));
+      }
+
+      /*!
+       * @brief Element-wise square root
+       */
+      RAJA_INLINE
+      self_type sqrt() const
+      {
+        return self_type(_mm512_sqrt_pd(m_value));
+      }
+
+      /*!
+       * @brief Element-wise round to nearest integer, ties to even
+       */
+      RAJA_INLINE
+      self_type round() const
+      {
+        return self_type(_mm512_roundscale_pd(m_value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+      }
+
+      /*!
+       * @brief Element-wise (*this) * 2^n
+       */
+      RAJA_INLINE
+      self_type ldexp(self_type const &n) const
+      {
+        return self_type(_mm512_scalef_pd(m_value, n.m_value));
+      }
+
+      /*!
+       * @brief Element-wise split of positive normal values into a
+       * mantissa in [1/2, 1), which is returned, and an exponent in e,
+       * see RegisterBase::frexp
+       */
+      RAJA_INLINE
+      self_type frexp(self_type &e) const
+      {
+        e = self_type(_mm512_add_pd(_mm512_getexp_pd(m_value), _mm512_set1_pd(1)));
+        return self_type(_mm512_getmant_pd(m_value, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
+      }
+
+    private:
+      // lane i of the left shuffle at level lvl, as an index into x:y
+      RAJA_INLINE
+      static
+      __m512i transposeShuffleIndex(camp::idx_t lvl) {
+        __m512i lane = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+        __mmask8 from_y = _mm512_test_epi64_mask(lane, _mm512_set1_epi64(1 << lvl));
+        return _mm512_mask_add_epi64(lane, from_y, lane, _mm512_set1_epi64(8 - (1 << lvl)));
+      }
+
+    public:
+
+      /*!
+       * @brief Permute-and-shuffle left step of a register transpose,
+       * see RegisterBase::transpose_shuffle_left
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_left(camp::idx_t lvl, self_type const &y) const
+      {
+        return self_type(_mm512_permutex2var_pd(m_value, transposeShuffleIndex(lvl), y.m_value));
+      }
+
+      /*!
+       * @brief Permute-and-shuffle right step of a register transpose,
+       * see RegisterBase::transpose_shuffle_right
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_right(int lvl, self_type const &y) const
+      {
+        __m512i index = _mm512_add_epi64(transposeShuffleIndex(lvl), _mm512_set1_epi64(1 << lvl));
+        return self_type(_mm512_permutex2var_pd(m_value, index, y.m_value));
+      }
   };
 
 
@@ -50,6 +50,8 @@ namespace expt
 
       using int_vector_type = Register<int64_t, cuda_warp_register>;
 
+      using mask_type = typename base_type::mask_type;
+
 
 		private:
       element_type m_value;
@@ -693,6 +695,136 @@ namespace expt
         return self_type{RAJA::min<element_type>(m_value, a.m_value)};
       }
 
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is equal to x
+       */
+      RAJA_INLINE
+      RAJA_DEVICE
+      mask_type cmp_eq(self_type const &x) const
+      {
+        return mask_type::s_from_bits(__ballot_sync(0xffffffff, m_value == x.m_value));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is not equal to x
+       */
+      RAJA_INLINE
+      RAJA_DEVICE
+      mask_type cmp_ne(self_type const &x) const
+      {
+        return mask_type::s_from_bits(__ballot_sync(0xffffffff, m_value != x.m_value));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is less than x
+       */
+      RAJA_INLINE
+      RAJA_DEVICE
+      mask_type cmp_lt(self_type const &x) const
+      {
+        return mask_type::s_from_bits(__ballot_sync(0xffffffff, m_value < x.m_value));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is less than or equal to x
+       */
+      RAJA_INLINE
+      RAJA_DEVICE
+      mask_type cmp_le(self_type const &x) const
+      {
+        return mask_type::s_from_bits(__ballot_sync(0xffffffff, m_value <= x.m_value));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is greater than x
+       */
+      RAJA_INLINE
+      RAJA_DEVICE
+      mask_type cmp_gt(self_type const &x) const
+      {
+        return mask_type::s_from_bits(__ballot_sync(0xffffffff, m_value > x.m_value));
+      }
+
+      /*!
+       * @brief Element-wise comparison: lanes where (*this) is greater than or equal to x
+       */
+      RAJA_INLINE
+      RAJA_DEVICE
+      mask_type cmp_ge(self_type const &x) const
+      {
+        return mask_type::s_from_bits(__ballot_sync(0xffffffff, m_value >= x.m_value));
+      }
+
+      /*!
+       * @brief Element-wise select: b in the lanes where mask is set, and
+       * (*this) in the others
+       */
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type blend(self_type const &b, mask_type const &mask) const
+      {
+        return self_type(mask.get(get_lane()) ? b.m_value : m_value);
+      }
+
+      /*!
+       * @brief Stores the lanes where mask is set
+       */
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const
+      {
+        auto lane = get_lane();
+        if(mask.get(lane)){
+          ptr[lane] = m_value;
+        }
+        return *this;
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type abs() const
+      {
+        return self_type(m_value <= element_type(0) ? element_type(0) - m_value : m_value);
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type sqrt() const
+      {
+        return self_type(::sqrt(m_value));
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type rsqrt() const
+      {
+        return self_type(::rsqrt(m_value));
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type round() const
+      {
+        return self_type(::nearbyint(m_value));
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type ldexp(self_type const &n) const
+      {
+        return self_type(::ldexp(m_value, static_cast<int>(n.m_value)));
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type frexp(self_type &e) const
+      {
+        int exponent = 0;
+        element_type mantissa = ::frexp(m_value, &exponent);
+        e = self_type(element_type(exponent));
+        return self_type(mantissa);
+      }
+
 
 
 
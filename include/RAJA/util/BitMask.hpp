@@ -20,6 +20,10 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstdint>
+
+#include "RAJA/util/macros.hpp"
+
 
 namespace RAJA
 {
@@ -79,6 +83,55 @@ namespace RAJA
 
   };
 
+  /*!
+   * Number of set bits in x
+   */
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  int popcount(std::uint64_t x)
+  {
+#if defined(RAJA_DEVICE_CODE)
+    return __popcll(x);
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return static_cast<int>((x * 0x0101010101010101ull) >> 56);
+#endif
+  }
+
+  /*!
+   * Position of the lowest set bit of x, x must not be 0
+   */
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  int count_trailing_zeros(std::uint64_t x)
+  {
+#if defined(RAJA_DEVICE_CODE)
+    return __ffsll(static_cast<long long>(x)) - 1;
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#else
+    return popcount((x & (0 - x)) - 1);
+#endif
+  }
+
+  /*!
+   * Position of the set bit of x with k set bits below it, x must have
+   * more than k set bits
+   */
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  int select_bit(std::uint64_t x, int k)
+  {
+    for (int i = 0; i < k; ++i) {
+      x &= x - 1;
+    }
+    return count_trailing_zeros(x);
+  }
+
 }  // namespace RAJA
 
 #endif //RAJA_util_BitMask_HPP
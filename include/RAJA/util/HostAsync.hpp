@@ -0,0 +1,359 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the RAJA asynchronous host resource.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_HostAsync_HPP
+#define RAJA_util_HostAsync_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief  A first in first out queue of work run by one worker thread.
+ *
+ * Every enqueued task gets a ticket, tasks complete in ticket order so a
+ * ticket is complete when the count of completed tasks reaches it.
+ *
+ * The worker thread shares ownership of the queue state. A task may hold
+ * the last handle to its own queue, the queue is then destroyed on the
+ * worker thread, which is detached and finishes the remaining tasks before
+ * it exits.
+ */
+class HostAsyncQueue
+{
+public:
+  using ticket_type = std::uint64_t;
+
+  HostAsyncQueue()
+    : m_state(std::make_shared<State>()),
+      m_thread(&HostAsyncQueue::work, m_state)
+  { }
+
+  HostAsyncQueue(HostAsyncQueue const&) = delete;
+  HostAsyncQueue& operator=(HostAsyncQueue const&) = delete;
+
+  ~HostAsyncQueue()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_state->mutex);
+      m_state->shutdown = true;
+    }
+    m_state->work_cv.notify_all();
+    if (on_worker_thread()) {
+      // a thread cannot join itself
+      m_thread.detach();
+    } else {
+      m_thread.join();
+    }
+  }
+
+  ticket_type enqueue(std::function<void()>&& task)
+  {
+    ticket_type ticket;
+    {
+      std::lock_guard<std::mutex> lock(m_state->mutex);
+      m_state->tasks.emplace_back(std::move(task));
+      ticket = ++m_state->submitted;
+    }
+    m_state->work_cv.notify_one();
+    return ticket;
+  }
+
+  //! ticket of the most recently enqueued task
+  ticket_type last_ticket()
+  {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->submitted;
+  }
+
+  bool is_complete(ticket_type ticket) const
+  {
+    return m_state->completed.load(std::memory_order_acquire) >= ticket;
+  }
+
+  //! block until the task with ticket has run, rethrows the first exception
+  //  thrown by any task. Must not be called from a task in this queue.
+  void wait(ticket_type ticket)
+  {
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+    m_state->done_cv.wait(lock, [&]() { return is_complete(ticket); });
+    if (m_state->error) {
+      std::exception_ptr error = m_state->error;
+      m_state->error = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  bool on_worker_thread() const
+  {
+    return std::this_thread::get_id() == m_thread.get_id();
+  }
+
+private:
+  struct State
+  {
+    std::mutex mutex;
+    std::condition_variable work_cv;
+    std::condition_variable done_cv;
+    std::deque<std::function<void()>> tasks;
+    ticket_type submitted = 0;
+    std::atomic<ticket_type> completed{0};
+    std::exception_ptr error;
+    bool shutdown = false;
+  };
+
+  std::shared_ptr<State> m_state;
+
+  // constructed last so the worker only sees initialized members
+  std::thread m_thread;
+
+  static void work(std::shared_ptr<State> state)
+  {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->work_cv.wait(lock, [&]() {
+          return state->shutdown || !state->tasks.empty();
+        });
+        if (state->tasks.empty()) {
+          return;
+        }
+        task = std::move(state->tasks.front());
+        state->tasks.pop_front();
+      }
+
+      std::exception_ptr error;
+      try {
+        task();
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (error && !state->error) {
+          state->error = error;
+        }
+        state->completed.fetch_add(1, std::memory_order_release);
+      }
+      state->done_cv.notify_all();
+    }
+  }
+};
+
+}  // namespace detail
+
+namespace resources
+{
+
+/*!
+ * \brief  Event marking a point in the work queue of a HostAsync resource.
+ */
+class HostAsyncEvent
+{
+public:
+  HostAsyncEvent() = default;
+
+  HostAsyncEvent(std::shared_ptr<detail::HostAsyncQueue> queue,
+                 detail::HostAsyncQueue::ticket_type ticket)
+    : m_queue(std::move(queue)), m_ticket(ticket)
+  { }
+
+  bool check() const
+  {
+    return !m_queue || m_queue->is_complete(m_ticket);
+  }
+
+  void wait() const
+  {
+    if (m_queue) {
+      m_queue->wait(m_ticket);
+    }
+  }
+
+private:
+  std::shared_ptr<detail::HostAsyncQueue> m_queue;
+  detail::HostAsyncQueue::ticket_type m_ticket = 0;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Asynchronous host resource.
+ *
+ * Each HostAsync object created with the default constructor is an
+ * independent stream backed by its own worker thread, copies of a HostAsync
+ * share their stream. Work passed to forall with a HostAsync resource is
+ * enqueued and the returned EventProxy refers to a pending event. Work on
+ * one stream runs in order, work on different streams runs concurrently.
+ * The host execution policy is applied on the worker thread, so OpenMP and
+ * TBB policies create their parallelism from that thread.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   RAJA::resources::HostAsync stream;
+
+   auto e = RAJA::forall<RAJA::omp_parallel_for_exec>(stream, range, body);
+
+   MPI_Waitall(...);   // overlaps with the loop
+
+   e.get().wait();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+class HostAsync
+{
+public:
+  HostAsync()
+    : m_queue(std::make_shared<detail::HostAsyncQueue>())
+  { }
+
+  //! the shared default stream
+  static HostAsync get_default()
+  {
+    static HostAsync h;
+    return h;
+  }
+
+  camp::resources::Platform get_platform() const
+  {
+    return camp::resources::Platform::host;
+  }
+
+  //! enqueue a callable to run on this stream
+  template < typename Task >
+  void enqueue(Task&& task)
+  {
+    m_queue->enqueue(std::function<void()>(std::forward<Task>(task)));
+  }
+
+  HostAsyncEvent get_event()
+  {
+    return HostAsyncEvent(m_queue, m_queue->last_ticket());
+  }
+
+  camp::resources::Event get_event_erased()
+  {
+    return camp::resources::Event{get_event()};
+  }
+
+  //! block until all work enqueued on this stream has run
+  void wait()
+  {
+    if (!m_queue->on_worker_thread()) {
+      get_event().wait();
+    }
+  }
+
+  //! make later work on this stream wait for e
+  void wait_for(camp::resources::Event* e)
+  {
+    camp::resources::Event event = *e;
+    enqueue([=]() mutable { event.wait(); });
+  }
+
+  // Memory, host memory is used so allocation happens immediately while
+  // copies and sets are ordered with the work on this stream
+
+  template < typename T >
+  T* allocate(size_t n)
+  {
+    return static_cast<T*>(std::malloc(sizeof(T) * n));
+  }
+  ///
+  template < typename T, typename MemoryAccess >
+  T* allocate(size_t n, MemoryAccess)
+  {
+    return allocate<T>(n);
+  }
+
+  void* calloc(size_t size)
+  {
+    return std::calloc(size, 1);
+  }
+  ///
+  template < typename MemoryAccess >
+  void* calloc(size_t size, MemoryAccess)
+  {
+    return calloc(size);
+  }
+
+  //! free p after the work currently enqueued on this stream has run
+  void deallocate(void* p)
+  {
+    enqueue([=]() { std::free(p); });
+  }
+  ///
+  template < typename MemoryAccess >
+  void deallocate(void* p, MemoryAccess)
+  {
+    deallocate(p);
+  }
+
+  void memcpy(void* dst, const void* src, size_t size)
+  {
+    enqueue([=]() { std::memcpy(dst, src, size); });
+  }
+
+  void memset(void* p, int val, size_t size)
+  {
+    enqueue([=]() { std::memset(p, val, size); });
+  }
+
+  friend inline bool operator==(HostAsync const& lhs, HostAsync const& rhs)
+  {
+    return lhs.m_queue == rhs.m_queue;
+  }
+
+  friend inline bool operator!=(HostAsync const& lhs, HostAsync const& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+private:
+  std::shared_ptr<detail::HostAsyncQueue> m_queue;
+};
+
+}  // namespace resources
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
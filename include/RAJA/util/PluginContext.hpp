@@ -8,14 +8,43 @@
 #ifndef RAJA_plugin_context_HPP
 #define RAJA_plugin_context_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+#include "camp/camp.hpp"
+
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
+#include "RAJA/pattern/params/kernel_name.hpp"
 
 namespace RAJA {
 namespace util {
 
 class KokkosPluginLoader;
 
+namespace detail {
+
+//! Number of plugins that want callbacks, see PluginStrategy.
+RAJASHAREDDLL_API extern std::atomic<int> active_plugin_count;
+
+//! Returns a new id on every call, starting from 1.
+RAJASHAREDDLL_API std::uint64_t new_call_site_id();
+
+} // closing brace for detail namespace
+
+/*!
+ * True when a registered plugin, or a plugin loaded by RuntimePluginLoader
+ * or KokkosPluginLoader, wants callbacks. Loop patterns skip the plugin
+ * calls and building the PluginContext when this is false.
+ */
+RAJA_INLINE bool plugins_active()
+{
+  return detail::active_plugin_count.load(std::memory_order_relaxed) > 0;
+}
+
 struct PluginContext {
   public:
     PluginContext(const Platform p) :
@@ -23,16 +52,146 @@ struct PluginContext {
 
     Platform platform;
 
+    //! Name given with RAJA::expt::KernelName, nullptr if none.
+    const char* kernel_name = nullptr;
+
+    //! Number of iterations of the loop, or of the loop nest, 0 if unknown.
+    std::size_t num_iterations = 0;
+
+    //! Execution policy type as spelled by the compiler.
+    const char* policy = "";
+
+    //! Same for every launch with one policy and loop body type, and
+    //! different otherwise, 0 if unknown. Lambdas have a unique type per
+    //! call site, functor bodies of one type share the id between call
+    //! sites.
+    std::uint64_t call_site_id = 0;
+
   private:
     mutable uint64_t kID;
 
     friend class KokkosPluginLoader;
 };
 
+namespace detail {
+
+//! Name of type T, computed once.
+template <typename T>
+const char* type_name()
+{
+#if defined(__clang__) || defined(__GNUC__)
+  // "... type_name() [with T = X]" or "... type_name() [T = X]"
+  static const std::string name = [](std::string const& f) {
+    const std::size_t b = f.find("T = ");
+    if (b == std::string::npos) return std::string();
+    const std::size_t e = f.find_first_of(";]", b + 4);
+    return f.substr(b + 4, e - b - 4);
+  }(__PRETTY_FUNCTION__);
+#elif defined(_MSC_VER)
+  // "... type_name<X>(void)"
+  static const std::string name = [](std::string const& f) {
+    const std::size_t b = f.find("type_name<");
+    const std::size_t e = f.rfind(">(void)");
+    if (b == std::string::npos || e == std::string::npos) return std::string();
+    return f.substr(b + 10, e - b - 10);
+  }(__FUNCSIG__);
+#else
+  static const std::string name;
+#endif
+  return name.c_str();
+}
+
+//! One id per policy and loop body type.
+template <typename Policy, typename LoopBody>
+std::uint64_t call_site_id()
+{
+  static const std::uint64_t id = new_call_site_id();
+  return id;
+}
+
+RAJA_INLINE const char* kernel_name_of() { return nullptr; }
+
+template <typename... Rest>
+RAJA_INLINE const char* kernel_name_of(
+    RAJA::expt::detail::KernelName const& kernel_name,
+    Rest const&...)
+{
+  return kernel_name.name;
+}
+
+template <typename First, typename... Rest>
+RAJA_INLINE const char* kernel_name_of(First const&, Rest const&... rest)
+{
+  return kernel_name_of(rest...);
+}
+
+template <typename Iterable>
+RAJA_INLINE auto iteration_count(Iterable const& c, int)
+    -> decltype(static_cast<std::size_t>(c.getLength()))
+{
+  return static_cast<std::size_t>(c.getLength());
+}
+
+template <typename Iterable>
+RAJA_INLINE auto iteration_count(Iterable const& c, long)
+    -> decltype(static_cast<std::size_t>(std::distance(std::begin(c),
+                                                        std::end(c))))
+{
+  return static_cast<std::size_t>(std::distance(std::begin(c), std::end(c)));
+}
+
+template <typename Iterable>
+RAJA_INLINE std::size_t iteration_count(Iterable const&, ...)
+{
+  return 0;
+}
+
+template <typename... Segments, camp::idx_t... Is>
+RAJA_INLINE std::size_t iteration_count_nest(
+    camp::tuple<Segments...> const& segments,
+    camp::idx_seq<Is...>)
+{
+  std::size_t count = 1;
+  camp::sink((count *= iteration_count(camp::get<Is>(segments), 0))...);
+  return count;
+}
+
+template <typename... Segments>
+RAJA_INLINE std::size_t iteration_count(camp::tuple<Segments...> const& segments,
+                                        int)
+{
+  return iteration_count_nest(segments,
+                              camp::make_idx_seq_t<sizeof...(Segments)>{});
+}
+
+} // closing brace for detail namespace
+
 template<typename Policy>
 PluginContext make_context()
 {
-  return PluginContext{detail::get_platform<Policy>::value};
+  PluginContext context{detail::get_platform<Policy>::value};
+  if (plugins_active()) {
+    context.policy = detail::type_name<Policy>();
+  }
+  return context;
+}
+
+/*!
+ * Context of one launch of a loop body over an iterable, a TypedIndexSet or
+ * a tuple of segments. params are searched for a RAJA::expt::KernelName.
+ * Only the platform is filled in when no plugin is active.
+ */
+template<typename Policy, typename LoopBody, typename Iterable, typename... Params>
+PluginContext make_context(Iterable const& iterable, Params const&... params)
+{
+  PluginContext context{detail::get_platform<Policy>::value};
+  if (plugins_active()) {
+    context.kernel_name = detail::kernel_name_of(params...);
+    context.num_iterations = detail::iteration_count(iterable, 0);
+    context.policy = detail::type_name<Policy>();
+    context.call_site_id = detail::call_site_id<Policy, LoopBody>();
+  }
+  return context;
 }
 
 } // closing brace for util namespace
@@ -15,12 +15,18 @@
 namespace RAJA {
 namespace util {
 
+/*!
+ * Base class of plugins. A plugin counts as active, so loop patterns call
+ * it, from construction to destruction. Loaders that forward the calls to
+ * plugins they load are constructed with loader_tag and only count as
+ * active while they have loaded something, see setActive.
+ */
 class PluginStrategy
 {
   public:
     RAJASHAREDDLL_API PluginStrategy();
 
-    virtual ~PluginStrategy() = default;
+    virtual RAJASHAREDDLL_API ~PluginStrategy();
 
     virtual RAJASHAREDDLL_API void init(const PluginOptions& p);
 
@@ -33,6 +39,16 @@ class PluginStrategy
     virtual RAJASHAREDDLL_API void postLaunch(const PluginContext& p);
 
     virtual RAJASHAREDDLL_API void finalize();
+
+  protected:
+    struct loader_tag {};
+
+    RAJASHAREDDLL_API explicit PluginStrategy(loader_tag);
+
+    RAJASHAREDDLL_API void setActive(bool active);
+
+  private:
+    bool m_active = false;
 };
 
 using PluginRegistry = Registry<PluginStrategy>;
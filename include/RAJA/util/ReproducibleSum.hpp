@@ -0,0 +1,508 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing an order independent floating point sum.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ReproducibleSum_HPP
+#define RAJA_util_ReproducibleSum_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Floating point sum whose result does not depend on the order in
+ *         which values are added or partial sums are combined.
+ *
+ * Values are accumulated in binned floating point folds, as in ReproBLAS.
+ * Bins are 40 bits wide and lie on a fixed exponent grid. The sum keeps the
+ * three highest bins needed by the largest magnitude value added so far.
+ * Adding a value splits it into the parts that fall in those bins, each
+ * part is added exactly to its bin with ordinary floating point adds, and
+ * the part below the lowest bin is rounded off. Since every bin boundary is
+ * fixed, each value contributes the same parts to the bins of the final
+ * window in any order, so results are bitwise identical for any thread
+ * count or schedule. The error before the final rounding is at most
+ * max(2^-80 * max|value|, 2^-1035) per value added.
+ *
+ * Values are buffered and split a batch at a time. Each bin has a fold per
+ * SIMD lane, so a batch is split with vector adds and no lane waits on the
+ * adds of another. The lanes are summed exactly when sums are combined and
+ * in get().
+ *
+ * Values too large for the grid, above 2^1005 in magnitude, are accumulated
+ * exactly in a fixed point superaccumulator (as in Neal's small
+ * superaccumulator), which is also used to round the result to T once, in
+ * get(). Infinities and NaNs are accumulated separately with ordinary
+ * floating point arithmetic, any NaN or infinities of both signs give NaN.
+ *
+ * Usable as the value type of RAJA::expt::Reduce<RAJA::operators::plus>.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class ReproducibleSum
+{
+  static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value,
+                "ReproducibleSum supports float and double");
+
+public:
+  using value_type = T;
+
+  ReproducibleSum() { set_window(num_folds); }
+
+  ReproducibleSum(T val) : ReproducibleSum() { operator+=(val); }
+
+  //! add a value to the sum
+  RAJA_INLINE ReproducibleSum& operator+=(T val)
+  {
+    m_batch[m_batch_count] = static_cast<double>(val);
+    if (++m_batch_count % batch_size == 0) {
+      deposit_previous_batch();
+    }
+    return *this;
+  }
+
+  //! add another sum to this sum
+  ReproducibleSum& operator+=(ReproducibleSum const& other)
+  {
+    ReproducibleSum tmp(other);
+    tmp.flush();
+    flush();
+    if (tmp.m_top > m_top) {
+      raise_window(tmp.m_top);
+    } else if (tmp.m_top < m_top) {
+      tmp.raise_window(m_top);
+    }
+    renormalize();
+    tmp.renormalize();
+    for (int k = 0; k < num_folds; ++k) {
+      for (int l = 0; l < num_lanes; ++l) {
+        m_fold[k][l] += tmp.m_fold[k][l] - m_anchor[k];
+      }
+      m_carry[k] += tmp.m_carry[k];
+    }
+    renormalize();
+
+    m_exact += tmp.m_exact;
+    m_special += tmp.m_special;
+    return *this;
+  }
+
+  friend ReproducibleSum operator+(ReproducibleSum lhs,
+                                   ReproducibleSum const& rhs)
+  {
+    lhs += rhs;
+    return lhs;
+  }
+
+  //! the sum rounded to T
+  T get() const
+  {
+    ReproducibleSum sum(*this);
+    sum.flush();
+    if (sum.m_special != 0.0) {
+      return static_cast<T>(sum.m_special);
+    }
+
+    Superaccumulator total(sum.m_exact);
+    for (int k = 0; k < num_folds; ++k) {
+      const int bin = sum.m_top - k;
+      for (int l = 0; l < num_lanes; ++l) {
+        total.add(sum.m_fold[k][l] - sum.m_anchor[k]);
+      }
+      total.add_scaled(sum.m_carry[k], fold_bits * bin + carry_bits);
+    }
+    return static_cast<T>(total.round());
+  }
+
+  explicit operator T() const { return get(); }
+
+private:
+  // exponent of the least significant bit of the grid, the smallest
+  // subnormal
+  static constexpr int min_exponent = -1074;
+
+  //! exact fixed point sum of doubles in bins of 32 bits
+  class Superaccumulator
+  {
+  public:
+    RAJA_INLINE void add(double val)
+    {
+      std::uint64_t bits;
+      std::memcpy(&bits, &val, sizeof(bits));
+
+      std::uint64_t exponent = (bits >> 52) & 0x7ffu;
+      std::uint64_t mantissa = bits & ((std::uint64_t(1) << 52) - 1u);
+
+      if (exponent != 0u) {
+        mantissa |= std::uint64_t(1) << 52;
+      } else {
+        exponent = 1u;  // subnormal
+      }
+
+      // val = +-mantissa * 2^(pos + min_exponent)
+      add_digits(mantissa,
+                 static_cast<int>(exponent) - 1,
+                 -static_cast<std::int64_t>(bits >> 63));
+    }
+
+    //! add c * 2^(pos + min_exponent)
+    void add_scaled(std::int64_t c, int pos)
+    {
+      const std::int64_t sign = c < 0 ? -1 : 0;
+      const std::uint64_t magnitude =
+          c < 0 ? std::uint64_t(0) - static_cast<std::uint64_t>(c)
+                : static_cast<std::uint64_t>(c);
+      add_digits(magnitude, pos, sign);
+    }
+
+    Superaccumulator& operator+=(Superaccumulator const& other)
+    {
+      Superaccumulator tmp(other);
+      tmp.normalize();
+      normalize();
+      for (int i = 0; i < num_bins; ++i) {
+        m_bins[i] += tmp.m_bins[i];
+      }
+      normalize();
+      return *this;
+    }
+
+    //! the sum rounded to double
+    double round() const
+    {
+      Superaccumulator tmp(*this);
+      tmp.normalize();
+
+      // convert to sign and magnitude so every bin is a non-negative digit
+      const bool negative = tmp.m_bins[num_bins-1] < 0;
+      if (negative) {
+        for (int i = 0; i < num_bins; ++i) {
+          tmp.m_bins[i] = -tmp.m_bins[i];
+        }
+        tmp.normalize();
+      }
+
+      // add digits from most significant, this order depends only on the
+      // value
+      double result = 0.0;
+      for (int i = num_bins-1; i >= 0; --i) {
+        if (tmp.m_bins[i] != 0) {
+          result += std::ldexp(static_cast<double>(tmp.m_bins[i]),
+                               bin_bits * i + min_exponent);
+        }
+      }
+
+      return negative ? -result : result;
+    }
+
+  private:
+    static constexpr int bin_bits = 32;
+    // bits 0 to 2098 cover every finite double, extra bins take the carries
+    // of the folds and of normalization
+    static constexpr int num_bins = 68;
+    // normalized bins are below 2^32 and each add changes a bin by less
+    // than 2^52, so 1024 adds can not overflow
+    static constexpr std::int64_t max_unnormalized_count = 1024;
+
+    std::int64_t m_bins[num_bins] = {};
+    std::int64_t m_count = 0;
+
+    //! add +-magnitude * 2^(pos + min_exponent), sign is 0 or -1
+    RAJA_INLINE void add_digits(std::uint64_t magnitude,
+                                int pos,
+                                std::int64_t sign)
+    {
+      const int bin = pos / bin_bits;
+      const int shift = pos % bin_bits;
+
+      // split the shifted magnitude into 32 bit digits
+      const std::uint64_t mask = 0xffffffffu;
+      const std::int64_t d0 = static_cast<std::int64_t>((magnitude << shift) & mask);
+      const std::int64_t d1 = static_cast<std::int64_t>(
+          (shift == 0 ? magnitude >> bin_bits
+                      : magnitude >> (bin_bits - shift)) & mask);
+      const std::int64_t d2 = static_cast<std::int64_t>(
+          shift == 0 ? 0u : magnitude >> (2 * bin_bits - shift));
+
+      // negate without branching, signs of summed values are unpredictable
+      m_bins[bin] += (d0 ^ sign) - sign;
+      m_bins[bin+1] += (d1 ^ sign) - sign;
+      if (d2 != 0) {
+        m_bins[bin+2] += (d2 ^ sign) - sign;
+      }
+
+      if (++m_count >= max_unnormalized_count) {
+        normalize();
+      }
+    }
+
+    //! propagate carries so bins below the top bin are in [0, 2^32)
+    void normalize()
+    {
+      constexpr std::int64_t radix = std::int64_t(1) << bin_bits;
+      for (int i = 0; i < num_bins-1; ++i) {
+        const std::int64_t digit = m_bins[i] & (radix - 1);
+        m_bins[i+1] += (m_bins[i] - digit) / radix;
+        m_bins[i] = digit;
+      }
+      m_count = 0;
+    }
+  };
+
+  // width of the bins of the folds, bin b has its least significant bit at
+  // 2^(fold_bits * b + min_exponent)
+  static constexpr int fold_bits = 40;
+  static constexpr int num_folds = 3;
+  // highest bin whose anchor is finite, values of 2^1005 and above go to
+  // the superaccumulator
+  static constexpr int max_top_bin = 51;
+  // renormalization moves multiples of 2^carry_bits units of a bin to its
+  // carry, leaving at most 2^49 units. Each add changes a bin by less than
+  // 2^40 units and a fold stays in [2^52, 2^53) units for less than 2^51
+  // units of change, so 1024 adds can not leave the binade.
+  static constexpr int carry_bits = 50;
+  static constexpr std::int64_t max_unnormalized_count = 1024;
+  // folds per bin, eight doubles fill an AVX-512 register or two AVX
+  // registers
+  static constexpr int num_lanes = 8;
+  // values split at once, lane l of the folds takes values l,
+  // l + num_lanes, ... of a batch
+  static constexpr int batch_size = 4 * num_lanes;
+
+  //! anchor(bin) + u * bin units, each lane holds part of the units of
+  //! each bin of the window
+  double m_fold[num_folds][num_lanes];
+  //! anchor of each bin of the window
+  double m_anchor[num_folds];
+  //! multiples of 2^carry_bits units moved out of the folds of each bin
+  std::int64_t m_carry[num_folds];
+  //! the window is bins m_top down to m_top - num_folds + 1
+  int m_top;
+  //! values below m_bound in magnitude fit the window
+  double m_bound;
+  //! most adds to any fold since the last renormalization
+  std::int64_t m_count = 0;
+
+  //! two batches of values. The lower half holds values [0, m_batch_count)
+  //! and, until it is full, the upper half holds the previous batch, which
+  //! is zeros, adding nothing, while there is none.
+  double m_batch[2 * batch_size] = {};
+  int m_batch_count = 0;
+
+  Superaccumulator m_exact;
+  double m_special = 0.0;
+
+  //! 1.5 * 2^52 units of bin, the fold of bin has ulp 1 unit while it is
+  //! in [2^52, 2^53) units
+  static double anchor(int bin)
+  {
+    return std::ldexp(1.5, 52 + fold_bits * bin + min_exponent);
+  }
+
+  //! split the half of the buffer that did not just fill. Each half is
+  //! split while the other fills, so the vector loads of a batch do not
+  //! wait on the stores that wrote it.
+  void deposit_previous_batch()
+  {
+    if (m_batch_count == batch_size) {
+      deposit_batch(m_batch + batch_size);
+    } else {
+      deposit_batch(m_batch);
+      m_batch_count = 0;
+    }
+  }
+
+  //! split batch_size values into the folds, with vector adds when all of
+  //! them fit the window
+  void deposit_batch(double const* values)
+  {
+    const double bound = m_bound;
+    // a double flag, so that the check is vectorized without AVX too
+    double outside = 0.0;
+    for (int i = 0; i < batch_size; ++i) {
+      // values above the window, infinities and NaNs
+      outside = std::fabs(values[i]) < bound ? outside : 1.0;
+    }
+    if (outside != 0.0) {
+      for (int i = 0; i < batch_size; ++i) {
+        add(values[i]);
+      }
+      return;
+    }
+
+    for (int b = 0; b < batch_size; b += num_lanes) {
+      deposit_lanes(values + b);
+    }
+    m_count += batch_size / num_lanes;
+    if (m_count >= max_unnormalized_count) {
+      renormalize();
+    }
+  }
+
+  //! deposit num_lanes values that fit the window, one in each lane.
+  //! Parts are rounded against the fixed anchor of their bin, so they do
+  //! not depend on the fold or the lane they are added to.
+  RAJA_INLINE void deposit_lanes(double const* values)
+  {
+    double x[num_lanes];
+    for (int l = 0; l < num_lanes; ++l) {
+      x[l] = values[l];
+    }
+    for (int k = 0; k < num_folds; ++k) {
+      const double anchor = m_anchor[k];
+      for (int l = 0; l < num_lanes; ++l) {
+        const double part = (anchor + x[l]) - anchor;
+        m_fold[k][l] += part;
+        x[l] -= part;
+      }
+    }
+  }
+
+  //! split the buffered values and empty the buffer
+  void flush()
+  {
+    if (m_batch_count < batch_size) {
+      deposit_batch(m_batch + batch_size);
+      for (int i = 0; i < m_batch_count; ++i) {
+        add(m_batch[i]);
+      }
+    } else {
+      deposit_batch(m_batch);
+      for (int i = batch_size; i < m_batch_count; ++i) {
+        add(m_batch[i]);
+      }
+    }
+    for (int i = batch_size; i < 2 * batch_size; ++i) {
+      m_batch[i] = 0.0;
+    }
+    m_batch_count = 0;
+  }
+
+  //! add one value, inside the window or not
+  void add(double x)
+  {
+    // false for values above the window, infinities and NaNs
+    if (!(std::fabs(x) < m_bound)) {
+      add_outside_window(x);
+    } else {
+      deposit(x);
+    }
+  }
+
+  //! add the parts of x in the bins of the window to the first lane,
+  //! |x| < m_bound
+  RAJA_INLINE void deposit(double x)
+  {
+    // each fold takes x rounded to its unit, the exact remainder goes to
+    // the next fold and is rounded off by the last one
+    for (int k = 0; k < num_folds; ++k) {
+      const double part = (m_anchor[k] + x) - m_anchor[k];
+      m_fold[k][0] += part;
+      x -= part;
+    }
+
+    if (++m_count >= max_unnormalized_count) {
+      renormalize();
+    }
+  }
+
+  void add_outside_window(double x)
+  {
+    if (!std::isfinite(x)) {
+      m_special += x;
+      return;
+    }
+
+    // smallest top bin with |x| < 2^(fold_bits - 1) units of it, then x
+    // has no part in any bin above the window
+    const int exponent = std::ilogb(x) + 1;
+    const int top = (exponent - (fold_bits - 1) - min_exponent + fold_bits - 1) /
+                    fold_bits;
+    if (top > max_top_bin) {
+      m_exact.add(x);
+      return;
+    }
+    raise_window(top);
+    deposit(x);
+  }
+
+  //! empty window with top bin top
+  void set_window(int top)
+  {
+    m_top = top;
+    m_bound = std::ldexp(1.0, fold_bits * top + min_exponent + fold_bits - 1);
+    for (int k = 0; k < num_folds; ++k) {
+      m_anchor[k] = anchor(top - k);
+      for (int l = 0; l < num_lanes; ++l) {
+        m_fold[k][l] = m_anchor[k];
+      }
+      m_carry[k] = 0;
+    }
+  }
+
+  //! move the window up to top bin top, dropping the bins below it
+  void raise_window(int top)
+  {
+    const int shift = top - m_top;
+    double fold[num_folds][num_lanes];
+    std::int64_t carry[num_folds];
+    for (int k = 0; k < num_folds; ++k) {
+      for (int l = 0; l < num_lanes; ++l) {
+        fold[k][l] = m_fold[k][l];
+      }
+      carry[k] = m_carry[k];
+    }
+    set_window(top);
+    for (int k = shift; k < num_folds; ++k) {
+      for (int l = 0; l < num_lanes; ++l) {
+        m_fold[k][l] = fold[k - shift][l];
+      }
+      m_carry[k] = carry[k - shift];
+    }
+  }
+
+  //! move multiples of 2^carry_bits units of each fold to its carry
+  void renormalize()
+  {
+    for (int k = 0; k < num_folds; ++k) {
+      const int carry_exponent =
+          fold_bits * (m_top - k) + min_exponent + carry_bits;
+      for (int l = 0; l < num_lanes; ++l) {
+        const double units = m_fold[k][l] - m_anchor[k];
+        const double carry =
+            std::floor(std::ldexp(units, -carry_exponent) + 0.5);
+        m_fold[k][l] -= std::ldexp(carry, carry_exponent);
+        m_carry[k] += static_cast<std::int64_t>(carry);
+      }
+    }
+    m_count = 0;
+  }
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,186 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for run time tuning of tile sizes.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_TileTuner_HPP
+#define RAJA_util_TileTuner_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "camp/number.hpp"
+
+#include "RAJA/util/Timer.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Online search for the tile sizes of a kernel.
+ *
+ *         A kernel is identified by a name and a problem shape, e.g. the
+ *         extents of the loops it tiles. While a kernel is being tuned,
+ *         each run gets the next configuration from the cartesian product of
+ *         the candidate sizes of its tiled dimensions. Each configuration is
+ *         run trials times and keeps its fastest time. Once all of them have
+ *         run, the fastest one is used from then on.
+ *
+ *         Candidates larger than the extent of a dimension are dropped,
+ *         except the smallest of them, which makes the dimension a single
+ *         tile.
+ *
+ *         Tuned sizes are kept per name and shape. A tuner made with a path
+ *         loads the sizes saved in that file and saves them back when it is
+ *         destroyed, so that later runs start tuned. The file is plain text,
+ *         one kernel per line; use one file per machine type.
+ *
+ *         \verbatim
+ *
+ *         RAJA::TileTuner tuner("tiles-" + node_type + ".txt");
+ *
+ *         tuner.run("transpose", {N, M}, 2,
+ *                   [&](RAJA::TileTuner::Sizes const& tile) {
+ *           RAJA::launch<launch_pol>(params, [=](RAJA::LaunchContext ctx) {
+ *             RAJA::tile<tile_pol>(ctx, tile[1], RAJA::RangeSegment(0, M),
+ *                                  [&](RAJA::RangeSegment const& rows) {
+ *               ...
+ *           });
+ *         });
+ *
+ *         \endverbatim
+ *
+ *         Runs are timed on the host with RAJA::Timer, so device kernels
+ *         must complete before the body of run returns.
+ *
+ ******************************************************************************
+ */
+class RAJASHAREDDLL_API TileTuner
+{
+public:
+  using Sizes = std::vector<camp::idx_t>;
+  using Shape = std::vector<Index_type>;
+
+  //! Default candidate sizes for each tiled dimension
+  static std::vector<camp::idx_t> defaultCandidates();
+
+  explicit TileTuner(std::vector<camp::idx_t> candidates = defaultCandidates(),
+                     int trials = 2);
+
+  ///
+  /// Make a tuner that loads the sizes saved in the file at path, if any,
+  /// and saves its sizes there when it is destroyed.
+  ///
+  explicit TileTuner(std::string path,
+                     std::vector<camp::idx_t> candidates = defaultCandidates(),
+                     int trials = 2);
+
+  TileTuner(const TileTuner&) = delete;
+  TileTuner& operator=(const TileTuner&) = delete;
+
+  ~TileTuner();
+
+  ///
+  /// Tile sizes for the next run of kernel name with the given shape,
+  /// ndims sizes. shape[d] is the extent of dimension d, dimensions past
+  /// the end of shape or with extent 0 keep all candidates.
+  ///
+  Sizes next(const std::string& name, const Shape& shape, size_t ndims);
+
+  ///
+  /// Record that a run of kernel name with the given shape and sizes, as
+  /// returned by next, took seconds.
+  ///
+  void record(const std::string& name,
+              const Shape& shape,
+              const Sizes& sizes,
+              double seconds);
+
+  ///
+  /// Call body(sizes) with the sizes from next, timed with RAJA::Timer while
+  /// the kernel is being tuned.
+  ///
+  template <typename BODY>
+  void run(const std::string& name,
+           const Shape& shape,
+           size_t ndims,
+           BODY&& body)
+  {
+    const Sizes sizes = next(name, shape, ndims);
+    if (isTuned(name, shape)) {
+      body(sizes);
+      return;
+    }
+    RAJA::Timer timer;
+    timer.start();
+    body(sizes);
+    timer.stop();
+    record(name, shape, sizes, timer.elapsed());
+  }
+
+  //! Whether the search for kernel name with the given shape is done
+  bool isTuned(const std::string& name, const Shape& shape) const;
+
+  //! Tuned sizes of kernel name with the given shape, empty if not tuned
+  Sizes getTuned(const std::string& name, const Shape& shape) const;
+
+  //! Use sizes for kernel name with the given shape, without a search
+  void setTuned(const std::string& name, const Shape& shape, const Sizes& sizes);
+
+  //! Add the tuned sizes saved in the file at path, returns false if the
+  //! file cannot be read
+  bool load(const std::string& path);
+
+  //! Save all tuned sizes to the file at path, returns false on error
+  bool save(const std::string& path) const;
+
+private:
+  struct Entry {
+    bool tuned = false;
+    Sizes best;
+    double best_time = 0.0;
+
+    //! configurations searched and the fastest time of each
+    std::vector<Sizes> configs;
+    std::vector<double> times;
+    size_t issued = 0;
+    size_t completed = 0;
+  };
+
+  static std::string makeKey(const std::string& name, const Shape& shape);
+
+  std::vector<Sizes> makeConfigs(const Shape& shape, size_t ndims) const;
+
+  std::vector<camp::idx_t> m_candidates;
+  int m_trials;
+  std::string m_path;
+
+  mutable std::mutex m_mutex;
+  std::map<std::string, Entry> m_entries;
+  bool m_dirty;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -280,6 +280,44 @@ struct AtomicViewWrapper<ViewType, RAJA::seq_atomic> {
 };
 
 
+/*
+ * Specialized AtomicViewWrapper for combining_atomic, each copy buffers
+ * adds in its own cache and flushes them when destroyed
+ */
+template <typename ViewType, typename FlushPolicy, size_t CacheEntries>
+struct AtomicViewWrapper<ViewType,
+                         RAJA::combining_atomic_explicit<FlushPolicy,
+                                                         CacheEntries>> {
+  using base_type = ViewType;
+  using pointer_type = typename base_type::pointer_type;
+  using value_type = typename base_type::value_type;
+  using cache_type = RAJA::detail::
+      CombiningAtomicCache<value_type, FlushPolicy, CacheEntries>;
+  using atomic_type = RAJA::detail::CombiningAtomicRef<value_type, cache_type>;
+
+  base_type base_;
+  mutable cache_type cache_;
+
+  RAJA_INLINE
+  explicit AtomicViewWrapper(ViewType const &view) : base_{view} {}
+
+  RAJA_INLINE void set_data(pointer_type data_ptr)
+  {
+    cache_.flush();
+    base_.set_data(data_ptr);
+  }
+
+  //! write the adds buffered in this copy
+  RAJA_INLINE void flush() const { cache_.flush(); }
+
+  template <typename... ARGS>
+  RAJA_INLINE atomic_type operator()(ARGS &&... args) const
+  {
+    return atomic_type(cache_, &base_.operator()(std::forward<ARGS>(args)...));
+  }
+};
+
+
 template <typename AtomicPolicy, typename ViewType>
 RAJA_INLINE AtomicViewWrapper<ViewType, AtomicPolicy> make_atomic_view(
     ViewType const &view)
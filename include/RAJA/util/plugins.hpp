@@ -32,6 +32,10 @@ RAJA_INLINE
 void
 callPreCapturePlugins(const PluginContext& p)
 {
+  if (!plugins_active()) {
+    return;
+  }
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -44,6 +48,10 @@ RAJA_INLINE
 void
 callPostCapturePlugins(const PluginContext& p)
 {
+  if (!plugins_active()) {
+    return;
+  }
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -56,6 +64,10 @@ RAJA_INLINE
 void
 callPreLaunchPlugins(const PluginContext& p)
 {
+  if (!plugins_active()) {
+    return;
+  }
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -68,6 +80,10 @@ RAJA_INLINE
 void
 callPostLaunchPlugins(const PluginContext& p)
 {
+  if (!plugins_active()) {
+    return;
+  }
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -21,6 +21,7 @@
 #define RAJA_resource_HPP
 
 #include "camp/resource.hpp"
+#include "RAJA/util/HostAsync.hpp"
 #if defined(RAJA_CUDA_ACTIVE)
 #include "RAJA/policy/cuda/policy.hpp"
 #endif
@@ -153,6 +154,7 @@ namespace RAJA
   {
     template <typename T> struct is_resource : std::false_type {};
     template <> struct is_resource<resources::Host> : std::true_type {};
+    template <> struct is_resource<resources::HostAsync> : std::true_type {};
 #if defined(RAJA_CUDA_ACTIVE)
     template <> struct is_resource<resources::Cuda> : std::true_type {};
 #endif
@@ -0,0 +1,363 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing the parallel selection used by host sort
+*          backends for nth_element, partial_sort and top_k.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_select_HPP
+#define RAJA_util_select_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/sort.hpp"
+#include "RAJA/util/zip.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+    \brief ranges at most this long are selected by one thread
+*/
+struct sample_select_serial_cutoff
+{
+  static constexpr size_t get() { return 1 << 14; }
+};
+
+/*!
+    \brief number of keys sampled to choose the splitters of a round
+*/
+struct sample_select_num_samples
+{
+  static constexpr size_t get() { return 1024; }
+};
+
+/*!
+    \brief stand-in for the values of sample_select on keys only
+*/
+struct NoSelectVals
+{
+};
+
+//@{
+/*!
+    \brief buffer for the values moved along with the keys
+*/
+template <typename ValIter>
+struct SelectValBuffer
+{
+  using diff_type = IterDiff<ValIter>;
+
+  void resize(size_t n) { buf.resize(n); }
+
+  void save(ValIter vals, diff_type from, diff_type to) { buf[to] = vals[from]; }
+
+  void restore(ValIter vals, diff_type i) { vals[i] = buf[i]; }
+
+  std::vector<IterVal<ValIter>> buf;
+};
+
+template <>
+struct SelectValBuffer<NoSelectVals>
+{
+  void resize(size_t) {}
+
+  template <typename diff_type>
+  void save(NoSelectVals, diff_type, diff_type) {}
+
+  template <typename diff_type>
+  void restore(NoSelectVals, diff_type) {}
+};
+//@}
+
+//@{
+/*!
+    \brief select nth in place using one thread
+*/
+template <typename KeyIter, typename Compare>
+void serial_select(KeyIter keys, NoSelectVals,
+                   IterDiff<KeyIter> n, IterDiff<KeyIter> nth, Compare comp)
+{
+  detail::intro_select(keys, keys + nth, keys + n, comp);
+}
+
+template <typename KeyIter, typename ValIter, typename Compare>
+void serial_select(KeyIter keys, ValIter vals,
+                   IterDiff<KeyIter> n, IterDiff<KeyIter> nth, Compare comp)
+{
+  auto begin = RAJA::zip(keys, vals);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  detail::intro_select(begin, begin + nth, begin + n,
+                       RAJA::compare_first<zip_ref>(comp));
+}
+//@}
+
+/*!
+    \brief bucket of key relative to the splitters lo and hi,
+    0 if before lo, 2 if after hi, and 1 otherwise
+*/
+template <typename T, typename Compare>
+RAJA_INLINE int select_bucket(T const& key, T const& lo, T const& hi,
+                              Compare& comp)
+{
+  return comp(key, lo) ? 0 : (comp(hi, key) ? 2 : 1);
+}
+
+/*!
+    \brief narrow down the keys in [src, src+n) that may be nth in sorted
+    order to those between two splitters chosen from a sample, copied to out.
+
+    Returns 0 if the nth key is found, and 1 if the candidates were narrowed
+    to fewer than n keys.
+*/
+template <typename Iter, typename diff_type, typename Compare,
+          typename ForChunks>
+int sample_select_round(Iter src,
+                        diff_type n,
+                        diff_type& nth,
+                        Compare comp,
+                        int num_chunks,
+                        ForChunks& for_chunks,
+                        std::vector<IterVal<Iter>>& out,
+                        IterVal<Iter>& found)
+{
+  using T = IterVal<Iter>;
+
+  // sorted sample with one key from each of num_samples equal parts
+  const diff_type num_samples = std::min(
+      n, static_cast<diff_type>(sample_select_num_samples::get()));
+  const diff_type part = n / num_samples;
+  std::vector<T> sample;
+  sample.reserve(num_samples);
+  std::uint64_t rng = 0x9E3779B97F4A7C15ull;
+  for (diff_type s = 0; s < num_samples; ++s) {
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    sample.push_back(src[s * part + static_cast<diff_type>(rng % part)]);
+  }
+  std::sort(sample.begin(), sample.end(), comp);
+
+  // splitters around the expected position of nth in the sample
+  const diff_type rank = static_cast<diff_type>(
+      (static_cast<double>(nth) * num_samples) / n);
+  const diff_type spread = num_samples / 16;
+  T lo = sample[std::max(rank - spread, diff_type(0))];
+  T hi = sample[std::min(rank + spread, num_samples - 1)];
+
+  std::vector<diff_type> counts(3 * num_chunks, 0);
+  diff_type totals[3] = {0, 0, 0};
+  auto count_buckets = [&]() {
+    for_chunks(num_chunks, [&](int c) {
+      Compare chunk_comp(comp);
+      diff_type chunk_counts[3] = {0, 0, 0};
+      const diff_type i_end = firstIndex(n, num_chunks, c + 1);
+      for (diff_type i = firstIndex(n, num_chunks, c); i < i_end; ++i) {
+        ++chunk_counts[select_bucket<T>(src[i], lo, hi, chunk_comp)];
+      }
+      for (int b = 0; b < 3; ++b) {
+        counts[3 * c + b] = chunk_counts[b];
+      }
+    });
+
+    for (int b = 0; b < 3; ++b) {
+      totals[b] = 0;
+    }
+    for (int c = 0; c < num_chunks; ++c) {
+      for (int b = 0; b < 3; ++b) {
+        totals[b] += counts[3 * c + b];
+      }
+    }
+  };
+  count_buckets();
+
+  // with few distinct keys all of them may lie between the splitters,
+  // split at the key at rank instead, the keys equal to it are then
+  // either the nth key or excluded
+  if (totals[1] == n && comp(lo, hi)) {
+    lo = sample[rank];
+    hi = lo;
+    count_buckets();
+  }
+
+  int bucket = 0;
+  if (nth >= totals[0]) {
+    nth -= totals[0];
+    bucket = 1;
+    if (nth >= totals[1]) {
+      nth -= totals[1];
+      bucket = 2;
+    }
+  }
+
+  // all candidates are equal to the splitters
+  if (bucket == 1 && !comp(lo, hi)) {
+    found = lo;
+    return 0;
+  }
+
+  std::vector<diff_type> offsets(num_chunks + 1, 0);
+  for (int c = 0; c < num_chunks; ++c) {
+    offsets[c + 1] = offsets[c] + counts[3 * c + bucket];
+  }
+  out.resize(totals[bucket]);
+  for_chunks(num_chunks, [&](int c) {
+    Compare chunk_comp(comp);
+    diff_type o = offsets[c];
+    const diff_type i_end = firstIndex(n, num_chunks, c + 1);
+    for (diff_type i = firstIndex(n, num_chunks, c); i < i_end; ++i) {
+      if (select_bucket<T>(src[i], lo, hi, chunk_comp) == bucket) {
+        out[o++] = src[i];
+      }
+    }
+  });
+  return 1;
+}
+
+/*!
+    \brief find the key that would be at nth in sorted order, without
+    moving keys, narrowing the candidates in parallel rounds
+*/
+template <typename KeyIter, typename Compare, typename ForChunks>
+IterVal<KeyIter> sample_select_key(KeyIter keys,
+                                   IterDiff<KeyIter> n,
+                                   IterDiff<KeyIter> nth,
+                                   Compare comp,
+                                   int num_chunks,
+                                   ForChunks& for_chunks)
+{
+  using T = IterVal<KeyIter>;
+  using diff_type = IterDiff<KeyIter>;
+  const diff_type cutoff =
+      static_cast<diff_type>(sample_select_serial_cutoff::get());
+
+  std::vector<T> bufs[2];
+  T found = keys[nth];
+
+  int state = sample_select_round(
+      keys, n, nth, comp, num_chunks, for_chunks, bufs[0], found);
+  int cur = 0;
+  while (state == 1 && static_cast<diff_type>(bufs[cur].size()) > cutoff) {
+    state = sample_select_round(bufs[cur].begin(),
+                                static_cast<diff_type>(bufs[cur].size()),
+                                nth, comp, num_chunks, for_chunks,
+                                bufs[1 - cur], found);
+    if (state == 1) {
+      cur = 1 - cur;
+    }
+  }
+  if (state == 0) {
+    return found;
+  }
+
+  std::nth_element(bufs[cur].begin(), bufs[cur].begin() + nth,
+                   bufs[cur].end(), comp);
+  return bufs[cur][nth];
+}
+
+/*!
+    \brief unstable parallel sample select of the keys in [keys, keys+n),
+    and the values in [vals, vals+n) if vals is not NoSelectVals
+
+    Moves the key that would be at nth in sorted order to nth, with no key in
+    [0, nth) after it and no key in (nth, n) before it. The nth key is found
+    with rounds of counting the keys between two splitters chosen from a
+    sample, then keys and values are partitioned around it in one pass.
+    for_chunks(num_chunks, func) must call func(c) for each chunk c in
+    [0, num_chunks) in parallel.
+*/
+template <typename KeyIter, typename ValIter, typename Compare,
+          typename ForChunks>
+void sample_select(KeyIter keys,
+                   ValIter vals,
+                   IterDiff<KeyIter> n,
+                   IterDiff<KeyIter> nth,
+                   Compare comp,
+                   int num_chunks,
+                   ForChunks&& for_chunks)
+{
+  using T = IterVal<KeyIter>;
+  using diff_type = IterDiff<KeyIter>;
+
+  if (nth < 0 || nth >= n) {
+    return;
+  }
+  if (n <= static_cast<diff_type>(sample_select_serial_cutoff::get())) {
+    serial_select(keys, vals, n, nth, comp);
+    return;
+  }
+
+  const T key = sample_select_key(keys, n, nth, comp, num_chunks, for_chunks);
+
+  // count keys before, equivalent to, and after the nth key
+  std::vector<diff_type> offsets(3 * num_chunks, 0);
+  for_chunks(num_chunks, [&](int c) {
+    Compare chunk_comp(comp);
+    diff_type chunk_counts[3] = {0, 0, 0};
+    const diff_type i_end = firstIndex(n, num_chunks, c + 1);
+    for (diff_type i = firstIndex(n, num_chunks, c); i < i_end; ++i) {
+      ++chunk_counts[select_bucket<T>(keys[i], key, key, chunk_comp)];
+    }
+    for (int b = 0; b < 3; ++b) {
+      offsets[3 * c + b] = chunk_counts[b];
+    }
+  });
+
+  // exclusive scan in bucket major order gives where each chunk writes
+  diff_type offset = 0;
+  for (int b = 0; b < 3; ++b) {
+    for (int c = 0; c < num_chunks; ++c) {
+      const diff_type count = offsets[3 * c + b];
+      offsets[3 * c + b] = offset;
+      offset += count;
+    }
+  }
+
+  std::vector<T> key_buf(n);
+  SelectValBuffer<ValIter> val_buf;
+  val_buf.resize(n);
+  for_chunks(num_chunks, [&](int c) {
+    Compare chunk_comp(comp);
+    diff_type o[3] = {offsets[3 * c], offsets[3 * c + 1], offsets[3 * c + 2]};
+    const diff_type i_end = firstIndex(n, num_chunks, c + 1);
+    for (diff_type i = firstIndex(n, num_chunks, c); i < i_end; ++i) {
+      const diff_type to = o[select_bucket<T>(keys[i], key, key, chunk_comp)]++;
+      key_buf[to] = keys[i];
+      val_buf.save(vals, i, to);
+    }
+  });
+  for_chunks(num_chunks, [&](int c) {
+    const diff_type i_end = firstIndex(n, num_chunks, c + 1);
+    for (diff_type i = firstIndex(n, num_chunks, c); i < i_end; ++i) {
+      keys[i] = key_buf[i];
+      val_buf.restore(vals, i);
+    }
+  });
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -438,6 +438,78 @@ intro_sort(Iter begin,
   detail::intro_sort_depth(begin, end, comp, max_depth);
 }
 
+/*!
+    \brief unstable intro select given range inplace using comparison function,
+    moves the item that would be at nth in sorted order to nth with no item
+    in [begin, nth) after it and no item in (nth, end) before it,
+    using O(N) comparisons on average and O(N*lg(N)) in the worst case
+    and O(1) memory
+*/
+template <typename Iter, typename Compare>
+RAJA_HOST_DEVICE inline
+void
+intro_select(Iter begin,
+             Iter nth,
+             Iter end,
+             Compare comp)
+{
+  using RAJA::safe_iter_swap;
+  using diff_type = ::RAJA::detail::IterDiff<Iter>;
+
+  // cutoff to use insertion sort
+  constexpr diff_type insertion_sort_cutoff =
+      static_cast<diff_type>(intro_sort_insertion_sort_cutoff::get());
+
+  // switch to heap sort after 2*lg(N) partitions, as in intro_sort
+  unsigned depth = 2*detail::ulog2(end - begin);
+
+  while (end - begin >= insertion_sort_cutoff) {
+
+    if (depth == 0) {
+      detail::heap_sort(begin, end, comp);
+      return;
+    }
+    --depth;
+
+    // choose pivot with median of 3 and swap it to last
+    Iter mid = begin + (end - begin)/2;
+    Iter last = end-1;
+    Iter pivot = comp(*begin, *mid)
+                    ? ( comp(*mid, *last)
+                           ? mid
+                           : ( comp(*begin, *last)
+                                  ? last
+                                  : begin ) )
+                    : ( comp(*mid, *last)
+                           ? ( comp(*begin, *last)
+                                  ? begin
+                                  : last )
+                           : mid );
+    if (pivot != last) {
+      safe_iter_swap(pivot, last);
+      pivot = last;
+    }
+
+    // partition and swap pivot to its sorted position
+    mid = detail::partition(begin, last, [&](Iter it){ return comp(*it, *pivot); });
+    if (mid != pivot) {
+      safe_iter_swap(mid, pivot);
+      pivot = mid;
+    }
+
+    // continue in the part containing nth
+    if (nth == pivot) {
+      return;
+    } else if (nth < pivot) {
+      end = pivot;
+    } else {
+      begin = RAJA::next(pivot);
+    }
+  }
+
+  detail::insertion_sort(begin, end, comp);
+}
+
 /*!
     \brief merge a range with midpoint using comparison function
     with local range/2 copy
@@ -0,0 +1,432 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for parallel graph coloring index set builders.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+
+namespace
+{
+
+inline int getOMPThreadNum()
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+inline int getOMPNumThreads()
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  return omp_get_num_threads();
+#else
+  return 1;
+#endif
+}
+
+/*
+ * Colors are read and written concurrently while coloring speculatively.
+ */
+inline int loadColor(const int* color, RAJA::Index_type v)
+{
+  int c;
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp atomic read
+#endif
+  c = color[v];
+  return c;
+}
+
+inline void storeColor(int* color, RAJA::Index_type v, int c)
+{
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp atomic write
+#endif
+  color[v] = c;
+}
+
+/*
+ ******************************************************************************
+ *
+ * Speculative parallel greedy coloring (Gebremedhin-Manne).
+ *
+ * Each round every vertex in the worklist takes the smallest color not used
+ * by its neighbors, reading neighbor colors that may be changing in the same
+ * round. Then every vertex that ended up with the color of a lower numbered
+ * neighbor from the same round is put in the worklist for the next round.
+ * The lowest numbered vertex of each conflict keeps its color, so every
+ * round makes progress.
+ *
+ * forEachNeighbor(v, f) calls f(u) for every neighbor u of v, u != v.
+ *
+ ******************************************************************************
+ */
+template <typename ForEachNeighbor>
+int speculativeColor(RAJA::Index_type numVertex,
+                     ForEachNeighbor const& forEachNeighbor,
+                     std::vector<int>& color)
+{
+  color.assign(numVertex, -1);
+  int* colorData = color.data();
+
+  std::vector<RAJA::Index_type> workset(numVertex);
+  std::iota(workset.begin(), workset.end(), RAJA::Index_type(0));
+
+  while (!workset.empty()) {
+
+    const RAJA::Index_type worksetSize = workset.size();
+    const RAJA::Index_type* worksetData = workset.data();
+
+    /* tentatively color every vertex in the workset */
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+    {
+      // forbidden[c] == stamp when color c is used by a neighbor
+      std::vector<long> forbidden;
+      long stamp = 0;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(dynamic, 256)
+#endif
+      for (RAJA::Index_type i = 0; i < worksetSize; ++i) {
+        const RAJA::Index_type v = worksetData[i];
+        ++stamp;
+        forEachNeighbor(v, [&](RAJA::Index_type u) {
+          const int c = loadColor(colorData, u);
+          if (c >= 0) {
+            if (static_cast<size_t>(c) >= forbidden.size()) {
+              forbidden.resize(c + 1, 0);
+            }
+            forbidden[c] = stamp;
+          }
+        });
+        int c = 0;
+        while (static_cast<size_t>(c) < forbidden.size() &&
+               forbidden[c] == stamp) {
+          ++c;
+        }
+        storeColor(colorData, v, c);
+      }
+    }
+
+    /* find conflicts, the higher numbered vertex of a conflict recolors */
+    std::vector<RAJA::Index_type> conflicts;
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+    {
+      std::vector<RAJA::Index_type> localConflicts;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+      for (RAJA::Index_type i = 0; i < worksetSize; ++i) {
+        const RAJA::Index_type v = worksetData[i];
+        const int c = colorData[v];
+        bool conflict = false;
+        forEachNeighbor(v, [&](RAJA::Index_type u) {
+          if (u < v && colorData[u] == c) {
+            conflict = true;
+          }
+        });
+        if (conflict) {
+          localConflicts.push_back(v);
+        }
+      }
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp critical
+#endif
+      conflicts.insert(conflicts.end(),
+                       localConflicts.begin(), localConflicts.end());
+    }
+
+    std::sort(conflicts.begin(), conflicts.end());
+    workset.swap(conflicts);
+  }
+
+  int numColors = 0;
+  for (int c : color) {
+    numColors = std::max(numColors, c + 1);
+  }
+  return numColors;
+}
+
+/*
+ ******************************************************************************
+ *
+ * Order vertices by color, vertices of one color stay in increasing order.
+ * Fills ordered with the vertices and colorOffsets with the start of each
+ * color in ordered.
+ *
+ ******************************************************************************
+ */
+void orderByColor(std::vector<int> const& color,
+                  int numColors,
+                  std::vector<RAJA::Index_type>& ordered,
+                  std::vector<RAJA::Index_type>& colorOffsets)
+{
+  const RAJA::Index_type numVertex = color.size();
+  const int maxThreads = getMaxOMPThreadsCPU();
+
+  ordered.resize(numVertex);
+  colorOffsets.assign(numColors + 1, 0);
+
+  // count[t*numColors + c] is the number of vertices of color c in chunk t
+  std::vector<RAJA::Index_type> count(
+      static_cast<size_t>(maxThreads) * numColors, 0);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel num_threads(maxThreads)
+#endif
+  {
+    const int numThreads = getOMPNumThreads();
+    const int t = getOMPThreadNum();
+    const RAJA::Index_type begin = (numVertex * t) / numThreads;
+    const RAJA::Index_type end = (numVertex * (t + 1)) / numThreads;
+    RAJA::Index_type* myCount = &count[static_cast<size_t>(t) * numColors];
+
+    for (RAJA::Index_type v = begin; v < end; ++v) {
+      ++myCount[color[v]];
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp barrier
+#pragma omp single
+#endif
+    {
+      /* exclusive scan ordered by color then by chunk */
+      RAJA::Index_type offset = 0;
+      for (int c = 0; c < numColors; ++c) {
+        colorOffsets[c] = offset;
+        for (int tt = 0; tt < numThreads; ++tt) {
+          RAJA::Index_type& n = count[static_cast<size_t>(tt) * numColors + c];
+          RAJA::Index_type chunkCount = n;
+          n = offset;
+          offset += chunkCount;
+        }
+      }
+      colorOffsets[numColors] = offset;
+    }
+
+    for (RAJA::Index_type v = begin; v < end; ++v) {
+      ordered[myCount[color[v]]++] = v;
+    }
+  }
+}
+
+/*
+ ******************************************************************************
+ *
+ * Push a segment per color onto iset, see the builders for the layout.
+ *
+ ******************************************************************************
+ */
+void pushColorSegments(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    std::vector<RAJA::Index_type>& ordered,
+    std::vector<RAJA::Index_type> const& colorOffsets,
+    RAJA::Index_type* elemPermutation,
+    RAJA::Index_type* ielemPermutation)
+{
+  const RAJA::Index_type numVertex = ordered.size();
+  const int numColors = static_cast<int>(colorOffsets.size()) - 1;
+
+  if (elemPermutation != nullptr) {
+    /* renumbered elements of each color are contiguous */
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+    for (RAJA::Index_type i = 0; i < numVertex; ++i) {
+      elemPermutation[i] = ordered[i];
+      if (ielemPermutation != nullptr) {
+        ielemPermutation[ordered[i]] = i;
+      }
+    }
+    for (int c = 0; c < numColors; ++c) {
+      iset.push_back(RAJA::RangeSegment(colorOffsets[c], colorOffsets[c + 1]));
+    }
+  } else {
+    for (int c = 0; c < numColors; ++c) {
+      const RAJA::Index_type begin = colorOffsets[c];
+      const RAJA::Index_type end = colorOffsets[c + 1];
+      if (ordered[end - 1] - ordered[begin] == end - begin - 1) {
+        iset.push_back(
+            RAJA::RangeSegment(ordered[begin], ordered[end - 1] + 1));
+      } else {
+        iset.push_back(RAJA::ListSegment(&ordered[begin], end - begin,
+                                         work_res));
+      }
+    }
+  }
+}
+
+}  // namespace
+
+/*
+ ******************************************************************************
+ *
+ * Generate a color index set from a graph using parallel distance-1 coloring.
+ *
+ ******************************************************************************
+ */
+void buildColorIndexSetDistance1(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* adjOffsets,
+    RAJA::Index_type const* adjacency,
+    RAJA::Index_type numVertex,
+    RAJA::Index_type* elemPermutation,
+    RAJA::Index_type* ielemPermutation)
+{
+  if (numVertex <= 0) return;
+
+  auto forEachNeighbor = [=](RAJA::Index_type v, auto&& f) {
+    for (RAJA::Index_type k = adjOffsets[v]; k < adjOffsets[v + 1]; ++k) {
+      const RAJA::Index_type u = adjacency[k];
+      if (u != v) {
+        f(u);
+      }
+    }
+  };
+
+  std::vector<int> color;
+  const int numColors = speculativeColor(numVertex, forEachNeighbor, color);
+
+  std::vector<RAJA::Index_type> ordered;
+  std::vector<RAJA::Index_type> colorOffsets;
+  orderByColor(color, numColors, ordered, colorOffsets);
+
+  pushColorSegments(iset, work_res, ordered, colorOffsets,
+                    elemPermutation, ielemPermutation);
+}
+
+/*
+ ******************************************************************************
+ *
+ * Generate a lock-free color index set from domain to range connectivity
+ * using parallel distance-2 coloring.
+ *
+ ******************************************************************************
+ */
+void buildColorIndexSetDistance2(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* domainToRange,
+    RAJA::Index_type numEntity,
+    int numRangePerDomain,
+    RAJA::Index_type numEntityRange,
+    RAJA::Index_type* elemPermutation,
+    RAJA::Index_type* ielemPermutation)
+{
+  if (numEntity <= 0) return;
+
+  /* create the inverse mapping in compressed row form */
+  std::vector<RAJA::Index_type> rangeOffsets(numEntityRange + 1, 0);
+  std::vector<RAJA::Index_type> rangeToDomain(
+      static_cast<size_t>(numEntity) * numRangePerDomain);
+  RAJA::Index_type* rangeOffsetsData = rangeOffsets.data();
+  RAJA::Index_type* rangeToDomainData = rangeToDomain.data();
+
+  const RAJA::Index_type numConnections =
+      numEntity * static_cast<RAJA::Index_type>(numRangePerDomain);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+  for (RAJA::Index_type k = 0; k < numConnections; ++k) {
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp atomic
+#endif
+    ++rangeOffsetsData[domainToRange[k] + 1];
+  }
+
+  std::partial_sum(rangeOffsets.begin(), rangeOffsets.end(),
+                   rangeOffsets.begin());
+
+  {
+    std::vector<RAJA::Index_type> fill(rangeOffsets.begin(),
+                                       rangeOffsets.end() - 1);
+    RAJA::Index_type* fillData = fill.data();
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+    for (RAJA::Index_type k = 0; k < numConnections; ++k) {
+      const RAJA::Index_type id = domainToRange[k];
+      RAJA::Index_type idx;
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp atomic capture
+#endif
+      idx = fillData[id]++;
+      rangeToDomainData[idx] = k / numRangePerDomain;
+    }
+  }
+
+  /* keep each range entity's domain list in order for locality */
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+  for (RAJA::Index_type id = 0; id < numEntityRange; ++id) {
+    std::sort(rangeToDomainData + rangeOffsetsData[id],
+              rangeToDomainData + rangeOffsetsData[id + 1]);
+  }
+
+  /* domain entities sharing a range entity are neighbors */
+  auto forEachNeighbor = [=](RAJA::Index_type v, auto&& f) {
+    for (int j = 0; j < numRangePerDomain; ++j) {
+      const RAJA::Index_type id = domainToRange[v * numRangePerDomain + j];
+      for (RAJA::Index_type k = rangeOffsetsData[id];
+           k < rangeOffsetsData[id + 1];
+           ++k) {
+        const RAJA::Index_type u = rangeToDomainData[k];
+        if (u != v) {
+          f(u);
+        }
+      }
+    }
+  };
+
+  std::vector<int> color;
+  const int numColors = speculativeColor(numEntity, forEachNeighbor, color);
+
+  std::vector<RAJA::Index_type> ordered;
+  std::vector<RAJA::Index_type> colorOffsets;
+  orderByColor(color, numColors, ordered, colorOffsets);
+
+  pushColorSegments(iset, work_res, ordered, colorOffsets,
+                    elemPermutation, ielemPermutation);
+}
+
+}  // namespace RAJA
@@ -0,0 +1,367 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the index set file cache.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/index/IndexSetCache.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#if defined(_WIN32)
+#include <cstdlib>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace RAJA
+{
+
+namespace
+{
+
+const char cache_magic[8] = {'R', 'A', 'J', 'A', 'I', 'S', 'C', '\0'};
+
+const std::uint32_t cache_byte_order = 0x01020304u;
+
+const std::uint64_t prime1 = 0x9E3779B185EBCA87ull;
+const std::uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+const std::uint64_t prime3 = 0x165667B19E3779F9ull;
+const std::uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+const std::uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+inline std::uint64_t rotl(std::uint64_t x, int r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+inline std::uint64_t load64(const unsigned char* p)
+{
+  std::uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline std::uint64_t hash_round(std::uint64_t acc, std::uint64_t input)
+{
+  acc += input * prime2;
+  acc = rotl(acc, 31);
+  return acc * prime1;
+}
+
+inline std::uint64_t hash_merge(std::uint64_t acc, std::uint64_t lane)
+{
+  acc ^= hash_round(0, lane);
+  return acc * prime1 + prime4;
+}
+
+//! Hash of the header bytes before header_checksum
+std::uint64_t header_checksum(const detail::IndexSetCacheHeader& header)
+{
+  detail::IndexSetCacheHasher hasher;
+  hasher.update(&header, offsetof(detail::IndexSetCacheHeader, header_checksum));
+  return hasher.digest();
+}
+
+//@{
+//! Read only mapping of a whole file, nullptr if the file cannot be read
+#if defined(_WIN32)
+
+void* map_file(const std::string& path, size_t& bytes)
+{
+  std::FILE* file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    return nullptr;
+  }
+  void* addr = nullptr;
+  if (std::fseek(file, 0, SEEK_END) == 0) {
+    long size = std::ftell(file);
+    if (size > 0 && std::fseek(file, 0, SEEK_SET) == 0) {
+      bytes = static_cast<size_t>(size);
+      addr = _aligned_malloc(bytes, 64);
+      if (addr != nullptr && std::fread(addr, 1, bytes, file) != bytes) {
+        _aligned_free(addr);
+        addr = nullptr;
+      }
+    }
+  }
+  std::fclose(file);
+  return addr;
+}
+
+void unmap_file(void* addr, size_t) { _aligned_free(addr); }
+
+#else
+
+void* map_file(const std::string& path, size_t& bytes)
+{
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  void* addr = nullptr;
+  struct stat st;
+  if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+    bytes = static_cast<size_t>(st.st_size);
+    addr = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+      addr = nullptr;
+    }
+  }
+  ::close(fd);
+  return addr;
+}
+
+void unmap_file(void* addr, size_t bytes) { ::munmap(addr, bytes); }
+
+#endif
+//@}
+
+}  // namespace
+
+
+namespace detail
+{
+
+IndexSetCacheHasher::IndexSetCacheHasher(std::uint64_t seed)
+    : m_lanes{seed + prime1 + prime2, seed + prime2, seed, seed - prime1},
+      m_buffer{},
+      m_buffered(0),
+      m_total(0),
+      m_seed(seed)
+{
+}
+
+void IndexSetCacheHasher::update(const void* data, size_t bytes)
+{
+  if (bytes == 0) {
+    return;
+  }
+  const unsigned char* p = static_cast<const unsigned char*>(data);
+  m_total += bytes;
+
+  if (m_buffered > 0) {
+    const size_t take = std::min(bytes, sizeof(m_buffer) - m_buffered);
+    std::memcpy(m_buffer + m_buffered, p, take);
+    m_buffered += take;
+    p += take;
+    bytes -= take;
+    if (m_buffered < sizeof(m_buffer)) {
+      return;
+    }
+    for (int l = 0; l < 4; ++l) {
+      m_lanes[l] = hash_round(m_lanes[l], load64(m_buffer + 8 * l));
+    }
+    m_buffered = 0;
+  }
+
+  std::uint64_t v0 = m_lanes[0];
+  std::uint64_t v1 = m_lanes[1];
+  std::uint64_t v2 = m_lanes[2];
+  std::uint64_t v3 = m_lanes[3];
+  for (; bytes >= 32; bytes -= 32, p += 32) {
+    v0 = hash_round(v0, load64(p));
+    v1 = hash_round(v1, load64(p + 8));
+    v2 = hash_round(v2, load64(p + 16));
+    v3 = hash_round(v3, load64(p + 24));
+  }
+  m_lanes[0] = v0;
+  m_lanes[1] = v1;
+  m_lanes[2] = v2;
+  m_lanes[3] = v3;
+
+  std::memcpy(m_buffer, p, bytes);
+  m_buffered = bytes;
+}
+
+std::uint64_t IndexSetCacheHasher::digest() const
+{
+  std::uint64_t h;
+  if (m_total >= 32) {
+    h = rotl(m_lanes[0], 1) + rotl(m_lanes[1], 7) + rotl(m_lanes[2], 12) +
+        rotl(m_lanes[3], 18);
+    for (int l = 0; l < 4; ++l) {
+      h = hash_merge(h, m_lanes[l]);
+    }
+  } else {
+    h = m_seed + prime5;
+  }
+  h += m_total;
+
+  const unsigned char* p = m_buffer;
+  size_t rest = m_buffered;
+  for (; rest >= 8; rest -= 8, p += 8) {
+    h ^= hash_round(0, load64(p));
+    h = rotl(h, 27) * prime1 + prime4;
+  }
+  for (; rest > 0; --rest, ++p) {
+    h ^= (*p) * prime5;
+    h = rotl(h, 11) * prime1;
+  }
+
+  h ^= h >> 33;
+  h *= prime2;
+  h ^= h >> 29;
+  h *= prime3;
+  h ^= h >> 32;
+  return h;
+}
+
+bool writeIndexSetCacheFile(
+    const std::string& path,
+    IndexSetCacheHeader header,
+    const std::vector<std::pair<const void*, size_t>>& sections)
+{
+  std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+  header.version = index_set_cache_version;
+  header.byte_order = cache_byte_order;
+
+  IndexSetCacheHasher hasher;
+  std::uint64_t bytes = sizeof(header);
+  for (auto const& section : sections) {
+    hasher.update(section.first, section.second);
+    bytes += section.second;
+  }
+  header.file_bytes = bytes;
+  header.payload_checksum = hasher.digest();
+  header.header_checksum = header_checksum(header);
+
+  const std::string tmp_path = path + ".tmp";
+  std::FILE* file = std::fopen(tmp_path.c_str(), "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+  for (auto const& section : sections) {
+    if (ok && section.second > 0) {
+      ok = std::fwrite(section.first, 1, section.second, file) ==
+           section.second;
+    }
+  }
+  ok = (std::fclose(file) == 0) && ok;
+
+#if defined(_WIN32)
+  // rename does not replace an existing file on Windows
+  if (ok) {
+    std::remove(path.c_str());
+  }
+#endif
+  if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace detail
+
+
+IndexSetCache::IndexSetCache(std::string path) : m_path(std::move(path)) {}
+
+IndexSetCache::IndexSetCache(IndexSetCache&& other)
+    : m_path(std::move(other.m_path)), m_mappings(std::move(other.m_mappings))
+{
+  other.m_mappings.clear();
+}
+
+IndexSetCache& IndexSetCache::operator=(IndexSetCache&& other)
+{
+  if (this != &other) {
+    unmapAll();
+    m_path = std::move(other.m_path);
+    m_mappings = std::move(other.m_mappings);
+    other.m_mappings.clear();
+  }
+  return *this;
+}
+
+IndexSetCache::~IndexSetCache() { unmapAll(); }
+
+const detail::IndexSetCacheHeader* IndexSetCache::map(
+    std::uint64_t key,
+    std::uint32_t index_bytes,
+    std::uint32_t index_signed,
+    bool verify)
+{
+  size_t bytes = 0;
+  void* addr = map_file(m_path, bytes);
+  if (addr == nullptr) {
+    return nullptr;
+  }
+
+  using detail::IndexSetCacheHeader;
+  using detail::IndexSetCacheRecord;
+  const IndexSetCacheHeader* header =
+      static_cast<const IndexSetCacheHeader*>(addr);
+
+  bool ok = bytes >= sizeof(IndexSetCacheHeader) &&
+            std::memcmp(header->magic, cache_magic, sizeof(cache_magic)) == 0 &&
+            header->version == detail::index_set_cache_version &&
+            header->byte_order == cache_byte_order &&
+            header->header_checksum == header_checksum(*header) &&
+            header->file_bytes == bytes && header->key == key &&
+            header->index_bytes == index_bytes &&
+            header->index_signed == index_signed;
+
+  if (ok) {
+    // the sections must fit in the file in order
+    const std::uint64_t tables_end =
+        sizeof(IndexSetCacheHeader) +
+        header->num_segments * sizeof(IndexSetCacheRecord) +
+        header->num_intervals * 2 * sizeof(std::int64_t);
+    ok = header->num_segments <= bytes / sizeof(IndexSetCacheRecord) &&
+         header->num_intervals <= bytes / (2 * sizeof(std::int64_t)) &&
+         header->list_offset % 64 == 0 && tables_end <= header->list_offset &&
+         header->list_count <= bytes / index_bytes &&
+         header->list_offset + header->list_count * index_bytes == bytes;
+  }
+
+  if (ok && verify) {
+    detail::IndexSetCacheHasher hasher;
+    hasher.update(header + 1, bytes - sizeof(IndexSetCacheHeader));
+    ok = hasher.digest() == header->payload_checksum;
+  }
+
+  if (!ok) {
+    unmap_file(addr, bytes);
+    return nullptr;
+  }
+
+  m_mappings.push_back(Mapping{addr, bytes});
+  return header;
+}
+
+void IndexSetCache::unmapLast()
+{
+  if (!m_mappings.empty()) {
+    unmap_file(m_mappings.back().addr, m_mappings.back().bytes);
+    m_mappings.pop_back();
+  }
+}
+
+void IndexSetCache::unmapAll()
+{
+  while (!m_mappings.empty()) {
+    unmapLast();
+  }
+}
+
+}  // namespace RAJA
@@ -42,7 +42,7 @@ getFunction(void* plugin, std::vector<function>& functions, const char* fname)
 namespace RAJA {
 namespace util {
 
-KokkosPluginLoader::KokkosPluginLoader()
+KokkosPluginLoader::KokkosPluginLoader() : Parent(loader_tag{})
 {
   char *env = getenv("KOKKOS_PLUGINS");
   if (env == nullptr)
@@ -51,6 +51,8 @@ KokkosPluginLoader::KokkosPluginLoader()
   }
   initDirectory(std::string(env));
 
+  setActive(!pre_functions.empty() || !post_functions.empty());
+
   for (auto &func : init_functions)
   {
     func(0, kokkos_interface_version, 0, nullptr);
@@ -61,7 +63,7 @@ void KokkosPluginLoader::preLaunch(const RAJA::util::PluginContext& p)
 {
   for (auto &func : pre_functions)
   {
-    func("", 0, &(p.kID));
+    func(p.kernel_name ? p.kernel_name : "", 0, &(p.kID));
   }
 }
 
@@ -83,6 +85,8 @@ void KokkosPluginLoader::finalize()
   pre_functions.clear();
   post_functions.clear();
   finalize_functions.clear();
+
+  setActive(false);
 }
 
 // Initialize plugin from a shared object file specified by 'path'.
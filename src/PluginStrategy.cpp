@@ -12,7 +12,31 @@ RAJA_INSTANTIATE_REGISTRY(PluginRegistry);
 namespace RAJA {
 namespace util {
 
-PluginStrategy::PluginStrategy() = default;
+namespace detail {
+
+std::atomic<int> active_plugin_count{0};
+
+std::uint64_t new_call_site_id()
+{
+  static std::atomic<std::uint64_t> next_id{1};
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+}
+
+PluginStrategy::PluginStrategy() { setActive(true); }
+
+PluginStrategy::PluginStrategy(loader_tag) { }
+
+PluginStrategy::~PluginStrategy() { setActive(false); }
+
+void PluginStrategy::setActive(bool active)
+{
+  if (active != m_active) {
+    detail::active_plugin_count.fetch_add(active ? 1 : -1);
+    m_active = active;
+  }
+}
 
 void PluginStrategy::init(const PluginOptions&) { }
 
@@ -22,7 +22,8 @@ isSharedObject(const std::string& filename)
 namespace RAJA {
 namespace util {
   
-RuntimePluginLoader::RuntimePluginLoader()
+// plugins loaded here count as active themselves
+RuntimePluginLoader::RuntimePluginLoader() : Parent(loader_tag{})
 {
   char *env = ::getenv("RAJA_PLUGINS");
   if (nullptr == env)
@@ -6,128 +6,268 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "RAJA/pattern/tensor/stats.hpp"
+
+#include <memory>
+#include <mutex>
 #include <stdio.h>
+#include <string>
+#include <vector>
+
+namespace RAJA
+{
+namespace expt
+{
+
+namespace
+{
+
+using counters = tensor_stats::counters;
+
+const char* const stat_names[] = {
+  "num_vector_copy",
+  "num_vector_copy_ctor",
+  "num_vector_broadcast_ctor",
+
+  "num_vector_load_packed",
+  "num_vector_load_packed_n",
+  "num_vector_load_strided",
+  "num_vector_load_strided_n",
+
+  "num_vector_store_packed",
+  "num_vector_store_packed_n",
+  "num_vector_store_strided",
+  "num_vector_store_strided_n",
+
+  "num_vector_broadcast",
+
+  "num_vector_get",
+  "num_vector_set",
+
+  "num_vector_add",
+  "num_vector_subtract",
+  "num_vector_multiply",
+  "num_vector_divide",
+
+  "num_vector_fma",
+  "num_vector_fms",
 
-int RAJA::tensor_stats::indent = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_copy = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_copy_ctor = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_broadcast_ctor = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_load_packed = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_load_packed_n = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_load_strided = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_load_strided_n = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_store_packed = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_store_packed_n = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_store_strided = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_store_strided_n = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_broadcast = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_get = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_set = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_add = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_subtract = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_multiply = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_divide = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_fma = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_fms = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_sum = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_max = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_min = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_vmax = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_vmin = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_dot = 0;
-
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_mult_row_row = 0;
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_multacc_row_row = 0;
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_mult_col_col = 0;
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_multacc_col_col = 0;
-
-void RAJA::tensor_stats::resetVectorStats(){
-  num_vector_copy = 0;
-  num_vector_copy_ctor = 0;
-  num_vector_broadcast_ctor = 0;
-
-  num_vector_load_packed = 0;
-  num_vector_load_packed_n = 0;
-  num_vector_load_strided = 0;
-  num_vector_load_strided_n = 0;
-  num_vector_store_packed = 0;
-  num_vector_store_packed_n = 0;
-  num_vector_store_strided = 0;
-  num_vector_store_strided_n = 0;
-
-  num_vector_broadcast = 0;
-
-  num_vector_get = 0;
-  num_vector_set = 0;
-
-  num_vector_add = 0;
-  num_vector_subtract = 0;
-  num_vector_multiply = 0;
-  num_vector_divide = 0;
-
-  num_vector_fma = 0;
-  num_vector_fms = 0;
-  num_vector_sum = 0;
-  num_vector_max = 0;
-  num_vector_min = 0;
-  num_vector_vmax = 0;
-  num_vector_vmin = 0;
-  num_vector_dot = 0;
-
-  num_matrix_mm_mult_row_row = 0;
-  num_matrix_mm_multacc_row_row = 0;
-  num_matrix_mm_mult_col_col = 0;
-  num_matrix_mm_multacc_col_col = 0;
+  "num_vector_sum",
+  "num_vector_max",
+  "num_vector_min",
+  "num_vector_vmax",
+  "num_vector_vmin",
+  "num_vector_dot",
+
+  "num_matrix_load_packed",
+  "num_matrix_load_strided",
+  "num_matrix_store_packed",
+  "num_matrix_store_strided",
+
+  "num_matrix_mm_mult_row_row",
+  "num_matrix_mm_multacc_row_row",
+  "num_matrix_mm_mult_col_col",
+  "num_matrix_mm_multacc_col_col"
+};
+
+static_assert(sizeof(stat_names) / sizeof(stat_names[0]) ==
+                  tensor_stats::num_stat_ids,
+              "tensor_stats names do not match stat ids");
+
+//! counters of one thread, indexed by kernel id, and the kernels it has open
+struct ThreadStats {
+  std::vector<counters> kernels;
+  std::vector<int> open_kernels;
+};
+
+//! kernel names and the counters of every thread that recorded operations
+struct StatsRegistry {
+  std::mutex mutex;
+  std::vector<std::string> names{std::string()};
+  std::vector<std::unique_ptr<ThreadStats>> threads;
+
+  //! id of the kernel name, adding it if new; mutex must be held
+  int find_or_add(const char* name)
+  {
+    for (size_t id = 0; id < names.size(); ++id) {
+      if (names[id] == name) {
+        return static_cast<int>(id);
+      }
+    }
+    names.emplace_back(name);
+    return static_cast<int>(names.size() - 1);
+  }
+
+  //! counters of kernel id summed over threads; mutex must be held
+  counters sum(int id)
+  {
+    counters total{};
+    for (auto const& thread : threads) {
+      if (static_cast<size_t>(id) < thread->kernels.size()) {
+        counters const& c = thread->kernels[id];
+        for (int s = 0; s < tensor_stats::num_stat_ids; ++s) {
+          total.count[s] += c.count[s];
+        }
+        total.bytes_loaded += c.bytes_loaded;
+        total.bytes_stored += c.bytes_stored;
+        total.flops += c.flops;
+      }
+    }
+    return total;
+  }
+};
+
+StatsRegistry& registry()
+{
+  static StatsRegistry r;
+  return r;
 }
 
-#define PRINT_STAT(STAT) if(STAT){printf("  %-32s   %ld\n", #STAT, STAT);}
+ThreadStats& thread_stats()
+{
+  thread_local ThreadStats* stats = nullptr;
+  if (stats == nullptr) {
+    StatsRegistry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.threads.emplace_back(new ThreadStats);
+    stats = r.threads.back().get();
+  }
+  return *stats;
+}
+
+void print_stat(const char* name, camp::idx_t value)
+{
+  if (value) {
+    printf("    %-32s   %ld\n", name, static_cast<long>(value));
+  }
+}
 
-void RAJA::tensor_stats::printVectorStats(){
+}  // namespace
+
+
+void tensor_stats::record(stat_id id,
+                          camp::idx_t bytes_loaded,
+                          camp::idx_t bytes_stored,
+                          camp::idx_t flops)
+{
+  ThreadStats& stats = thread_stats();
+  const size_t kernel =
+      stats.open_kernels.empty() ? 0 : stats.open_kernels.back();
+  if (stats.kernels.size() <= kernel) {
+    stats.kernels.resize(kernel + 1, counters{});
+  }
+  counters& c = stats.kernels[kernel];
+  ++c.count[id];
+  c.bytes_loaded += bytes_loaded;
+  c.bytes_stored += bytes_stored;
+  c.flops += flops;
+}
+
+void tensor_stats::beginKernel(const char* name)
+{
+  int id = 0;
+  {
+    StatsRegistry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    id = r.find_or_add(name ? name : "");
+  }
+  enterKernel(id);
+}
+
+void tensor_stats::enterKernel(int id)
+{
+  thread_stats().open_kernels.push_back(id);
+}
+
+void tensor_stats::endKernel()
+{
+  ThreadStats& stats = thread_stats();
+  if (!stats.open_kernels.empty()) {
+    stats.open_kernels.pop_back();
+  }
+}
+
+int tensor_stats::currentKernel()
+{
+  ThreadStats& stats = thread_stats();
+  return stats.open_kernels.empty() ? 0 : stats.open_kernels.back();
+}
+
+tensor_stats::counters tensor_stats::getKernelStats(const char* name)
+{
+  StatsRegistry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  for (size_t id = 0; id < r.names.size(); ++id) {
+    if (r.names[id] == (name ? name : "")) {
+      return r.sum(static_cast<int>(id));
+    }
+  }
+  return counters{};
+}
+
+void tensor_stats::resetVectorStats()
+{
+  StatsRegistry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  for (auto& thread : r.threads) {
+    for (counters& c : thread->kernels) {
+      c = counters{};
+    }
+  }
+}
+
+void tensor_stats::printVectorStats()
+{
+  StatsRegistry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
 
   printf("RAJA SIMD Register Statistics:\n");
 
-  PRINT_STAT(num_vector_copy);
-  PRINT_STAT(num_vector_copy_ctor);
-  PRINT_STAT(num_vector_broadcast_ctor);
-
-  PRINT_STAT(num_vector_load_packed);
-  PRINT_STAT(num_vector_load_packed_n);
-  PRINT_STAT(num_vector_load_strided);
-  PRINT_STAT(num_vector_load_strided_n);
-  PRINT_STAT(num_vector_store_packed);
-  PRINT_STAT(num_vector_store_packed_n);
-  PRINT_STAT(num_vector_store_strided);
-  PRINT_STAT(num_vector_store_strided_n);
-
-  PRINT_STAT(num_vector_broadcast);
-  PRINT_STAT(num_vector_get);
-  PRINT_STAT(num_vector_set);
-
-  PRINT_STAT(num_vector_add);
-  PRINT_STAT(num_vector_subtract);
-  PRINT_STAT(num_vector_multiply);
-  PRINT_STAT(num_vector_divide);
-
-  PRINT_STAT(num_vector_fma);
-  PRINT_STAT(num_vector_fms);
-  PRINT_STAT(num_vector_sum);
-  PRINT_STAT(num_vector_max);
-  PRINT_STAT(num_vector_min);
-  PRINT_STAT(num_vector_vmax);
-  PRINT_STAT(num_vector_vmin);
-  PRINT_STAT(num_vector_dot);
-
-  PRINT_STAT(num_matrix_mm_mult_row_row);
-  PRINT_STAT(num_matrix_mm_multacc_row_row);
-  PRINT_STAT(num_matrix_mm_mult_col_col);
-  PRINT_STAT(num_matrix_mm_multacc_col_col);
+  for (size_t id = 0; id < r.names.size(); ++id) {
+    const counters c = r.sum(static_cast<int>(id));
 
+    camp::idx_t num_ops = 0;
+    for (int s = 0; s < num_stat_ids; ++s) {
+      num_ops += c.count[s];
+    }
+    if (num_ops == 0) {
+      continue;
+    }
+
+    printf("  kernel: %s\n",
+           r.names[id].empty() ? "(outside kernels)" : r.names[id].c_str());
+
+    for (int s = 0; s < num_stat_ids; ++s) {
+      print_stat(stat_names[s], c.count[s]);
+    }
+
+    const camp::idx_t packed = c.count[num_vector_load_packed] +
+                               c.count[num_vector_load_packed_n] +
+                               c.count[num_vector_store_packed] +
+                               c.count[num_vector_store_packed_n] +
+                               c.count[num_matrix_load_packed] +
+                               c.count[num_matrix_store_packed];
+    const camp::idx_t strided = c.count[num_vector_load_strided] +
+                                c.count[num_vector_load_strided_n] +
+                                c.count[num_vector_store_strided] +
+                                c.count[num_vector_store_strided_n] +
+                                c.count[num_matrix_load_strided] +
+                                c.count[num_matrix_store_strided];
+    const camp::idx_t bytes = c.bytes_loaded + c.bytes_stored;
+
+    printf("    %-32s   %ld\n", "bytes_loaded", static_cast<long>(c.bytes_loaded));
+    printf("    %-32s   %ld\n", "bytes_stored", static_cast<long>(c.bytes_stored));
+    printf("    %-32s   %ld\n", "flops", static_cast<long>(c.flops));
+    if (bytes > 0) {
+      printf("    %-32s   %.3f\n", "arithmetic intensity (flop/B)",
+             static_cast<double>(c.flops) / static_cast<double>(bytes));
+    }
+    if (packed + strided > 0) {
+      printf("    %-32s   %.1f%%\n", "strided loads and stores",
+             100.0 * static_cast<double>(strided) /
+                 static_cast<double>(packed + strided));
+    }
+  }
 }
+
+}  // namespace expt
+}  // namespace RAJA
@@ -0,0 +1,307 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for run time tuning of tile sizes.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/TileTuner.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace RAJA
+{
+
+namespace
+{
+
+const char tuner_file_header[] = "# RAJA tile sizes v1";
+
+template <typename T>
+void write_list(std::ostream& out, const std::vector<T>& values)
+{
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (i > 0) {
+      out << ',';
+    }
+    out << values[i];
+  }
+}
+
+template <typename T>
+bool read_list(const std::string& text, std::vector<T>& values)
+{
+  values.clear();
+  if (text.empty()) {
+    return true;
+  }
+  std::istringstream in(text);
+  std::string item;
+  while (std::getline(in, item, ',')) {
+    std::istringstream item_in(item);
+    T value;
+    if (!(item_in >> value)) {
+      return false;
+    }
+    values.push_back(value);
+  }
+  return true;
+}
+
+}  // namespace
+
+
+std::vector<camp::idx_t> TileTuner::defaultCandidates()
+{
+  return {8, 16, 32, 64, 128, 256};
+}
+
+TileTuner::TileTuner(std::vector<camp::idx_t> candidates, int trials)
+    : m_candidates(std::move(candidates)),
+      m_trials(std::max(trials, 1)),
+      m_dirty(false)
+{
+  std::sort(m_candidates.begin(), m_candidates.end());
+  m_candidates.erase(std::unique(m_candidates.begin(), m_candidates.end()),
+                     m_candidates.end());
+  m_candidates.erase(std::remove_if(m_candidates.begin(),
+                                    m_candidates.end(),
+                                    [](camp::idx_t c) { return c <= 0; }),
+                     m_candidates.end());
+  if (m_candidates.empty()) {
+    m_candidates = defaultCandidates();
+  }
+}
+
+TileTuner::TileTuner(std::string path,
+                     std::vector<camp::idx_t> candidates,
+                     int trials)
+    : TileTuner(std::move(candidates), trials)
+{
+  m_path = std::move(path);
+  load(m_path);
+}
+
+TileTuner::~TileTuner()
+{
+  if (!m_path.empty() && m_dirty) {
+    save(m_path);
+  }
+}
+
+std::string TileTuner::makeKey(const std::string& name, const Shape& shape)
+{
+  std::ostringstream key;
+  key << name << '\t';
+  write_list(key, shape);
+  return key.str();
+}
+
+std::vector<TileTuner::Sizes> TileTuner::makeConfigs(const Shape& shape,
+                                                     size_t ndims) const
+{
+  // candidates of each dimension, up to the first that covers its extent
+  std::vector<Sizes> dim_candidates(ndims);
+  for (size_t d = 0; d < ndims; ++d) {
+    const Index_type extent = d < shape.size() ? shape[d] : 0;
+    for (camp::idx_t c : m_candidates) {
+      dim_candidates[d].push_back(c);
+      if (extent > 0 && c >= extent) {
+        break;
+      }
+    }
+  }
+
+  std::vector<Sizes> configs;
+  Sizes config(ndims);
+  std::vector<size_t> pos(ndims, 0);
+  for (;;) {
+    for (size_t d = 0; d < ndims; ++d) {
+      config[d] = dim_candidates[d][pos[d]];
+    }
+    configs.push_back(config);
+
+    // the last dimension varies fastest
+    size_t d = ndims;
+    while (d > 0 && ++pos[d - 1] == dim_candidates[d - 1].size()) {
+      pos[d - 1] = 0;
+      --d;
+    }
+    if (d == 0) {
+      break;
+    }
+  }
+  return configs;
+}
+
+TileTuner::Sizes TileTuner::next(const std::string& name,
+                                 const Shape& shape,
+                                 size_t ndims)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  Entry& entry = m_entries[makeKey(name, shape)];
+  if (entry.tuned && entry.best.size() == ndims) {
+    return entry.best;
+  }
+  if (entry.tuned || entry.configs.empty() ||
+      entry.configs.front().size() != ndims) {
+    entry = Entry{};
+    entry.configs = makeConfigs(shape, ndims);
+    entry.times.assign(entry.configs.size(), -1.0);
+  }
+
+  // runs still in flight on other threads may take more than one pass
+  const size_t config = (entry.issued++ / m_trials) % entry.configs.size();
+  return entry.configs[config];
+}
+
+void TileTuner::record(const std::string& name,
+                       const Shape& shape,
+                       const Sizes& sizes,
+                       double seconds)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_entries.find(makeKey(name, shape));
+  if (it == m_entries.end() || it->second.tuned) {
+    return;
+  }
+  Entry& entry = it->second;
+  auto config = std::find(entry.configs.begin(), entry.configs.end(), sizes);
+  if (config == entry.configs.end()) {
+    return;
+  }
+  double& time = entry.times[config - entry.configs.begin()];
+  if (time < 0.0 || seconds < time) {
+    time = seconds;
+  }
+
+  if (++entry.completed < entry.configs.size() * m_trials) {
+    return;
+  }
+  size_t best = 0;
+  for (size_t c = 1; c < entry.times.size(); ++c) {
+    if (entry.times[c] >= 0.0 &&
+        (entry.times[best] < 0.0 || entry.times[c] < entry.times[best])) {
+      best = c;
+    }
+  }
+  entry.tuned = true;
+  entry.best = entry.configs[best];
+  entry.best_time = entry.times[best];
+  entry.configs.clear();
+  entry.times.clear();
+  m_dirty = true;
+}
+
+bool TileTuner::isTuned(const std::string& name, const Shape& shape) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_entries.find(makeKey(name, shape));
+  return it != m_entries.end() && it->second.tuned;
+}
+
+TileTuner::Sizes TileTuner::getTuned(const std::string& name,
+                                     const Shape& shape) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_entries.find(makeKey(name, shape));
+  if (it == m_entries.end() || !it->second.tuned) {
+    return Sizes{};
+  }
+  return it->second.best;
+}
+
+void TileTuner::setTuned(const std::string& name,
+                         const Shape& shape,
+                         const Sizes& sizes)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  Entry& entry = m_entries[makeKey(name, shape)];
+  entry = Entry{};
+  entry.tuned = true;
+  entry.best = sizes;
+  m_dirty = true;
+}
+
+bool TileTuner::load(const std::string& path)
+{
+  std::ifstream in(path);
+  if (!in) {
+    return false;
+  }
+  std::string line;
+  if (!std::getline(in, line) || line != tuner_file_header) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  while (std::getline(in, line)) {
+    // name, shape, sizes, and time separated by tabs
+    std::vector<std::string> fields;
+    std::istringstream line_in(line);
+    std::string field;
+    while (std::getline(line_in, field, '\t')) {
+      fields.push_back(field);
+    }
+    Shape shape;
+    Entry entry;
+    if (fields.size() != 4 || fields[0].empty() ||
+        !read_list(fields[1], shape) || !read_list(fields[2], entry.best) ||
+        entry.best.empty()) {
+      continue;
+    }
+    entry.tuned = true;
+    std::istringstream(fields[3]) >> entry.best_time;
+    m_entries[makeKey(fields[0], shape)] = std::move(entry);
+  }
+  return true;
+}
+
+bool TileTuner::save(const std::string& path) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const std::string tmp_path = path + ".tmp";
+  {
+    std::ofstream out(tmp_path);
+    if (!out) {
+      return false;
+    }
+    out << tuner_file_header << '\n';
+    for (auto const& item : m_entries) {
+      if (item.second.tuned) {
+        // the key is already the name and the shape separated by a tab
+        out << item.first << '\t';
+        write_list(out, item.second.best);
+        out << '\t' << item.second.best_time << '\n';
+      }
+    }
+    if (!out.flush()) {
+      std::remove(tmp_path.c_str());
+      return false;
+    }
+  }
+#if defined(_WIN32)
+  // rename does not replace an existing file on Windows
+  std::remove(path.c_str());
+#endif
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace RAJA
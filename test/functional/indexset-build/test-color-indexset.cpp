@@ -0,0 +1,169 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the graph coloring index set builders.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "camp/resource.hpp"
+
+#include <set>
+#include <vector>
+
+using ColorISet = RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>;
+
+//
+// Gather the indices of each segment of iset
+//
+static std::vector<std::vector<RAJA::Index_type>> getSegments(ColorISet const& iset)
+{
+  std::vector<std::vector<RAJA::Index_type>> segments(iset.getNumSegments());
+  for (size_t s = 0; s < iset.getNumSegments(); ++s) {
+    iset.segmentCall(s, [&](auto const& seg) {
+      for (auto idx : seg) {
+        segments[s].push_back(idx);
+      }
+    });
+  }
+  return segments;
+}
+
+//
+// Element to node connectivity of an nx by ny quad mesh
+//
+static std::vector<RAJA::Index_type> makeQuadMesh(RAJA::Index_type nx,
+                                                  RAJA::Index_type ny)
+{
+  std::vector<RAJA::Index_type> elemToNode;
+  for (RAJA::Index_type j = 0; j < ny; ++j) {
+    for (RAJA::Index_type i = 0; i < nx; ++i) {
+      RAJA::Index_type n0 = j * (nx + 1) + i;
+      elemToNode.push_back(n0);
+      elemToNode.push_back(n0 + 1);
+      elemToNode.push_back(n0 + nx + 1);
+      elemToNode.push_back(n0 + nx + 2);
+    }
+  }
+  return elemToNode;
+}
+
+TEST(IndexSetBuild, ColorDistance2)
+{
+  const RAJA::Index_type nx = 37;
+  const RAJA::Index_type ny = 23;
+  const RAJA::Index_type numElem = nx * ny;
+  std::vector<RAJA::Index_type> elemToNode = makeQuadMesh(nx, ny);
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  ColorISet iset;
+  RAJA::buildColorIndexSetDistance2(iset, res, elemToNode.data(),
+                                    numElem, 4, (nx + 1) * (ny + 1));
+
+  ASSERT_EQ(iset.getLength(), static_cast<size_t>(numElem));
+  ASSERT_GE(iset.getNumSegments(), 4u);
+
+  std::vector<int> count(numElem, 0);
+  for (auto const& seg : getSegments(iset)) {
+    std::set<RAJA::Index_type> nodes;
+    for (RAJA::Index_type e : seg) {
+      ++count[e];
+      for (int k = 0; k < 4; ++k) {
+        // no two elements of a segment share a node
+        ASSERT_TRUE(nodes.insert(elemToNode[e * 4 + k]).second);
+      }
+    }
+  }
+  for (RAJA::Index_type e = 0; e < numElem; ++e) {
+    ASSERT_EQ(count[e], 1);
+  }
+}
+
+TEST(IndexSetBuild, ColorDistance2Permutation)
+{
+  const RAJA::Index_type nx = 41;
+  const RAJA::Index_type ny = 19;
+  const RAJA::Index_type numElem = nx * ny;
+  std::vector<RAJA::Index_type> elemToNode = makeQuadMesh(nx, ny);
+
+  std::vector<RAJA::Index_type> perm(numElem);
+  std::vector<RAJA::Index_type> iperm(numElem);
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  ColorISet iset;
+  RAJA::buildColorIndexSetDistance2(iset, res, elemToNode.data(),
+                                    numElem, 4, (nx + 1) * (ny + 1),
+                                    perm.data(), iperm.data());
+
+  ASSERT_EQ(iset.getLength(), static_cast<size_t>(numElem));
+
+  // segments are contiguous ranges of the renumbered elements
+  RAJA::Index_type next = 0;
+  for (size_t s = 0; s < iset.getNumSegments(); ++s) {
+    const RAJA::RangeSegment& seg = iset.getSegment<const RAJA::RangeSegment>(s);
+    ASSERT_EQ(*seg.begin(), next);
+    next = *seg.end();
+
+    std::set<RAJA::Index_type> nodes;
+    for (RAJA::Index_type i : seg) {
+      RAJA::Index_type e = perm[i];
+      ASSERT_EQ(iperm[e], i);
+      for (int k = 0; k < 4; ++k) {
+        ASSERT_TRUE(nodes.insert(elemToNode[e * 4 + k]).second);
+      }
+    }
+  }
+  ASSERT_EQ(next, numElem);
+}
+
+TEST(IndexSetBuild, ColorDistance1)
+{
+  // 5-point stencil graph on an nx by ny grid
+  const RAJA::Index_type nx = 53;
+  const RAJA::Index_type ny = 31;
+  const RAJA::Index_type numVertex = nx * ny;
+
+  std::vector<RAJA::Index_type> offsets(1, 0);
+  std::vector<RAJA::Index_type> adjacency;
+  for (RAJA::Index_type j = 0; j < ny; ++j) {
+    for (RAJA::Index_type i = 0; i < nx; ++i) {
+      if (i > 0)      adjacency.push_back(j * nx + i - 1);
+      if (i < nx - 1) adjacency.push_back(j * nx + i + 1);
+      if (j > 0)      adjacency.push_back((j - 1) * nx + i);
+      if (j < ny - 1) adjacency.push_back((j + 1) * nx + i);
+      offsets.push_back(static_cast<RAJA::Index_type>(adjacency.size()));
+    }
+  }
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  ColorISet iset;
+  RAJA::buildColorIndexSetDistance1(iset, res, offsets.data(),
+                                    adjacency.data(), numVertex);
+
+  ASSERT_EQ(iset.getLength(), static_cast<size_t>(numVertex));
+
+  std::vector<int> color(numVertex, -1);
+  int c = 0;
+  for (auto const& seg : getSegments(iset)) {
+    for (RAJA::Index_type v : seg) {
+      ASSERT_EQ(color[v], -1);
+      color[v] = c;
+    }
+    ++c;
+  }
+  for (RAJA::Index_type v = 0; v < numVertex; ++v) {
+    for (RAJA::Index_type k = offsets[v]; k < offsets[v + 1]; ++k) {
+      ASSERT_NE(color[v], color[adjacency[k]]);
+    }
+  }
+}
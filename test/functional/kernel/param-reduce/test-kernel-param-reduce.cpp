@@ -0,0 +1,207 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::expt reducers passed as
+/// kernel_param params to host kernel policies.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+constexpr int N0 = 97;
+constexpr int N1 = 61;
+
+// one unique minimum so that the location is well defined
+int value(int i, int j)
+{
+  return (i == 41 && j == 23) ? -100 : (i * 7 + j * 13) % 101 - 50;
+}
+
+struct Reference {
+  long sum = 0;
+  int max = -1000;
+  int min = 1000;
+  RAJA::Index_type minloc = -1;
+
+  Reference()
+  {
+    for (int j = 0; j < N1; ++j) {
+      for (int i = 0; i < N0; ++i) {
+        int v = value(i, j);
+        sum += v;
+        max = v > max ? v : max;
+        if (v < min) {
+          min = v;
+          minloc = i + N0 * j;
+        }
+      }
+    }
+  }
+};
+
+// Runs a two level kernel with a sum, a max and a KernelName in the param
+// tuple using the default Lambda arguments, the sums start from a non zero
+// value which the kernel adds to.
+template <typename Pol>
+void check_kernel_reduce()
+{
+  Reference ref;
+
+  long sum = 5;
+  int max = -1000;
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, N0),
+                       RAJA::TypedRangeSegment<int>(0, N1)),
+      RAJA::make_tuple(RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+                       RAJA::expt::KernelName("param-reduce"),
+                       RAJA::expt::Reduce<RAJA::operators::maximum>(&max)),
+      [=](int i, int j, long &s, int &m) {
+        int v = value(i, j);
+        s += v;
+        m = v > m ? v : m;
+      });
+
+  ASSERT_EQ(sum, ref.sum + 5);
+  ASSERT_EQ(max, ref.max);
+
+  // running again accumulates into the targets
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, N0),
+                       RAJA::TypedRangeSegment<int>(0, N1)),
+      RAJA::make_tuple(RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+                       RAJA::expt::KernelName("param-reduce"),
+                       RAJA::expt::Reduce<RAJA::operators::maximum>(&max)),
+      [=](int i, int j, long &s, int &m) {
+        int v = value(i, j);
+        s += v;
+        m = v > m ? v : m;
+      });
+
+  ASSERT_EQ(sum, 2 * ref.sum + 5);
+  ASSERT_EQ(max, ref.max);
+}
+
+// Same with explicit Lambda arguments and a ReduceLoc
+template <typename Pol>
+void check_kernel_reduce_loc()
+{
+  Reference ref;
+
+  using VL = RAJA::expt::ValLoc<int>;
+  VL minloc(1000, -1);
+  long sum = 0;
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, N0),
+                       RAJA::TypedRangeSegment<int>(0, N1)),
+      RAJA::make_tuple(RAJA::expt::Reduce<RAJA::operators::minimum>(&minloc),
+                       RAJA::expt::Reduce<RAJA::operators::plus>(&sum)),
+      [=](int i, int j, VL &ml, long &s) {
+        ml.min(value(i, j), i + N0 * j);
+        s += 1;
+      });
+
+  ASSERT_EQ(minloc.getVal(), ref.min);
+  ASSERT_EQ(minloc.getLoc(), ref.minloc);
+  ASSERT_EQ(sum, static_cast<long>(N0) * N1);
+}
+
+template <typename Outer, typename Inner>
+using kernel_pol = RAJA::KernelPolicy<
+    RAJA::statement::For<1, Outer,
+      RAJA::statement::For<0, Inner,
+        RAJA::statement::Lambda<0>
+      >
+    >
+  >;
+
+template <typename Outer, typename Inner>
+using kernel_args_pol = RAJA::KernelPolicy<
+    RAJA::statement::For<1, Outer,
+      RAJA::statement::For<0, Inner,
+        RAJA::statement::Lambda<0, RAJA::Segs<0, 1>, RAJA::Params<0, 1>>
+      >
+    >
+  >;
+
+}  // namespace
+
+
+TEST(KernelParamReduce, Sequential)
+{
+  check_kernel_reduce<kernel_pol<RAJA::seq_exec, RAJA::seq_exec>>();
+  check_kernel_reduce<kernel_pol<RAJA::loop_exec, RAJA::simd_exec>>();
+  check_kernel_reduce_loc<kernel_args_pol<RAJA::seq_exec, RAJA::loop_exec>>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(KernelParamReduce, OpenMP)
+{
+  check_kernel_reduce<kernel_pol<RAJA::omp_parallel_for_exec, RAJA::loop_exec>>();
+  check_kernel_reduce<kernel_pol<RAJA::seq_exec, RAJA::omp_parallel_for_exec>>();
+  check_kernel_reduce_loc<kernel_args_pol<RAJA::omp_parallel_for_exec, RAJA::loop_exec>>();
+
+  using collapse_pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                RAJA::ArgList<1, 0>,
+        RAJA::statement::Lambda<0>
+      >
+    >;
+  check_kernel_reduce<collapse_pol>();
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(KernelParamReduce, TBB)
+{
+  check_kernel_reduce<kernel_pol<RAJA::tbb_for_dynamic, RAJA::loop_exec>>();
+  check_kernel_reduce<kernel_pol<RAJA::tbb_for_exec, RAJA::loop_exec>>();
+  check_kernel_reduce_loc<kernel_args_pol<RAJA::tbb_for_dynamic, RAJA::loop_exec>>();
+}
+
+// Many short tasks, so that tasks copy the shared LoopData while others
+// fold into it. Run with -fsanitize=thread to check the copies.
+TEST(KernelParamReduce, TBBManyTasks)
+{
+  constexpr int M0 = 8;
+  constexpr int M1 = 20000;
+
+  long expected_sum = 0;
+  int expected_max = -1000;
+  for (int j = 0; j < M1; ++j) {
+    for (int i = 0; i < M0; ++i) {
+      const int v = (i * 7 + j * 13) % 101 - 50;
+      expected_sum += v;
+      expected_max = v > expected_max ? v : expected_max;
+    }
+  }
+
+  for (int rep = 0; rep < 5; ++rep) {
+    long sum = 0;
+    int max = -1000;
+
+    RAJA::kernel_param<kernel_pol<RAJA::tbb_for_dynamic, RAJA::loop_exec>>(
+        RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, M0),
+                         RAJA::TypedRangeSegment<int>(0, M1)),
+        RAJA::make_tuple(RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+                         RAJA::expt::Reduce<RAJA::operators::maximum>(&max)),
+        [=](int i, int j, long &s, int &m) {
+          const int v = (i * 7 + j * 13) % 101 - 50;
+          s += v;
+          m = v > m ? v : m;
+        });
+
+    ASSERT_EQ(sum, expected_sum);
+    ASSERT_EQ(max, expected_max);
+  }
+}
+#endif
@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::expt reducers passed to the
+/// host launch policies.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+constexpr int N = 10007;
+
+int value(int i) { return (i == 6001) ? -100 : (i * 37) % 199 - 99; }
+
+// Reduces over a teams loop and a threads loop, with a KernelName
+template <typename LaunchPol, typename TeamsPol, typename ThreadsPol>
+void check_launch_reduce()
+{
+  long ref_sum = 0;
+  int ref_min = 1000;
+  for (int i = 0; i < N; ++i) {
+    ref_sum += value(i);
+    ref_min = value(i) < ref_min ? value(i) : ref_min;
+  }
+
+  const int tile = 64;
+  const int num_tiles = (N + tile - 1) / tile;
+
+  long sum = 3;
+  int min = 1000;
+  int count = 0;
+
+  RAJA::launch<RAJA::LaunchPolicy<LaunchPol>>(
+      RAJA::LaunchParams(RAJA::Teams(num_tiles), RAJA::Threads(tile)),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      RAJA::expt::KernelName("param-reduce"),
+      RAJA::expt::Reduce<RAJA::operators::minimum>(&min),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&count),
+      [=](RAJA::LaunchContext ctx, long &s, int &m, int &c) {
+        RAJA::loop<RAJA::LoopPolicy<TeamsPol>>(
+            ctx, RAJA::TypedRangeSegment<int>(0, num_tiles), [&](int t) {
+              RAJA::loop<RAJA::LoopPolicy<ThreadsPol>>(
+                  ctx, RAJA::TypedRangeSegment<int>(0, tile), [&](int l) {
+                    const int i = t * tile + l;
+                    if (i < N) {
+                      s += value(i);
+                      m = value(i) < m ? value(i) : m;
+                      c += 1;
+                    }
+                  });
+            });
+      });
+
+  ASSERT_EQ(sum, ref_sum + 3);
+  ASSERT_EQ(min, ref_min);
+  ASSERT_EQ(count, N);
+}
+
+}  // namespace
+
+
+TEST(LaunchParamReduce, Sequential)
+{
+  check_launch_reduce<RAJA::seq_launch_t, RAJA::loop_exec, RAJA::loop_exec>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(LaunchParamReduce, OpenMP)
+{
+  check_launch_reduce<RAJA::omp_launch_t, RAJA::omp_for_exec, RAJA::loop_exec>();
+  check_launch_reduce<RAJA::omp_team_launch_t, RAJA::loop_exec, RAJA::omp_for_exec>();
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(LaunchParamReduce, TBBKernelName)
+{
+  int count = 0;
+  RAJA::launch<RAJA::LaunchPolicy<RAJA::tbb_launch_t>>(
+      RAJA::LaunchParams(RAJA::Teams(1), RAJA::Threads(1)),
+      RAJA::expt::KernelName("param-reduce"),
+      [&](RAJA::LaunchContext) { ++count; });
+  ASSERT_EQ(count, 1);
+}
+#endif
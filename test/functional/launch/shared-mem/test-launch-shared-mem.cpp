@@ -0,0 +1,208 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the dynamic shared memory of the host
+/// launch policies.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+namespace
+{
+
+template <typename LaunchPol>
+void* launch_shared_ptr(size_t bytes)
+{
+  void* ptr = nullptr;
+  RAJA::launch<RAJA::LaunchPolicy<LaunchPol>>(
+      RAJA::LaunchParams(RAJA::Teams(1), RAJA::Threads(1), bytes),
+      [&](RAJA::LaunchContext ctx) { ptr = ctx.shared_mem_ptr; });
+  return ptr;
+}
+
+// reverses each tile of a through shared memory, every team fills the
+// tile, synchronizes and then reads it in reverse
+template <typename LaunchPol, typename ThreadsPol>
+void check_tile_reverse(int N, int tile)
+{
+  std::vector<int> a(N);
+  std::vector<int> b(N, -1);
+  for (int i = 0; i < N; ++i) {
+    a[i] = 3 * i + 1;
+  }
+  int* ap = a.data();
+  int* bp = b.data();
+
+  using teams_pol = RAJA::LoopPolicy<RAJA::loop_exec>;
+  using threads_pol = RAJA::LoopPolicy<ThreadsPol>;
+
+  RAJA::launch<RAJA::LaunchPolicy<LaunchPol>>(
+      RAJA::LaunchParams(RAJA::Teams(N / tile), RAJA::Threads(tile),
+                         tile * sizeof(int)),
+      [=](RAJA::LaunchContext ctx) {
+        RAJA::loop<teams_pol>(ctx, RAJA::TypedRangeSegment<int>(0, N / tile),
+          [&](int t) {
+            int* s = ctx.getSharedMemory<int>(tile);
+
+            RAJA::loop<threads_pol>(ctx, RAJA::TypedRangeSegment<int>(0, tile),
+              [&](int i) { s[i] = ap[t * tile + i]; });
+
+            ctx.teamSync();
+
+            RAJA::loop<threads_pol>(ctx, RAJA::TypedRangeSegment<int>(0, tile),
+              [&](int i) { bp[t * tile + i] = s[tile - 1 - i]; });
+
+            ctx.teamSync();
+            ctx.releaseSharedMemory();
+          });
+      });
+
+  for (int t = 0; t < N / tile; ++t) {
+    for (int i = 0; i < tile; ++i) {
+      ASSERT_EQ(b[t * tile + i], a[t * tile + tile - 1 - i]);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(LaunchSharedMemTest, SeqReusesBuffer)
+{
+  RAJA::release_launch_scratch();
+
+  void* first = launch_shared_ptr<RAJA::seq_launch_t>(1000);
+  ASSERT_NE(first, nullptr);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(first) %
+                RAJA::detail::LaunchScratch::alignment,
+            0u);
+
+  // smaller and equal sizes reuse the buffer
+  ASSERT_EQ(launch_shared_ptr<RAJA::seq_launch_t>(10), first);
+  ASSERT_EQ(launch_shared_ptr<RAJA::seq_launch_t>(1000), first);
+
+  // the buffer grows to the largest size asked for and stays there
+  void* grown = launch_shared_ptr<RAJA::seq_launch_t>(100000);
+  ASSERT_NE(grown, nullptr);
+  ASSERT_GE(RAJA::detail::launch_scratch().capacity(), 100000u);
+  ASSERT_EQ(launch_shared_ptr<RAJA::seq_launch_t>(1000), grown);
+  ASSERT_FALSE(RAJA::detail::launch_scratch().in_use());
+
+  RAJA::release_launch_scratch();
+  ASSERT_EQ(RAJA::detail::launch_scratch().capacity(), 0u);
+}
+
+TEST(LaunchSharedMemTest, SeqNestedLaunch)
+{
+  using launch_pol = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+
+  void* outer = nullptr;
+  void* inner = nullptr;
+  RAJA::launch<launch_pol>(
+      RAJA::LaunchParams(RAJA::Teams(1), RAJA::Threads(1), 256),
+      [&](RAJA::LaunchContext ctx) {
+        outer = ctx.shared_mem_ptr;
+        static_cast<char*>(outer)[0] = 'o';
+        RAJA::launch<launch_pol>(
+            RAJA::LaunchParams(RAJA::Teams(1), RAJA::Threads(1), 256),
+            [&](RAJA::LaunchContext inner_ctx) {
+              inner = inner_ctx.shared_mem_ptr;
+              static_cast<char*>(inner)[0] = 'i';
+            });
+        ASSERT_EQ(static_cast<char*>(outer)[0], 'o');
+      });
+
+  ASSERT_NE(outer, nullptr);
+  ASSERT_NE(inner, nullptr);
+  ASSERT_NE(outer, inner);
+  ASSERT_FALSE(RAJA::detail::launch_scratch().in_use());
+}
+
+TEST(LaunchSharedMemTest, SeqTileReverse)
+{
+  check_tile_reverse<RAJA::seq_launch_t, RAJA::loop_exec>(1024, 64);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(LaunchSharedMemTest, OpenMPPrivateBuffers)
+{
+  std::vector<void*> ptrs(omp_get_max_threads(), nullptr);
+  void** p = ptrs.data();
+
+  for (int rep = 0; rep < 2; ++rep) {
+    RAJA::launch<RAJA::LaunchPolicy<RAJA::omp_launch_t>>(
+        RAJA::LaunchParams(RAJA::Teams(1), RAJA::Threads(1), 512),
+        [=](RAJA::LaunchContext ctx) {
+          void* ptr = ctx.shared_mem_ptr;
+          const int tid = omp_get_thread_num();
+          // every thread keeps its buffer between launches
+          if (rep > 0 && p[tid] != nullptr) {
+            ASSERT_EQ(p[tid], ptr);
+          }
+          p[tid] = ptr;
+        });
+  }
+
+  std::set<void*> distinct;
+  int num_used = 0;
+  for (void* ptr : ptrs) {
+    if (ptr != nullptr) {
+      distinct.insert(ptr);
+      ++num_used;
+    }
+  }
+  ASSERT_EQ(static_cast<int>(distinct.size()), num_used);
+}
+
+TEST(LaunchSharedMemTest, OpenMPTeamSharesBuffer)
+{
+  std::vector<void*> ptrs(omp_get_max_threads(), nullptr);
+  void** p = ptrs.data();
+
+  RAJA::launch<RAJA::LaunchPolicy<RAJA::omp_team_launch_t>>(
+      RAJA::LaunchParams(RAJA::Teams(1), RAJA::Threads(1), 512),
+      [=](RAJA::LaunchContext ctx) {
+        p[omp_get_thread_num()] = ctx.shared_mem_ptr;
+      });
+
+  ASSERT_NE(ptrs[0], nullptr);
+  for (void* ptr : ptrs) {
+    if (ptr != nullptr) {
+      ASSERT_EQ(ptr, ptrs[0]);
+    }
+  }
+}
+
+TEST(LaunchSharedMemTest, OpenMPTeamTileReverse)
+{
+  check_tile_reverse<RAJA::omp_team_launch_t, RAJA::omp_for_exec>(4096, 128);
+}
+
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+
+// teams run as concurrent tasks sharing one context, so there is no
+// buffer that could be given to each team
+TEST(LaunchSharedMemTest, TBBRejectsSharedMem)
+{
+  ASSERT_EQ(launch_shared_ptr<RAJA::tbb_launch_t>(0), nullptr);
+  ASSERT_THROW(launch_shared_ptr<RAJA::tbb_launch_t>(2048), std::runtime_error);
+}
+
+#endif
@@ -0,0 +1,195 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::permute_copy, every element of
+/// the destination view is compared with the same element of the source.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <vector>
+
+using PermuteCopyExecPols = ::testing::Types<
+    RAJA::seq_exec
+#if defined(RAJA_ENABLE_OPENMP)
+    , RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+    , RAJA::tbb_for_exec
+#endif
+  >;
+
+template <typename T>
+class PermuteCopyTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(PermuteCopyTest, PermuteCopyExecPols);
+
+namespace
+{
+
+using idx_t = RAJA::Index_type;
+
+template <typename ExecPol, typename Src, typename Dst, size_t N>
+void check_permute_copy(std::array<idx_t, N> sizes,
+                        std::array<camp::idx_t, N> src_perm,
+                        std::array<camp::idx_t, N> dst_perm,
+                        camp::idx_t tile_size = 32)
+{
+  const RAJA::Layout<N> src_layout =
+      RAJA::make_permuted_layout(sizes, src_perm);
+  const RAJA::Layout<N> dst_layout =
+      RAJA::make_permuted_layout(sizes, dst_perm);
+
+  std::vector<Src> src_data(src_layout.size());
+  for (size_t i = 0; i < src_data.size(); ++i) {
+    src_data[i] = static_cast<Src>(i);
+  }
+  std::vector<Dst> dst_data(dst_layout.size(), Dst(-1));
+
+  RAJA::View<const Src, RAJA::Layout<N>> src(src_data.data(), src_layout);
+  RAJA::View<Dst, RAJA::Layout<N>> dst(dst_data.data(), dst_layout);
+
+  RAJA::permute_copy<ExecPol>(src, dst, tile_size);
+
+  // visit every element through the linear index of the source
+  for (idx_t linear = 0; linear < static_cast<idx_t>(src_data.size());
+       ++linear) {
+    std::array<idx_t, N> idx;
+    idx_t rest = linear;
+    for (size_t d = N; d-- > 0;) {
+      idx[d] = rest % sizes[d];
+      rest /= sizes[d];
+    }
+    idx_t src_offset = 0;
+    idx_t dst_offset = 0;
+    for (size_t d = 0; d < N; ++d) {
+      src_offset += idx[d] * src_layout.strides[d];
+      dst_offset += idx[d] * dst_layout.strides[d];
+    }
+    ASSERT_EQ(static_cast<Dst>(src_data[src_offset]), dst_data[dst_offset]);
+  }
+}
+
+}  // namespace
+
+TYPED_TEST(PermuteCopyTest, Transpose2D)
+{
+  using pol = TypeParam;
+  const std::array<camp::idx_t, 2> ij{{0, 1}};
+  const std::array<camp::idx_t, 2> ji{{1, 0}};
+
+  // extents that are not multiples of the tile or the register width
+  check_permute_copy<pol, double, double, 2>({{37, 53}}, ij, ji);
+  check_permute_copy<pol, double, double, 2>({{53, 37}}, ji, ij);
+  check_permute_copy<pol, float, float, 2>({{67, 29}}, ij, ji);
+  check_permute_copy<pol, int, int, 2>({{31, 45}}, ij, ji);
+  check_permute_copy<pol, float, double, 2>({{40, 24}}, ij, ji);
+
+  // small tiles, and tiles narrower than a register
+  check_permute_copy<pol, double, double, 2>({{64, 64}}, ij, ji, 8);
+  check_permute_copy<pol, float, float, 2>({{33, 35}}, ij, ji, 3);
+
+  // same layout, and extents of 1
+  check_permute_copy<pol, double, double, 2>({{37, 53}}, ij, ij);
+  check_permute_copy<pol, double, double, 2>({{1, 53}}, ij, ji);
+  check_permute_copy<pol, double, double, 2>({{53, 1}}, ij, ji);
+}
+
+TYPED_TEST(PermuteCopyTest, LargeTranspose)
+{
+  using pol = TypeParam;
+  const std::array<camp::idx_t, 2> ij{{0, 1}};
+  const std::array<camp::idx_t, 2> ji{{1, 0}};
+
+  // destinations past the streaming store threshold, with rows aligned to
+  // the register width, with ragged rows, and with a tile that is not a
+  // multiple of the register width
+  check_permute_copy<pol, double, double, 2>({{1024, 1024}}, ij, ji);
+  check_permute_copy<pol, float, float, 2>({{1024, 1024}}, ij, ji);
+  check_permute_copy<pol, double, double, 2>({{1000, 1032}}, ij, ji);
+  check_permute_copy<pol, double, double, 2>({{1023, 1025}}, ij, ji);
+  check_permute_copy<pol, float, float, 2>({{1023, 1025}}, ij, ji, 20);
+
+  // a batch of transposes
+  check_permute_copy<pol, double, double, 3>({{4, 512, 512}},
+                                             {{0, 1, 2}},
+                                             {{0, 2, 1}});
+}
+
+TYPED_TEST(PermuteCopyTest, Permutations3D)
+{
+  using pol = TypeParam;
+  const std::array<std::array<camp::idx_t, 3>, 6> perms{{{{0, 1, 2}},
+                                                          {{0, 2, 1}},
+                                                          {{1, 0, 2}},
+                                                          {{1, 2, 0}},
+                                                          {{2, 0, 1}},
+                                                          {{2, 1, 0}}}};
+  for (auto const& src_perm : perms) {
+    for (auto const& dst_perm : perms) {
+      check_permute_copy<pol, double, double, 3>({{7, 19, 33}},
+                                                 src_perm,
+                                                 dst_perm);
+      check_permute_copy<pol, float, float, 3>({{9, 17, 12}},
+                                               src_perm,
+                                               dst_perm,
+                                               8);
+    }
+  }
+}
+
+TYPED_TEST(PermuteCopyTest, ArrayOfStructs)
+{
+  using pol = TypeParam;
+
+  // zones x 5 members: struct members contiguous, and each member
+  // contiguous over the zones
+  const std::array<camp::idx_t, 2> aos{{0, 1}};
+  const std::array<camp::idx_t, 2> soa{{1, 0}};
+  check_permute_copy<pol, double, double, 2>({{1000, 5}}, aos, soa);
+  check_permute_copy<pol, double, double, 2>({{1000, 5}}, soa, aos);
+
+  // enough zones for tiles widened along the zones and streaming stores
+  check_permute_copy<pol, double, double, 2>({{70000, 8}}, aos, soa);
+  check_permute_copy<pol, double, double, 2>({{70000, 8}}, soa, aos);
+  check_permute_copy<pol, float, float, 2>({{70001, 5}}, aos, soa);
+
+  // 3D mesh of zones with 4 members, and a 4D permutation
+  const std::array<camp::idx_t, 4> zones_members{{0, 1, 2, 3}};
+  const std::array<camp::idx_t, 4> members_zones{{3, 0, 1, 2}};
+  const std::array<camp::idx_t, 4> mixed{{2, 0, 3, 1}};
+  check_permute_copy<pol, double, double, 4>({{6, 11, 13, 4}},
+                                             zones_members,
+                                             members_zones);
+  check_permute_copy<pol, double, double, 4>({{6, 11, 13, 4}},
+                                             members_zones,
+                                             mixed);
+}
+
+TYPED_TEST(PermuteCopyTest, Empty)
+{
+  using pol = TypeParam;
+
+  // a zero extent, nothing is read or written
+  const RAJA::Layout<2> src_layout(0, 5);
+  const RAJA::Layout<2> dst_layout =
+      RAJA::make_permuted_layout({{0, 5}}, RAJA::as_array<RAJA::PERM_JI>::get());
+  std::vector<double> dst_data(5, -1.0);
+
+  RAJA::View<const double, RAJA::Layout<2>> src(nullptr, src_layout);
+  RAJA::View<double, RAJA::Layout<2>> dst(dst_data.data(), dst_layout);
+  RAJA::permute_copy<pol>(src, dst);
+
+  for (double x : dst_data) {
+    ASSERT_EQ(x, -1.0);
+  }
+}
@@ -0,0 +1,215 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the temporally blocked stencil pattern,
+/// results are compared with one sweep per time step.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+using StencilExecPols = ::testing::Types<
+    RAJA::seq_exec
+#if defined(RAJA_ENABLE_OPENMP)
+    , RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+    , RAJA::tbb_for_exec
+#endif
+  >;
+
+template <typename T>
+class StencilTemporalBlockingTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(StencilTemporalBlockingTest, StencilExecPols);
+
+namespace
+{
+
+using idx_t = RAJA::Index_type;
+
+std::vector<double> make_grid(size_t size)
+{
+  std::vector<double> grid(size);
+  for (size_t i = 0; i < size; ++i) {
+    grid[i] = std::sin(0.37 * static_cast<double>(i));
+  }
+  return grid;
+}
+
+// every combination of tile widths and time block, including tiles narrower
+// than 2*time_block*radius, ragged last tiles and tiles in every dimension
+template <typename ExecPol, typename View, typename Body>
+void check_stencil(std::vector<double> const& init,
+                   typename View::layout_type const& layout,
+                   idx_t radius,
+                   Body const& body,
+                   std::vector<double> const& expected_even,
+                   std::vector<double> const& expected_odd,
+                   idx_t num_steps)
+{
+  for (idx_t width : {1, 5, 16, 1000}) {
+    for (idx_t inner_width : {width, idx_t(3), idx_t(1000)}) {
+      for (idx_t time_block : {1, 3, 8}) {
+        std::vector<double> a(init), b(init);
+        View va(a.data(), layout);
+        View vb(b.data(), layout);
+
+        RAJA::expt::StencilBlocking blocking;
+        blocking.radius = radius;
+        blocking.tile_width = width;
+        blocking.inner_tile_width = inner_width;
+        blocking.time_block = time_block;
+
+        View result =
+            RAJA::expt::stencil<ExecPol>(va, vb, num_steps, blocking, body);
+
+        std::vector<double> const& expected =
+            num_steps % 2 == 0 ? expected_even : expected_odd;
+        ASSERT_EQ(result.get_data(),
+                  num_steps % 2 == 0 ? a.data() : b.data());
+        for (size_t i = 0; i < init.size(); ++i) {
+          ASSERT_EQ(result.get_data()[i], expected[i])
+              << "width " << width << " inner_width " << inner_width
+              << " time_block " << time_block;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TYPED_TEST(StencilTemporalBlockingTest, Stencil1D)
+{
+  using view_t = RAJA::View<double, RAJA::OffsetLayout<1>>;
+  const idx_t n = 101;
+  const idx_t r = 2;
+  const auto layout = RAJA::make_offset_layout<1>({{-r}}, {{n + r}});
+
+  auto body = [=](view_t const& in, view_t const& out, idx_t i) {
+    out(i) = 0.1 * (in(i - 2) + in(i + 2)) + 0.2 * (in(i - 1) + in(i + 1)) +
+             0.4 * in(i);
+  };
+
+  const std::vector<double> init = make_grid(n + 2 * r);
+  for (idx_t num_steps : {0, 1, 7, 20}) {
+    std::vector<double> c(init), d(init);
+    const view_t v[2] = {view_t(c.data(), layout), view_t(d.data(), layout)};
+    for (idx_t s = 0; s < num_steps; ++s) {
+      for (idx_t i = 0; i < n; ++i) {
+        body(v[s % 2], v[(s + 1) % 2], i);
+      }
+    }
+    check_stencil<TypeParam, view_t>(init, layout, r, body, c, d, num_steps);
+  }
+}
+
+TYPED_TEST(StencilTemporalBlockingTest, Stencil2D)
+{
+  using view_t = RAJA::View<double, RAJA::OffsetLayout<2>>;
+  const idx_t n = 37;
+  const idx_t m = 11;
+  const auto layout =
+      RAJA::make_offset_layout<2>({{-1, -1}}, {{n + 1, m + 1}});
+
+  auto body = [=](view_t const& in, view_t const& out, idx_t i, idx_t j) {
+    out(i, j) =
+        0.25 * (in(i - 1, j) + in(i + 1, j) + in(i, j - 1) + in(i, j + 1));
+  };
+
+  const std::vector<double> init = make_grid((n + 2) * (m + 2));
+  for (idx_t num_steps : {1, 6, 13}) {
+    std::vector<double> c(init), d(init);
+    const view_t v[2] = {view_t(c.data(), layout), view_t(d.data(), layout)};
+    for (idx_t s = 0; s < num_steps; ++s) {
+      for (idx_t i = 0; i < n; ++i) {
+        for (idx_t j = 0; j < m; ++j) {
+          body(v[s % 2], v[(s + 1) % 2], i, j);
+        }
+      }
+    }
+    check_stencil<TypeParam, view_t>(init, layout, 1, body, c, d, num_steps);
+  }
+}
+
+TYPED_TEST(StencilTemporalBlockingTest, Stencil2DBox)
+{
+  using view_t = RAJA::View<double, RAJA::OffsetLayout<2>>;
+  const idx_t n = 33;
+  const idx_t m = 29;
+  const idx_t r = 2;
+  const auto layout =
+      RAJA::make_offset_layout<2>({{-r, -r}}, {{n + r, m + r}});
+
+  // reads the corners, which come from the tiles diagonal to the gaps
+  auto body = [=](view_t const& in, view_t const& out, idx_t i, idx_t j) {
+    double sum = 0.0;
+    for (idx_t di = -r; di <= r; ++di) {
+      for (idx_t dj = -r; dj <= r; ++dj) {
+        sum += (1.0 + 0.1 * di + 0.01 * dj) * in(i + di, j + dj);
+      }
+    }
+    out(i, j) = sum / 25.0;
+  };
+
+  const std::vector<double> init = make_grid((n + 2 * r) * (m + 2 * r));
+  for (idx_t num_steps : {5, 17}) {
+    std::vector<double> c(init), d(init);
+    const view_t v[2] = {view_t(c.data(), layout), view_t(d.data(), layout)};
+    for (idx_t s = 0; s < num_steps; ++s) {
+      for (idx_t i = 0; i < n; ++i) {
+        for (idx_t j = 0; j < m; ++j) {
+          body(v[s % 2], v[(s + 1) % 2], i, j);
+        }
+      }
+    }
+    check_stencil<TypeParam, view_t>(init, layout, r, body, c, d, num_steps);
+  }
+}
+
+TYPED_TEST(StencilTemporalBlockingTest, Stencil3D)
+{
+  using view_t = RAJA::View<double, RAJA::OffsetLayout<3>>;
+  const idx_t n = 19;
+  const idx_t m = 13;
+  const idx_t p = 11;
+  const auto layout = RAJA::make_offset_layout<3>({{-1, -1, -1}},
+                                                  {{n + 1, m + 1, p + 1}});
+
+  auto body = [=](view_t const& in,
+                  view_t const& out,
+                  idx_t i,
+                  idx_t j,
+                  idx_t k) {
+    out(i, j, k) = (in(i - 1, j, k) + in(i + 1, j, k) + in(i, j - 1, k) +
+                    in(i, j + 1, k) + in(i, j, k - 1) + in(i, j, k + 1)) /
+                   6.0;
+  };
+
+  const std::vector<double> init = make_grid((n + 2) * (m + 2) * (p + 2));
+  for (idx_t num_steps : {4, 9}) {
+    std::vector<double> c(init), d(init);
+    const view_t v[2] = {view_t(c.data(), layout), view_t(d.data(), layout)};
+    for (idx_t s = 0; s < num_steps; ++s) {
+      for (idx_t i = 0; i < n; ++i) {
+        for (idx_t j = 0; j < m; ++j) {
+          for (idx_t k = 0; k < p; ++k) {
+            body(v[s % 2], v[(s + 1) % 2], i, j, k);
+          }
+        }
+      }
+    }
+    check_stencil<TypeParam, view_t>(init, layout, 1, body, c, d, num_steps);
+  }
+}
@@ -0,0 +1,295 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using TensorBatchedTypes = ::testing::Types<
+#ifdef __AVX2__
+    camp::list<double, RAJA::expt::avx2_register>,
+    camp::list<float, RAJA::expt::avx2_register>,
+#endif
+    camp::list<double, RAJA::expt::scalar_register>,
+    camp::list<double, RAJA::expt::default_register>,
+    camp::list<float, RAJA::expt::default_register>
+  >;
+
+template <typename T>
+class TestTensorBatched : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(TestTensorBatched, TensorBatchedTypes);
+
+
+namespace
+{
+
+template <typename T>
+T tolerance(camp::idx_t n)
+{
+  return std::is_same<T, float>::value ? T(1e-3) * n : T(1e-10) * n;
+}
+
+// diagonally dominant row major matrices, one after another
+template <typename T>
+std::vector<T> make_matrices(camp::idx_t num_batch, camp::idx_t rows,
+                             camp::idx_t cols, bool dominant)
+{
+  std::mt19937 rng(rows * 100 + cols);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<T> m(num_batch * rows * cols);
+  for (camp::idx_t b = 0; b < num_batch; ++b) {
+    for (camp::idx_t i = 0; i < rows; ++i) {
+      for (camp::idx_t j = 0; j < cols; ++j) {
+        m[(b * rows + i) * cols + j] =
+            T(dist(rng) + ((dominant && i == j) ? cols : 0));
+      }
+    }
+  }
+  return m;
+}
+
+// row major C = A*B for every matrix of the batch
+template <typename T>
+std::vector<T> reference_gemm(std::vector<T> const& A, std::vector<T> const& B,
+                              camp::idx_t num_batch, camp::idx_t M,
+                              camp::idx_t K, camp::idx_t N)
+{
+  std::vector<T> C(num_batch * M * N, T(0));
+  for (camp::idx_t b = 0; b < num_batch; ++b) {
+    for (camp::idx_t i = 0; i < M; ++i) {
+      for (camp::idx_t j = 0; j < N; ++j) {
+        for (camp::idx_t k = 0; k < K; ++k) {
+          C[(b * M + i) * N + j] +=
+              A[(b * M + i) * K + k] * B[(b * K + k) * N + j];
+        }
+      }
+    }
+  }
+  return C;
+}
+
+template <typename T>
+void check_close(std::vector<T> const& actual, std::vector<T> const& expected,
+                 T tol)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    ASSERT_NEAR(actual[i], expected[i], tol);
+  }
+}
+
+}  // namespace
+
+
+TYPED_TEST(TestTensorBatched, PackUnpack)
+{
+  using T = camp::at_v<TypeParam, 0>;
+  using policy_t = camp::at_v<TypeParam, 1>;
+  namespace batched = RAJA::expt::batched;
+
+  constexpr camp::idx_t nb = 37;
+  std::vector<T> src = make_matrices<T>(nb, 3, 2, false);
+
+  const camp::idx_t stride = batched::padded_batch_size<T, policy_t>(nb);
+  ASSERT_GE(stride, nb);
+  ASSERT_EQ(stride % RAJA::expt::Register<T, policy_t>::s_num_elem, 0);
+
+  std::vector<T> packed(3 * 2 * stride);
+  auto view = batched::make_batch_matrix_view<3, 2, policy_t>(packed.data(), nb);
+  ASSERT_EQ(view.batch_stride, stride);
+
+  batched::pack<RAJA::seq_exec>(src.data(), view);
+  for (camp::idx_t b = 0; b < nb; ++b) {
+    for (camp::idx_t i = 0; i < 3; ++i) {
+      for (camp::idx_t j = 0; j < 2; ++j) {
+        ASSERT_EQ(view(b, i, j), src[(b * 3 + i) * 2 + j]);
+      }
+    }
+  }
+
+  std::vector<T> dst(src.size());
+  batched::unpack<RAJA::seq_exec>(view, dst.data());
+  ASSERT_EQ(dst, src);
+}
+
+TYPED_TEST(TestTensorBatched, GemmGemv)
+{
+  using T = camp::at_v<TypeParam, 0>;
+  using policy_t = camp::at_v<TypeParam, 1>;
+  namespace batched = RAJA::expt::batched;
+
+  // batch size not a multiple of the register width, without padding
+  constexpr camp::idx_t nb = 29;
+  constexpr camp::idx_t M = 3, K = 5, N = 4;
+
+  std::vector<T> A = make_matrices<T>(nb, M, K, false);
+  std::vector<T> B = make_matrices<T>(nb, K, N, false);
+  std::vector<T> C0 = make_matrices<T>(nb, M, N, false);
+
+  std::vector<T> a(M * K * nb), b(K * N * nb), c(M * N * nb);
+  batched::BatchMatrixView<T, M, K> Av(a.data(), nb, nb);
+  batched::BatchMatrixView<T, K, N> Bv(b.data(), nb, nb);
+  batched::BatchMatrixView<T, M, N> Cv(c.data(), nb, nb);
+  batched::pack<RAJA::seq_exec>(A.data(), Av);
+  batched::pack<RAJA::seq_exec>(B.data(), Bv);
+  batched::pack<RAJA::seq_exec>(C0.data(), Cv);
+
+  batched::gemm<RAJA::seq_exec, policy_t>(Av, Bv, Cv, T(2), T(-1));
+
+  std::vector<T> expected = reference_gemm(A, B, nb, M, K, N);
+  for (size_t i = 0; i < expected.size(); ++i) {
+    expected[i] = T(2) * expected[i] - C0[i];
+  }
+  std::vector<T> result(expected.size());
+  batched::unpack<RAJA::seq_exec>(Cv, result.data());
+  check_close(result, expected, tolerance<T>(K));
+
+  // y = A*x with x the first column of B
+  std::vector<T> x(nb * K), y(nb * M);
+  for (camp::idx_t e = 0; e < nb; ++e) {
+    for (camp::idx_t k = 0; k < K; ++k) {
+      x[e * K + k] = B[(e * K + k) * N];
+    }
+  }
+  std::vector<T> xp(K * nb), yp(M * nb);
+  batched::BatchVectorView<T, K> xv(xp.data(), nb, nb);
+  batched::BatchVectorView<T, M> yv(yp.data(), nb, nb);
+  batched::pack<RAJA::seq_exec>(x.data(), xv);
+
+  batched::gemv<RAJA::seq_exec, policy_t>(Av, xv, yv);
+
+  std::vector<T> yexp = reference_gemm(A, x, nb, M, K, 1);
+  batched::unpack<RAJA::seq_exec>(yv, y.data());
+  check_close(y, yexp, tolerance<T>(K));
+}
+
+TYPED_TEST(TestTensorBatched, LUSolveInverse)
+{
+  using T = camp::at_v<TypeParam, 0>;
+  using policy_t = camp::at_v<TypeParam, 1>;
+  namespace batched = RAJA::expt::batched;
+
+  constexpr camp::idx_t nb = 21;
+  constexpr camp::idx_t N = 6, NRHS = 2;
+
+  std::vector<T> A = make_matrices<T>(nb, N, N, true);
+  std::vector<T> B = make_matrices<T>(nb, N, NRHS, false);
+
+  const camp::idx_t stride = batched::padded_batch_size<T, policy_t>(nb);
+  std::vector<T> a(N * N * stride), lu(N * N * stride), ainv(N * N * stride),
+      x(N * NRHS * stride);
+  batched::BatchMatrixView<T, N, N> Av(a.data(), nb, stride);
+  batched::BatchMatrixView<T, N, N> LUv(lu.data(), nb, stride);
+  batched::BatchMatrixView<T, N, N> Iv(ainv.data(), nb, stride);
+  batched::BatchMatrixView<T, N, NRHS> Xv(x.data(), nb, stride);
+  batched::pack<RAJA::seq_exec>(A.data(), Av);
+  batched::pack<RAJA::seq_exec>(A.data(), LUv);
+  batched::pack<RAJA::seq_exec>(B.data(), Xv);
+
+  batched::lu_factor<RAJA::seq_exec, policy_t>(LUv);
+  batched::lu_solve<RAJA::seq_exec, policy_t>(LUv, Xv);
+
+  std::vector<T> X(nb * N * NRHS);
+  batched::unpack<RAJA::seq_exec>(Xv, X.data());
+  check_close(reference_gemm(A, X, nb, N, N, NRHS), B, tolerance<T>(N));
+
+  batched::inverse<RAJA::seq_exec, policy_t>(
+      batched::BatchMatrixView<T const, N, N>(Av), Iv);
+
+  std::vector<T> Ainv(nb * N * N);
+  batched::unpack<RAJA::seq_exec>(Iv, Ainv.data());
+  std::vector<T> identity(nb * N * N, T(0));
+  for (camp::idx_t b = 0; b < nb; ++b) {
+    for (camp::idx_t i = 0; i < N; ++i) {
+      identity[(b * N + i) * N + i] = T(1);
+    }
+  }
+  check_close(reference_gemm(A, Ainv, nb, N, N, N), identity, tolerance<T>(N));
+}
+
+TYPED_TEST(TestTensorBatched, CholeskySolve)
+{
+  using T = camp::at_v<TypeParam, 0>;
+  using policy_t = camp::at_v<TypeParam, 1>;
+  namespace batched = RAJA::expt::batched;
+
+  constexpr camp::idx_t nb = 19;
+  constexpr camp::idx_t N = 5, NRHS = 3;
+
+  // symmetric positive definite S = A*A^T
+  std::vector<T> A = make_matrices<T>(nb, N, N, true);
+  std::vector<T> S(nb * N * N, T(0));
+  for (camp::idx_t b = 0; b < nb; ++b) {
+    for (camp::idx_t i = 0; i < N; ++i) {
+      for (camp::idx_t j = 0; j < N; ++j) {
+        for (camp::idx_t k = 0; k < N; ++k) {
+          S[(b * N + i) * N + j] +=
+              A[(b * N + i) * N + k] * A[(b * N + j) * N + k];
+        }
+      }
+    }
+  }
+  std::vector<T> B = make_matrices<T>(nb, N, NRHS, false);
+
+  std::vector<T> l(N * N * nb), x(N * NRHS * nb);
+  batched::BatchMatrixView<T, N, N> Lv(l.data(), nb, nb);
+  batched::BatchMatrixView<T, N, NRHS> Xv(x.data(), nb, nb);
+  batched::pack<RAJA::seq_exec>(S.data(), Lv);
+  batched::pack<RAJA::seq_exec>(B.data(), Xv);
+
+  batched::cholesky_factor<RAJA::seq_exec, policy_t>(Lv);
+  batched::cholesky_solve<RAJA::seq_exec, policy_t>(Lv, Xv);
+
+  std::vector<T> X(nb * N * NRHS);
+  batched::unpack<RAJA::seq_exec>(Xv, X.data());
+  check_close(reference_gemm(S, X, nb, N, N, NRHS), B, tolerance<T>(N * N));
+}
+
+TYPED_TEST(TestTensorBatched, MismatchedViews)
+{
+  using T = camp::at_v<TypeParam, 0>;
+  using policy_t = camp::at_v<TypeParam, 1>;
+  namespace batched = RAJA::expt::batched;
+
+  // A is not padded, C is: chunks sized from C would read past the end of A
+  constexpr camp::idx_t nb = 29;
+  const camp::idx_t padded = batched::padded_batch_size<T, policy_t>(nb) + 8;
+
+  std::vector<T> a(2 * 2 * nb, T(1)), b(2 * 2 * padded, T(1)),
+      c(2 * 2 * padded, T(0));
+  batched::BatchMatrixView<T, 2, 2> Av(a.data(), nb, nb);
+  batched::BatchMatrixView<T, 2, 2> Bv(b.data(), nb, padded);
+  batched::BatchMatrixView<T, 2, 2> Cv(c.data(), nb, padded);
+  batched::BatchMatrixView<T, 2, 2> Cfew(c.data(), nb - 1, padded);
+
+  ASSERT_THROW((batched::gemm<RAJA::seq_exec, policy_t>(Av, Bv, Cv)),
+               std::runtime_error);
+  ASSERT_THROW((batched::gemm<RAJA::seq_exec, policy_t>(Bv, Bv, Cfew)),
+               std::runtime_error);
+  ASSERT_THROW((batched::lu_solve<RAJA::seq_exec, policy_t>(Av, Cv)),
+               std::runtime_error);
+  ASSERT_THROW((batched::cholesky_solve<RAJA::seq_exec, policy_t>(Av, Cv)),
+               std::runtime_error);
+  ASSERT_THROW((batched::inverse<RAJA::seq_exec, policy_t>(Av, Cv)),
+               std::runtime_error);
+
+  batched::BatchVectorView<T, 2> xv(a.data(), nb, nb);
+  batched::BatchVectorView<T, 2> yv(c.data(), nb, padded);
+  ASSERT_THROW((batched::gemv<RAJA::seq_exec, policy_t>(Bv, xv, yv)),
+               std::runtime_error);
+
+  // matching views are accepted
+  batched::gemm<RAJA::seq_exec, policy_t>(Bv, Bv, Cv);
+  ASSERT_EQ(T(2), Cv(0, 1, 1));
+}
@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TESNOR_REGISTER_CompareSelect_HPP__
+#define __TEST_TESNOR_REGISTER_CompareSelect_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+template <typename REGISTER_TYPE>
+void CompareSelectImpl()
+{
+  using register_t = REGISTER_TYPE;
+  using element_t = typename register_t::element_type;
+  using policy_t = typename register_t::register_policy;
+
+  static constexpr camp::idx_t num_elem = register_t::s_num_elem;
+
+  // Allocate
+
+  std::vector<element_t> input0_vec(num_elem);
+  element_t *input0_hptr = input0_vec.data();
+  element_t *input0_dptr = tensor_malloc<policy_t, element_t>(num_elem);
+
+  std::vector<element_t> input1_vec(num_elem);
+  element_t *input1_hptr = input1_vec.data();
+  element_t *input1_dptr = tensor_malloc<policy_t, element_t>(num_elem);
+
+  // one mask per comparison, lane i of comparison c is output0[c*num_elem+i]
+  std::vector<element_t> output0_vec(6*num_elem);
+  element_t *output0_dptr = tensor_malloc<policy_t, element_t>(6*num_elem);
+
+  std::vector<element_t> output1_vec(num_elem);
+  element_t *output1_dptr = tensor_malloc<policy_t, element_t>(num_elem);
+
+  std::vector<element_t> output2_vec(num_elem);
+  element_t *output2_dptr = tensor_malloc<policy_t, element_t>(num_elem);
+
+
+  // Initialize input data, with some lanes equal
+  for(camp::idx_t i = 0;i < num_elem; ++ i){
+    input0_hptr[i] = (element_t)(i % 3);
+    input1_hptr[i] = (element_t)((num_elem - i) % 4);
+  }
+
+  tensor_copy_to_device<policy_t>(input0_dptr, input0_vec);
+  tensor_copy_to_device<policy_t>(input1_dptr, input1_vec);
+
+
+  tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+
+    register_t x;
+    x.load_packed(input0_dptr);
+
+    register_t y;
+    y.load_packed(input1_dptr);
+
+    register_t one((element_t)1);
+    register_t zero((element_t)0);
+
+    // expand each mask into ones and zeros
+    one.blend(zero, ~x.cmp_eq(y)).store_packed(output0_dptr);
+    one.blend(zero, ~x.cmp_ne(y)).store_packed(output0_dptr+num_elem);
+    one.blend(zero, ~x.cmp_lt(y)).store_packed(output0_dptr+2*num_elem);
+    one.blend(zero, ~x.cmp_le(y)).store_packed(output0_dptr+3*num_elem);
+    one.blend(zero, ~x.cmp_gt(y)).store_packed(output0_dptr+4*num_elem);
+    one.blend(zero, ~x.cmp_ge(y)).store_packed(output0_dptr+5*num_elem);
+
+    // element-wise max through a select
+    y.blend(x, x.cmp_gt(y)).store_packed(output1_dptr);
+
+    // store only the lanes where x < y
+    y.store_packed(output2_dptr);
+    x.store_packed_masked(output2_dptr, x.cmp_lt(y));
+  });
+
+  tensor_copy_to_host<policy_t>(output0_vec, output0_dptr);
+  tensor_copy_to_host<policy_t>(output1_vec, output1_dptr);
+  tensor_copy_to_host<policy_t>(output2_vec, output2_dptr);
+
+
+  for(camp::idx_t i = 0;i < num_elem;++i){
+    element_t a = input0_vec[i];
+    element_t b = input1_vec[i];
+
+    ASSERT_SCALAR_EQ(element_t(a == b ? 1 : 0), output0_vec[i]);
+    ASSERT_SCALAR_EQ(element_t(a != b ? 1 : 0), output0_vec[num_elem+i]);
+    ASSERT_SCALAR_EQ(element_t(a <  b ? 1 : 0), output0_vec[2*num_elem+i]);
+    ASSERT_SCALAR_EQ(element_t(a <= b ? 1 : 0), output0_vec[3*num_elem+i]);
+    ASSERT_SCALAR_EQ(element_t(a >  b ? 1 : 0), output0_vec[4*num_elem+i]);
+    ASSERT_SCALAR_EQ(element_t(a >= b ? 1 : 0), output0_vec[5*num_elem+i]);
+
+    ASSERT_SCALAR_EQ(std::max<element_t>(a, b), output1_vec[i]);
+    ASSERT_SCALAR_EQ(std::min<element_t>(a, b), output2_vec[i]);
+  }
+
+
+  // check the mask operations on the host
+  using mask_t = typename register_t::mask_type;
+  mask_t mask;
+  ASSERT_TRUE(mask.none());
+  for(camp::idx_t i = 0;i < num_elem;i += 2){
+    mask.set(true, i);
+  }
+  ASSERT_EQ((num_elem+1)/2, mask.count());
+  ASSERT_EQ(camp::idx_t(num_elem), (mask | ~mask).count());
+  ASSERT_TRUE((mask | ~mask).all());
+  ASSERT_TRUE((mask & ~mask).none());
+  ASSERT_TRUE(mask_t(true) == (mask ^ ~mask));
+
+
+  // Cleanup
+  tensor_free<policy_t>(input0_dptr);
+  tensor_free<policy_t>(input1_dptr);
+  tensor_free<policy_t>(output0_dptr);
+  tensor_free<policy_t>(output1_dptr);
+  tensor_free<policy_t>(output2_dptr);
+}
+
+
+
+TYPED_TEST_P(TestTensorRegister, CompareSelect)
+{
+  CompareSelectImpl<TypeParam>();
+}
+
+
+#endif
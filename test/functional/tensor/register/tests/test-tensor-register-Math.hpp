@@ -0,0 +1,333 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TESNOR_REGISTER_Math_HPP__
+#define __TEST_TESNOR_REGISTER_Math_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+/*
+ * Error of got in units in the last place of the exact result want.
+ *
+ * NaN, infinite and zero results must be reproduced exactly, including the
+ * sign of zero.  Results beyond the largest finite value may be rounded to
+ * it or to infinity.  Below the normal range the ulp is that of the
+ * subnormals.
+ */
+template <typename T>
+double math_ulp_error(T got, long double want)
+{
+  static constexpr double fail = std::numeric_limits<double>::infinity();
+
+  if(std::isnan(want)){
+    return std::isnan(got) ? 0.0 : fail;
+  }
+  if(std::isnan(got)){
+    return fail;
+  }
+  if(want == 0 || std::isinf(want)){
+    return got == want && std::signbit(got) == std::signbit(want) ? 0.0 : fail;
+  }
+  if(std::signbit(got) != std::signbit(want)){
+    return fail;
+  }
+  if(std::fabs(want) > std::numeric_limits<T>::max()){
+    return std::isinf(got) || std::fabs(got) == std::numeric_limits<T>::max() ? 0.0 : fail;
+  }
+  if(std::isinf(got)){
+    return fail;
+  }
+
+  int e = 0;
+  std::frexp(want, &e);
+  e = std::max(e, std::numeric_limits<T>::min_exponent);
+  long double ulp = std::ldexp((long double)1, e - std::numeric_limits<T>::digits);
+  return (double)(std::fabs((long double)got - want) / ulp);
+}
+
+/*
+ * The long double reference is exact enough to measure errors of a
+ * fraction of an ulp, unless long double is no wider than element_t.
+ */
+template <typename T>
+double math_ulp_reference_slack()
+{
+  return std::numeric_limits<long double>::digits >=
+         std::numeric_limits<T>::digits + 8 ? 0.0 : 1.0;
+}
+
+/*
+ * Computes exp(ex), log(lx) and pow(px, py) with ACCURACY on the register,
+ * and checks them against the long double results: exp and log are within
+ * MAX_ULP, and pow within the larger of 2 and MAX_ULP.
+ */
+template <typename REGISTER_TYPE, typename ACCURACY, typename element_t>
+void MathAccuracyImpl(std::vector<element_t> const &ex,
+                      std::vector<element_t> const &lx,
+                      std::vector<element_t> const &px,
+                      std::vector<element_t> const &py)
+{
+  using register_t = REGISTER_TYPE;
+  using policy_t = typename register_t::register_policy;
+
+  static constexpr camp::idx_t num_elem = register_t::s_num_elem;
+
+  // pad the inputs to whole registers with ones
+  camp::idx_t num_reg = (camp::idx_t(ex.size()) + num_elem - 1) / num_elem;
+  camp::idx_t n = num_reg * num_elem;
+
+  std::vector<element_t> input_vec(4*n, element_t(1));
+  std::copy(ex.begin(), ex.end(), input_vec.begin());
+  std::copy(lx.begin(), lx.end(), input_vec.begin()+n);
+  std::copy(px.begin(), px.end(), input_vec.begin()+2*n);
+  std::copy(py.begin(), py.end(), input_vec.begin()+3*n);
+
+  element_t *input_dptr = tensor_malloc<policy_t, element_t>(4*n);
+  std::vector<element_t> output_vec(3*n);
+  element_t *output_dptr = tensor_malloc<policy_t, element_t>(3*n);
+
+  tensor_copy_to_device<policy_t>(input_dptr, input_vec);
+
+  tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+    for(camp::idx_t r = 0;r < num_reg;++ r){
+      camp::idx_t offset = r*num_elem;
+
+      register_t x;
+      x.load_packed(input_dptr+offset);
+      x.template exp<ACCURACY>().store_packed(output_dptr+offset);
+
+      x.load_packed(input_dptr+n+offset);
+      x.template log<ACCURACY>().store_packed(output_dptr+n+offset);
+
+      register_t y;
+      x.load_packed(input_dptr+2*n+offset);
+      y.load_packed(input_dptr+3*n+offset);
+      x.template pow<ACCURACY>(y).store_packed(output_dptr+2*n+offset);
+    }
+  });
+
+  tensor_copy_to_host<policy_t>(output_vec, output_dptr);
+
+  int max_ulp = ACCURACY::s_max_ulp;
+  double slack = math_ulp_reference_slack<element_t>();
+  double exp_log_ulp = max_ulp + slack;
+  double pow_ulp = std::max(2, max_ulp) + slack;
+
+  for(camp::idx_t i = 0;i < camp::idx_t(ex.size());++ i){
+    element_t a = ex[i], b = lx[i], c = px[i], d = py[i];
+
+    ASSERT_LE(math_ulp_error(output_vec[i], std::exp((long double)a)), exp_log_ulp)
+        << "exp(" << a << ") = " << output_vec[i];
+    ASSERT_LE(math_ulp_error(output_vec[n+i], std::log((long double)b)), exp_log_ulp)
+        << "log(" << b << ") = " << output_vec[n+i];
+    ASSERT_LE(math_ulp_error(output_vec[2*n+i], std::pow((long double)c, (long double)d)), pow_ulp)
+        << "pow(" << c << ", " << d << ") = " << output_vec[2*n+i];
+  }
+
+  tensor_free<policy_t>(input_dptr);
+  tensor_free<policy_t>(output_dptr);
+}
+
+/*
+ * Sweeps the domain of each function with pseudo-random arguments, with
+ * fixed seeds so that failures reproduce.
+ */
+template <typename REGISTER_TYPE, typename ACCURACY>
+void MathSweepImpl()
+{
+  using element_t = typename REGISTER_TYPE::element_type;
+  using limits = std::numeric_limits<element_t>;
+
+  static constexpr int num_points = 4096;
+
+  std::mt19937 gen(1234);
+  auto uniform = [&](double lo, double hi){
+    return std::uniform_real_distribution<double>(lo, hi)(gen);
+  };
+
+  // from the results that underflow to those that overflow
+  double exp_lo = std::log((double)limits::denorm_min()) - 1.0;
+  double exp_hi = std::log((double)limits::max()) + 1.0;
+
+  // subnormals up to the largest values
+  double log2_lo = limits::min_exponent - limits::digits;
+  double log2_hi = limits::max_exponent;
+
+  double eps = limits::epsilon();
+
+  std::vector<element_t> ex(num_points), lx(num_points), px(num_points), py(num_points);
+  for(int i = 0;i < num_points;++ i){
+    switch(i % 4){
+      case 0:
+        ex[i] = element_t(uniform(exp_lo, exp_hi));
+        lx[i] = element_t(std::exp2(uniform(log2_lo, log2_hi)));
+        // y*log(x) across the range of exp, where it amplifies the error
+        // of log(x) the most
+        px[i] = element_t(std::exp2(uniform(-4, 4)));
+        py[i] = element_t(uniform(exp_lo, exp_hi) / std::log((double)px[i]));
+        break;
+
+      case 1:
+        // log(x) and x^y near x = 1, where large y amplify the error of log
+        ex[i] = element_t(uniform(-1, 1));
+        lx[i] = element_t(1.0 + uniform(-0.0625, 0.0625));
+        px[i] = element_t(1.0 + std::exp2(-uniform(4, limits::digits-2)) * (i % 8 < 4 ? 1 : -1));
+        py[i] = element_t(uniform(-30, 30) / std::fabs(px[i] - 1.0));
+        break;
+
+      case 2:
+        // tiny arguments, arguments within a few ulp of 1, and negative
+        // bases with odd and even integer exponents
+        ex[i] = element_t(std::exp2(uniform(-limits::digits-4, 0)) * (i % 8 < 4 ? 1 : -1));
+        lx[i] = element_t(1.0 + eps * std::floor(uniform(-8, 8)));
+        px[i] = element_t(-std::exp2(uniform(-6, 6)));
+        py[i] = element_t(std::floor(uniform(-20, 20)));
+        break;
+
+      default:
+        ex[i] = element_t(uniform(-20, 20));
+        lx[i] = element_t(uniform(0, 4));
+        px[i] = element_t(uniform(0, 4));
+        py[i] = element_t(uniform(-8, 8));
+        break;
+    }
+  }
+
+  MathAccuracyImpl<REGISTER_TYPE, ACCURACY>(ex, lx, px, py);
+}
+
+/*
+ * exp, log and pow of NaN, infinities, signed zeros, subnormals, negative
+ * bases and integer exponents, each pair of values for pow.
+ */
+template <typename REGISTER_TYPE, typename ACCURACY>
+void MathSpecialImpl()
+{
+  using element_t = typename REGISTER_TYPE::element_type;
+  using limits = std::numeric_limits<element_t>;
+
+  element_t const special[] = {
+      limits::quiet_NaN(), limits::infinity(), -limits::infinity(),
+      element_t(0), -element_t(0),
+      limits::denorm_min(), -limits::denorm_min(), limits::min() / 3, limits::min(),
+      limits::max(), -limits::max(),
+      element_t(1), element_t(-1), element_t(0.5), element_t(-0.5),
+      element_t(2), element_t(-2), element_t(3), element_t(-3),
+      element_t(1.5), element_t(-1.5), element_t(1) + limits::epsilon(),
+      element_t(1) - limits::epsilon()/2, element_t(200), element_t(-1001)};
+
+  std::vector<element_t> ex, px, py;
+  for(element_t x : special){
+    for(element_t y : special){
+      ex.push_back(x);
+      px.push_back(x);
+      py.push_back(y);
+    }
+  }
+
+  MathAccuracyImpl<REGISTER_TYPE, ACCURACY>(ex, ex, px, py);
+}
+
+// the math functions are only provided for floating point registers
+template <typename REGISTER_TYPE>
+void MathImpl(std::false_type)
+{
+}
+
+template <typename REGISTER_TYPE>
+void MathImpl(std::true_type)
+{
+  using register_t = REGISTER_TYPE;
+  using element_t = typename register_t::element_type;
+  using policy_t = typename register_t::register_policy;
+
+  static constexpr camp::idx_t num_elem = register_t::s_num_elem;
+
+  // Allocate
+
+  std::vector<element_t> input0_vec(num_elem);
+  element_t *input0_hptr = input0_vec.data();
+  element_t *input0_dptr = tensor_malloc<policy_t, element_t>(num_elem);
+
+  std::vector<element_t> input1_vec(num_elem);
+  element_t *input1_hptr = input1_vec.data();
+  element_t *input1_dptr = tensor_malloc<policy_t, element_t>(num_elem);
+
+  // one result per function, lane i of function f is output0[f*num_elem+i]
+  static constexpr camp::idx_t num_func = 3;
+  std::vector<element_t> output0_vec(num_func*num_elem);
+  element_t *output0_dptr = tensor_malloc<policy_t, element_t>(num_func*num_elem);
+
+
+  // Initialize input data, input0 in (-8, 8) and input1 in (0, 4)
+  for(camp::idx_t i = 0;i < num_elem; ++ i){
+    input0_hptr[i] = (element_t)(16.0*rand()/RAND_MAX - 8.0);
+    input1_hptr[i] = (element_t)(4.0*rand()/RAND_MAX + 1.0e-3);
+  }
+
+  tensor_copy_to_device<policy_t>(input0_dptr, input0_vec);
+  tensor_copy_to_device<policy_t>(input1_dptr, input1_vec);
+
+
+  tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+
+    register_t x;
+    x.load_packed(input0_dptr);
+
+    register_t y;
+    y.load_packed(input1_dptr);
+
+    x.abs().store_packed(output0_dptr);
+    y.sqrt().store_packed(output0_dptr+num_elem);
+    y.rsqrt().store_packed(output0_dptr+2*num_elem);
+  });
+
+  tensor_copy_to_host<policy_t>(output0_vec, output0_dptr);
+
+
+  element_t eps = std::numeric_limits<element_t>::epsilon();
+  for(camp::idx_t i = 0;i < num_elem;++i){
+    element_t a = input0_vec[i];
+    element_t b = input1_vec[i];
+
+    ASSERT_SCALAR_EQ(std::abs(a), output0_vec[i]);
+    ASSERT_NEAR(std::sqrt(b), output0_vec[num_elem+i], 4*eps*std::sqrt(b));
+    ASSERT_NEAR(1/std::sqrt(b), output0_vec[2*num_elem+i], 4*eps/std::sqrt(b));
+  }
+
+
+  // Cleanup
+  tensor_free<policy_t>(input0_dptr);
+  tensor_free<policy_t>(input1_dptr);
+  tensor_free<policy_t>(output0_dptr);
+
+
+  // exp, log and pow for each accuracy
+  MathSweepImpl<register_t, RAJA::expt::math_accurate>();
+  MathSweepImpl<register_t, RAJA::expt::math_accuracy<2>>();
+  MathSweepImpl<register_t, RAJA::expt::math_fast>();
+
+  MathSpecialImpl<register_t, RAJA::expt::math_accurate>();
+  MathSpecialImpl<register_t, RAJA::expt::math_fast>();
+}
+
+
+
+TYPED_TEST_P(TestTensorRegister, Math)
+{
+  using element_t = typename TypeParam::element_type;
+  MathImpl<TypeParam>(std::is_floating_point<element_t>());
+}
+
+
+#endif
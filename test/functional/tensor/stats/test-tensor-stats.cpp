@@ -0,0 +1,139 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the per kernel tensor statistics
+///
+
+#define RAJA_ENABLE_VECTOR_STATS
+
+#include "RAJA_test-base.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using TensorStatsPolicies = ::testing::Types<RAJA::seq_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                             ,
+                                             RAJA::omp_parallel_for_exec,
+                                             RAJA::omp_parallel_for_static_exec<1>
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                             ,
+                                             RAJA::tbb_for_exec
+#endif
+                                             >;
+
+template <typename POLICY>
+class TestTensorStats : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(TestTensorStats, TensorStatsPolicies);
+
+namespace
+{
+
+using stats = RAJA::expt::tensor_stats;
+
+camp::idx_t num_ops(stats::counters const& c)
+{
+  camp::idx_t n = 0;
+  for (int s = 0; s < stats::num_stat_ids; ++s) {
+    n += c.count[s];
+  }
+  return n;
+}
+
+}  // namespace
+
+//
+// Z = X * Y one register per iteration: two loads, a multiply and a store.
+//
+TYPED_TEST(TestTensorStats, KernelCounters)
+{
+  using vector_t = RAJA::expt::VectorRegister<double>;
+  using idx_t = RAJA::VectorIndex<int, vector_t>;
+
+  const int width = vector_t::s_num_elem;
+  const int num_blocks = 1000;
+  const int N = num_blocks * width;
+
+  std::vector<double> x(N, 2.0), y(N, 3.0), z(N, 0.0);
+  RAJA::View<double, RAJA::Layout<1>> X(x.data(), N);
+  RAJA::View<double, RAJA::Layout<1>> Y(y.data(), N);
+  RAJA::View<double, RAJA::Layout<1>> Z(z.data(), N);
+
+  stats::resetVectorStats();
+
+  const std::string name =
+      std::string("tensor-stats-") + ::testing::UnitTest::GetInstance()
+                                         ->current_test_info()
+                                         ->type_param();
+
+  RAJA::forall<TypeParam>(RAJA::TypedRangeSegment<int>(0, num_blocks),
+    RAJA::expt::KernelName(name.c_str()),
+    [=](int b) {
+      auto i = idx_t::range(b * width, (b + 1) * width);
+      Z[i] = X[i] * Y[i];
+  });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(6.0, z[i]);
+  }
+
+  const stats::counters c = stats::getKernelStats(name.c_str());
+
+  ASSERT_EQ(2 * num_blocks, c.count[stats::num_vector_load_packed] +
+                                c.count[stats::num_vector_load_packed_n]);
+  ASSERT_EQ(num_blocks, c.count[stats::num_vector_store_packed] +
+                            c.count[stats::num_vector_store_packed_n]);
+  ASSERT_EQ(num_blocks, c.count[stats::num_vector_multiply]);
+  ASSERT_EQ(4 * num_blocks, num_ops(c));
+
+  ASSERT_EQ(static_cast<camp::idx_t>(2 * N * sizeof(double)), c.bytes_loaded);
+  ASSERT_EQ(static_cast<camp::idx_t>(N * sizeof(double)), c.bytes_stored);
+  ASSERT_EQ(static_cast<camp::idx_t>(N), c.flops);
+
+  // nothing recorded by the worker threads is left outside of the kernel
+  ASSERT_EQ(0, num_ops(stats::getKernelStats("")));
+  ASSERT_EQ(0, stats::currentKernel());
+}
+
+//
+// Kernels opened on one thread do not capture the operations of another.
+//
+TEST(TestTensorStatsThreads, KernelPerThread)
+{
+  using vector_t = RAJA::expt::VectorRegister<double>;
+
+  stats::resetVectorStats();
+
+  {
+    stats::KernelScope scope("tensor-stats-main");
+    std::thread other([]() {
+      vector_t a(1.0), b(2.0);
+      a = a.add(b);
+      EXPECT_EQ(0, stats::currentKernel());
+    });
+    other.join();
+
+    vector_t a(1.0), b(2.0);
+    a = a.multiply(b);
+    ASSERT_NE(0, stats::currentKernel());
+  }
+
+  const stats::counters main_stats =
+      stats::getKernelStats("tensor-stats-main");
+  ASSERT_EQ(1, main_stats.count[stats::num_vector_multiply]);
+  ASSERT_EQ(0, main_stats.count[stats::num_vector_add]);
+
+  const stats::counters outside = stats::getKernelStats("");
+  ASSERT_EQ(1, outside.count[stats::num_vector_add]);
+  ASSERT_EQ(0, outside.count[stats::num_vector_multiply]);
+}
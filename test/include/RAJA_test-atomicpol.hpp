@@ -32,6 +32,7 @@ using SequentialAtomicPols =
               RAJA::hip_atomic_explicit<RAJA::builtin_atomic>,
 #endif
 #endif
+              RAJA::combining_atomic,
               RAJA::seq_atomic
             >;
 
@@ -54,6 +55,7 @@ using OpenMPAtomicPols =
               RAJA::hip_atomic_explicit<RAJA::builtin_atomic>,
 #endif
 #endif
+              RAJA::combining_atomic,
               RAJA::auto_atomic
             >;
 #endif  // RAJA_ENABLE_OPENMP
@@ -67,6 +69,7 @@ using TBBAtomicPols =
 #if defined(RAJA_ENABLE_HIP)
               RAJA::hip_atomic_explicit<RAJA::builtin_atomic>,
 #endif
+              RAJA::combining_atomic,
               RAJA::builtin_atomic
             >;
 #endif  // RAJA_ENABLE_TBB
@@ -30,6 +30,17 @@ using OpenMPAsyncForallAtomicExecPols = OpenMPForallAtomicExecPols;
 
 #endif  // RAJA_ENABLE_OPENMP
 
+// Host policies run on the worker thread of an asynchronous host resource
+using HostAsyncAsyncForallExecPols = camp::list< RAJA::seq_exec,
+                                                 RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                                ,RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                                ,RAJA::tbb_for_exec
+#endif
+                                               >;
+
 #if defined(RAJA_ENABLE_TBB)
 using TBBAsyncForallExecPols = TBBForallExecPols;
 using TBBAsyncForallReduceExecPols = TBBForallReduceExecPols;
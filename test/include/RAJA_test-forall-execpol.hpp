@@ -38,7 +38,13 @@ using OpenMPForallExecPols =
               , RAJA::omp_parallel_for_static_exec< >
               , RAJA::omp_parallel_for_static_exec<4>
 
+              , RAJA::omp_taskloop_exec< >
+              , RAJA::omp_taskloop_exec<16>
+
 #if defined(RAJA_TEST_EXHAUSTIVE)
+              , RAJA::omp_taskloop_nogroup_exec< >
+              , RAJA::omp_taskloop_nogroup_exec<16>
+
               , RAJA::omp_parallel_for_dynamic_exec< >
               , RAJA::omp_parallel_for_dynamic_exec<4>
 
@@ -91,6 +97,8 @@ using OpenMPForallAtomicExecPols =
               , RAJA::omp_parallel_for_guided_exec<3>
 
               , RAJA::omp_parallel_for_runtime_exec
+
+              , RAJA::omp_taskloop_exec<8>
 #endif
             >; 
 
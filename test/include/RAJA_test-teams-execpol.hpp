@@ -37,6 +37,24 @@ using OpenMP_launch_policies = camp::list<
 
 #endif  // RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_TBB)
+using tbb_policies = camp::list<
+         RAJA::LaunchPolicy<RAJA::tbb_launch_t>,
+         RAJA::LoopPolicy<RAJA::tbb_for_dynamic>
+  >;
+
+using tbb_static_policies = camp::list<
+         RAJA::LaunchPolicy<RAJA::tbb_launch_t>,
+         RAJA::LoopPolicy<RAJA::tbb_for_static<4>>
+  >;
+
+using TBB_launch_policies = camp::list<
+  tbb_policies,
+  tbb_static_policies
+  >;
+
+#endif  // RAJA_ENABLE_TBB
+
 #if defined(RAJA_ENABLE_CUDA)
 
 using cuda_policies = camp::list<
@@ -16,6 +16,8 @@ class CounterPlugin :
   public RAJA::util::PluginStrategy
 {
   public:
+  using RAJA::util::PluginStrategy::setActive;
+
   void preCapture(const RAJA::util::PluginContext& p) override {
     ASSERT_NE(plugin_test_data, nullptr);
     ASSERT_NE(plugin_test_resource, nullptr);
@@ -54,6 +56,10 @@ class CounterPlugin :
     ASSERT_EQ(data.launch_platform_active, RAJA::Platform::undefined);
     data.launch_counter_pre++;
     data.launch_platform_active = p.platform;
+    data.launch_num_iterations = p.num_iterations;
+    data.launch_call_site_id = p.call_site_id;
+    data.launch_kernel_name = p.kernel_name;
+    data.launch_policy = p.policy;
 
     plugin_test_resource->memcpy(plugin_test_data, &data, sizeof(CounterData));
   }
@@ -75,3 +81,16 @@ class CounterPlugin :
 
 // Statically loading plugin.
 static RAJA::util::PluginRegistry::add<CounterPlugin> P("counter-plugin", "Counter");
+
+void set_counter_plugin_active(bool active)
+{
+  for (auto plugin = RAJA::util::PluginRegistry::begin();
+      plugin != RAJA::util::PluginRegistry::end();
+      ++plugin)
+  {
+    CounterPlugin* counter = dynamic_cast<CounterPlugin*>((*plugin).get());
+    if (counter != nullptr) {
+      counter->setActive(active);
+    }
+  }
+}
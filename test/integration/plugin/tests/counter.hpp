@@ -16,6 +16,10 @@ struct CounterData
   RAJA::Platform launch_platform_active = RAJA::Platform::undefined;
   int            launch_counter_pre     = 0;
   int            launch_counter_post    = 0;
+  size_t         launch_num_iterations  = 0;
+  uint64_t       launch_call_site_id    = 0;
+  const char*    launch_kernel_name     = nullptr;
+  const char*    launch_policy          = nullptr;
 };
 
 // note the use of a pointer here to allow different types of memory
@@ -24,4 +28,7 @@ extern CounterData* plugin_test_data;
 
 extern camp::resources::Resource* plugin_test_resource;
 
+// turn the callbacks of the counter plugin on or off
+void set_counter_plugin_active(bool active);
+
 #endif  // RAJA_counter_HPP
@@ -55,6 +55,11 @@ void PluginForallTestImpl()
   ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
   ASSERT_EQ(plugin_data.launch_counter_pre,     10);
   ASSERT_EQ(plugin_data.launch_counter_post,    10);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  1u);
+  ASSERT_NE(plugin_data.launch_call_site_id,    0u);
+  ASSERT_EQ(plugin_data.launch_kernel_name,     nullptr);
+  ASSERT_STREQ(plugin_data.launch_policy,
+               RAJA::util::detail::type_name<ExecPolicy>());
 
   plugin_test_resource->deallocate(data);
 }
@@ -94,6 +99,11 @@ void PluginForAllICountTestImpl()
   ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
   ASSERT_EQ(plugin_data.launch_counter_pre,     10);
   ASSERT_EQ(plugin_data.launch_counter_post,    10);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  1u);
+  ASSERT_NE(plugin_data.launch_call_site_id,    0u);
+  ASSERT_EQ(plugin_data.launch_kernel_name,     nullptr);
+  ASSERT_STREQ(plugin_data.launch_policy,
+               RAJA::util::detail::type_name<ExecPolicy>());
 
   plugin_test_resource->deallocate(data);
 }
@@ -141,6 +151,11 @@ void PluginForAllIdxSetTestImpl()
   ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
   ASSERT_EQ(plugin_data.launch_counter_pre,     10);
   ASSERT_EQ(plugin_data.launch_counter_post,    10);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  1u);
+  ASSERT_NE(plugin_data.launch_call_site_id,    0u);
+  ASSERT_EQ(plugin_data.launch_kernel_name,     nullptr);
+  ASSERT_STREQ(plugin_data.launch_policy,
+               RAJA::util::detail::type_name<RAJA::ExecPolicy<RAJA::seq_segit, ExecPolicy>>());
 
   plugin_test_resource->deallocate(data);
 }
@@ -188,10 +203,145 @@ void PluginForAllIcountIdxSetTestImpl()
   ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
   ASSERT_EQ(plugin_data.launch_counter_pre,     10);
   ASSERT_EQ(plugin_data.launch_counter_post,    10);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  1u);
+  ASSERT_NE(plugin_data.launch_call_site_id,    0u);
+  ASSERT_EQ(plugin_data.launch_kernel_name,     nullptr);
+  ASSERT_STREQ(plugin_data.launch_policy,
+               RAJA::util::detail::type_name<RAJA::ExecPolicy<RAJA::seq_segit, ExecPolicy>>());
 
   plugin_test_resource->deallocate(data);
 }
 
+// test the kernel name, policy and call site id passed to the plugin
+template <typename ExecPolicy,
+          typename WORKING_RES,
+          RAJA::Platform PLATFORM>
+void PluginForallContextTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  CounterData plugin_data;
+
+  RAJA::forall<ExecPolicy>(
+    RAJA::RangeSegment(0, 7),
+    RAJA::expt::KernelName("plugin-test-kernel"),
+    [=] RAJA_HOST_DEVICE (int) { }
+  );
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
+  ASSERT_EQ(plugin_data.launch_counter_pre,     1);
+  ASSERT_EQ(plugin_data.launch_counter_post,    1);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  7u);
+  ASSERT_STREQ(plugin_data.launch_kernel_name,  "plugin-test-kernel");
+  ASSERT_STRNE(plugin_data.launch_policy,       "");
+  ASSERT_STREQ(plugin_data.launch_policy,
+               RAJA::util::detail::type_name<ExecPolicy>());
+
+  const uint64_t named_id = plugin_data.launch_call_site_id;
+  ASSERT_NE(named_id, 0u);
+
+  // every launch from a call site has the same id, call sites with
+  // different loop bodies have different ids
+  uint64_t first_ids[2];
+  uint64_t second_ids[2];
+
+  for (int i = 0; i < 2; i++) {
+
+    RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(0, 1),
+      [=] RAJA_HOST_DEVICE (int) { }
+    );
+
+    plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+    ASSERT_EQ(plugin_data.launch_kernel_name, nullptr);
+    first_ids[i] = plugin_data.launch_call_site_id;
+
+    RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(0, 1),
+      [=] RAJA_HOST_DEVICE (int) { }
+    );
+
+    plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+    second_ids[i] = plugin_data.launch_call_site_id;
+  }
+
+  ASSERT_NE(first_ids[0],  0u);
+  ASSERT_NE(second_ids[0], 0u);
+  ASSERT_EQ(first_ids[0],  first_ids[1]);
+  ASSERT_EQ(second_ids[0], second_ids[1]);
+  ASSERT_NE(first_ids[0],  second_ids[0]);
+  ASSERT_NE(named_id,      first_ids[0]);
+  ASSERT_NE(named_id,      second_ids[0]);
+}
+
+// test that no plugin is called when no plugin is active
+template <typename ExecPolicy,
+          typename WORKING_RES,
+          RAJA::Platform PLATFORM>
+void PluginForallInactiveTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+  InactivePluginScope inactive;
+
+  ASSERT_FALSE(RAJA::util::plugins_active());
+
+  CounterData* data = plugin_test_resource->allocate<CounterData>(10);
+
+  for (int i = 0; i < 10; i++) {
+
+    RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(i,i+1),
+      PluginTestCallable{data}
+    );
+
+    // the loop body never saw a capture
+    CounterData loop_data;
+    plugin_test_resource->memcpy(&loop_data, &data[i], sizeof(CounterData));
+    ASSERT_EQ(loop_data.capture_platform_active, RAJA::Platform::undefined);
+    ASSERT_EQ(loop_data.capture_counter_pre,     -1);
+    ASSERT_EQ(loop_data.capture_counter_post,    -1);
+    ASSERT_EQ(loop_data.launch_platform_active, RAJA::Platform::undefined);
+    ASSERT_EQ(loop_data.launch_counter_pre,     0);
+    ASSERT_EQ(loop_data.launch_counter_post,    0);
+  }
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.capture_counter_pre,    0);
+  ASSERT_EQ(plugin_data.capture_counter_post,   0);
+  ASSERT_EQ(plugin_data.launch_counter_pre,     0);
+  ASSERT_EQ(plugin_data.launch_counter_post,    0);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  0u);
+  ASSERT_EQ(plugin_data.launch_call_site_id,    0u);
+
+  plugin_test_resource->deallocate(data);
+}
+
+// test that the loop body is only copied for plugins when one is active
+TEST(PluginForallCopyTest, PluginForallBodyCopies)
+{
+  SetupPluginVars spv(camp::resources::Host::get_default());
+
+  {
+    InactivePluginScope inactive;
+
+    CopyCountingCallable::num_copies = 0;
+    RAJA::forall<RAJA::seq_exec>(
+      RAJA::RangeSegment(0, 10),
+      CopyCountingCallable{}
+    );
+    ASSERT_EQ(CopyCountingCallable::num_copies, 0);
+  }
+
+  CopyCountingCallable::num_copies = 0;
+  RAJA::forall<RAJA::seq_exec>(
+    RAJA::RangeSegment(0, 10),
+    CopyCountingCallable{}
+  );
+  ASSERT_EQ(CopyCountingCallable::num_copies, 1);
+}
+
 TYPED_TEST_SUITE_P(PluginForallTest);
 template <typename T>
 class PluginForallTest : public ::testing::Test
@@ -234,10 +384,30 @@ TYPED_TEST_P(PluginForallTest, PluginForAllIcountIdxSet)
   PluginForAllIcountIdxSetTestImpl<ExecPolicy, ResType, PlatformHolder::platform>( );
 }
 
+TYPED_TEST_P(PluginForallTest, PluginForallContext)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginForallContextTestImpl<ExecPolicy, ResType, PlatformHolder::platform>( );
+}
+
+TYPED_TEST_P(PluginForallTest, PluginForallInactive)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginForallInactiveTestImpl<ExecPolicy, ResType, PlatformHolder::platform>( );
+}
+
 REGISTER_TYPED_TEST_SUITE_P(PluginForallTest,
                             PluginForall,
                             PluginForAllICount,
                             PluginForAllIdxSet,
-                            PluginForAllIcountIdxSet);
+                            PluginForAllIcountIdxSet,
+                            PluginForallContext,
+                            PluginForallInactive);
 
 #endif  //__TEST_PLUGIN_FORALL_HPP__
@@ -65,6 +65,37 @@ private:
 };
 
 
+// Turns the callbacks of the counter plugin off while in scope
+struct InactivePluginScope
+{
+  InactivePluginScope() { set_counter_plugin_active(false); }
+  ~InactivePluginScope() { set_counter_plugin_active(true); }
+
+  InactivePluginScope(InactivePluginScope const&) = delete;
+  InactivePluginScope& operator=(InactivePluginScope const&) = delete;
+};
+
+
+// Counts the copies of the loop body made on the host
+struct CopyCountingCallable
+{
+  static int num_copies;
+
+  CopyCountingCallable() = default;
+
+  RAJA_HOST_DEVICE CopyCountingCallable(CopyCountingCallable const&)
+  {
+#if !defined(RAJA_DEVICE_CODE)
+    num_copies++;
+#endif
+  }
+
+  RAJA_HOST_DEVICE void operator()(int) const { }
+};
+
+int CopyCountingCallable::num_copies = 0;
+
+
 struct PluginTestCallable
 {
   PluginTestCallable(CounterData* data_optr)
@@ -0,0 +1,274 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for nth_element, partial_sort, top_k
+/// and their pairs variants
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+using SelectPolicies = ::testing::Types<RAJA::seq_exec,
+                                        RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                        ,
+                                        RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                        ,
+                                        RAJA::tbb_for_exec
+#endif
+                                        >;
+
+template <typename POLICY>
+class SelectUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(SelectUnitTest, SelectPolicies);
+
+//
+// Sizes below and above the size at which the parallel backends stop
+// selecting serially.
+//
+const long select_sizes[] = {0, 1, 2, 7, 100, 5000, 100000};
+
+//
+// Random keys in [0, max_key), a small max_key gives many duplicates.
+//
+std::vector<int> make_keys(long n, int max_key, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, max_key - 1);
+  std::vector<int> keys(n);
+  for (auto& k : keys) {
+    k = dist(gen);
+  }
+  return keys;
+}
+
+template <typename Compare>
+void check_nth(const std::vector<int>& keys,
+               const std::vector<int>& sorted,
+               long nth,
+               Compare comp)
+{
+  ASSERT_EQ(sorted[nth], keys[nth]);
+  for (long i = 0; i < nth; ++i) {
+    ASSERT_FALSE(comp(keys[nth], keys[i]));
+  }
+  for (long i = nth + 1; i < static_cast<long>(keys.size()); ++i) {
+    ASSERT_FALSE(comp(keys[i], keys[nth]));
+  }
+}
+
+TYPED_TEST(SelectUnitTest, NthElement)
+{
+  for (long n : select_sizes) {
+    for (int max_key : {3, 1 << 30}) {
+      const std::vector<int> orig = make_keys(n, max_key, 7u);
+      std::vector<int> sorted = orig;
+      std::sort(sorted.begin(), sorted.end());
+
+      for (long nth : {0L, n / 3, n - 1}) {
+        if (nth < 0 || nth >= n) {
+          continue;
+        }
+        std::vector<int> keys = orig;
+        RAJA::nth_element<TypeParam>(keys, nth);
+        check_nth(keys, sorted, nth, RAJA::operators::less<int>{});
+
+        std::vector<int> check = keys;
+        std::sort(check.begin(), check.end());
+        ASSERT_EQ(sorted, check);
+      }
+    }
+  }
+
+  // already sorted input
+  std::vector<int> keys(50000);
+  for (int i = 0; i < 50000; ++i) {
+    keys[i] = i;
+  }
+  RAJA::nth_element<TypeParam>(keys, 12345);
+  ASSERT_EQ(12345, keys[12345]);
+
+  // out of range nth leaves the range alone
+  std::vector<int> small{3, 1, 2};
+  RAJA::nth_element<TypeParam>(small, 3);
+  ASSERT_EQ((std::vector<int>{3, 1, 2}), small);
+}
+
+//
+// Keys with only two values all lie between the splitters sampled in a
+// round, with nth on either side of the boundary between the two values.
+//
+std::vector<int> make_two_valued_keys(long n, long num_zeros, unsigned seed)
+{
+  std::vector<int> keys(n, 1);
+  std::fill(keys.begin(), keys.begin() + num_zeros, 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(seed));
+  return keys;
+}
+
+TYPED_TEST(SelectUnitTest, TwoValued)
+{
+  const long n = 100000;
+  for (long num_zeros : {n / 2, n / 100, n - 10}) {
+    const std::vector<int> orig = make_two_valued_keys(n, num_zeros, 19u);
+    std::vector<int> sorted = orig;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (long nth : {num_zeros - 1, num_zeros, num_zeros + 1}) {
+      std::vector<int> keys = orig;
+      RAJA::nth_element<TypeParam>(keys, nth);
+      check_nth(keys, sorted, nth, RAJA::operators::less<int>{});
+    }
+  }
+}
+
+TEST(SelectUnitTestRound, TwoValuedRoundNarrows)
+{
+  const long n = 100000;
+  const std::vector<int> keys = make_two_valued_keys(n, n / 2, 23u);
+  std::vector<int> sorted = keys;
+  std::sort(sorted.begin(), sorted.end());
+
+  auto for_chunks = [](int num_chunks, std::function<void(int)> const& func) {
+    for (int c = 0; c < num_chunks; ++c) {
+      func(c);
+    }
+  };
+
+  for (long nth : {n / 2 - 1, n / 2, n / 2 + 1}) {
+    long round_nth = nth;
+    std::vector<int> out;
+    int found = -1;
+    const int state = RAJA::detail::sample_select_round(
+        keys.cbegin(), n, round_nth, RAJA::operators::less<int>{}, 4,
+        for_chunks, out, found);
+
+    // the round finds the nth key or keeps fewer candidates
+    if (state == 0) {
+      ASSERT_EQ(sorted[nth], found);
+    } else {
+      ASSERT_EQ(1, state);
+      ASSERT_LT(static_cast<long>(out.size()), n);
+      std::sort(out.begin(), out.end());
+      ASSERT_EQ(sorted[nth], out[round_nth]);
+    }
+  }
+}
+
+TYPED_TEST(SelectUnitTest, PartialSort)
+{
+  for (long n : select_sizes) {
+    const std::vector<int> orig = make_keys(n, 1000, 11u);
+    std::vector<int> sorted = orig;
+    std::sort(sorted.begin(), sorted.end(), std::greater<int>{});
+
+    for (long k : {0L, 1L, 2L, 3L, n / 2, n, n + 5}) {
+      std::vector<int> keys = orig;
+      RAJA::partial_sort<TypeParam>(keys, k, RAJA::operators::greater<int>{});
+
+      const long sorted_k = std::min(k, n);
+      for (long i = 0; i < sorted_k; ++i) {
+        ASSERT_EQ(sorted[i], keys[i]);
+      }
+      std::vector<int> check = keys;
+      std::sort(check.begin(), check.end(), std::greater<int>{});
+      ASSERT_EQ(sorted, check);
+    }
+  }
+}
+
+TYPED_TEST(SelectUnitTest, TopK)
+{
+  for (long n : select_sizes) {
+    const std::vector<int> orig = make_keys(n, 50, 13u);
+    std::vector<int> sorted = orig;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (long k : {1L, n / 4, n - 1}) {
+      if (k <= 0 || k >= n) {
+        continue;
+      }
+      std::vector<int> keys = orig;
+      RAJA::top_k<TypeParam>(keys, k);
+
+      std::vector<int> first(keys.begin(), keys.begin() + k);
+      std::sort(first.begin(), first.end());
+      ASSERT_TRUE(std::equal(first.begin(), first.end(), sorted.begin()));
+    }
+  }
+}
+
+//
+// Values are the original indices of the keys, so any value that does not
+// move with its key is detected, even between equal keys.
+//
+std::vector<long> make_indices(long n)
+{
+  std::vector<long> vals(n);
+  for (long i = 0; i < n; ++i) {
+    vals[i] = i;
+  }
+  return vals;
+}
+
+void check_pairs(const std::vector<int>& orig,
+                 const std::vector<int>& keys,
+                 const std::vector<long>& vals)
+{
+  std::vector<bool> seen(orig.size(), false);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ASSERT_GE(vals[i], 0);
+    ASSERT_LT(vals[i], static_cast<long>(orig.size()));
+    ASSERT_FALSE(seen[vals[i]]);
+    seen[vals[i]] = true;
+    ASSERT_EQ(orig[vals[i]], keys[i]);
+  }
+}
+
+TYPED_TEST(SelectUnitTest, Pairs)
+{
+  for (long n : select_sizes) {
+    const std::vector<int> orig = make_keys(n, 100, 17u);
+    std::vector<int> sorted = orig;
+    std::sort(sorted.begin(), sorted.end());
+
+    // values follow their keys
+    const long k = n / 2;
+    if (k <= 0) {
+      continue;
+    }
+
+    std::vector<int> keys = orig;
+    std::vector<long> vals = make_indices(n);
+    RAJA::nth_element_pairs<TypeParam>(keys, vals, k);
+    ASSERT_EQ(sorted[k], keys[k]);
+    check_pairs(orig, keys, vals);
+
+    keys = orig;
+    vals = make_indices(n);
+    RAJA::partial_sort_pairs<TypeParam>(keys, vals, k);
+    ASSERT_TRUE(std::equal(keys.begin(), keys.begin() + k, sorted.begin()));
+    check_pairs(orig, keys, vals);
+
+    keys = orig;
+    vals = make_indices(n);
+    RAJA::top_k_pairs<TypeParam>(keys, vals, k);
+    ASSERT_TRUE(std::is_permutation(keys.begin(), keys.begin() + k,
+                                    sorted.begin()));
+    check_pairs(orig, keys, vals);
+  }
+}
@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for worklist and worklist_levels
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+using WorklistPolicies = ::testing::Types<RAJA::seq_exec,
+                                          RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                          ,
+                                          RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                          ,
+                                          RAJA::tbb_for_exec
+#endif
+                                          >;
+
+template <typename POLICY>
+class WorklistUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(WorklistUnitTest, WorklistPolicies);
+
+//
+// Nodes of a complete binary tree with N nodes, node k has the children
+// 2k+1 and 2k+2 and is at level floor(log2(k+1)).
+//
+constexpr long num_nodes = 100000;
+
+int tree_level(long k)
+{
+  int level = 0;
+  while ((2L << level) - 1 <= k) {
+    ++level;
+  }
+  return level;
+}
+
+TYPED_TEST(WorklistUnitTest, TreeTraversal)
+{
+  std::vector<std::atomic<int>> visits(num_nodes);
+  for (auto& v : visits) {
+    v.store(0);
+  }
+
+  std::vector<long> root{0};
+  RAJA::worklist<TypeParam>(
+      root, [&](long k, RAJA::WorklistContext<long>& ctx) {
+        visits[k].fetch_add(1);
+        if (2 * k + 1 < num_nodes) ctx.push(2 * k + 1);
+        if (2 * k + 2 < num_nodes) ctx.push(2 * k + 2);
+      });
+
+  for (long k = 0; k < num_nodes; ++k) {
+    ASSERT_EQ(1, visits[k].load());
+  }
+}
+
+TYPED_TEST(WorklistUnitTest, TreeLevels)
+{
+  std::vector<std::atomic<int>> levels(num_nodes);
+  for (auto& l : levels) {
+    l.store(-1);
+  }
+
+  std::vector<long> root{0};
+  RAJA::worklist_levels<TypeParam>(
+      root, [&](long k, RAJA::WorklistContext<long>& ctx) {
+        levels[k].store(ctx.level());
+        if (2 * k + 1 < num_nodes) ctx.push(2 * k + 1);
+        if (2 * k + 2 < num_nodes) ctx.push(2 * k + 2);
+      });
+
+  for (long k = 0; k < num_nodes; ++k) {
+    ASSERT_EQ(tree_level(k), levels[k].load());
+  }
+}
+
+TYPED_TEST(WorklistUnitTest, InitialItems)
+{
+  std::atomic<long> sum(0);
+  RAJA::worklist<TypeParam>(
+      RAJA::TypedRangeSegment<long>(0, num_nodes),
+      [&](long k, RAJA::WorklistContext<long>&) { sum.fetch_add(k); });
+  ASSERT_EQ(num_nodes * (num_nodes - 1) / 2, sum.load());
+
+  std::vector<long> none;
+  int calls = 0;
+  RAJA::worklist<TypeParam>(
+      none, [&](long, RAJA::WorklistContext<long>&) { ++calls; });
+  RAJA::worklist_levels<TypeParam>(
+      none, [&](long, RAJA::WorklistContext<long>&) { ++calls; });
+  ASSERT_EQ(0, calls);
+}
@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for scatter-adds through combining atomic
+/// views in host foralls
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <vector>
+
+using CombiningForallPolicies =
+    ::testing::Types<RAJA::seq_exec,
+                     RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                     ,
+                     RAJA::omp_parallel_for_exec,
+                     RAJA::omp_parallel_for_static_exec<8>,
+                     RAJA::omp_parallel_exec<RAJA::omp_for_nowait_static_exec< > >
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                     ,
+                     RAJA::tbb_for_exec
+#endif
+                     >;
+
+template <typename POLICY>
+class AtomicCombiningUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(AtomicCombiningUnitTest, CombiningForallPolicies);
+
+//
+// Runs of equal cells, as in particle deposition with cell-sorted particles,
+// and more cells than cache entries so entries are evicted.
+//
+constexpr int num_items = 100000;
+constexpr int num_cells = 300;
+
+inline int cell_of(int i) { return (i / 7) % num_cells; }
+
+std::vector<long> expected_counts()
+{
+  std::vector<long> counts(num_cells, 0);
+  for (int i = 0; i < num_items; ++i) {
+    counts[cell_of(i)] += i % 5;
+  }
+  return counts;
+}
+
+TYPED_TEST(AtomicCombiningUnitTest, ScatterAdd)
+{
+  std::vector<long> counts(num_cells, 0);
+  RAJA::View<long, RAJA::Layout<1>> counts_view(counts.data(), num_cells);
+  auto combined = RAJA::make_atomic_view<RAJA::combining_atomic>(counts_view);
+
+  RAJA::forall<TypeParam>(RAJA::TypedRangeSegment<int>(0, num_items),
+    [=](int i) {
+      combined(cell_of(i)) += i % 5;
+  });
+
+  ASSERT_EQ(expected_counts(), counts);
+}
+
+TYPED_TEST(AtomicCombiningUnitTest, ScatterAddWithParams)
+{
+  std::vector<long> counts(num_cells, 0);
+  RAJA::View<long, RAJA::Layout<1>> counts_view(counts.data(), num_cells);
+  auto combined = RAJA::make_atomic_view<RAJA::combining_atomic>(counts_view);
+
+  long total = 0;
+  RAJA::forall<TypeParam>(RAJA::TypedRangeSegment<int>(0, num_items),
+    RAJA::expt::Reduce<RAJA::operators::plus>(&total),
+    [=](int i, long& t) {
+      combined(cell_of(i)) += i % 5;
+      t += i % 5;
+  });
+
+  const std::vector<long> expected = expected_counts();
+  long expected_total = 0;
+  for (long c : expected) {
+    expected_total += c;
+  }
+  ASSERT_EQ(expected_total, total);
+  ASSERT_EQ(expected, counts);
+}
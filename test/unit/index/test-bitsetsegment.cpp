@@ -0,0 +1,198 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for BitsetSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "camp/resource.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using BitsetIndexTypes = ::testing::Types<RAJA::Index_type,
+                                          int,
+                                          unsigned int>;
+
+template<typename T>
+class BitsetSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(BitsetSegmentUnitTest, BitsetIndexTypes);
+
+//
+// Resource object used to construct bitset segment objects with data
+// living in host (CPU) memory. Used in all tests in this file.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+//
+// Mask over len indices with full, empty, dense and sparse words, and one
+// word past the range with every bit set.
+//
+std::vector<std::uint64_t> make_mask(size_t len)
+{
+  std::mt19937_64 rng(len);
+  std::vector<std::uint64_t> mask((len + 63) / 64 + 1, ~std::uint64_t(0));
+  for (size_t w = 0; w < (len + 63) / 64; ++w) {
+    switch (rng() % 4) {
+      case 0:
+        mask[w] = ~std::uint64_t(0);
+        break;
+      case 1:
+        mask[w] = 0;
+        break;
+      case 2:
+        mask[w] = rng() | rng();
+        break;
+      default:
+        mask[w] = rng() & rng() & rng();
+        break;
+    }
+  }
+  return mask;
+}
+
+//
+// Indices of the set bits of mask over [begin, end)
+//
+template <typename T>
+std::vector<T> set_indices(std::vector<std::uint64_t> const& mask,
+                           T begin,
+                           T end)
+{
+  std::vector<T> idx;
+  for (T i = begin; i < end; ++i) {
+    const size_t k = static_cast<size_t>(i - begin);
+    if ((mask[k / 64] >> (k % 64)) & 1) {
+      idx.push_back(i);
+    }
+  }
+  return idx;
+}
+
+TYPED_TEST(BitsetSegmentUnitTest, Constructors)
+{
+  const std::vector<std::uint64_t> mask = make_mask(1000);
+  const TypeParam begin = 3;
+  const TypeParam end = 1003;
+  const std::vector<TypeParam> idx = set_indices(mask, begin, end);
+
+  RAJA::TypedBitsetSegment<TypeParam> bits1(&mask[0], begin, end, host_res);
+  ASSERT_EQ(bits1.size(), static_cast<RAJA::Index_type>(idx.size()));
+  ASSERT_EQ(bits1.getIndexOwnership(), RAJA::Owned);
+  ASSERT_EQ(bits1.getRangeBegin(), begin);
+  ASSERT_EQ(bits1.getRangeEnd(), end);
+  ASSERT_TRUE(bits1.indicesEqual(&idx[0], idx.size()));
+
+  RAJA::TypedBitsetSegment<TypeParam> copied(bits1);
+  ASSERT_EQ(copied.getIndexOwnership(), RAJA::Unowned);
+  ASSERT_TRUE(copied.indicesEqual(&idx[0], idx.size()));
+
+  RAJA::TypedBitsetSegment<TypeParam> moved(std::move(bits1));
+  ASSERT_EQ(bits1.size(), 0);
+  ASSERT_EQ(moved.getIndexOwnership(), RAJA::Owned);
+  ASSERT_TRUE(moved.indicesEqual(&idx[0], idx.size()));
+
+  RAJA::TypedBitsetSegment<TypeParam> container(mask, begin, end, host_res);
+  ASSERT_TRUE(container.indicesEqual(&idx[0], idx.size()));
+
+  RAJA::TypedBitsetSegment<TypeParam> none(mask, begin, begin, host_res);
+  ASSERT_EQ(none.size(), 0);
+  ASSERT_EQ(none.begin(), none.end());
+}
+
+TYPED_TEST(BitsetSegmentUnitTest, Iterators)
+{
+  const std::vector<std::uint64_t> mask = make_mask(777);
+  const std::vector<TypeParam> idx = set_indices(mask, TypeParam(0),
+                                                 TypeParam(777));
+  RAJA::TypedBitsetSegment<TypeParam> bits(mask, 0, 777, host_res);
+
+  ASSERT_EQ(bits.end() - bits.begin(), bits.size());
+  ASSERT_TRUE(std::equal(bits.begin(), bits.end(), idx.begin()));
+
+  auto it = bits.begin();
+  for (RAJA::Index_type i = 0; i < bits.size(); i += 13) {
+    ASSERT_EQ(it[i], idx[i]);
+    ASSERT_EQ(*(it + i), idx[i]);
+  }
+  ASSERT_EQ(*(bits.end() - 1), idx.back());
+}
+
+TYPED_TEST(BitsetSegmentUnitTest, ForEachInBlock)
+{
+  // several blocks, which start and end in the middle of words
+  const TypeParam len = 5 * RAJA::TypedBitsetSegment<TypeParam>::block_size;
+  const std::vector<std::uint64_t> mask = make_mask(len);
+  const std::vector<TypeParam> idx = set_indices(mask, TypeParam(7),
+                                                 TypeParam(7 + len));
+  RAJA::TypedBitsetSegment<TypeParam> bits(mask, 7, 7 + len, host_res);
+  ASSERT_GT(bits.getNumBlocks(), 1);
+
+  std::vector<TypeParam> seq_out;
+  std::vector<TypeParam> simd_out;
+  std::vector<TypeParam> loop_out;
+  for (RAJA::Index_type b = 0; b < bits.getNumBlocks(); ++b) {
+    bits.template forEachInBlock<RAJA::seq_exec>(
+        b, [&](TypeParam i) { seq_out.push_back(i); });
+    bits.template forEachInBlock<RAJA::simd_exec>(
+        b, [&](TypeParam i) { simd_out.push_back(i); });
+    bits.template forEachInBlock<RAJA::loop_exec>(
+        b, [&](TypeParam i) { loop_out.push_back(i); });
+  }
+  ASSERT_EQ(seq_out, idx);
+  ASSERT_EQ(simd_out, idx);
+  ASSERT_EQ(loop_out, idx);
+}
+
+template <typename ExecPol>
+void check_forall(std::vector<std::uint64_t> const& mask, int len)
+{
+  RAJA::TypedBitsetSegment<int> bits(mask, 0, len, host_res);
+
+  std::vector<int> visits(len, 0);
+  int* v = visits.data();
+
+  RAJA::forall<ExecPol>(bits, [=](int i) { v[i] += 1; });
+
+  std::vector<int> expected(len, 0);
+  for (int i : set_indices(mask, 0, len)) {
+    expected[i] = 1;
+  }
+  ASSERT_EQ(visits, expected);
+
+  // the sum of the indices through a parameter reduction
+  RAJA::Index_type sum = 0;
+  RAJA::forall<ExecPol>(bits,
+                        RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+                        [=](int i, RAJA::Index_type& s) { s += i; });
+  RAJA::Index_type expected_sum = 0;
+  for (int i : set_indices(mask, 0, len)) {
+    expected_sum += i;
+  }
+  ASSERT_EQ(sum, expected_sum);
+}
+
+TEST(BitsetSegmentForallTest, Policies)
+{
+  const int len = 100000;
+  const std::vector<std::uint64_t> mask = make_mask(len);
+
+  check_forall<RAJA::seq_exec>(mask, len);
+  check_forall<RAJA::simd_exec>(mask, len);
+  check_forall<RAJA::loop_exec>(mask, len);
+#if defined(RAJA_ENABLE_OPENMP)
+  check_forall<RAJA::omp_parallel_for_exec>(mask, len);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  check_forall<RAJA::tbb_for_exec>(mask, len);
+#endif
+}
@@ -0,0 +1,190 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for CompressedListSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "camp/resource.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using CompressedIndexTypes = ::testing::Types<RAJA::Index_type,
+                                              int,
+                                              unsigned int>;
+
+template<typename T>
+class CompressedListSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(CompressedListSegmentUnitTest, CompressedIndexTypes);
+
+//
+// Resource object used to construct list segment objects with indices
+// living in host (CPU) memory. Used in all tests in this file.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+//
+// Mostly increasing indices: runs, small and large gaps, and a few jumps
+// backwards, so every kind of block is used.
+//
+template <typename T>
+std::vector<T> make_indices(size_t len)
+{
+  std::mt19937 rng(static_cast<unsigned>(len));
+  std::vector<T> idx;
+  T x = 7;
+  for (size_t i = 0; i < len; ++i) {
+    const unsigned r = rng() % 20;
+    if (r < 12) {
+      x += 1;
+    } else if (r < 16) {
+      x += static_cast<T>(2 + rng() % 200);
+    } else if (r < 18) {
+      x += static_cast<T>(rng() % 70000);
+    } else if (x > 100000) {
+      x -= static_cast<T>(rng() % 100000);
+    }
+    idx.push_back(x);
+  }
+  return idx;
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Constructors)
+{
+  std::vector<TypeParam> idx = make_indices<TypeParam>(1000);
+
+  RAJA::TypedCompressedListSegment<TypeParam> list1(&idx[0], idx.size(),
+                                                    host_res);
+  ASSERT_EQ(list1.size(), static_cast<RAJA::Index_type>(idx.size()));
+  ASSERT_EQ(list1.getIndexOwnership(), RAJA::Owned);
+  ASSERT_TRUE(list1.indicesEqual(&idx[0], idx.size()));
+
+  RAJA::TypedCompressedListSegment<TypeParam> copied(list1);
+  ASSERT_EQ(copied.getIndexOwnership(), RAJA::Unowned);
+  ASSERT_TRUE(copied.indicesEqual(&idx[0], idx.size()));
+
+  RAJA::TypedCompressedListSegment<TypeParam> moved(std::move(list1));
+  ASSERT_EQ(list1.size(), 0);
+  ASSERT_EQ(moved.getIndexOwnership(), RAJA::Owned);
+  ASSERT_TRUE(moved.indicesEqual(&idx[0], idx.size()));
+
+  RAJA::TypedCompressedListSegment<TypeParam> container(idx, host_res);
+  ASSERT_TRUE(container.indicesEqual(&idx[0], idx.size()));
+
+  std::vector<TypeParam> empty;
+  RAJA::TypedCompressedListSegment<TypeParam> none(empty, host_res);
+  ASSERT_EQ(none.size(), 0);
+  ASSERT_EQ(none.begin(), none.end());
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Iterators)
+{
+  std::vector<TypeParam> idx = make_indices<TypeParam>(777);
+  RAJA::TypedCompressedListSegment<TypeParam> list(idx, host_res);
+
+  ASSERT_EQ(list.end() - list.begin(), list.size());
+  ASSERT_TRUE(std::equal(list.begin(), list.end(), idx.begin()));
+
+  auto it = list.begin();
+  for (RAJA::Index_type i = 0; i < list.size(); i += 13) {
+    ASSERT_EQ(it[i], idx[i]);
+    ASSERT_EQ(*(it + i), idx[i]);
+  }
+  ASSERT_EQ(*(list.end() - 1), idx.back());
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Compression)
+{
+  const RAJA::Index_type block_size =
+      RAJA::TypedCompressedListSegment<TypeParam>::block_size;
+
+  // one header per block and no payload for consecutive indices
+  std::vector<TypeParam> run(10 * block_size);
+  std::iota(run.begin(), run.end(), TypeParam(5));
+  RAJA::TypedCompressedListSegment<TypeParam> run_list(run, host_res);
+  ASSERT_EQ(run_list.getNumBlocks(), 10);
+  ASSERT_LT(run_list.getCompressedBytes(), run.size());
+
+  // small gaps take one byte per index
+  std::vector<TypeParam> gaps;
+  for (TypeParam i = 0; i < 1000; ++i) {
+    gaps.push_back(3 * i);
+  }
+  RAJA::TypedCompressedListSegment<TypeParam> gap_list(gaps, host_res);
+  ASSERT_TRUE(gap_list.indicesEqual(&gaps[0], gaps.size()));
+  ASSERT_LT(gap_list.getCompressedBytes(), 2 * gaps.size());
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, ForEachInBlock)
+{
+  std::vector<TypeParam> idx = make_indices<TypeParam>(1000);
+  RAJA::TypedCompressedListSegment<TypeParam> list(idx, host_res);
+
+  std::vector<TypeParam> seq_out;
+  std::vector<TypeParam> simd_out;
+  for (RAJA::Index_type b = 0; b < list.getNumBlocks(); ++b) {
+    list.template forEachInBlock<RAJA::seq_exec>(
+        b, [&](TypeParam i) { seq_out.push_back(i); });
+    list.template forEachInBlock<RAJA::simd_exec>(
+        b, [&](TypeParam i) { simd_out.push_back(i); });
+  }
+  ASSERT_EQ(seq_out, idx);
+  ASSERT_EQ(simd_out, idx);
+}
+
+template <typename ExecPol, typename T>
+void check_forall(std::vector<T> const& idx)
+{
+  RAJA::TypedCompressedListSegment<T> list(idx, host_res);
+
+  const T max_idx = *std::max_element(idx.begin(), idx.end());
+  std::vector<int> visits(static_cast<size_t>(max_idx) + 1, 0);
+  int* v = visits.data();
+
+  RAJA::forall<ExecPol>(list, [=](T i) { v[i] = 1; });
+
+  std::vector<int> expected(visits.size(), 0);
+  for (T i : idx) {
+    expected[i] = 1;
+  }
+  ASSERT_EQ(visits, expected);
+
+  // the sum of the indices through a parameter reduction
+  RAJA::Index_type sum = 0;
+  RAJA::forall<ExecPol>(list,
+                        RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+                        [=](T i, RAJA::Index_type& s) { s += i; });
+  RAJA::Index_type expected_sum = 0;
+  for (T i : idx) {
+    expected_sum += i;
+  }
+  ASSERT_EQ(sum, expected_sum);
+}
+
+TEST(CompressedListSegmentForallTest, Policies)
+{
+  // unique indices, so parallel loops write every element once
+  std::vector<int> idx = make_indices<int>(5000);
+  std::sort(idx.begin(), idx.end());
+  idx.erase(std::unique(idx.begin(), idx.end()), idx.end());
+
+  check_forall<RAJA::seq_exec>(idx);
+  check_forall<RAJA::simd_exec>(idx);
+  check_forall<RAJA::loop_exec>(idx);
+#if defined(RAJA_ENABLE_OPENMP)
+  check_forall<RAJA::omp_parallel_for_exec>(idx);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  check_forall<RAJA::tbb_for_exec>(idx);
+#endif
+}
@@ -0,0 +1,216 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for TypedFlatIndexSet
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+//
+// Resource object used to construct list segment objects with indices
+// living in host (CPU) memory. Used in all tests in this file.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+using RangeSegType = RAJA::TypedRangeSegment<int>;
+using ListSegType = RAJA::TypedListSegment<int>;
+using FlatSetType = RAJA::TypedFlatIndexSet<RangeSegType, ListSegType>;
+using ISetType = RAJA::TypedIndexSet<RangeSegType, ListSegType>;
+
+//
+// Every third segment is a list segment of 3 indices, the others are range
+// segments of 4 indices. Indices of different segments overlap.
+//
+template <typename SET>
+void fill(SET& iset, int num_seg)
+{
+  const int idx[] = {1, 4, 9};
+  for (int s = 0; s < num_seg; ++s) {
+    if (s % 3 == 0) {
+      iset.push_back(ListSegType(idx, 3, host_res));
+    } else {
+      iset.push_back(RangeSegType(s, s + 4));
+    }
+  }
+}
+
+template <typename SET>
+std::vector<int> indices_of(const SET& iset)
+{
+  std::vector<int> out;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [&](int i) { out.push_back(i); });
+  return out;
+}
+
+TEST(FlatIndexSetUnitTest, Empty)
+{
+  FlatSetType is;
+  ASSERT_EQ(0, is.size());
+  ASSERT_EQ(is.begin(), is.end());
+  ASSERT_EQ(size_t(0), is.getLength());
+  ASSERT_EQ(size_t(2), is.getNumTypes());
+
+  FlatSetType is2(is);
+  ASSERT_TRUE(is == is2);
+  ASSERT_EQ(0, is.createSlice(0, 5).size());
+}
+
+TEST(FlatIndexSetUnitTest, ConstructAndCompareSegments)
+{
+  FlatSetType is;
+  is.reserve(2);
+  int idx[] = {0, 2, 4, 5};
+  is.push_back(ListSegType(idx, 4, host_res));
+  is.push_back(RangeSegType(6, 8));
+  is.push_back(RangeSegType(10, 13));
+
+  ASSERT_EQ(3, is.size());
+  ASSERT_EQ(size_t(9), is.getLength());
+  ASSERT_EQ(0, is.getStartingIcount(0));
+  ASSERT_EQ(4, is.getStartingIcount(1));
+  ASSERT_EQ(6, is.getStartingIcount(2));
+
+  ASSERT_TRUE(is.checkSegmentType<ListSegType>(0));
+  ASSERT_FALSE(is.checkSegmentType<RangeSegType>(0));
+  ASSERT_TRUE(is.checkSegmentType<RangeSegType>(2));
+  ASSERT_EQ(4, is.getSegment<ListSegType>(0).size());
+  ASSERT_EQ(10, *is.getSegment<RangeSegType>(2).begin());
+
+  FlatSetType is2;
+  is2.push_back(ListSegType(idx, 4, host_res));
+  is2.push_back(RangeSegType(6, 8));
+  ASSERT_TRUE(is != is2);
+  is2.push_back(RangeSegType(10, 13));
+  ASSERT_TRUE(is == is2);
+}
+
+TEST(FlatIndexSetUnitTest, CopyAndPush)
+{
+  FlatSetType is;
+  fill(is, 100);
+  const std::vector<int> ref = indices_of(is);
+
+  FlatSetType copy(is);
+  ASSERT_TRUE(copy == is);
+
+  // pushing to a copy leaves the original alone
+  copy.push_back(RangeSegType(0, 2));
+  ASSERT_EQ(101, copy.size());
+  ASSERT_EQ(100, is.size());
+  ASSERT_EQ(ref, indices_of(is));
+
+  // the copy keeps its list segments after the original goes away
+  is = FlatSetType();
+  std::vector<int> copy_ref(ref);
+  copy_ref.push_back(0);
+  copy_ref.push_back(1);
+  ASSERT_EQ(copy_ref, indices_of(copy));
+}
+
+TEST(FlatIndexSetUnitTest, Slices)
+{
+  FlatSetType is;
+  fill(is, 30);
+
+  FlatSetType range_slice = is.createSlice(4, 7);
+  ASSERT_EQ(3, range_slice.size());
+  ASSERT_EQ(size_t(4 + 4 + 3), range_slice.getLength());
+  ASSERT_EQ(0, range_slice.getStartingIcount(0));
+  ASSERT_EQ(8, range_slice.getStartingIcount(2));
+  ASSERT_TRUE(range_slice.checkSegmentType<ListSegType>(2));
+
+  FlatSetType nested = range_slice.createSlice(1, 10);
+  ASSERT_EQ(2, nested.size());
+  ASSERT_EQ(5, *nested.getSegment<RangeSegType>(0).begin());
+  ASSERT_TRUE(nested.checkSegmentType<ListSegType>(1));
+  ASSERT_EQ(0, is.createSlice(40, 50).size());
+  ASSERT_EQ(0, is.createSlice(7, 4).size());
+
+  int ids[] = {29, 0, -1, 30, 5};
+  FlatSetType array_slice = is.createSlice(ids, 5);
+  ASSERT_EQ(3, array_slice.size());
+  ASSERT_EQ(29, *array_slice.getSegment<RangeSegType>(0).begin());
+  ASSERT_TRUE(array_slice.checkSegmentType<ListSegType>(1));
+  ASSERT_EQ(4 + 3, array_slice.getStartingIcount(2));
+
+  std::vector<int> vids{5, 29};
+  FlatSetType container_slice = is.createSlice(vids);
+  ASSERT_EQ(2, container_slice.size());
+  ASSERT_EQ(5, *container_slice.getSegment<RangeSegType>(0).begin());
+  ASSERT_EQ(29, *container_slice.getSegment<RangeSegType>(1).begin());
+
+  // pushing to a slice leaves the set it came from alone
+  range_slice.push_back(RangeSegType(0, 1));
+  ASSERT_EQ(4, range_slice.size());
+  ASSERT_EQ(30, is.size());
+  ASSERT_TRUE(range_slice.createSlice(0, 3) == is.createSlice(4, 7));
+}
+
+TEST(FlatIndexSetUnitTest, FromTypedIndexSet)
+{
+  ISetType iset;
+  fill(iset, 50);
+  FlatSetType is(iset);
+
+  ASSERT_EQ(iset.size(), is.size());
+  ASSERT_EQ(iset.getLength(), is.getLength());
+  for (int s = 0; s < iset.size(); ++s) {
+    ASSERT_EQ(iset.getStartingIcount(s), is.getStartingIcount(s));
+  }
+  ASSERT_EQ(indices_of(iset), indices_of(is));
+}
+
+template <typename POLICY>
+void check_forall_icount()
+{
+  FlatSetType is;
+  fill(is, 200);
+  ISetType iset;
+  fill(iset, 200);
+
+  const int len = static_cast<int>(is.getLength());
+  std::vector<int> flat_out(len, -1);
+  std::vector<int> ref_out(len, -1);
+  int* flat_ptr = flat_out.data();
+  int* ref_ptr = ref_out.data();
+
+  RAJA::forall_Icount<POLICY>(is, [=](int icount, int i) {
+    flat_ptr[icount] = i;
+  });
+  RAJA::forall_Icount<POLICY>(iset, [=](int icount, int i) {
+    ref_ptr[icount] = i;
+  });
+  ASSERT_EQ(ref_out, flat_out);
+
+  RAJA::ReduceSum<RAJA::seq_reduce, long> sum(0);
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      is.createSlice(10, 20), [=](int i) { sum += i; });
+  long ref_sum = 0;
+  for (int k = is.getStartingIcount(10); k < is.getStartingIcount(20); ++k) {
+    ref_sum += ref_out[k];
+  }
+  ASSERT_EQ(ref_sum, sum.get());
+}
+
+TEST(FlatIndexSetUnitTest, ForallIcountSequential)
+{
+  check_forall_icount<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(FlatIndexSetUnitTest, ForallIcountOpenMP)
+{
+  check_forall_icount<
+      RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>>();
+}
+#endif
@@ -0,0 +1,168 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for IndexSetCache
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "camp/resource.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+//
+// Resource object used to construct list segment objects with indices
+// living in host (CPU) memory. Used in all tests in this file.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+using RangeSegType = RAJA::TypedRangeSegment<RAJA::Index_type>;
+using StrideSegType = RAJA::TypedRangeStrideSegment<RAJA::Index_type>;
+using ListSegType = RAJA::TypedListSegment<RAJA::Index_type>;
+using ISetType = RAJA::TypedIndexSet<RangeSegType, StrideSegType, ListSegType>;
+
+//
+// Cache file removed when the test ends
+//
+struct CacheFile {
+  std::string path;
+  explicit CacheFile(const char* name) : path(name) { std::remove(name); }
+  ~CacheFile() { std::remove(path.c_str()); }
+};
+
+std::vector<RAJA::Index_type> make_indices(RAJA::Index_type len)
+{
+  std::vector<RAJA::Index_type> idx(len);
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    idx[i] = (i * 7919) % len;
+  }
+  return idx;
+}
+
+void build(ISetType& iset, const std::vector<RAJA::Index_type>& idx)
+{
+  RAJA::Index_type small[] = {5, 3, 9};
+  iset.push_back(RangeSegType(0, 10));
+  iset.push_back(ListSegType(small, 3, host_res));
+  iset.push_back(StrideSegType(20, 30, 3));
+  iset.push_back(StrideSegType(40, 30, -4));
+  iset.push_back(ListSegType(idx, host_res));
+  iset.setSegmentInterval(0, 0, 2);
+  iset.setSegmentInterval(1, 2, 5);
+}
+
+TEST(IndexSetCacheUnitTest, Key)
+{
+  std::vector<int> mesh{1, 2, 3, 4};
+  RAJA::IndexSetCacheKey k0;
+  k0.add(std::string("builder")).add(4).add(mesh.data(), mesh.size());
+  RAJA::IndexSetCacheKey k1;
+  k1.add(std::string("builder")).add(4).add(mesh.data(), mesh.size());
+  ASSERT_TRUE(k0 == k1);
+
+  mesh[3] = 5;
+  RAJA::IndexSetCacheKey k2;
+  k2.add(std::string("builder")).add(4).add(mesh.data(), mesh.size());
+  ASSERT_TRUE(k0 != k2);
+  ASSERT_NE(k0.value(), RAJA::IndexSetCacheKey().add(4).value());
+}
+
+TEST(IndexSetCacheUnitTest, StoreAndLoad)
+{
+  CacheFile file("test-indexset-cache-store.rajaisc");
+  const std::vector<RAJA::Index_type> idx = make_indices(10007);
+  const RAJA::IndexSetCacheKey key = RAJA::IndexSetCacheKey().add(10007);
+
+  ISetType built;
+  build(built, idx);
+
+  RAJA::IndexSetCache cache(file.path);
+  ISetType loaded;
+  ASSERT_FALSE(cache.load(key, loaded));
+  ASSERT_TRUE(cache.store(key, built));
+  ASSERT_TRUE(cache.load(key, loaded));
+
+  ASSERT_TRUE(loaded == built);
+  ASSERT_EQ(built.getLength(), loaded.getLength());
+  ASSERT_EQ(RAJA::Unowned,
+            loaded.getSegment<ListSegType>(4).getIndexOwnership());
+  ASSERT_EQ(size_t(2), loaded.getNumSegmentIntervals());
+  ASSERT_EQ(2, loaded.getSegmentIntervalBegin(1));
+  ASSERT_EQ(5, loaded.getSegmentIntervalEnd(1));
+
+  // a flat index set loads from the same file
+  RAJA::TypedFlatIndexSet<RangeSegType, StrideSegType, ListSegType> flat;
+  ASSERT_TRUE(cache.load(key, flat, false));
+  ASSERT_EQ(built.getLength(), flat.getLength());
+
+  // other keys, index types, and sets without strided ranges are misses
+  ISetType other;
+  ASSERT_FALSE(cache.load(RAJA::IndexSetCacheKey().add(10008), other));
+  ASSERT_EQ(0, other.size());
+  RAJA::TypedIndexSet<RAJA::TypedRangeSegment<int>> int_set;
+  ASSERT_FALSE(cache.load(key, int_set));
+  RAJA::TypedIndexSet<RangeSegType, ListSegType> no_stride;
+  ASSERT_FALSE(cache.load(key, no_stride));
+  ASSERT_EQ(0, no_stride.size());
+}
+
+TEST(IndexSetCacheUnitTest, Corruption)
+{
+  CacheFile file("test-indexset-cache-corrupt.rajaisc");
+  const std::vector<RAJA::Index_type> idx = make_indices(1000);
+  const RAJA::IndexSetCacheKey key = RAJA::IndexSetCacheKey().add(1000);
+
+  ISetType built;
+  build(built, idx);
+  ASSERT_TRUE(RAJA::IndexSetCache(file.path).store(key, built));
+
+  // change one list index
+  std::FILE* fp = std::fopen(file.path.c_str(), "r+b");
+  ASSERT_NE(nullptr, fp);
+  std::fseek(fp, -16, SEEK_END);
+  std::fputc(0x7f, fp);
+  std::fclose(fp);
+
+  RAJA::IndexSetCache cache(file.path);
+  ISetType loaded;
+  ASSERT_FALSE(cache.load(key, loaded));
+  ASSERT_EQ(0, loaded.size());
+
+  // without verification only the header is checked
+  ASSERT_TRUE(cache.load(key, loaded, false));
+  ASSERT_FALSE(loaded == built);
+}
+
+TEST(IndexSetCacheUnitTest, LoadOrBuild)
+{
+  CacheFile file("test-indexset-cache-build.rajaisc");
+  const std::vector<RAJA::Index_type> idx = make_indices(5000);
+  const RAJA::IndexSetCacheKey key = RAJA::IndexSetCacheKey().add(5000);
+
+  int num_builds = 0;
+  auto builder = [&](ISetType& iset) {
+    ++num_builds;
+    build(iset, idx);
+  };
+
+  RAJA::IndexSetCache cache(file.path);
+  ISetType first;
+  ASSERT_FALSE(cache.loadOrBuild(key, first, builder));
+  ISetType second;
+  ASSERT_TRUE(cache.loadOrBuild(key, second, builder));
+  ASSERT_EQ(1, num_builds);
+  ASSERT_TRUE(first == second);
+
+  std::vector<RAJA::Index_type> visited;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      second, [&](RAJA::Index_type i) { visited.push_back(i); });
+  ASSERT_EQ(second.getLength(), visited.size());
+  ASSERT_EQ(idx.back(), visited.back());
+}
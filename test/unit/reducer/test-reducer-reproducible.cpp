@@ -0,0 +1,193 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for reproducible sum reducers.
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+namespace {
+
+std::vector<double> makeIllConditionedData(size_t N)
+{
+  std::mt19937_64 gen(1234);
+  std::uniform_real_distribution<double> mant(-1.0, 1.0);
+  std::uniform_int_distribution<int> expo(-40, 40);
+
+  std::vector<double> data(N);
+  for (size_t i = 0; i < N; ++i) {
+    data[i] = std::ldexp(mant(gen), expo(gen));
+  }
+  return data;
+}
+
+bool bitwiseEqual(double a, double b)
+{
+  return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+}  // namespace
+
+TEST(ReproducibleSumUnitTest, OrderIndependent)
+{
+  std::vector<double> data = makeIllConditionedData(10000);
+
+  RAJA::ReproducibleSum<double> forward;
+  for (double v : data) { forward += v; }
+
+  std::mt19937_64 gen(42);
+  for (int trial = 0; trial < 5; ++trial) {
+    std::shuffle(data.begin(), data.end(), gen);
+
+    // sum in uneven partial sums and combine them in reverse
+    std::vector<RAJA::ReproducibleSum<double>> parts(7);
+    for (size_t i = 0; i < data.size(); ++i) {
+      parts[(i * i) % parts.size()] += data[i];
+    }
+    RAJA::ReproducibleSum<double> combined;
+    for (auto it = parts.rbegin(); it != parts.rend(); ++it) {
+      combined += *it;
+    }
+
+    ASSERT_TRUE(bitwiseEqual(forward.get(), combined.get()));
+  }
+}
+
+TEST(ReproducibleSumUnitTest, Exact)
+{
+  RAJA::ReproducibleSum<double> sum;
+  sum += 1.0e16;
+  sum += 1.0;
+  sum += -1.0e16;
+  ASSERT_EQ(sum.get(), 1.0);
+
+  RAJA::ReproducibleSum<double> neg;
+  neg += -3.5;
+  neg += std::numeric_limits<double>::denorm_min();
+  neg += -std::numeric_limits<double>::denorm_min();
+  ASSERT_EQ(neg.get(), -3.5);
+
+  RAJA::ReproducibleSum<float> fsum;
+  fsum += 1.0e8f;
+  fsum += 1.0f;
+  fsum += -1.0e8f;
+  ASSERT_EQ(fsum.get(), 1.0f);
+
+  RAJA::ReproducibleSum<double> inf;
+  inf += 1.0;
+  inf += std::numeric_limits<double>::infinity();
+  ASSERT_EQ(inf.get(), std::numeric_limits<double>::infinity());
+}
+
+TEST(ReducerReproducibleUnitTest, Sequential)
+{
+  std::vector<double> data = makeIllConditionedData(10000);
+  double* ptr = data.data();
+
+  RAJA::ReproducibleSum<double> expected;
+  for (double v : data) { expected += v; }
+
+  RAJA::ReduceSum<RAJA::seq_reduce_reproducible, double> sum(0.0);
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, data.size()),
+    [=](int i) {
+      sum += ptr[i];
+  });
+
+  ASSERT_TRUE(bitwiseEqual(sum.get(), expected.get()));
+
+  sum.reset(2.0);
+  ASSERT_EQ(sum.get(), 2.0);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(ReducerReproducibleUnitTest, OpenMPThreadCounts)
+{
+  std::vector<double> data = makeIllConditionedData(100000);
+  double* ptr = data.data();
+
+  RAJA::ReproducibleSum<double> expected;
+  for (double v : data) { expected += v; }
+
+  const int max_threads = omp_get_max_threads();
+  for (int nthreads : {1, 2, 3, 4, 7, 8}) {
+    omp_set_num_threads(nthreads);
+
+    RAJA::ReduceSum<RAJA::omp_reduce_reproducible, double> sum(0.0);
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+      RAJA::TypedRangeSegment<int>(0, data.size()),
+      [=](int i) {
+        sum += ptr[i];
+    });
+
+    ASSERT_TRUE(bitwiseEqual(sum.get(), expected.get()));
+  }
+  omp_set_num_threads(max_threads);
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(ReducerReproducibleUnitTest, TBB)
+{
+  std::vector<double> data = makeIllConditionedData(100000);
+  double* ptr = data.data();
+
+  RAJA::ReproducibleSum<double> expected;
+  for (double v : data) { expected += v; }
+
+  RAJA::ReduceSum<RAJA::tbb_reduce_reproducible, double> sum(0.0);
+  RAJA::forall<RAJA::tbb_for_exec>(
+    RAJA::TypedRangeSegment<int>(0, data.size()),
+    [=](int i) {
+      sum += ptr[i];
+  });
+
+  ASSERT_TRUE(bitwiseEqual(sum.get(), expected.get()));
+}
+#endif
+
+TEST(ReducerReproducibleUnitTest, ExptReduce)
+{
+  std::vector<double> data = makeIllConditionedData(10000);
+  double* ptr = data.data();
+
+  RAJA::ReproducibleSum<double> expected;
+  for (double v : data) { expected += v; }
+
+  RAJA::ReproducibleSum<double> seq_sum;
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, data.size()),
+    RAJA::expt::Reduce<RAJA::operators::plus>(&seq_sum),
+    [=](int i, RAJA::ReproducibleSum<double>& s) {
+      s += ptr[i];
+  });
+
+  ASSERT_TRUE(bitwiseEqual(seq_sum.get(), expected.get()));
+
+#if defined(RAJA_ENABLE_OPENMP)
+  RAJA::ReproducibleSum<double> omp_sum;
+  RAJA::forall<RAJA::omp_parallel_for_exec>(
+    RAJA::TypedRangeSegment<int>(0, data.size()),
+    RAJA::expt::Reduce<RAJA::operators::plus>(&omp_sum),
+    [=](int i, RAJA::ReproducibleSum<double>& s) {
+      s += ptr[i];
+  });
+
+  ASSERT_TRUE(bitwiseEqual(omp_sum.get(), expected.get()));
+#endif
+}
@@ -0,0 +1,166 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the asynchronous host resource
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(HostAsyncResourceUnitTest, PendingEvent)
+{
+  RAJA::resources::HostAsync stream;
+
+  std::atomic<bool> release{false};
+  std::atomic<bool>* release_ptr = &release;
+
+  stream.enqueue([=]() {
+    while (!release_ptr->load()) { }
+  });
+
+  constexpr int N = 100;
+  std::vector<int> a(N, 0);
+  int* a_ptr = a.data();
+
+  auto e = RAJA::forall<RAJA::seq_exec>(stream, RAJA::TypedRangeSegment<int>(0, N),
+      [=](int i) { a_ptr[i] = i; });
+
+  RAJA::resources::Event event = e;
+  ASSERT_FALSE(event.check());
+
+  release.store(true);
+  event.wait();
+
+  ASSERT_TRUE(event.check());
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(a[i], i);
+  }
+}
+
+TEST(HostAsyncResourceUnitTest, IndependentStreams)
+{
+  RAJA::resources::HostAsync s1;
+  RAJA::resources::HostAsync s2;
+
+  ASSERT_NE(s1, s2);
+  ASSERT_EQ(RAJA::resources::HostAsync::get_default(),
+            RAJA::resources::HostAsync::get_default());
+
+  std::atomic<bool> release{false};
+  std::atomic<bool>* release_ptr = &release;
+
+  // s1 is blocked until s2 has run its work
+  s1.enqueue([=]() {
+    while (!release_ptr->load()) { }
+  });
+  s2.enqueue([=]() { release_ptr->store(true); });
+
+  s2.wait();
+  s1.wait();
+
+  ASSERT_TRUE(release.load());
+}
+
+TEST(HostAsyncResourceUnitTest, Exception)
+{
+  RAJA::resources::HostAsync stream;
+
+  stream.enqueue([]() { throw std::runtime_error("host async task"); });
+
+  ASSERT_THROW(stream.wait(), std::runtime_error);
+
+  // the stream keeps working after an exception
+  int value = 0;
+  int* value_ptr = &value;
+  stream.enqueue([=]() { *value_ptr = 1; });
+  stream.wait();
+  ASSERT_EQ(value, 1);
+}
+
+//
+// Sets flag when the last copy of it is destroyed.
+//
+struct SetOnDestroy
+{
+  explicit SetOnDestroy(std::atomic<bool>* f) : flag(f) { }
+  SetOnDestroy(SetOnDestroy const&) = delete;
+  ~SetOnDestroy() { flag->store(true); }
+
+  std::atomic<bool>* flag;
+};
+
+//
+// Task holding a handle to the stream it runs on. Members are destroyed in
+// reverse order, so the handle is gone before done is set.
+//
+struct SelfHandleTask
+{
+  std::shared_ptr<SetOnDestroy> done;
+  RAJA::resources::HostAsync stream;
+
+  void operator()() const { }
+};
+
+TEST(HostAsyncResourceUnitTest, LastHandleDroppedByTask)
+{
+  std::atomic<bool> release{false};
+  std::atomic<bool> done{false};
+  std::atomic<bool> later{false};
+  std::atomic<bool>* release_ptr = &release;
+  std::atomic<bool>* later_ptr = &later;
+
+  {
+    RAJA::resources::HostAsync stream;
+    stream.enqueue([=]() {
+      while (!release_ptr->load()) { }
+    });
+    stream.enqueue(
+        SelfHandleTask{std::make_shared<SetOnDestroy>(&done), stream});
+    stream.enqueue([=]() { later_ptr->store(true); });
+  }
+
+  // the stream is destroyed on its own worker thread, which still runs the
+  // work enqueued after the task that held the last handle
+  release.store(true);
+  while (!done.load() || !later.load()) {
+    std::this_thread::yield();
+  }
+  ASSERT_TRUE(done.load());
+  ASSERT_TRUE(later.load());
+}
+
+TEST(HostAsyncResourceUnitTest, LastHandleResetInTask)
+{
+  std::atomic<bool> release{false};
+  std::atomic<bool> done{false};
+  std::atomic<bool>* release_ptr = &release;
+  std::atomic<bool>* done_ptr = &done;
+
+  // the task resets the only handle to the stream it runs on
+  auto holder = std::make_shared<std::unique_ptr<RAJA::resources::HostAsync>>(
+      new RAJA::resources::HostAsync);
+  (*holder)->enqueue([=]() {
+    while (!release_ptr->load()) { }
+  });
+  (*holder)->enqueue([=]() {
+    holder->reset();
+    done_ptr->store(true);
+  });
+  holder.reset();
+
+  release.store(true);
+  while (!done.load()) {
+    std::this_thread::yield();
+  }
+  ASSERT_TRUE(done.load());
+}
@@ -0,0 +1,217 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for CSR and SELL-C-sigma sparse matrices
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+using SparseExecPols = ::testing::Types<
+    RAJA::seq_exec,
+    RAJA::simd_exec
+#if defined(RAJA_ENABLE_OPENMP)
+    , RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+    , RAJA::tbb_for_exec
+#endif
+  >;
+
+template <typename T>
+class SparseMatrixTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(SparseMatrixTest, SparseExecPols);
+
+namespace
+{
+
+using csr_t = RAJA::sparse::CSRMatrix<double>;
+
+// rows with 0 to 12 random entries, so slices need padding
+csr_t make_random_matrix(RAJA::Index_type num_rows, RAJA::Index_type num_cols)
+{
+  std::mt19937 rng(num_rows);
+  std::uniform_int_distribution<RAJA::Index_type> len(0, 12);
+  std::uniform_int_distribution<RAJA::Index_type> col(0, num_cols - 1);
+  std::uniform_real_distribution<double> val(-1.0, 1.0);
+
+  std::vector<RAJA::Index_type> rows, cols;
+  std::vector<double> vals;
+  for (RAJA::Index_type i = 0; i < num_rows; ++i) {
+    const RAJA::Index_type n = len(rng);
+    for (RAJA::Index_type k = 0; k < n; ++k) {
+      rows.push_back(i);
+      cols.push_back(col(rng));
+      vals.push_back(val(rng));
+    }
+  }
+  return csr_t::from_coo(num_rows, num_cols, rows, cols, vals);
+}
+
+std::vector<double> reference_spmv(csr_t const& A, std::vector<double> const& x)
+{
+  std::vector<double> y(A.num_rows(), 0.0);
+  for (RAJA::Index_type i = 0; i < A.num_rows(); ++i) {
+    for (RAJA::Index_type k : A.row_range(i)) {
+      y[i] += A.values()[k] * x[A.col_indices()[k]];
+    }
+  }
+  return y;
+}
+
+std::vector<double> make_vector(size_t n, double offset)
+{
+  std::vector<double> v(n);
+  for (size_t i = 0; i < n; ++i) {
+    v[i] = offset + 0.25 * static_cast<double>(i % 7);
+  }
+  return v;
+}
+
+}  // namespace
+
+
+TEST(SparseMatrixUnitTest, FromCOO)
+{
+  // duplicates are summed and entries are sorted by row and column
+  std::vector<RAJA::Index_type> rows{2, 0, 2, 0, 2};
+  std::vector<RAJA::Index_type> cols{1, 3, 0, 3, 1};
+  std::vector<double> vals{1.0, 2.0, 3.0, 4.0, 5.0};
+  csr_t A = csr_t::from_coo(3, 4, rows, cols, vals);
+
+  ASSERT_EQ(A.num_rows(), 3);
+  ASSERT_EQ(A.num_cols(), 4);
+  ASSERT_EQ(A.num_nonzeros(), 3);
+
+  EXPECT_EQ(A.row_offsets()[0], 0);
+  EXPECT_EQ(A.row_offsets()[1], 1);
+  EXPECT_EQ(A.row_offsets()[2], 1);
+  EXPECT_EQ(A.row_offsets()[3], 3);
+
+  EXPECT_EQ(A.col_indices()[0], 3);
+  EXPECT_EQ(A.values()[0], 6.0);
+  EXPECT_EQ(A.col_indices()[1], 0);
+  EXPECT_EQ(A.values()[1], 3.0);
+  EXPECT_EQ(A.col_indices()[2], 1);
+  EXPECT_EQ(A.values()[2], 6.0);
+
+  EXPECT_EQ(A.row_length(1), 0);
+}
+
+TYPED_TEST(SparseMatrixTest, CSRSpmvSpmm)
+{
+  using ExecPol = TypeParam;
+
+  csr_t A = make_random_matrix(157, 61);
+  std::vector<double> x = make_vector(A.num_cols(), 1.0);
+  std::vector<double> expected = reference_spmv(A, x);
+
+  std::vector<double> y(A.num_rows(), 3.0);
+  RAJA::sparse::spmv<ExecPol>(A, x.data(), y.data(), 2.0, -1.0);
+  for (RAJA::Index_type i = 0; i < A.num_rows(); ++i) {
+    ASSERT_NEAR(y[i], 2.0 * expected[i] - 3.0, 1e-12);
+  }
+
+  // every column of X is x scaled by the column number plus one
+  const RAJA::Index_type nv = 3;
+  std::vector<double> X(A.num_cols() * nv);
+  for (RAJA::Index_type j = 0; j < A.num_cols(); ++j) {
+    for (RAJA::Index_type v = 0; v < nv; ++v) {
+      X[j * nv + v] = (v + 1) * x[j];
+    }
+  }
+  std::vector<double> Y(A.num_rows() * nv, -5.0);
+  RAJA::sparse::spmm<ExecPol>(A, X.data(), nv, Y.data());
+  for (RAJA::Index_type i = 0; i < A.num_rows(); ++i) {
+    for (RAJA::Index_type v = 0; v < nv; ++v) {
+      ASSERT_NEAR(Y[i * nv + v], (v + 1) * expected[i], 1e-12);
+    }
+  }
+}
+
+#if defined(RAJA_ENABLE_VECTORIZATION)
+
+TYPED_TEST(SparseMatrixTest, SellSpmvSpmm)
+{
+  using ExecPol = TypeParam;
+  using sell_t = RAJA::sparse::SellMatrix<double>;
+
+  csr_t A = make_random_matrix(157, 61);
+  std::vector<double> x = make_vector(A.num_cols(), 1.0);
+  std::vector<double> expected = reference_spmv(A, x);
+
+  for (RAJA::Index_type sigma : {1, 8, 64, 1000}) {
+    sell_t S(A, sigma);
+    ASSERT_EQ(S.num_rows(), A.num_rows());
+    ASSERT_EQ(S.num_nonzeros(), A.num_nonzeros());
+    ASSERT_GE(S.num_stored(), S.num_nonzeros());
+
+    std::vector<double> y(A.num_rows(), 3.0);
+    RAJA::sparse::spmv<ExecPol>(S, x.data(), y.data(), 2.0, -1.0);
+    for (RAJA::Index_type i = 0; i < A.num_rows(); ++i) {
+      ASSERT_NEAR(y[i], 2.0 * expected[i] - 3.0, 1e-12);
+    }
+
+    const RAJA::Index_type nv = 2;
+    std::vector<double> X(A.num_cols() * nv);
+    for (RAJA::Index_type j = 0; j < A.num_cols(); ++j) {
+      X[j * nv] = x[j];
+      X[j * nv + 1] = -x[j];
+    }
+    std::vector<double> Y(A.num_rows() * nv, 7.0);
+    RAJA::sparse::spmm<ExecPol>(S, X.data(), nv, Y.data());
+    for (RAJA::Index_type i = 0; i < A.num_rows(); ++i) {
+      ASSERT_NEAR(Y[i * nv], expected[i], 1e-12);
+      ASSERT_NEAR(Y[i * nv + 1], -expected[i], 1e-12);
+    }
+  }
+}
+
+TEST(SparseMatrixUnitTest, SellSpmmIndexOverflow)
+{
+  // float registers index with 32 bit integers
+  RAJA::sparse::CSRMatrix<float> A = RAJA::sparse::CSRMatrix<float>::from_coo(
+      1000, 10, {0, 999}, {0, 9}, {1.0f, 2.0f});
+  RAJA::sparse::SellMatrix<float> S(A, 1);
+
+  const RAJA::Index_type nv = 3000000;
+  ASSERT_THROW(RAJA::sparse::spmm<RAJA::seq_exec>(S,
+                                                   static_cast<float*>(nullptr),
+                                                   nv,
+                                                   static_cast<float*>(nullptr)),
+               std::runtime_error);
+}
+
+TEST(SparseMatrixUnitTest, SellToCSR)
+{
+  csr_t A = make_random_matrix(99, 40);
+  RAJA::sparse::SellMatrix<double> S(A, 32);
+
+  // sorting within windows reduces padding
+  RAJA::sparse::SellMatrix<double> unsorted(A, 1);
+  EXPECT_LE(S.num_stored(), unsorted.num_stored());
+
+  csr_t B = S.to_csr();
+  ASSERT_EQ(B.num_rows(), A.num_rows());
+  ASSERT_EQ(B.num_nonzeros(), A.num_nonzeros());
+  for (RAJA::Index_type i = 0; i <= A.num_rows(); ++i) {
+    ASSERT_EQ(B.row_offsets()[i], A.row_offsets()[i]);
+  }
+  for (RAJA::Index_type k = 0; k < A.num_nonzeros(); ++k) {
+    ASSERT_EQ(B.col_indices()[k], A.col_indices()[k]);
+    ASSERT_EQ(B.values()[k], A.values()[k]);
+  }
+}
+
+#endif
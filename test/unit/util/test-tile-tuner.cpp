@@ -0,0 +1,134 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for TileTuner
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdio>
+#include <set>
+#include <string>
+#include <vector>
+
+using Sizes = RAJA::TileTuner::Sizes;
+
+//
+// Tuning file removed when the test ends
+//
+struct TuningFile {
+  std::string path;
+  explicit TuningFile(const char* name) : path(name) { std::remove(name); }
+  ~TuningFile() { std::remove(path.c_str()); }
+};
+
+TEST(TileTunerUnitTest, SearchAndPick)
+{
+  RAJA::TileTuner tuner({32, 8, 16, 8}, 2);
+
+  // the 2nd dimension only needs candidates up to one covering its extent
+  std::set<Sizes> seen;
+  int runs = 0;
+  while (!tuner.isTuned("k", {100, 10})) {
+    const Sizes sizes = tuner.next("k", {100, 10}, 2);
+    ASSERT_EQ(size_t(2), sizes.size());
+    seen.insert(sizes);
+    ++runs;
+    // 16x8 is the fastest configuration
+    const bool fast = sizes[0] == 16 && sizes[1] == 8;
+    tuner.record("k", {100, 10}, sizes, fast ? 1.0 : 2.0);
+  }
+  ASSERT_EQ(size_t(3 * 2), seen.size());
+  ASSERT_EQ(3 * 2 * 2, runs);
+  ASSERT_EQ((Sizes{16, 8}), tuner.getTuned("k", {100, 10}));
+  ASSERT_EQ((Sizes{16, 8}), tuner.next("k", {100, 10}, 2));
+
+  // other shapes are tuned separately
+  ASSERT_FALSE(tuner.isTuned("k", {100, 20}));
+  ASSERT_TRUE(tuner.getTuned("k", {100, 20}).empty());
+}
+
+TEST(TileTunerUnitTest, Run)
+{
+  RAJA::TileTuner tuner({4, 8}, 1);
+  int runs = 0;
+  for (int r = 0; r < 5; ++r) {
+    tuner.run("run", {64}, 1, [&](Sizes const& sizes) {
+      ASSERT_EQ(size_t(1), sizes.size());
+      ++runs;
+    });
+  }
+  ASSERT_EQ(5, runs);
+  ASSERT_TRUE(tuner.isTuned("run", {64}));
+}
+
+TEST(TileTunerUnitTest, SaveAndLoad)
+{
+  TuningFile file("test-tile-tuner.txt");
+  {
+    RAJA::TileTuner tuner(file.path);
+    tuner.setTuned("a", {10, 20}, {8, 16});
+    tuner.setTuned("b", {}, {32});
+  }
+  {
+    RAJA::TileTuner tuner(file.path);
+    ASSERT_TRUE(tuner.isTuned("a", {10, 20}));
+    ASSERT_EQ((Sizes{8, 16}), tuner.next("a", {10, 20}, 2));
+    ASSERT_EQ((Sizes{32}), tuner.getTuned("b", {}));
+    ASSERT_FALSE(tuner.isTuned("a", {10, 21}));
+  }
+
+  RAJA::TileTuner other;
+  ASSERT_TRUE(other.load(file.path));
+  ASSERT_TRUE(other.isTuned("a", {10, 20}));
+  ASSERT_FALSE(other.load("no-such-tile-tuner-file.txt"));
+}
+
+TEST(TileTunerUnitTest, KernelParamTuned)
+{
+  using Pol = RAJA::KernelPolicy<RAJA::statement::Tile<
+      1,
+      RAJA::tile_dynamic<1>,
+      RAJA::seq_exec,
+      RAJA::statement::Tile<
+          0,
+          RAJA::tile_dynamic<0>,
+          RAJA::seq_exec,
+          RAJA::statement::For<
+              1,
+              RAJA::seq_exec,
+              RAJA::statement::For<0, RAJA::seq_exec,
+                                   RAJA::statement::Lambda<0>>>>>>;
+
+  constexpr int N = 40;
+  constexpr int M = 24;
+  RAJA::TileTuner tuner({8, 16}, 1);
+
+  for (int r = 0; r < 6; ++r) {
+    std::vector<int> count(N * M, 0);
+    std::set<Sizes> sizes_seen;
+    RAJA::kernel_param_tuned<Pol>(
+        tuner,
+        "kernel",
+        RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, M)),
+        RAJA::make_tuple(RAJA::TileSize{1}, RAJA::TileSize{1}),
+        [&](int i, int j, RAJA::TileSize ti, RAJA::TileSize tj) {
+          ++count[i * M + j];
+          sizes_seen.insert(Sizes{ti.size, tj.size});
+        });
+
+    for (int c : count) {
+      ASSERT_EQ(1, c);
+    }
+    ASSERT_EQ(size_t(1), sizes_seen.size());
+    ASSERT_NE(1, sizes_seen.begin()->at(0));
+  }
+
+  ASSERT_TRUE(tuner.isTuned("kernel", {N, M}));
+  ASSERT_EQ(size_t(2), tuner.getTuned("kernel", {N, M}).size());
+}
@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for expt::Graph record and replay
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+using GraphExecPolicies = ::testing::Types<
+    camp::list<RAJA::seq_work, RAJA::seq_exec>,
+    camp::list<RAJA::loop_work, RAJA::loop_exec>
+#if defined(RAJA_ENABLE_OPENMP)
+   ,camp::list<RAJA::omp_work, RAJA::omp_parallel_for_exec>
+#endif
+#if defined(RAJA_ENABLE_TBB)
+   ,camp::list<RAJA::tbb_work, RAJA::tbb_for_exec>
+#endif
+  >;
+
+template<typename T>
+class GraphUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(GraphUnitTest, GraphExecPolicies);
+
+
+TYPED_TEST(GraphUnitTest, Schedule)
+{
+  using graph_policy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using exec_policy = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  constexpr int N = 1000;
+  std::vector<int> a(N, 0), b(N, 0), c(N, 0);
+  int* a_ptr = a.data();
+  int* b_ptr = b.data();
+  int* c_ptr = c.data();
+
+  RAJA::expt::Graph<graph_policy> graph;
+
+  auto s0 = graph.default_stream();
+  auto s1 = graph.stream();
+
+  graph.template forall<exec_policy>(s0, RAJA::TypedRangeSegment<int>(0, N),
+      [=](int i) { a_ptr[i] += 1; });
+  graph.template forall<exec_policy>(s1, RAJA::TypedRangeSegment<int>(0, N),
+      [=](int i) { b_ptr[i] += 2; });
+  graph.wait_for(s0, s1);
+  graph.template forall<exec_policy>(s0, RAJA::TypedRangeSegment<int>(0, N),
+      [=](int i) { c_ptr[i] = a_ptr[i] + b_ptr[i]; });
+
+  ASSERT_EQ(graph.num_nodes(), 3u);
+  ASSERT_FALSE(graph.is_instantiated());
+
+  graph.instantiate();
+
+  ASSERT_TRUE(graph.is_instantiated());
+  ASSERT_EQ(graph.num_levels(), 2u);
+
+  // recording does not run anything
+  ASSERT_EQ(c[N-1], 0);
+
+  for (int step = 1; step <= 3; ++step) {
+    graph.replay();
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(a[i], step);
+      ASSERT_EQ(b[i], 2*step);
+      ASSERT_EQ(c[i], 3*step);
+    }
+  }
+}
+
+TYPED_TEST(GraphUnitTest, KernelAndLaunch)
+{
+  using graph_policy = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  constexpr int N = 16;
+  std::vector<int> a(N*N, 0), b(N, 0);
+  int* a_ptr = a.data();
+  int* b_ptr = b.data();
+
+  using kernel_policy = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::seq_exec,
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+  using launch_policy = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+  using loop_policy = RAJA::LoopPolicy<RAJA::loop_exec>;
+
+  RAJA::expt::Graph<graph_policy> graph;
+
+  graph.template kernel<kernel_policy>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, N),
+                       RAJA::TypedRangeSegment<int>(0, N)),
+      [=](int i, int j) { a_ptr[i + N*j] += 1; });
+
+  graph.template launch<launch_policy>(
+      RAJA::LaunchParams(RAJA::Teams(1), RAJA::Threads(N)),
+      [=](RAJA::LaunchContext ctx) {
+        RAJA::loop<loop_policy>(ctx, RAJA::TypedRangeSegment<int>(0, N), [&](int i) {
+          b_ptr[i] = a_ptr[i + N*i];
+        });
+      });
+
+  ASSERT_EQ(graph.num_nodes(), 2u);
+
+  graph.replay();
+  graph.replay();
+
+  ASSERT_EQ(graph.num_levels(), 2u);
+
+  for (int i = 0; i < N*N; ++i) {
+    ASSERT_EQ(a[i], 2);
+  }
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(b[i], 2);
+  }
+
+  graph.clear();
+  ASSERT_EQ(graph.num_nodes(), 0u);
+}